@@ -330,6 +330,9 @@ function initHomeTelemetry() {
   }
 
   let pollTimer = null;
+  // Dashboard bindings come from the cached config body; the poll only carries values and its tag.
+  let statusConfig = {};
+  let statusConfigEtag = "";
 
   const buttonByMode = {};
   buttons.forEach((button) => {
@@ -519,16 +522,15 @@ function initHomeTelemetry() {
   };
 
   const renderHomeDashboard = (status) => {
-    const dashboardSignals = Array.isArray(status?.dashboardSignals) ? status.dashboardSignals : [];
-    const apiDashMappings =
-      status?.dashMappings && typeof status.dashMappings === "object" ? status.dashMappings : {};
+    const dashboardSlots = Array.isArray(statusConfig?.dashboardSlots) ? statusConfig.dashboardSlots : [];
+    const dashboardValues = Array.isArray(status?.dashboardValues) ? status.dashboardValues : [];
     const localProfile = readLocalSetupProfile();
     const localDashMappings =
       localProfile?.dashMappings && typeof localProfile.dashMappings === "object"
         ? localProfile.dashMappings
         : {};
     const dashboardBySlot = new Map(
-      dashboardSignals.map((item) => [
+      dashboardSlots.map((item) => [
         String(item?.slot || ""),
         item && typeof item === "object" ? item : {},
       ])
@@ -539,16 +541,15 @@ function initHomeTelemetry() {
         return;
       }
 
-      const slot = dashboardBySlot.get(`dash_${index + 1}`);
       const slotKey = `dash_${index + 1}`;
-      const mappedSignalId = String(
-        slot?.signalId || apiDashMappings[slotKey] || localDashMappings[slotKey] || ""
-      );
+      const slot = dashboardBySlot.get(slotKey);
+      const value = dashboardValues[index];
+      const mappedSignalId = String(slot?.signalId || localDashMappings[slotKey] || "");
       if (slot?.mapped || mappedSignalId) {
         card.labelNode.textContent = slot?.label
           ? prettifyDashboardLabel(slot.label, `Dashboard ${index + 1}`)
           : dashboardLabelFromSignalId(mappedSignalId, `Dashboard ${index + 1}`);
-        card.valueNode.textContent = String(slot?.display || "--");
+        card.valueNode.textContent = String(value?.display || "--");
         return;
       }
 
@@ -598,7 +599,12 @@ function initHomeTelemetry() {
 
   const syncFromStatus = async () => {
     try {
-      const status = await apiJson("/api/status");
+      const status = await apiJson("/api/status?fields=core,can,telemetry,dashboardValues,configEtag");
+      if (status?.configEtag && status.configEtag !== statusConfigEtag) {
+        // The browser revalidates with If-None-Match, so an unchanged body costs a 304.
+        statusConfig = await apiJson("/api/status?fields=config");
+        statusConfigEtag = status.configEtag;
+      }
       const target = modeToButton(status);
       if (target && target !== document.querySelector(".btn-circle.active")) {
         setMode(target);
@@ -706,6 +712,7 @@ function initSetupPage() {
   const modeTriggerSignalValue = document.getElementById("mode-trigger-signal-value");
   const modeTriggerAssignButton = document.getElementById("mode-trigger-assign");
   const modeTriggerStatus = document.getElementById("mode-trigger-status");
+  const modeTriggerRulesList = document.getElementById("mode-trigger-rules");
   const lowPowerSleepEnabled = document.getElementById("low-power-sleep-enabled");
   const lowPowerStatus = document.getElementById("low-power-status");
 
@@ -756,6 +763,9 @@ function initSetupPage() {
   let mappings = { ...defaultMappings };
   let dashMappings = { ...defaultDashMappings };
   let modeTrigger = { ...defaultModeTrigger };
+  // Extra trigger rules are set through the API only; the card lists them read-only.
+  let modeTriggerRules = [];
+  let modeTriggerActiveRule = -1;
   let lowPower = { ...defaultLowPower };
   let currentHaldexGen = "";
   let pollTimer = null;
@@ -1369,6 +1379,45 @@ function initSetupPage() {
     }
   }
 
+  function applyModeTriggerRules(source) {
+    if (Array.isArray(source?.modeTriggerRules)) {
+      modeTriggerRules = source.modeTriggerRules;
+    }
+    const activeRule = Number(source?.modeTrigger?.activeRule);
+    modeTriggerActiveRule = Number.isInteger(activeRule) ? activeRule : -1;
+  }
+
+  function renderModeTriggerRules() {
+    if (!modeTriggerRulesList) {
+      return;
+    }
+    const operators = { gt: ">", gte: ">=", lt: "<", lte: "<=", eq: "=", neq: "!=", change: "changes" };
+    modeTriggerRulesList.hidden = modeTriggerRules.length === 0;
+    modeTriggerRulesList.innerHTML = modeTriggerRules
+      .map((rule, index) => {
+        const joiner = rule?.combine === "any" ? " or " : " and ";
+        const terms = (Array.isArray(rule?.terms) ? rule.terms : [])
+          .map((term) => {
+            const op = operators[normalizeModeTriggerOperator(term?.operator)];
+            const value = term?.operator === "change" ? "" : ` ${Number(term?.value)}`;
+            return `${signalSummaryFromKey(term?.signal).name} ${op}${value}`;
+          })
+          .join(joiner);
+        const active = index === modeTriggerActiveRule;
+        const state = rule?.enabled === false ? "off" : active ? "active" : "--";
+        return `
+          <li class="setup-map-row mode-trigger-signal${active ? " is-active" : ""}">
+            <div class="setup-map-main">
+              <span class="setup-map-key">Rule ${index + 1}: ${escapeHtml(normalizeModeName(rule?.mode))}</span>
+              <span class="setup-map-value">${escapeHtml(terms || "No conditions")}</span>
+            </div>
+            <span class="setup-live-value">${state}</span>
+          </li>
+        `;
+      })
+      .join("");
+  }
+
   function renderLowPower() {
     if (!lowPowerSleepEnabled) {
       return;
@@ -1397,6 +1446,7 @@ function initSetupPage() {
     renderMappedInputs();
     renderDashSignals();
     renderModeTrigger();
+    renderModeTriggerRules();
     renderLowPower();
     if (saveProfileButton) {
       saveProfileButton.disabled = false;
@@ -1483,6 +1533,7 @@ function initSetupPage() {
         modeTrigger = normalizeModeTrigger(resp.modeTrigger);
         writeProfile();
       }
+      applyModeTriggerRules(resp);
       if (resp?.lowPower && typeof resp.lowPower === "object") {
         lowPower = normalizeLowPower(resp.lowPower);
         writeProfile();
@@ -1723,6 +1774,7 @@ function initSetupPage() {
       if (status?.modeTrigger && typeof status.modeTrigger === "object") {
         modeTrigger = normalizeModeTrigger(status.modeTrigger);
       }
+      applyModeTriggerRules(status);
       if (status?.power && typeof status.power === "object") {
         lowPower = normalizeLowPower({
           sleepEnabled: status.power.lowPowerSleepEnabled,
@@ -3058,6 +3110,16 @@ function initLogsPage() {
   }
 
   function downloadView() {
+    if (activePath) {
+      // Stream the full file from the device instead of the tail shown in the view.
+      const link = document.createElement("a");
+      link.href = `/api/logs/read?path=${encodeURIComponent(activePath)}&from=0&download=1`;
+      link.download = sanitizeFilename(activePath.split("/").pop() || "openhaldex-log.txt");
+      document.body.appendChild(link);
+      link.click();
+      link.remove();
+      return;
+    }
     const body = output.textContent || "";
     const blob = new Blob([body], { type: "text/plain;charset=utf-8" });
     const url = URL.createObjectURL(blob);
@@ -3500,7 +3562,7 @@ function initMapPage() {
   function mapNameFromPath(path) {
     const value = String(path || "");
     const base = value.split("/").pop() || value;
-    return base.replace(/\.(txt|json)$/i, "");
+    return base.replace(/\.(txt|json|ohmap)$/i, "");
   }
 
   function mapLabel(entry) {
@@ -3921,7 +3983,7 @@ function initMapPage() {
 
   async function refreshTrace() {
     try {
-      const data = await fetchJson("/api/status");
+      const data = await fetchJson("/api/status?fields=telemetry");
       const telem = data.telemetry || {};
       const speed = Number(telem.speed || 0);
       const throttle = Number(telem.throttle || 0);
@@ -4710,6 +4772,20 @@ function initDiagPage() {
     return dids;
   }
 
+  // "DID:len" per DID, len being the furthest byte any catalog signal reads, so the device can pack the
+  // DIDs into one request and split the combined response.
+  function manifestDidRequests(manifest) {
+    const lengths = new Map();
+    (manifest?.records || []).forEach((record) => {
+      const did = normalizeDidHex(record.didHex);
+      const end = Number(record.offset ?? 0) + Number(record.length ?? 0);
+      if (did && Number.isInteger(end) && end > 0) {
+        lengths.set(did, Math.max(lengths.get(did) || 0, end));
+      }
+    });
+    return manifestDids(manifest).map((did) => (lengths.has(did) ? `${did}:${lengths.get(did)}` : did));
+  }
+
   function readSignalRaw(bytes, record) {
     const offset = Number(record?.offset ?? 0);
     const length = Number(record?.length ?? 0);
@@ -4800,7 +4876,8 @@ function initDiagPage() {
         lines.push(`${label}: ${detail || "failed"}`);
         return;
       }
-      lines.push(`${label}: ${formatDecodedSignal(record, hexBytes(item.rawDataHex))}`);
+      const stale = item.stale ? ` (stale, ${Math.round((item.ageMs || 0) / 1000)} s)` : "";
+      lines.push(`${label}: ${formatDecodedSignal(record, hexBytes(item.rawDataHex))}${stale}`);
     });
 
     return lines.join("\n");
@@ -4834,17 +4911,40 @@ function initDiagPage() {
     return lines.join("\n");
   }
 
+  let measuredPollTimer = null;
+
+  // Only stops this page's reads. The device poller is shared by every open tab and turns itself off once
+  // nobody has read it for a few intervals.
+  function stopMeasuredPoll() {
+    if (measuredPollTimer) {
+      window.clearInterval(measuredPollTimer);
+      measuredPollTimer = null;
+    }
+  }
+
+  // The device polls the DIDs in the background; this page (and any other tab) only reads the cache.
   async function runGen5MeasuredValues() {
+    stopMeasuredPoll();
     setUdsBusy(true);
     writeUdsOutput("Loading manifest...");
     try {
       const manifest = await loadGen5MwbManifest();
-      const dids = manifestDids(manifest);
+      const dids = manifestDidRequests(manifest);
       if (!dids.length) throw new Error("No Gen 5 measured-value DIDs in manifest");
 
-      writeUdsOutput("Running...");
-      const data = await fetchJson(`/api/diag/measured?dids=${encodeURIComponent(dids.join(","))}`, { method: "POST" });
-      writeUdsOutput(renderMeasuredResult(data, manifest));
+      writeUdsOutput("Starting measured-value poller...");
+      await fetchJson("/api/diag/poll", {
+        method: "POST",
+        headers: { "Content-Type": "application/json" },
+        body: JSON.stringify({ enabled: true, intervalMs: 1000, dids: dids.join(",") }),
+      });
+      const refresh = async () => {
+        try {
+          writeUdsOutput(renderMeasuredResult(await fetchJson("/api/diag/poll"), manifest));
+        } catch (_) {}
+      };
+      measuredPollTimer = window.setInterval(refresh, 1000);
+      await refresh();
       try {
         const status = await fetchJson("/api/uds/status");
         renderUdsStatus(status);
@@ -4872,11 +4972,24 @@ function initDiagPage() {
     return lines.join("\n");
   }
 
+  // Diagnostic requests are queued on the device; poll the job until the result is in.
+  async function runDiagJob(path) {
+    const job = await fetchJson(path, { method: "POST" });
+    if (!job || !job.jobId) return job;
+    for (;;) {
+      await new Promise((resolve) => window.setTimeout(resolve, 250));
+      const state = await fetchJson(`/api/diag/job?id=${job.jobId}`);
+      if (state.state === "done") return state.result;
+      writeUdsOutput(state.state === "running" ? "Running..." : `Queued (${state.queuedAhead || 0} ahead)...`);
+    }
+  }
+
   async function runUdsAction(path, renderer) {
+    stopMeasuredPoll();
     setUdsBusy(true);
     writeUdsOutput("Running...");
     try {
-      const data = await fetchJson(path, { method: "POST" });
+      const data = await runDiagJob(path);
       writeUdsOutput(renderer(data));
       try {
         const status = await fetchJson("/api/uds/status");
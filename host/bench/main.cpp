@@ -0,0 +1,110 @@
+// Entry point of the env:bench build: the microbenchmark suite (functions/bench/bench.h) on the host,
+// against a fixed scenario so check values are comparable between runs and commits: Gen5, map mode
+// at 60 km/h and 35 % pedal, and CAN View holding one frame of every MQB chassis ID. The device runs
+// the same cases through GET /api/bench; both print the same lines.
+//
+//   pio run -e bench && .pio/build/bench/program --repeat 5
+//   g++ -O2 -std=gnu++17 -DARDUINO=10800 -DOH_HOST=1 -Ihost/include -Iinclude
+//       -I.pio/libdeps/native/ArduinoJson/src host/bench/main.cpp host/src/*.cpp src/functions/core/*.cpp
+//       src/functions/can/*.cpp src/functions/canview/*.cpp src/functions/diag/*.cpp src/functions/bench/*.cpp
+//       -o oh_bench
+//
+// The host cycle counter is nanoseconds and wraps after about four seconds, so keep --scale small
+// enough that one case stays under that.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "functions/bench/bench.h"
+#include "functions/canview/canview.h"
+#include "functions/canview/dbc_table.h"
+#include "functions/core/state.h"
+#include "host/clock.h"
+
+struct bench_options_t {
+  const char* filter = nullptr;
+  uint32_t scale = 1;
+  uint8_t repeat = 3;
+};
+
+static void setupScenario() {
+  hostClockReset();
+  // Start away from millis() == 0, which the firmware reads as "never".
+  hostClockAdvanceTo(1000000ULL);
+
+  haldexGeneration = 5;
+  mappedInputSignalsInit();
+  modeTriggerInit();
+  dashboardSignalsInit();
+  lockTablesInit();
+  (void)lockTablesPublish(50);
+  dbcTablesInit();
+
+  state.mode = MODE_MAP;
+  received_vehicle_speed = 60;
+  received_pedal_value = 35.0f;
+  lock_target = 45.0f;
+
+  const dbc_table_t* table = dbcActiveChassisTable();
+  if (!table) {
+    return;
+  }
+  twai_message_t msg = {};
+  msg.data_length_code = 8;
+  for (uint16_t f = 0; f < table->frame_count; f++) {
+    msg.identifier = table->frames[f].id;
+    msg.extd = msg.identifier > 0x7FF;
+    for (uint8_t i = 0; i < 8; i++) {
+      msg.data[i] = (uint8_t)(msg.identifier * 31U + i * 17U);
+    }
+    canviewCacheFrame(msg, 0);
+    hostClockAdvanceTo(hostClockUs() + 100);
+  }
+}
+
+static void printResult(const bench_result_t& result, void* ctx) {
+  (void)ctx;
+  printf("%s\n", benchResultLine(result).c_str());
+  fflush(stdout);
+}
+
+static void usage() {
+  fprintf(stderr, "usage: oh_bench [--filter NAME] [--scale N] [--repeat N]\n");
+}
+
+static bool parseArgs(int argc, char** argv, bench_options_t& options) {
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const bool has_value = (i + 1) < argc;
+    if (strcmp(arg, "--filter") == 0 && has_value) {
+      options.filter = argv[++i];
+    } else if (strcmp(arg, "--scale") == 0 && has_value) {
+      options.scale = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(arg, "--repeat") == 0 && has_value) {
+      options.repeat = (uint8_t)strtoul(argv[++i], nullptr, 10);
+    } else {
+      return false;
+    }
+  }
+  return options.scale > 0 && options.repeat > 0;
+}
+
+int main(int argc, char** argv) {
+  bench_options_t options;
+  if (!parseArgs(argc, argv, options)) {
+    usage();
+    return 2;
+  }
+
+  const uint32_t cases = benchSelectCases(options.filter);
+  if (cases == 0) {
+    fprintf(stderr, "no case matches %s\n", options.filter);
+    return 2;
+  }
+
+  setupScenario();
+  printf("%s\n", benchEnvLine().c_str());
+  benchRunSuite(cases, options.scale, options.repeat, printResult, nullptr);
+  return 0;
+}
@@ -0,0 +1,311 @@
+#pragma once
+
+// Host stand-in for the Arduino-ESP32 core: enough of String, Serial and the timing calls for the
+// diag/CAN modules to build and run on a PC. Time comes from the virtual clock in host/clock.h.
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HEX 16
+#define DEC 10
+#define PROGMEM
+#define IRAM_ATTR
+
+using std::max;
+using std::min;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+template <class T, class L, class H> T constrain(T value, L low, H high) {
+  return value < low ? (T)low : (value > high ? (T)high : value);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+class String {
+public:
+  String() {}
+  String(const char* text) : s_(text ? text : "") {}
+  String(const std::string& text) : s_(text) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int value, unsigned char base = DEC) : s_(formatInteger((long long)value, base)) {}
+  String(unsigned int value, unsigned char base = DEC) : s_(formatUnsigned(value, base)) {}
+  String(long value, unsigned char base = DEC) : s_(formatInteger(value, base)) {}
+  String(unsigned long value, unsigned char base = DEC) : s_(formatUnsigned(value, base)) {}
+  String(long long value, unsigned char base = DEC) : s_(formatInteger(value, base)) {}
+  String(unsigned long long value, unsigned char base = DEC) : s_(formatUnsigned(value, base)) {}
+  String(float value, unsigned int decimals = 2) : s_(formatFloat(value, decimals)) {}
+  String(double value, unsigned int decimals = 2) : s_(formatFloat(value, decimals)) {}
+
+  unsigned int length() const {
+    return (unsigned int)s_.size();
+  }
+  bool isEmpty() const {
+    return s_.empty();
+  }
+  const char* c_str() const {
+    return s_.c_str();
+  }
+  bool reserve(unsigned int size) {
+    s_.reserve(size);
+    return true;
+  }
+
+  bool concat(const char* text, unsigned int len) {
+    s_.append(text, len);
+    return true;
+  }
+  bool concat(const String& other) {
+    s_ += other.s_;
+    return true;
+  }
+  bool concat(const char* text) {
+    s_ += text ? text : "";
+    return true;
+  }
+  bool concat(char c) {
+    s_ += c;
+    return true;
+  }
+
+  String& operator+=(const String& other) {
+    s_ += other.s_;
+    return *this;
+  }
+  String& operator+=(const char* text) {
+    s_ += text ? text : "";
+    return *this;
+  }
+  String& operator+=(char c) {
+    s_ += c;
+    return *this;
+  }
+  template <class T> String& operator+=(T value) {
+    s_ += String(value).s_;
+    return *this;
+  }
+
+  friend String operator+(const String& a, const String& b) {
+    return String(a.s_ + b.s_);
+  }
+  friend String operator+(const String& a, const char* b) {
+    return String(a.s_ + (b ? b : ""));
+  }
+  friend String operator+(const char* a, const String& b) {
+    return String((a ? a : "") + b.s_);
+  }
+  friend String operator+(const String& a, char b) {
+    return String(a.s_ + b);
+  }
+
+  bool operator==(const String& other) const {
+    return s_ == other.s_;
+  }
+  bool operator==(const char* other) const {
+    return s_ == (other ? other : "");
+  }
+  bool operator!=(const String& other) const {
+    return s_ != other.s_;
+  }
+  bool operator!=(const char* other) const {
+    return !(*this == other);
+  }
+  bool operator<(const String& other) const {
+    return s_ < other.s_;
+  }
+
+  char operator[](unsigned int index) const {
+    return index < s_.size() ? s_[index] : 0;
+  }
+  char& operator[](unsigned int index) {
+    return s_[index];
+  }
+  char charAt(unsigned int index) const {
+    return (*this)[index];
+  }
+  void setCharAt(unsigned int index, char c) {
+    if (index < s_.size()) {
+      s_[index] = c;
+    }
+  }
+
+  bool equals(const String& other) const {
+    return s_ == other.s_;
+  }
+  bool equalsIgnoreCase(const String& other) const;
+  bool startsWith(const String& prefix) const {
+    return s_.compare(0, prefix.s_.size(), prefix.s_) == 0;
+  }
+  bool endsWith(const String& suffix) const {
+    return s_.size() >= suffix.s_.size() && s_.compare(s_.size() - suffix.s_.size(), suffix.s_.size(), suffix.s_) == 0;
+  }
+  int indexOf(char c, unsigned int from = 0) const {
+    return position(s_.find(c, from));
+  }
+  int indexOf(const String& text, unsigned int from = 0) const {
+    return position(s_.find(text.s_, from));
+  }
+  int lastIndexOf(char c) const {
+    return position(s_.rfind(c));
+  }
+  int lastIndexOf(const String& text) const {
+    return position(s_.rfind(text.s_));
+  }
+  String substring(unsigned int from) const {
+    return from < s_.size() ? String(s_.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void replace(const String& find, const String& with);
+  void replace(char find, char with) {
+    std::replace(s_.begin(), s_.end(), find, with);
+  }
+  void remove(unsigned int index) {
+    if (index < s_.size()) {
+      s_.erase(index);
+    }
+  }
+  void remove(unsigned int index, unsigned int count) {
+    if (index < s_.size()) {
+      s_.erase(index, count);
+    }
+  }
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+
+  long toInt() const {
+    return strtol(s_.c_str(), nullptr, 10);
+  }
+  float toFloat() const {
+    return strtof(s_.c_str(), nullptr);
+  }
+  double toDouble() const {
+    return strtod(s_.c_str(), nullptr);
+  }
+  void toCharArray(char* buf, unsigned int size) const {
+    getBytes((unsigned char*)buf, size);
+  }
+  void getBytes(unsigned char* buf, unsigned int size) const;
+
+private:
+  static int position(size_t pos) {
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+  static std::string formatUnsigned(unsigned long long value, unsigned char base);
+  static std::string formatInteger(long long value, unsigned char base);
+  static std::string formatFloat(double value, unsigned int decimals);
+
+  std::string s_;
+};
+
+// Arduino's operator+ returns this type; ArduinoJson's String adapter names it.
+class StringSumHelper : public String {
+public:
+  using String::String;
+  StringSumHelper(const String& s) : String(s) {}
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (n < size && write(buffer[n])) {
+      n++;
+    }
+    return n;
+  }
+  size_t print(const char* text) {
+    return write((const uint8_t*)text, strlen(text));
+  }
+  size_t print(const String& text) {
+    return write((const uint8_t*)text.c_str(), text.length());
+  }
+  size_t println(const char* text = "") {
+    return print(text) + print("\n");
+  }
+  size_t println(const String& text) {
+    return print(text) + print("\n");
+  }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class Stream : public Print {
+public:
+  virtual int available() {
+    return 0;
+  }
+  virtual int read() {
+    return -1;
+  }
+  virtual int peek() {
+    return -1;
+  }
+  size_t readBytes(char* buffer, size_t length);
+  size_t readBytes(uint8_t* buffer, size_t length) {
+    return readBytes((char*)buffer, length);
+  }
+};
+
+// Serial writes to stdout.
+class HardwareSerial : public Stream {
+public:
+  void begin(unsigned long baud) {
+    (void)baud;
+  }
+  size_t write(uint8_t c) override {
+    return fputc(c, stdout) == EOF ? 0 : 1;
+  }
+  size_t write(const uint8_t* buffer, size_t size) override {
+    return fwrite(buffer, 1, size, stdout);
+  }
+  operator bool() const {
+    return true;
+  }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+  // Host stand-in for the CPU cycle counter: nanoseconds of the steady clock.
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz() {
+    return 1000;
+  }
+  uint32_t getFreeHeap() {
+    return 0;
+  }
+  uint32_t getMinFreeHeap() {
+    return 0;
+  }
+  uint32_t getMaxAllocHeap() {
+    return 0;
+  }
+  void restart() {
+    exit(0);
+  }
+};
+
+extern EspClass ESP;
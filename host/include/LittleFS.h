@@ -0,0 +1,43 @@
+#pragma once
+
+// Host stand-in for the LittleFS filesystem: read-only files under the directory named by
+// OH_HOST_FS (default ./data, the image the firmware's filesystem is built from).
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+class File {
+public:
+  File() {}
+  explicit File(FILE* fp) : fp_(fp) {}
+
+  explicit operator bool() const {
+    return fp_ != nullptr;
+  }
+  size_t read(uint8_t* buffer, size_t size) {
+    return fp_ ? fread(buffer, 1, size, fp_) : 0;
+  }
+  int read() {
+    return fp_ ? fgetc(fp_) : -1;
+  }
+  size_t size() const;
+  int available() const;
+  void close() {
+    if (fp_) {
+      fclose(fp_);
+      fp_ = nullptr;
+    }
+  }
+
+private:
+  FILE* fp_ = nullptr;
+};
+
+class LittleFSClass {
+public:
+  File open(const char* path, const char* mode = "r");
+  bool exists(const char* path);
+};
+
+extern LittleFSClass LittleFS;
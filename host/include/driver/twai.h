@@ -0,0 +1,45 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF TWAI driver types. Only the message layout and the configuration
+// types and alert bits named in shared code; host builds never touch the controller.
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+
+#define TWAI_FRAME_MAX_DLC 8
+
+#define TWAI_ALERT_RX_DATA 0x00000004
+#define TWAI_ALERT_BUS_ERROR 0x00000200
+#define TWAI_ALERT_RX_QUEUE_FULL 0x00000800
+#define TWAI_ALERT_ERR_PASS 0x00001000
+
+typedef struct {
+  union {
+    struct {
+      uint32_t extd : 1;
+      uint32_t rtr : 1;
+      uint32_t ss : 1;
+      uint32_t self : 1;
+      uint32_t dlc_non_comp : 1;
+      uint32_t reserved : 27;
+    };
+    uint32_t flags;
+  };
+  uint32_t identifier;
+  uint8_t data_length_code;
+  uint8_t data[TWAI_FRAME_MAX_DLC];
+} twai_message_t;
+
+typedef enum {
+  TWAI_MODE_NORMAL,
+  TWAI_MODE_NO_ACK,
+  TWAI_MODE_LISTEN_ONLY,
+} twai_mode_t;
+
+typedef enum {
+  TWAI_STATE_STOPPED,
+  TWAI_STATE_RUNNING,
+  TWAI_STATE_BUS_OFF,
+  TWAI_STATE_RECOVERING,
+} twai_state_t;
@@ -0,0 +1,20 @@
+#pragma once
+
+// Host stand-in for the ESP-IDF capability allocator: one heap, capabilities ignored.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+inline void heap_caps_free(void* ptr) {
+  free(ptr);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <driver/twai.h>
+
+// Host CAN backend (can_hal_host in functions/can/can_hal.h). Each logical bus is either an
+// in-memory loopback, where the harness injects the frames the firmware receives and takes the
+// frames it sent, or a Linux SocketCAN interface such as vcan0.
+
+#define CAN_HOST_RX_QUEUE_LEN 2048 // same depths as the TWAI driver configuration
+#define CAN_HOST_TX_QUEUE_LEN 1024
+
+struct can_host_stats_t {
+  uint32_t tx;
+  uint32_t rx;
+  uint32_t txDropped; // loopback TX queue full or SocketCAN write failed
+  uint32_t rxDropped; // injected while the loopback RX queue was full
+  uint32_t rxHighWater;
+};
+
+// spec is "loopback" or a SocketCAN interface name; applies from the next begin of that bus.
+bool canHostConfigure(uint8_t bus, const char* spec);
+// OH_HOST_CAN0 / OH_HOST_CAN1 from the environment; unset keeps loopback.
+void canHostConfigureFromEnv();
+const char* canHostSpec(uint8_t bus);
+
+// Loopback only: queue a frame for the firmware to receive / take the oldest frame it sent.
+bool canHostInject(uint8_t bus, const twai_message_t& frame);
+bool canHostTake(uint8_t bus, twai_message_t& frame);
+uint32_t canHostRxPending(uint8_t bus);
+
+void canHostGetStats(uint8_t bus, can_host_stats_t& out);
+void canHostResetStats(uint8_t bus);
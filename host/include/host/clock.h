@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+// Virtual time for host builds, in microseconds from the start of the run. millis(), micros() and
+// the FreeRTOS tick read it; a call that would block asks the wait hook to run simulated peers up to
+// its deadline. Nothing sleeps, so a run is deterministic and takes only the CPU time it needs.
+
+// Runs simulated activity up to deadline_us. Returns true after delivering something (the clock
+// then stands at that event, and the caller re-checks its condition), false once the clock has
+// reached deadline_us with nothing to deliver.
+typedef bool (*host_clock_wait_fn_t)(uint64_t deadline_us);
+
+uint64_t hostClockUs();
+void hostClockReset();
+void hostClockSetWaitHook(host_clock_wait_fn_t hook);
+// Moves the clock forward (never back), without running the wait hook.
+void hostClockAdvanceTo(uint64_t us);
+bool hostClockWaitUntil(uint64_t deadline_us);
+// Waits out the whole interval, delivering every event that falls inside it.
+void hostClockSleepUs(uint64_t us);
+
+// Real-time mode follows the host's monotonic clock from the current reading on, and waits really
+// sleep. Needed when the firmware talks to something outside the process (SocketCAN).
+void hostClockSetRealTime(bool enabled);
+bool hostClockRealTime();
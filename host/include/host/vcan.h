@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <driver/twai.h>
+
+// In-memory CAN bus for host builds. The firmware side transmits with hostVcanTransmit() and
+// receives through one callback; simulated peers attach as nodes, see every firmware frame when
+// its transmission ends, and queue their own frames for a virtual time. Frames are serialized on
+// the bus at the configured bitrate (nominal bit count, no stuffing).
+
+struct host_vcan_node_t {
+  void (*onFrame)(void* ctx, const twai_message_t& frame, uint64_t end_us);
+  void* ctx;
+};
+
+// Firmware receive path; returns whether the frame was consumed.
+typedef bool (*host_vcan_receiver_t)(const twai_message_t& frame);
+
+struct host_vcan_stats_t {
+  uint32_t firmwareTx;
+  uint32_t firmwareRx;
+  uint32_t nodeTx;
+  uint64_t busyUs;
+  uint64_t bits;
+};
+
+// Clears the bus, its nodes and statistics, and installs the bus as the clock's wait hook.
+void hostVcanReset(uint32_t bitrate = 500000);
+bool hostVcanAttach(const host_vcan_node_t& node);
+void hostVcanSetReceiver(host_vcan_receiver_t receiver);
+uint32_t hostVcanFrameUs(const twai_message_t& frame);
+
+bool hostVcanTransmit(const twai_message_t& frame);
+// Puts a node frame on the bus once ready_us has passed and the bus is free; the receiver gets it
+// when its transmission ends.
+void hostVcanSchedule(const twai_message_t& frame, uint64_t ready_us);
+uint32_t hostVcanPending();
+
+void hostVcanGetStats(host_vcan_stats_t& out);
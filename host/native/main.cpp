@@ -0,0 +1,92 @@
+// Entry point of the env:native build. Brings the CAN module up on the host backend
+// (functions/can/can_hal.h). With both buses on loopback it checks the send/receive path through
+// chassis_can_* and haldex_can_*; with SocketCAN interfaces it runs in real time and reports the
+// traffic seen on each bus, cached into CAN View like the firmware does.
+//
+//   pio run -e native && .pio/build/native/program
+//   OH_HOST_CAN0=vcan0 OH_HOST_CAN1=vcan1 .pio/build/native/program 30
+//
+// A vcan pair is set up with: ip link add dev vcan0 type vcan && ip link set up vcan0 (same for vcan1).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "functions/can/can.h"
+#include "functions/can/can_hal.h"
+#include "functions/canview/canview.h"
+#include "functions/core/state.h"
+#include "host/can_host.h"
+#include "host/clock.h"
+
+static bool sameFrame(const twai_message_t& a, const twai_message_t& b) {
+  return a.identifier == b.identifier && a.extd == b.extd && a.data_length_code == b.data_length_code &&
+         memcmp(a.data, b.data, a.data_length_code) == 0;
+}
+
+static int runLoopbackCheck() {
+  twai_message_t frame = {};
+  frame.identifier = 0x280;
+  frame.data_length_code = 8;
+  for (uint8_t i = 0; i < 8; i++) {
+    frame.data[i] = (uint8_t)(0x10 + i);
+  }
+
+  twai_message_t received = {};
+  twai_message_t sent = {};
+  const bool injected = canHostInject(0, frame);
+  const bool chassis_rx = chassis_can_receive(received) && sameFrame(received, frame);
+  const bool haldex_tx = haldex_can_send(received, pdMS_TO_TICKS(10)) && canHostTake(1, sent) && sameFrame(sent, frame);
+  const bool haldex_empty = !haldex_can_receive(received);
+
+  printf("loopback inject=%d chassis_rx=%d haldex_tx=%d haldex_rx_empty=%d\n", injected, chassis_rx, haldex_tx,
+         haldex_empty);
+  const bool ok = injected && chassis_rx && haldex_tx && haldex_empty;
+  printf("%s\n", ok ? "PASS" : "FAIL");
+  return ok ? 0 : 1;
+}
+
+static int runMonitor(uint32_t seconds) {
+  hostClockSetRealTime(true);
+  uint32_t frames[CAN_HAL_BUS_COUNT] = {};
+  const uint32_t started_ms = millis();
+  while ((millis() - started_ms) < seconds * 1000U) {
+    twai_message_t msg = {};
+    while (chassis_can_receive(msg)) {
+      canviewCacheFrame(msg, 0);
+      frames[0]++;
+    }
+    while (haldex_can_receive(msg)) {
+      canviewCacheFrame(msg, 1);
+      frames[1]++;
+    }
+    delay(1);
+  }
+
+  for (uint8_t bus = 0; bus < CAN_HAL_BUS_COUNT; bus++) {
+    can_host_stats_t stats = {};
+    canHostGetStats(bus, stats);
+    printf("bus%u %s frames=%lu fps=%.1f tx=%lu tx_dropped=%lu\n", bus, canHostSpec(bus), (unsigned long)frames[bus],
+           seconds ? (double)frames[bus] / seconds : 0.0, (unsigned long)stats.tx, (unsigned long)stats.txDropped);
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  const uint32_t seconds = (argc > 1) ? (uint32_t)strtoul(argv[1], nullptr, 10) : 10;
+
+  canHostConfigureFromEnv();
+  canInit();
+  for (uint8_t bus = 0; bus < CAN_HAL_BUS_COUNT; bus++) {
+    printf("bus%u backend=%s spec=%s ready=%d\n", bus, canHalBackend(bus)->name, canHostSpec(bus), canHalReady(bus));
+  }
+  if (!can_ready) {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  const bool loopback = strcmp(canHostSpec(0), "loopback") == 0 && strcmp(canHostSpec(1), "loopback") == 0;
+  const int rc = loopback ? runLoopbackCheck() : runMonitor(seconds);
+  canDeinit();
+  return rc;
+}
@@ -0,0 +1,622 @@
+#include "haldex_ecu_sim.h"
+
+#include <string.h>
+
+#include <map>
+#include <vector>
+
+#include "host/vcan.h"
+
+static const uint8_t k_negative = 0x7F;
+static const uint8_t k_nrc_service_not_supported = 0x11;
+static const uint8_t k_nrc_sub_function_not_supported = 0x12;
+static const uint8_t k_nrc_incorrect_length = 0x13;
+static const uint8_t k_nrc_response_too_long = 0x14;
+static const uint8_t k_nrc_out_of_range = 0x31;
+static const uint8_t k_nrc_response_pending = 0x78;
+
+static const uint32_t k_tp20_setup_id = 0x200;
+static const uint8_t k_tp20_logical_haldex = 0x0A;
+static const uint8_t k_tp20_app_kwp = 0x01;
+static const uint8_t k_tp20_params[] = {0xA1, 0x0F, 0x8A, 0xFF, 0x4A, 0xFF};
+
+struct sim_dtc_t {
+  uint32_t code;
+  uint8_t status;
+};
+
+struct sim_fault_t {
+  uint8_t sid;
+  uint8_t nrc;
+  uint8_t count;
+};
+
+struct sim_pending_t {
+  uint8_t sid;
+  uint8_t count;
+  uint32_t intervalUs;
+};
+
+// Multi-frame request being received.
+struct isotp_rx_t {
+  bool active;
+  uint16_t total;
+  uint8_t nextSeq;
+  uint8_t blockCount;
+  std::vector<uint8_t> data;
+};
+
+// Multi-frame response being sent; paced by the tester's flow control.
+struct isotp_tx_t {
+  bool active;
+  bool waitingFc;
+  uint16_t offset;
+  uint8_t seq;
+  std::vector<uint8_t> data;
+};
+
+struct tp20_channel_t {
+  bool open;
+  uint8_t txSeq;
+  uint64_t lastUs;
+  std::vector<uint8_t> rx;
+};
+
+static ecu_sim_config_t g_config = {};
+static ecu_sim_stats_t g_stats = {};
+static std::map<uint16_t, std::vector<uint8_t>> g_dids;
+static std::map<uint8_t, std::vector<uint8_t>> g_local_ids;
+static std::vector<sim_dtc_t> g_dtcs;
+static std::vector<sim_fault_t> g_faults;
+static std::vector<sim_pending_t> g_pending;
+static bool g_silent = false;
+static isotp_rx_t g_rx = {};
+static isotp_tx_t g_tx = {};
+static tp20_channel_t g_tp20 = {};
+
+static uint32_t decodeStMinUs(uint8_t raw) {
+  if (raw <= 0x7F) {
+    return (uint32_t)raw * 1000UL;
+  }
+  if (raw >= 0xF1 && raw <= 0xF9) {
+    return (uint32_t)(raw - 0xF0) * 100UL;
+  }
+  return 127000UL;
+}
+
+static void sendFrame(uint32_t id, bool extended, const uint8_t* bytes, uint8_t len, bool pad, uint64_t at_us) {
+  twai_message_t frame = {};
+  frame.identifier = id;
+  frame.extd = extended ? 1 : 0;
+  frame.data_length_code = pad ? 8 : len;
+  memset(frame.data, 0xAA, sizeof(frame.data));
+  memcpy(frame.data, bytes, len);
+  hostVcanSchedule(frame, at_us);
+  g_stats.framesOut++;
+}
+
+static void sendUdsFrame(const uint8_t* bytes, uint8_t len, uint64_t at_us) {
+  sendFrame(g_config.udsResponseId, g_config.udsExtended, bytes, len, true, at_us);
+}
+
+static void sendUdsMessage(const std::vector<uint8_t>& message, uint64_t at_us) {
+  uint8_t frame[8] = {};
+  if (message.size() <= 7) {
+    frame[0] = (uint8_t)message.size();
+    memcpy(&frame[1], message.data(), message.size());
+    sendUdsFrame(frame, (uint8_t)(message.size() + 1), at_us);
+    return;
+  }
+  frame[0] = (uint8_t)(0x10 | ((message.size() >> 8) & 0x0F));
+  frame[1] = (uint8_t)(message.size() & 0xFF);
+  memcpy(&frame[2], message.data(), 6);
+  sendUdsFrame(frame, 8, at_us);
+  g_tx.active = true;
+  g_tx.waitingFc = true;
+  g_tx.offset = 6;
+  g_tx.seq = 1;
+  g_tx.data = message;
+}
+
+// TP2.0 data: a two-byte length, then the message, seven bytes per frame; only the last frame asks
+// for an ACK.
+static void sendTp20Message(const std::vector<uint8_t>& message, uint64_t at_us) {
+  std::vector<uint8_t> stream;
+  stream.push_back((uint8_t)(message.size() >> 8));
+  stream.push_back((uint8_t)(message.size() & 0xFF));
+  stream.insert(stream.end(), message.begin(), message.end());
+
+  for (size_t offset = 0; offset < stream.size(); offset += 7) {
+    const size_t chunk = stream.size() - offset < 7 ? stream.size() - offset : 7;
+    const bool last = offset + chunk >= stream.size();
+    uint8_t frame[8] = {};
+    frame[0] = (uint8_t)((last ? 0x10 : 0x20) | (g_tp20.txSeq & 0x0F));
+    memcpy(&frame[1], &stream[offset], chunk);
+    sendFrame(g_config.tp20EcuTxId, false, frame, (uint8_t)(chunk + 1), false, at_us);
+    g_tp20.txSeq = (g_tp20.txSeq + 1) & 0x0F;
+    at_us += g_config.frameGapUs;
+  }
+}
+
+static void negative(std::vector<uint8_t>& out, uint8_t sid, uint8_t nrc) {
+  out.assign({k_negative, sid, nrc});
+}
+
+static void handleUdsService(const std::vector<uint8_t>& req, std::vector<uint8_t>& out) {
+  const uint8_t sid = req[0];
+  switch (sid) {
+  case 0x22: {
+    if (req.size() < 3 || (req.size() - 1) % 2 != 0) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    const size_t count = (req.size() - 1) / 2;
+    if (g_config.maxDidsPerRequest != 0 && count > g_config.maxDidsPerRequest) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    // Unsupported DIDs are left out of the answer; only when none is supported is it negative.
+    out.assign({0x62});
+    for (size_t i = 0; i < count; i++) {
+      const uint16_t did = (uint16_t)((req[1 + 2 * i] << 8) | req[2 + 2 * i]);
+      auto it = g_dids.find(did);
+      if (it == g_dids.end()) {
+        continue;
+      }
+      out.push_back(req[1 + 2 * i]);
+      out.push_back(req[2 + 2 * i]);
+      out.insert(out.end(), it->second.begin(), it->second.end());
+    }
+    if (out.size() == 1) {
+      negative(out, sid, k_nrc_out_of_range);
+    } else if (out.size() > 4095) {
+      negative(out, sid, k_nrc_response_too_long);
+    }
+    return;
+  }
+  case 0x19:
+    if (req.size() != 3) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    if (req[1] != 0x02) {
+      negative(out, sid, k_nrc_sub_function_not_supported);
+      return;
+    }
+    out.assign({0x59, 0x02, 0xFF});
+    for (const sim_dtc_t& dtc : g_dtcs) {
+      if ((dtc.status & req[2]) == 0) {
+        continue;
+      }
+      out.push_back((uint8_t)(dtc.code >> 16));
+      out.push_back((uint8_t)(dtc.code >> 8));
+      out.push_back((uint8_t)dtc.code);
+      out.push_back(dtc.status);
+    }
+    return;
+  case 0x14: {
+    if (req.size() != 4) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    const uint32_t group = ((uint32_t)req[1] << 16) | ((uint32_t)req[2] << 8) | req[3];
+    std::vector<sim_dtc_t> kept;
+    for (const sim_dtc_t& dtc : g_dtcs) {
+      if (group != 0xFFFFFF && dtc.code != group) {
+        kept.push_back(dtc);
+      }
+    }
+    g_dtcs = kept;
+    out.assign({0x54});
+    return;
+  }
+  case 0x10:
+    if (req.size() != 2) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    out.assign({0x50, req[1], 0x00, 0x32, 0x01, 0xF4});
+    return;
+  case 0x3E:
+    out.assign({0x7E, (uint8_t)(req.size() > 1 ? req[1] : 0)});
+    return;
+  default:
+    negative(out, sid, k_nrc_service_not_supported);
+    return;
+  }
+}
+
+static void handleKwpService(const std::vector<uint8_t>& req, std::vector<uint8_t>& out) {
+  const uint8_t sid = req[0];
+  switch (sid) {
+  case 0x10:
+    if (req.size() != 2) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    out.assign({0x50, req[1]});
+    return;
+  case 0x21: {
+    if (req.size() != 2) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    auto it = g_local_ids.find(req[1]);
+    if (it == g_local_ids.end()) {
+      negative(out, sid, k_nrc_out_of_range);
+      return;
+    }
+    out.assign({0x61, req[1]});
+    out.insert(out.end(), it->second.begin(), it->second.end());
+    return;
+  }
+  case 0x14:
+    if (req.size() < 3) {
+      negative(out, sid, k_nrc_incorrect_length);
+      return;
+    }
+    g_dtcs.clear();
+    out.assign({0x54, req[1], req[2]});
+    return;
+  case 0x3E:
+    out.assign({0x7E});
+    return;
+  default:
+    negative(out, sid, k_nrc_service_not_supported);
+    return;
+  }
+}
+
+// Runs one complete request: injected faults first, then the service, then any response-pending
+// frames ahead of the answer.
+static void handleRequest(const std::vector<uint8_t>& req, bool kwp, uint64_t done_us) {
+  if (req.empty()) {
+    return;
+  }
+  const uint8_t sid = req[0];
+  if (kwp) {
+    g_stats.kwpRequests++;
+  } else {
+    g_stats.udsRequests++;
+  }
+
+  std::vector<uint8_t> out;
+  bool faulted = false;
+  for (size_t i = 0; i < g_faults.size(); i++) {
+    if (g_faults[i].sid == sid) {
+      negative(out, sid, g_faults[i].nrc);
+      if (--g_faults[i].count == 0) {
+        g_faults.erase(g_faults.begin() + i);
+      }
+      faulted = true;
+      break;
+    }
+  }
+  if (!faulted) {
+    if (kwp) {
+      handleKwpService(req, out);
+    } else {
+      handleUdsService(req, out);
+    }
+  }
+  if (out[0] == k_negative) {
+    g_stats.negativeResponses++;
+  }
+
+  uint64_t at_us = done_us + g_config.responseDelayUs;
+  for (size_t i = 0; i < g_pending.size(); i++) {
+    if (g_pending[i].sid != sid) {
+      continue;
+    }
+    const std::vector<uint8_t> pending = {k_negative, sid, k_nrc_response_pending};
+    for (uint8_t n = 0; n < g_pending[i].count; n++) {
+      if (kwp) {
+        sendTp20Message(pending, at_us);
+      } else {
+        sendUdsMessage(pending, at_us);
+      }
+      g_stats.pendingResponses++;
+      at_us += g_pending[i].intervalUs;
+    }
+    g_pending.erase(g_pending.begin() + i);
+    break;
+  }
+
+  if (kwp) {
+    sendTp20Message(out, at_us);
+  } else {
+    sendUdsMessage(out, at_us);
+  }
+}
+
+static void sendFlowControl(uint64_t at_us) {
+  const uint8_t fc[] = {0x30, g_config.blockSize, g_config.stMin};
+  sendUdsFrame(fc, sizeof(fc), at_us);
+  g_stats.flowControls++;
+}
+
+// Consecutive frames for one block of our multi-frame response, at the tester's STmin.
+static void sendConsecutiveBlock(uint8_t block_size, uint32_t st_min_us, uint64_t at_us) {
+  const uint32_t gap_us = st_min_us > g_config.frameGapUs ? st_min_us : g_config.frameGapUs;
+  uint8_t sent = 0;
+  while (g_tx.offset < g_tx.data.size() && (block_size == 0 || sent < block_size)) {
+    uint8_t frame[8] = {};
+    frame[0] = (uint8_t)(0x20 | g_tx.seq);
+    uint8_t len = 1;
+    while (len < 8 && g_tx.offset < g_tx.data.size()) {
+      frame[len++] = g_tx.data[g_tx.offset++];
+    }
+    sendUdsFrame(frame, len, at_us);
+    g_tx.seq = (g_tx.seq + 1) & 0x0F;
+    at_us += gap_us;
+    sent++;
+  }
+  if (g_tx.offset >= g_tx.data.size()) {
+    g_tx.active = false;
+  }
+  g_tx.waitingFc = g_tx.active;
+}
+
+static void onUdsFrame(const twai_message_t& frame, uint64_t end_us) {
+  if (frame.data_length_code == 0) {
+    return;
+  }
+  const uint8_t pci = frame.data[0] & 0xF0;
+  switch (pci) {
+  case 0x00: {
+    const uint8_t len = frame.data[0] & 0x0F;
+    if (len == 0 || len > 7 || frame.data_length_code < len + 1) {
+      return;
+    }
+    g_rx.active = false;
+    g_tx.active = false;
+    handleRequest(std::vector<uint8_t>(&frame.data[1], &frame.data[1] + len), false, end_us);
+    return;
+  }
+  case 0x10:
+    if (frame.data_length_code < 8) {
+      return;
+    }
+    g_tx.active = false;
+    g_rx.active = true;
+    g_rx.total = (uint16_t)(((frame.data[0] & 0x0F) << 8) | frame.data[1]);
+    g_rx.nextSeq = 1;
+    g_rx.blockCount = 0;
+    g_rx.data.assign(&frame.data[2], &frame.data[8]);
+    sendFlowControl(end_us + g_config.turnaroundUs);
+    return;
+  case 0x20:
+    if (!g_rx.active || (frame.data[0] & 0x0F) != g_rx.nextSeq) {
+      g_rx.active = false;
+      return;
+    }
+    g_rx.nextSeq = (g_rx.nextSeq + 1) & 0x0F;
+    for (uint8_t i = 1; i < frame.data_length_code && g_rx.data.size() < g_rx.total; i++) {
+      g_rx.data.push_back(frame.data[i]);
+    }
+    if (g_rx.data.size() >= g_rx.total) {
+      g_rx.active = false;
+      handleRequest(g_rx.data, false, end_us);
+      return;
+    }
+    if (g_config.blockSize != 0 && ++g_rx.blockCount >= g_config.blockSize) {
+      g_rx.blockCount = 0;
+      sendFlowControl(end_us + g_config.turnaroundUs);
+    }
+    return;
+  case 0x30:
+    if (!g_tx.active || !g_tx.waitingFc || frame.data_length_code < 3) {
+      return;
+    }
+    if ((frame.data[0] & 0x0F) == 0x0) {
+      sendConsecutiveBlock(frame.data[1], decodeStMinUs(frame.data[2]), end_us + g_config.turnaroundUs);
+    } else if ((frame.data[0] & 0x0F) != 0x1) {
+      g_tx.active = false; // overflow or invalid flow status aborts the transfer
+    }
+    return;
+  default:
+    return;
+  }
+}
+
+static void onTp20Setup(const twai_message_t& frame, uint64_t end_us) {
+  if (frame.data_length_code < 7 || frame.data[0] != k_tp20_logical_haldex || frame.data[1] != 0xC0) {
+    return;
+  }
+  if (frame.data[6] != k_tp20_app_kwp) {
+    const uint8_t rejected[] = {0x00, 0xD6, 0x00, 0x10, 0x00, 0x10, frame.data[6]};
+    sendFrame(k_tp20_setup_id + k_tp20_logical_haldex, false, rejected, sizeof(rejected), false,
+              end_us + g_config.responseDelayUs);
+    return;
+  }
+
+  g_tp20.open = true;
+  g_tp20.txSeq = 0;
+  g_tp20.lastUs = end_us;
+  g_tp20.rx.clear();
+  g_stats.tp20Opens++;
+  const uint8_t accepted[] = {
+    0x00,
+    0xD0,
+    (uint8_t)(g_config.tp20EcuTxId & 0xFF),
+    (uint8_t)((g_config.tp20EcuTxId >> 8) & 0x0F),
+    (uint8_t)(g_config.tp20TesterTxId & 0xFF),
+    (uint8_t)((g_config.tp20TesterTxId >> 8) & 0x0F),
+    k_tp20_app_kwp,
+  };
+  sendFrame(k_tp20_setup_id + k_tp20_logical_haldex, false, accepted, sizeof(accepted), false,
+            end_us + g_config.responseDelayUs);
+}
+
+static void onTp20ChannelFrame(const twai_message_t& frame, uint64_t end_us) {
+  if (!g_tp20.open || frame.data_length_code == 0) {
+    return;
+  }
+  if (g_config.tp20InactivityMs != 0 && end_us - g_tp20.lastUs > (uint64_t)g_config.tp20InactivityMs * 1000ULL) {
+    g_tp20.open = false;
+    g_stats.tp20Dropped++;
+    return;
+  }
+  g_tp20.lastUs = end_us;
+
+  const uint8_t op = frame.data[0];
+  const uint64_t reply_us = end_us + g_config.turnaroundUs;
+  if (op == 0xA0 || op == 0xA3) {
+    if (op == 0xA3) {
+      g_stats.tp20ChannelTests++;
+    }
+    sendFrame(g_config.tp20EcuTxId, false, k_tp20_params, sizeof(k_tp20_params), false, reply_us);
+    return;
+  }
+  if (op == 0xA8) {
+    const uint8_t disconnect[] = {0xA8};
+    sendFrame(g_config.tp20EcuTxId, false, disconnect, sizeof(disconnect), false, reply_us);
+    g_tp20.open = false;
+    g_stats.tp20Disconnects++;
+    return;
+  }
+
+  const uint8_t type = op >> 4;
+  if (type > 0x3) {
+    return; // ACKs for our own frames
+  }
+  g_tp20.rx.insert(g_tp20.rx.end(), &frame.data[1], &frame.data[frame.data_length_code]);
+  if (type == 0x0 || type == 0x1) {
+    const uint8_t ack[] = {(uint8_t)(0xB0 | (((op & 0x0F) + 1) & 0x0F))};
+    sendFrame(g_config.tp20EcuTxId, false, ack, sizeof(ack), false, reply_us);
+  }
+  if (type == 0x1 || type == 0x3) {
+    std::vector<uint8_t> message;
+    if (g_tp20.rx.size() >= 2) {
+      const uint16_t len = (uint16_t)((g_tp20.rx[0] << 8) | g_tp20.rx[1]);
+      if (g_tp20.rx.size() >= (size_t)len + 2) {
+        message.assign(g_tp20.rx.begin() + 2, g_tp20.rx.begin() + 2 + len);
+      }
+    }
+    g_tp20.rx.clear();
+    handleRequest(message, true, reply_us);
+  }
+}
+
+static void onFrame(void* ctx, const twai_message_t& frame, uint64_t end_us) {
+  (void)ctx;
+  if (g_silent) {
+    return;
+  }
+  g_stats.framesIn++;
+  const uint32_t id = frame.identifier & 0x1FFFFFFF;
+  if (g_config.udsRequestId != 0 && id == g_config.udsRequestId && (bool)frame.extd == g_config.udsExtended) {
+    onUdsFrame(frame, end_us);
+    return;
+  }
+  if (!g_config.tp20Enabled || frame.extd) {
+    return;
+  }
+  if (id == k_tp20_setup_id) {
+    onTp20Setup(frame, end_us);
+  } else if (id == g_config.tp20TesterTxId) {
+    onTp20ChannelFrame(frame, end_us);
+  }
+}
+
+static void setBytes(std::vector<uint8_t>& out, const char* text) {
+  out.assign(text, text + strlen(text));
+}
+
+static void loadDefaults() {
+  g_dids.clear();
+  setBytes(g_dids[0xF19E], "EV_AllWheeDrivHalde5"); // ASAM/ODX file identifier, read by the route probe
+  setBytes(g_dids[0xF187], "0CQ907554K ");
+  setBytes(g_dids[0xF189], "1105");
+  setBytes(g_dids[0xF18C], "H5-00012345678");
+  setBytes(g_dids[0xF191], "0CQ907554  ");
+  setBytes(g_dids[0xF197], "HALDEX GEN5");
+  g_dids[0x0286] = {0x5A};
+  g_dids[0x2BE6] = {0x01, 0x2C};
+  g_dids[0x02BD] = {0x00, 0x64};
+  g_dids[0x1F60] = {0x12, 0x34, 0x56, 0x78};
+
+  // KWP measuring blocks: groups of three (type, a, b) values.
+  g_local_ids.clear();
+  g_local_ids[0x01] = {0x01, 0xC8, 0x0A, 0x05, 0x0A, 0x1E, 0x21, 0x64, 0x00, 0x10, 0x01, 0x02};
+  g_local_ids[0x02] = {0x07, 0x0A, 0x32, 0x07, 0x0A, 0x30};
+  g_local_ids[0x03] = {0x21, 0x64, 0x55};
+  g_local_ids[0x04] = {0x06, 0x7D, 0x8C, 0x05, 0x0A, 0x50, 0x25, 0x00, 0x01};
+
+  g_dtcs = {{0x01314F, 0x2F}, {0x056200, 0x08}};
+}
+
+void ecuSimDefaultConfig(ecu_sim_config_t& out) {
+  out = {};
+  out.udsRequestId = 0x70F;
+  out.udsResponseId = 0x779;
+  out.udsExtended = false;
+  out.responseDelayUs = 2000;
+  out.turnaroundUs = 300;
+  out.frameGapUs = 200;
+  out.blockSize = 0;
+  out.stMin = 0;
+  out.maxDidsPerRequest = 0;
+  out.tp20Enabled = true;
+  out.tp20TesterTxId = 0x740;
+  out.tp20EcuTxId = 0x300;
+  out.tp20InactivityMs = 0;
+}
+
+bool ecuSimInit(const ecu_sim_config_t& config) {
+  g_config = config;
+  g_stats = {};
+  g_faults.clear();
+  g_pending.clear();
+  g_silent = false;
+  g_rx = {};
+  g_tx = {};
+  g_tp20 = {};
+  loadDefaults();
+  return hostVcanAttach({onFrame, nullptr});
+}
+
+void ecuSimSetDid(uint16_t did, const uint8_t* data, uint16_t len) {
+  g_dids[did].assign(data, data + len);
+}
+
+void ecuSimRemoveDid(uint16_t did) {
+  g_dids.erase(did);
+}
+
+void ecuSimSetLocalId(uint8_t local_id, const uint8_t* data, uint16_t len) {
+  g_local_ids[local_id].assign(data, data + len);
+}
+
+void ecuSimSetDtcs(const uint32_t* dtcs, const uint8_t* status, uint8_t count) {
+  g_dtcs.clear();
+  for (uint8_t i = 0; i < count; i++) {
+    g_dtcs.push_back({dtcs[i] & 0xFFFFFF, status[i]});
+  }
+}
+
+uint8_t ecuSimDtcCount() {
+  return (uint8_t)g_dtcs.size();
+}
+
+void ecuSimInjectNrc(uint8_t sid, uint8_t nrc, uint8_t count) {
+  if (count > 0) {
+    g_faults.push_back({sid, nrc, count});
+  }
+}
+
+void ecuSimInjectPending(uint8_t sid, uint8_t count, uint32_t interval_us) {
+  g_pending.push_back({sid, count, interval_us});
+}
+
+void ecuSimSetSilent(bool silent) {
+  g_silent = silent;
+}
+
+bool ecuSimTp20ChannelOpen() {
+  return g_tp20.open;
+}
+
+void ecuSimGetStats(ecu_sim_stats_t& out) {
+  out = g_stats;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <driver/twai.h>
+
+// Simulated Haldex module on the host virtual CAN bus: UDS over ISO 15765-2 on one route (Gen 5) and
+// KWP2000 over VW TP2.0 (Gen 2/4). Every response is scheduled in virtual time, so runs are
+// deterministic. Faults are injected per service ID and consumed by the next matching requests.
+
+struct ecu_sim_config_t {
+  uint32_t udsRequestId; // 0 disables UDS
+  uint32_t udsResponseId;
+  bool udsExtended;
+  uint32_t responseDelayUs; // complete request -> first response frame (P2)
+  uint32_t turnaroundUs;    // frame -> our flow control / TP2.0 ACK
+  uint32_t frameGapUs;      // minimum gap between our own consecutive frames
+  uint8_t blockSize;        // flow control we answer multi-frame requests with
+  uint8_t stMin;            // raw STmin in that flow control
+  uint8_t maxDidsPerRequest; // more DIDs in one 0x22 -> NRC 0x13; 0 = no limit
+  bool tp20Enabled;
+  uint32_t tp20TesterTxId;   // where the module listens once the channel is up
+  uint32_t tp20EcuTxId;      // where it answers
+  uint32_t tp20InactivityMs; // channel dropped after this long without traffic; 0 = never
+};
+
+struct ecu_sim_stats_t {
+  uint32_t framesIn;
+  uint32_t framesOut;
+  uint32_t udsRequests;
+  uint32_t kwpRequests;
+  uint32_t negativeResponses;
+  uint32_t pendingResponses;
+  uint32_t flowControls;
+  uint32_t tp20Opens;
+  uint32_t tp20ChannelTests;
+  uint32_t tp20Disconnects;
+  uint32_t tp20Dropped; // channels timed out by tp20InactivityMs
+};
+
+void ecuSimDefaultConfig(ecu_sim_config_t& out);
+// Attaches to the virtual bus (call after hostVcanReset()) and loads the default DIDs, local
+// identifiers and DTCs.
+bool ecuSimInit(const ecu_sim_config_t& config);
+
+void ecuSimSetDid(uint16_t did, const uint8_t* data, uint16_t len);
+void ecuSimRemoveDid(uint16_t did);
+void ecuSimSetLocalId(uint8_t local_id, const uint8_t* data, uint16_t len);
+void ecuSimSetDtcs(const uint32_t* dtcs, const uint8_t* status, uint8_t count);
+uint8_t ecuSimDtcCount();
+
+// The next count requests for sid are answered with 7F sid nrc, without running the service.
+void ecuSimInjectNrc(uint8_t sid, uint8_t nrc, uint8_t count);
+// The next request for sid gets count 7F sid 78 (response pending) frames, interval_us apart,
+// before its real answer.
+void ecuSimInjectPending(uint8_t sid, uint8_t count, uint32_t interval_us);
+// A silent module ignores every frame (unplugged or asleep).
+void ecuSimSetSilent(bool silent);
+
+bool ecuSimTp20ChannelOpen();
+void ecuSimGetStats(ecu_sim_stats_t& out);
@@ -0,0 +1,172 @@
+#include <Arduino.h>
+
+#include <ctype.h>
+
+#include <chrono>
+
+#include "host/clock.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+uint32_t millis() {
+  return (uint32_t)(hostClockUs() / 1000ULL);
+}
+
+uint32_t micros() {
+  return (uint32_t)hostClockUs();
+}
+
+void delay(uint32_t ms) {
+  hostClockSleepUs((uint64_t)ms * 1000ULL);
+}
+
+void delayMicroseconds(uint32_t us) {
+  hostClockSleepUs(us);
+}
+
+void yield() {
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  if (in_max == in_min) {
+    return out_min;
+  }
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+uint32_t EspClass::getCycleCount() {
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+std::string String::formatUnsigned(unsigned long long value, unsigned char base) {
+  if (base < 2 || base > 36) {
+    base = DEC;
+  }
+  static const char k_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+  char buf[72];
+  size_t pos = sizeof(buf);
+  do {
+    buf[--pos] = k_digits[value % base];
+    value /= base;
+  } while (value != 0);
+  return std::string(&buf[pos], sizeof(buf) - pos);
+}
+
+std::string String::formatInteger(long long value, unsigned char base) {
+  if (base == DEC && value < 0) {
+    return "-" + formatUnsigned(0ULL - (unsigned long long)value, base);
+  }
+  // Arduino prints other bases as the two's complement of the 32-bit value.
+  if (value < 0 && value >= INT32_MIN) {
+    return formatUnsigned((uint32_t)value, base);
+  }
+  return formatUnsigned((unsigned long long)value, base);
+}
+
+std::string String::formatFloat(double value, unsigned int decimals) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimals, value);
+  return buf;
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+  if (s_.size() != other.s_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < s_.size(); i++) {
+    if (tolower((unsigned char)s_[i]) != tolower((unsigned char)other.s_[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) {
+    std::swap(from, to);
+  }
+  if (from >= s_.size()) {
+    return String();
+  }
+  return String(s_.substr(from, std::min<size_t>(to, s_.size()) - from));
+}
+
+void String::replace(const String& find, const String& with) {
+  if (find.s_.empty()) {
+    return;
+  }
+  size_t pos = 0;
+  while ((pos = s_.find(find.s_, pos)) != std::string::npos) {
+    s_.replace(pos, find.s_.size(), with.s_);
+    pos += with.s_.size();
+  }
+}
+
+void String::trim() {
+  size_t begin = 0;
+  size_t end = s_.size();
+  while (begin < end && isspace((unsigned char)s_[begin])) {
+    begin++;
+  }
+  while (end > begin && isspace((unsigned char)s_[end - 1])) {
+    end--;
+  }
+  s_ = s_.substr(begin, end - begin);
+}
+
+void String::toLowerCase() {
+  for (char& c : s_) {
+    c = (char)tolower((unsigned char)c);
+  }
+}
+
+void String::toUpperCase() {
+  for (char& c : s_) {
+    c = (char)toupper((unsigned char)c);
+  }
+}
+
+void String::getBytes(unsigned char* buf, unsigned int size) const {
+  if (size == 0) {
+    return;
+  }
+  const size_t n = std::min<size_t>(size - 1, s_.size());
+  memcpy(buf, s_.data(), n);
+  buf[n] = 0;
+}
+
+size_t Print::printf(const char* fmt, ...) {
+  char stack_buf[256];
+  va_list args;
+  va_start(args, fmt);
+  va_list copy;
+  va_copy(copy, args);
+  const int len = vsnprintf(stack_buf, sizeof(stack_buf), fmt, args);
+  va_end(args);
+  if (len < 0) {
+    va_end(copy);
+    return 0;
+  }
+  if ((size_t)len < sizeof(stack_buf)) {
+    va_end(copy);
+    return write((const uint8_t*)stack_buf, (size_t)len);
+  }
+  std::string big((size_t)len + 1, '\0');
+  vsnprintf(&big[0], big.size(), fmt, copy);
+  va_end(copy);
+  return write((const uint8_t*)big.data(), (size_t)len);
+}
+
+size_t Stream::readBytes(char* buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    const int c = read();
+    if (c < 0) {
+      break;
+    }
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
@@ -0,0 +1,316 @@
+#include "host/can_host.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <deque>
+#include <mutex>
+#include <string>
+
+#include "functions/can/can_hal.h"
+
+#if !OH_HOST
+#error "host sources are built with -DOH_HOST=1"
+#endif
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+struct can_host_bus_t {
+  std::string spec = "loopback";
+  bool started = false;
+  bool listenOnly = false;
+  int fd = -1;
+  std::deque<twai_message_t> rx;
+  std::deque<twai_message_t> tx;
+  can_host_stats_t stats = {};
+};
+
+static can_host_bus_t g_buses[CAN_HAL_BUS_COUNT];
+static std::mutex g_mutex;
+
+static bool isLoopback(const can_host_bus_t& bus) {
+  return bus.spec == "loopback";
+}
+
+#if defined(__linux__)
+static int openSocketCan(const char* ifname) {
+  const int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+  if (fd < 0) {
+    return -errno;
+  }
+  struct ifreq ifr = {};
+  strncpy(ifr.ifr_name, ifname, IFNAMSIZ - 1);
+  if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+    const int err = errno;
+    close(fd);
+    return -err;
+  }
+  struct sockaddr_can addr = {};
+  addr.can_family = AF_CAN;
+  addr.can_ifindex = ifr.ifr_ifindex;
+  if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+    const int err = errno;
+    close(fd);
+    return -err;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+static int writeSocketCan(int fd, const twai_message_t& msg, TickType_t timeout_ticks) {
+  struct can_frame frame = {};
+  frame.can_id = msg.identifier & CAN_EFF_MASK;
+  if (msg.extd) {
+    frame.can_id |= CAN_EFF_FLAG;
+  }
+  if (msg.rtr) {
+    frame.can_id |= CAN_RTR_FLAG;
+  }
+  frame.can_dlc = msg.data_length_code > 8 ? 8 : msg.data_length_code;
+  memcpy(frame.data, msg.data, frame.can_dlc);
+
+  while (write(fd, &frame, sizeof(frame)) != (ssize_t)sizeof(frame)) {
+    // The interface TX queue is full; wait for room like twai_transmit does, one tick = 1 ms.
+    if ((errno != EAGAIN && errno != ENOBUFS) || timeout_ticks == 0) {
+      return errno;
+    }
+    struct pollfd pfd = {fd, POLLOUT, 0};
+    if (poll(&pfd, 1, (int)timeout_ticks) <= 0) {
+      return ETIMEDOUT;
+    }
+    timeout_ticks = 0;
+  }
+  return 0;
+}
+
+static bool readSocketCan(int fd, twai_message_t& msg) {
+  struct can_frame frame = {};
+  if (read(fd, &frame, sizeof(frame)) != (ssize_t)sizeof(frame)) {
+    return false;
+  }
+  if (frame.can_id & CAN_ERR_FLAG) {
+    return false;
+  }
+  msg = {};
+  msg.extd = (frame.can_id & CAN_EFF_FLAG) ? 1 : 0;
+  msg.rtr = (frame.can_id & CAN_RTR_FLAG) ? 1 : 0;
+  msg.identifier = frame.can_id & (msg.extd ? CAN_EFF_MASK : CAN_SFF_MASK);
+  msg.data_length_code = frame.can_dlc > 8 ? 8 : frame.can_dlc;
+  memcpy(msg.data, frame.data, msg.data_length_code);
+  return true;
+}
+#endif
+
+static void hostEnd(uint8_t bus_index) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  can_host_bus_t& bus = g_buses[bus_index];
+#if defined(__linux__)
+  if (bus.fd >= 0) {
+    close(bus.fd);
+  }
+#endif
+  bus.fd = -1;
+  bus.started = false;
+  bus.rx.clear();
+  bus.tx.clear();
+}
+
+static bool hostBegin(uint8_t bus_index, twai_mode_t mode) {
+  hostEnd(bus_index);
+  std::lock_guard<std::mutex> lock(g_mutex);
+  can_host_bus_t& bus = g_buses[bus_index];
+  bus.listenOnly = (mode == TWAI_MODE_LISTEN_ONLY);
+  if (!isLoopback(bus)) {
+#if defined(__linux__)
+    const int fd = openSocketCan(bus.spec.c_str());
+    if (fd < 0) {
+      LOG_ERROR("can", "bus init failed: socketcan bus=%d if=%s err=%s", bus_index, bus.spec.c_str(), strerror(-fd));
+      return false;
+    }
+    bus.fd = fd;
+#else
+    LOG_ERROR("can", "bus init failed: socketcan needs Linux bus=%d if=%s", bus_index, bus.spec.c_str());
+    return false;
+#endif
+  }
+  bus.started = true;
+  return true;
+}
+
+static int hostSend(uint8_t bus_index, const twai_message_t& msg, TickType_t timeout_ticks) {
+  int fd = -1;
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    can_host_bus_t& bus = g_buses[bus_index];
+    if (!bus.started) {
+      return ENOTCONN;
+    }
+    if (bus.listenOnly) {
+      return EPERM;
+    }
+    if (isLoopback(bus)) {
+      if (bus.tx.size() >= CAN_HOST_TX_QUEUE_LEN) {
+        bus.stats.txDropped++;
+        return ENOBUFS;
+      }
+      bus.tx.push_back(msg);
+      bus.stats.tx++;
+      return 0;
+    }
+    fd = bus.fd;
+  }
+#if defined(__linux__)
+  const int err = writeSocketCan(fd, msg, timeout_ticks);
+  std::lock_guard<std::mutex> lock(g_mutex);
+  if (err == 0) {
+    g_buses[bus_index].stats.tx++;
+  } else {
+    g_buses[bus_index].stats.txDropped++;
+  }
+  return err;
+#else
+  (void)fd;
+  (void)timeout_ticks;
+  return ENOTSUP;
+#endif
+}
+
+static bool hostReceive(uint8_t bus_index, twai_message_t& msg) {
+  int fd = -1;
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    can_host_bus_t& bus = g_buses[bus_index];
+    if (!bus.started) {
+      return false;
+    }
+    if (isLoopback(bus)) {
+      if (bus.rx.empty()) {
+        return false;
+      }
+      msg = bus.rx.front();
+      bus.rx.pop_front();
+      bus.stats.rx++;
+      return true;
+    }
+    fd = bus.fd;
+  }
+#if defined(__linux__)
+  if (!readSocketCan(fd, msg)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_buses[bus_index].stats.rx++;
+  return true;
+#else
+  (void)fd;
+  return false;
+#endif
+}
+
+static const char* hostErrorName(int err) {
+  return strerror(err);
+}
+
+const can_hal_backend_t can_hal_host = {
+  "host", hostBegin, hostEnd, hostSend, hostReceive, nullptr, nullptr, nullptr, hostErrorName,
+};
+
+bool canHostConfigure(uint8_t bus_index, const char* spec) {
+  if (bus_index >= CAN_HAL_BUS_COUNT || !spec || !spec[0]) {
+    return false;
+  }
+#if !defined(__linux__)
+  if (strcmp(spec, "loopback") != 0) {
+    return false;
+  }
+#endif
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_buses[bus_index].spec = spec;
+  return true;
+}
+
+void canHostConfigureFromEnv() {
+  static const char* const k_env_names[CAN_HAL_BUS_COUNT] = {"OH_HOST_CAN0", "OH_HOST_CAN1"};
+  for (uint8_t i = 0; i < CAN_HAL_BUS_COUNT; i++) {
+    const char* spec = getenv(k_env_names[i]);
+    if (spec && spec[0]) {
+      (void)canHostConfigure(i, spec);
+    }
+  }
+}
+
+const char* canHostSpec(uint8_t bus_index) {
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return "";
+  }
+  return g_buses[bus_index].spec.c_str();
+}
+
+bool canHostInject(uint8_t bus_index, const twai_message_t& frame) {
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  can_host_bus_t& bus = g_buses[bus_index];
+  if (!bus.started || !isLoopback(bus)) {
+    return false;
+  }
+  if (bus.rx.size() >= CAN_HOST_RX_QUEUE_LEN) {
+    bus.stats.rxDropped++;
+    return false;
+  }
+  bus.rx.push_back(frame);
+  if (bus.rx.size() > bus.stats.rxHighWater) {
+    bus.stats.rxHighWater = (uint32_t)bus.rx.size();
+  }
+  return true;
+}
+
+bool canHostTake(uint8_t bus_index, twai_message_t& frame) {
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  can_host_bus_t& bus = g_buses[bus_index];
+  if (bus.tx.empty()) {
+    return false;
+  }
+  frame = bus.tx.front();
+  bus.tx.pop_front();
+  return true;
+}
+
+uint32_t canHostRxPending(uint8_t bus_index) {
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  return (uint32_t)g_buses[bus_index].rx.size();
+}
+
+void canHostGetStats(uint8_t bus_index, can_host_stats_t& out) {
+  out = {};
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  out = g_buses[bus_index].stats;
+}
+
+void canHostResetStats(uint8_t bus_index) {
+  if (bus_index >= CAN_HAL_BUS_COUNT) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_buses[bus_index].stats = {};
+}
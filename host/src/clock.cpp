@@ -0,0 +1,66 @@
+#include "host/clock.h"
+
+#include <chrono>
+#include <thread>
+
+static uint64_t g_now_us = 0;
+static host_clock_wait_fn_t g_wait_hook = nullptr;
+static bool g_real_time = false;
+static std::chrono::steady_clock::time_point g_real_base;
+static uint64_t g_real_base_us = 0;
+
+uint64_t hostClockUs() {
+  if (g_real_time) {
+    const auto elapsed = std::chrono::steady_clock::now() - g_real_base;
+    g_now_us = g_real_base_us + (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  }
+  return g_now_us;
+}
+
+void hostClockReset() {
+  g_now_us = 0;
+  g_real_base = std::chrono::steady_clock::now();
+  g_real_base_us = 0;
+}
+
+void hostClockSetWaitHook(host_clock_wait_fn_t hook) {
+  g_wait_hook = hook;
+}
+
+void hostClockAdvanceTo(uint64_t us) {
+  if (!g_real_time && us > g_now_us) {
+    g_now_us = us;
+  }
+}
+
+bool hostClockWaitUntil(uint64_t deadline_us) {
+  if (g_wait_hook && g_wait_hook(deadline_us)) {
+    return true;
+  }
+  if (g_real_time) {
+    // An unbounded wait has nothing in-process to end it.
+    const uint64_t now_us = hostClockUs();
+    if (deadline_us > now_us && deadline_us != UINT64_MAX) {
+      std::this_thread::sleep_for(std::chrono::microseconds(deadline_us - now_us));
+    }
+  }
+  hostClockAdvanceTo(deadline_us);
+  return false;
+}
+
+void hostClockSleepUs(uint64_t us) {
+  const uint64_t deadline_us = hostClockUs() + us;
+  while (hostClockWaitUntil(deadline_us)) {
+  }
+}
+
+void hostClockSetRealTime(bool enabled) {
+  const uint64_t now_us = hostClockUs();
+  g_real_time = enabled;
+  g_real_base = std::chrono::steady_clock::now();
+  g_real_base_us = now_us;
+}
+
+bool hostClockRealTime() {
+  return g_real_time;
+}
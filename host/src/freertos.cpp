@@ -0,0 +1,223 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <string.h>
+
+#include <deque>
+#include <vector>
+
+#include "host/clock.h"
+
+struct host_queue_t {
+  UBaseType_t length;
+  UBaseType_t itemSize;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+struct host_semaphore_t {
+  bool available;
+};
+
+static uint64_t deadlineUs(TickType_t ticks) {
+  if (ticks == portMAX_DELAY) {
+    return UINT64_MAX;
+  }
+  return hostClockUs() + (uint64_t)ticks * 1000ULL;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+  if (length == 0) {
+    return nullptr;
+  }
+  host_queue_t* queue = new host_queue_t();
+  queue->length = length;
+  queue->itemSize = item_size;
+  return queue;
+}
+
+void vQueueDelete(QueueHandle_t queue) {
+  delete queue;
+}
+
+static BaseType_t queuePut(QueueHandle_t queue, const void* item, bool front, bool overwrite) {
+  if (!queue) {
+    return pdFALSE;
+  }
+  if (queue->items.size() >= queue->length) {
+    if (!overwrite) {
+      return pdFALSE; // nothing drains a full queue while a host run waits
+    }
+    queue->items.pop_back();
+  }
+  const uint8_t* bytes = (const uint8_t*)item;
+  std::vector<uint8_t> copy(bytes, bytes + queue->itemSize);
+  if (front) {
+    queue->items.push_front(std::move(copy));
+  } else {
+    queue->items.push_back(std::move(copy));
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+  (void)ticks;
+  return queuePut(queue, item, false, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t queue, const void* item, TickType_t ticks) {
+  (void)ticks;
+  return queuePut(queue, item, false, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks) {
+  (void)ticks;
+  return queuePut(queue, item, true, false);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void* item) {
+  return queuePut(queue, item, false, true);
+}
+
+static BaseType_t queueTake(QueueHandle_t queue, void* item, TickType_t ticks, bool remove) {
+  if (!queue) {
+    return pdFALSE;
+  }
+  const uint64_t deadline_us = deadlineUs(ticks);
+  while (queue->items.empty()) {
+    if (ticks == 0 || hostClockUs() >= deadline_us) {
+      return pdFALSE;
+    }
+    // With nothing left to simulate an infinite wait would never return.
+    if (!hostClockWaitUntil(deadline_us) && deadline_us == UINT64_MAX) {
+      return pdFALSE;
+    }
+  }
+  memcpy(item, queue->items.front().data(), queue->itemSize);
+  if (remove) {
+    queue->items.pop_front();
+  }
+  return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+  return queueTake(queue, item, ticks, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void* item, TickType_t ticks) {
+  return queueTake(queue, item, ticks, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  return queue ? (UBaseType_t)queue->items.size() : 0;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t queue) {
+  return queue ? queue->length - (UBaseType_t)queue->items.size() : 0;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+  if (queue) {
+    queue->items.clear();
+  }
+  return pdPASS;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return new host_semaphore_t{true};
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+  return new host_semaphore_t{false};
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+  delete sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  if (!sem) {
+    return pdFALSE;
+  }
+  if (!sem->available) {
+    if (ticks != 0 && ticks != portMAX_DELAY) {
+      hostClockSleepUs((uint64_t)ticks * 1000ULL);
+    }
+    return pdFALSE;
+  }
+  sem->available = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  if (!sem || sem->available) {
+    return pdFALSE;
+  }
+  sem->available = true;
+  return pdTRUE;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stack, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+  (void)fn;
+  (void)name;
+  (void)stack;
+  (void)arg;
+  (void)priority;
+  (void)core;
+  if (handle) {
+    *handle = nullptr;
+  }
+  return pdFAIL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t stack, void* arg, UBaseType_t priority,
+                       TaskHandle_t* handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, arg, priority, handle, 0);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  (void)task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  hostClockSleepUs((uint64_t)ticks * 1000ULL);
+}
+
+void vTaskDelayUntil(TickType_t* previous_wake, TickType_t period) {
+  *previous_wake += period;
+  const uint64_t wake_us = (uint64_t)*previous_wake * 1000ULL;
+  if (wake_us > hostClockUs()) {
+    hostClockSleepUs(wake_us - hostClockUs());
+  }
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)(hostClockUs() / 1000ULL);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+  (void)task;
+  return 0;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return nullptr;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  (void)task;
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+  (void)clear_on_exit;
+  if (ticks != portMAX_DELAY) {
+    vTaskDelay(ticks);
+  }
+  return 0;
+}
+
+void taskYIELD() {
+}
@@ -0,0 +1,47 @@
+#include <LittleFS.h>
+
+#include <stdlib.h>
+
+#include <string>
+
+LittleFSClass LittleFS;
+
+static std::string hostPath(const char* path) {
+  const char* root = getenv("OH_HOST_FS");
+  return std::string(root && root[0] ? root : "data") + (path && path[0] == '/' ? "" : "/") + (path ? path : "");
+}
+
+size_t File::size() const {
+  if (!fp_) {
+    return 0;
+  }
+  const long pos = ftell(fp_);
+  fseek(fp_, 0, SEEK_END);
+  const long end = ftell(fp_);
+  fseek(fp_, pos, SEEK_SET);
+  return end > 0 ? (size_t)end : 0;
+}
+
+int File::available() const {
+  if (!fp_) {
+    return 0;
+  }
+  return (int)(size() - (size_t)ftell(fp_));
+}
+
+File LittleFSClass::open(const char* path, const char* mode) {
+  // Read-only: the host never writes into the filesystem image.
+  if (!mode || mode[0] != 'r') {
+    return File();
+  }
+  return File(fopen(hostPath(path).c_str(), "rb"));
+}
+
+bool LittleFSClass::exists(const char* path) {
+  FILE* fp = fopen(hostPath(path).c_str(), "rb");
+  if (!fp) {
+    return false;
+  }
+  fclose(fp);
+  return true;
+}
@@ -0,0 +1,33 @@
+// Host replacements for the file logger hooks behind LOG_INFO/WARN/ERROR. Nothing is stored; set
+// OH_HOST_LOG=1 to see the messages on stdout.
+
+#include <stdlib.h>
+
+#include "functions/config/config.h"
+#include "functions/storage/filelog.h"
+
+bool filelogShouldSerialEmit(const char* level, const char* tag) {
+  (void)level;
+  (void)tag;
+  static const bool enabled = getenv("OH_HOST_LOG") != nullptr;
+  return enabled;
+}
+
+void filelogPrintf(const char* level, const char* tag, const char* fmt, ...) {
+  (void)level;
+  (void)tag;
+  (void)fmt;
+}
+
+void filelogLogCanFrame(const twai_message_t& msg, uint8_t bus, uint8_t dir, bool generated) {
+  (void)msg;
+  (void)bus;
+  (void)dir;
+  (void)generated;
+}
+
+void filelogLogMeasuredValue(uint16_t did, const uint8_t* data, uint16_t len) {
+  (void)did;
+  (void)data;
+  (void)len;
+}
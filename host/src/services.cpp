@@ -0,0 +1,16 @@
+// Host replacements for the firmware services outside the native build (storage, power): the parts
+// the core, CAN, CAN View and diag modules call into.
+
+#include "functions/power/power.h"
+#include "functions/storage/storage.h"
+
+// The LittleFS stand-in reads straight from the host directory; there is nothing to mount.
+bool storageFsReady() {
+  return true;
+}
+
+// No sleep/wake handling on the host, so chassis activity is not tracked.
+void powerTrackChassisFrame(const twai_message_t& frame, uint32_t now_ms) {
+  (void)frame;
+  (void)now_ms;
+}
@@ -0,0 +1,126 @@
+#include "host/vcan.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "host/clock.h"
+
+#define HOST_VCAN_NODE_MAX 4
+
+struct vcan_pending_t {
+  uint64_t readyUs;
+  uint32_t order; // keeps frames with the same ready time in submission order
+  twai_message_t frame;
+};
+
+static uint32_t g_bitrate = 500000;
+static host_vcan_node_t g_nodes[HOST_VCAN_NODE_MAX];
+static uint8_t g_node_count = 0;
+static host_vcan_receiver_t g_receiver = nullptr;
+static std::vector<vcan_pending_t> g_pending;
+static uint32_t g_order = 0;
+static uint64_t g_bus_free_us = 0;
+static host_vcan_stats_t g_stats = {};
+
+// Nominal frame length in bits: SOF, arbitration, control, data, CRC, ACK, EOF and intermission.
+static uint32_t frameBits(const twai_message_t& frame) {
+  const uint8_t dlc = frame.data_length_code > 8 ? 8 : frame.data_length_code;
+  return (frame.extd ? 67U : 47U) + 8U * (frame.rtr ? 0U : dlc);
+}
+
+uint32_t hostVcanFrameUs(const twai_message_t& frame) {
+  return (uint32_t)(((uint64_t)frameBits(frame) * 1000000ULL + g_bitrate - 1) / g_bitrate);
+}
+
+// Claims the bus for one frame starting no earlier than ready_us; returns when it ends.
+static uint64_t occupyBus(const twai_message_t& frame, uint64_t ready_us) {
+  const uint64_t start_us = ready_us > g_bus_free_us ? ready_us : g_bus_free_us;
+  const uint32_t duration_us = hostVcanFrameUs(frame);
+  g_bus_free_us = start_us + duration_us;
+  g_stats.busyUs += duration_us;
+  g_stats.bits += frameBits(frame);
+  return g_bus_free_us;
+}
+
+static int nextPendingIndex() {
+  int best = -1;
+  for (size_t i = 0; i < g_pending.size(); i++) {
+    if (best < 0 || g_pending[i].readyUs < g_pending[best].readyUs ||
+        (g_pending[i].readyUs == g_pending[best].readyUs && g_pending[i].order < g_pending[best].order)) {
+      best = (int)i;
+    }
+  }
+  return best;
+}
+
+// Clock wait hook: delivers the next node frame whose transmission ends by deadline_us.
+static bool runUntil(uint64_t deadline_us) {
+  const int index = nextPendingIndex();
+  if (index < 0) {
+    return false;
+  }
+  const vcan_pending_t& next = g_pending[index];
+  const uint64_t start_us = next.readyUs > g_bus_free_us ? next.readyUs : g_bus_free_us;
+  if (start_us + hostVcanFrameUs(next.frame) > deadline_us) {
+    return false;
+  }
+
+  const twai_message_t frame = next.frame;
+  g_pending.erase(g_pending.begin() + index);
+  const uint64_t end_us = occupyBus(frame, start_us);
+  hostClockAdvanceTo(end_us);
+  g_stats.nodeTx++;
+  if (g_receiver && g_receiver(frame)) {
+    g_stats.firmwareRx++;
+  }
+  return true;
+}
+
+void hostVcanReset(uint32_t bitrate) {
+  g_bitrate = bitrate > 0 ? bitrate : 500000;
+  g_node_count = 0;
+  g_receiver = nullptr;
+  g_pending.clear();
+  g_order = 0;
+  g_bus_free_us = hostClockUs();
+  g_stats = {};
+  hostClockSetWaitHook(runUntil);
+}
+
+bool hostVcanAttach(const host_vcan_node_t& node) {
+  if (g_node_count >= HOST_VCAN_NODE_MAX || !node.onFrame) {
+    return false;
+  }
+  g_nodes[g_node_count++] = node;
+  return true;
+}
+
+void hostVcanSetReceiver(host_vcan_receiver_t receiver) {
+  g_receiver = receiver;
+}
+
+bool hostVcanTransmit(const twai_message_t& frame) {
+  if (frame.data_length_code > 8) {
+    return false;
+  }
+  // The firmware does not wait for its own transmission; peers see the frame when it ends.
+  const uint64_t end_us = occupyBus(frame, hostClockUs());
+  g_stats.firmwareTx++;
+  for (uint8_t i = 0; i < g_node_count; i++) {
+    g_nodes[i].onFrame(g_nodes[i].ctx, frame, end_us);
+  }
+  return true;
+}
+
+void hostVcanSchedule(const twai_message_t& frame, uint64_t ready_us) {
+  g_pending.push_back({ready_us, g_order++, frame});
+}
+
+uint32_t hostVcanPending() {
+  return (uint32_t)g_pending.size();
+}
+
+void hostVcanGetStats(host_vcan_stats_t& out) {
+  out = g_stats;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Microbenchmarks for the per-frame hot paths: lock target calculation, DBC extraction, the MQB
+// CRC, the CAN View cache and its JSON. The same suite runs on the host (host/bench/main.cpp, env
+// bench) and, in firmware built with OH_BENCH_API, on the device (GET /api/bench, a diag worker job
+// timed with the CPU cycle counter). Every result is one line, so runs diff and parse the same way
+// on both:
+//
+//   bench name=<case> iters=<n> ns_per_op=<f> cycles_per_op=<f|-> check=<hex>
+//
+// check folds every result a case computed; it moves when behavior does, not when speed does.
+// Cases read live state (mode, lock target, CAN View cache); the host runner sets up a fixed one.
+
+struct bench_result_t {
+  const char* name;
+  uint32_t iterations;
+  float nsPerOp;
+  float cyclesPerOp; // negative where there is no cycle counter (host)
+  uint32_t check;
+};
+
+typedef void (*bench_report_fn_t)(const bench_result_t& result, void* ctx);
+
+// Bit i set: case i's name contains filter (null or empty: every case). 0 when nothing matches.
+uint32_t benchSelectCases(const char* filter);
+// Runs the selected cases at scale times their base iteration count, best of repeat runs.
+// Returns the number of cases run.
+uint8_t benchRunSuite(uint32_t cases, uint32_t scale, uint8_t repeat, bench_report_fn_t report, void* ctx);
+// The "bench_env ..." header line: target, CPU clock, mode and generation the numbers belong to.
+String benchEnvLine();
+String benchResultLine(const bench_result_t& result);
@@ -12,6 +12,9 @@ bool haldex_can_receive(twai_message_t& msg);
 void broadcastOpenHaldex(void* arg);
 void parseCAN_chs(void* arg);
 void parseCAN_hdx(void* arg);
+// One pass of the receive tasks above; host harnesses call these directly.
+void canBridgeChassisPass();
+void canBridgeHaldexPass();
 
 void canInit();
 bool canInitChassisOnly(twai_mode_t mode = TWAI_MODE_NO_ACK);
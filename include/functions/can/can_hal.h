@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <driver/twai.h>
+
+#include "functions/config/config.h"
+#include "functions/config/pins.h"
+
+// Controller interface behind chassis_can_send/haldex_can_send and *_receive. Logical bus 0 is the
+// chassis bus, bus 1 the Haldex bus; each is bound to one backend, which owns its controller state.
+#define CAN_HAL_BUS_COUNT 2
+
+struct can_hal_backend_t {
+  const char* name;
+  bool (*begin)(uint8_t bus, twai_mode_t mode);
+  void (*end)(uint8_t bus);
+  // Returns 0 on success, otherwise a backend error code for errorName().
+  int (*send)(uint8_t bus, const twai_message_t& msg, TickType_t timeout_ticks);
+  // Non-blocking; false when nothing is waiting.
+  bool (*receive)(uint8_t bus, twai_message_t& msg);
+  // Puts the controller/transceiver in standby; begin() brings it back. Null -> end().
+  void (*sleep)(uint8_t bus);
+  // Bus-off recovery; may be null.
+  void (*recover)(uint8_t bus);
+  // Controller alert reporting (TWAI only); may be null.
+  bool (*enableAlerts)(uint8_t bus, uint32_t alerts);
+  const char* (*errorName)(int err);
+};
+
+#if OH_HOST
+extern const can_hal_backend_t can_hal_host;
+#else
+extern const can_hal_backend_t can_hal_twai;
+#if OH_CAN_HALDEX_MCP2515
+extern const can_hal_backend_t can_hal_mcp2515;
+#endif
+#endif
+#if OH_HOST || OH_CAN_LOADGEN
+extern const can_hal_backend_t can_hal_loadgen; // functions/can/can_loadgen.h
+#endif
+
+// Board default until overridden: TWAI chassis bus, MCP2515 or second TWAI Haldex bus; host
+// builds use can_hal_host on both, OH_CAN_LOADGEN builds can_hal_loadgen on both. Rebinding a running bus ends it first.
+const can_hal_backend_t* canHalBackend(uint8_t bus);
+void canHalSetBackend(uint8_t bus, const can_hal_backend_t* backend);
+
+bool canHalBegin(uint8_t bus, twai_mode_t mode);
+void canHalEnd(uint8_t bus);
+void canHalSleep(uint8_t bus);
+bool canHalReady(uint8_t bus);
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <driver/twai.h>
+
+#include "functions/can/can_hal.h"
+
+// Synthetic chassis traffic for stress tests. can_hal_loadgen stands in for both controllers: on
+// bus 0 it plays a PQ (Gen1/2/4) or MQB (Gen5) chassis bus at a chosen load, with the periods of
+// the standalone frame tasks, rolling counters and CRCs (ID_SEQ_* tables), arbitration by ID and
+// real wire times at 500 kbit/s; frames land in an RX queue as deep as the TWAI one. Bus 1 is a
+// sink that times each forwarded chassis frame. Traffic follows micros(), so the same backend runs
+// in virtual time on the host (scripts/can_loadgen_bench.cpp) and live in OH_CAN_LOADGEN builds.
+
+#define CAN_LOADGEN_RX_QUEUE_LEN 2048
+#define CAN_LOADGEN_BITRATE 500000
+#define CAN_LOADGEN_LATENCY_BUCKETS 128
+
+struct can_loadgen_stats_t {
+  uint8_t generation;
+  uint8_t loadPercent;
+  uint64_t elapsedUs; // since bus 0 began
+  uint64_t busyUs;    // wire time of the generated frames
+  uint32_t generated;
+  uint32_t overwritten; // periodic frames replaced by the next instance before winning arbitration
+  uint32_t received;    // taken from the RX queue by the bridge
+  uint32_t rxDropped;   // arrived while the RX queue was full
+  uint32_t rxHighWater;
+  uint32_t forwarded; // chassis frames that reached the Haldex bus
+  uint32_t haldexTx;  // every frame sent on the Haldex bus
+  uint32_t latencyMaxUs;
+  uint64_t latencySumUs;
+  // Arrival on the chassis bus to haldex send, log-linear buckets (canLoadgenLatencyPercentileUs).
+  uint32_t latency[CAN_LOADGEN_LATENCY_BUCKETS];
+};
+
+// generation 0 follows haldexGeneration when bus 0 begins; load_percent 0 keeps the native periods.
+// Above 100 the periods ask for more than the wire carries and the bus saturates (up to 150).
+// Takes effect from the next begin of bus 0.
+bool canLoadgenConfigure(uint8_t generation, uint8_t load_percent);
+// Load of the generation's frame mix at its native periods, percent of CAN_LOADGEN_BITRATE.
+float canLoadgenNativeLoad(uint8_t generation);
+
+void canLoadgenGetStats(can_loadgen_stats_t& out);
+void canLoadgenResetStats();
+// Upper bound of the bucket holding the given percentile; 0 without samples.
+uint32_t canLoadgenLatencyPercentileUs(const can_loadgen_stats_t& stats, uint8_t percentile);
+
+// Bits a frame occupies on the wire: stuff bits included, plus the 3-bit intermission.
+uint16_t canFrameWireBits(const twai_message_t& frame);
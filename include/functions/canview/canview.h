@@ -7,6 +7,8 @@ void canviewCacheFrame(const twai_message_t& msg, uint8_t bus);
 void canviewCacheFrameTx(const twai_message_t& msg, uint8_t bus, bool generated = false);
 String canviewBuildJson(uint16_t decoded_limit, uint8_t raw_limit, const String& bus_filter);
 String canviewBuildDumpText(uint32_t window_ms, const String& bus_filter);
+// canviewCacheFrame's cache update alone, into a private scratch cache (functions/bench). Returns the slot.
+uint8_t canviewBenchUpdateCache(const twai_message_t& msg);
 
 struct canview_last_tx_t {
   bool found;
@@ -26,12 +28,18 @@ struct canview_resolved_signal_t {
   bool generated;
   uint32_t id;
   uint32_t ageMs;
-  String bus;
-  String dir;
-  String name;
-  String unit;
+  const char* bus;
+  const char* dir;
+  const char* name; // points into the DBC table; valid while the table is
+  const char* unit;
   float numericValue;
+  bool integral; // numericValue came from an INT decode; integerValue is exact
+  int32_t integerValue;
   String textValue;
 };
 
-bool canviewResolveMappedSignal(const String& key, canview_resolved_signal_t& out);
+// Dashboard slot (0-based) decoded from the newest cached frame. Slot keys are bound to their DBC signal
+// and extraction plans once per config epoch, not per call. Web task only.
+bool canviewResolveDashboardSlot(uint8_t slot, canview_resolved_signal_t& out);
+// Name of the signal a slot is bound to, or nullptr while its key does not resolve.
+const char* canviewDashboardSlotName(uint8_t slot);
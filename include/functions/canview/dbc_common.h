@@ -1,7 +1,9 @@
 #pragma once
 
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 typedef struct {
   uint32_t id;
@@ -18,36 +20,125 @@ typedef struct {
   int16_t mux; // -1 none, -2 multiplexor, >=0 multiplexed value
 } dbc_signal_t;
 
-static inline uint64_t dbc_extract_raw(const uint8_t* data, uint16_t start_bit, uint8_t length,
-                                       uint8_t is_little_endian) {
-  if (length == 0 || length > 64) {
-    return 0;
+// Signals of one frame ID are contiguous in an ID-sorted signal array.
+typedef struct {
+  uint32_t id;
+  uint16_t first;
+  uint16_t count;
+  int16_t mux; // offset of the multiplexor signal inside the frame range, -1 if none
+} dbc_frame_index_t;
+
+// Minimal perfect hash over (frame ID, normalized signal name), generated by scripts/dbc_codegen.py.
+// bucket = hash(seed 0) % bucket_count; slot = hash(seeds[bucket]) % slot_count -> signal index.
+typedef struct {
+  const uint16_t* seeds;
+  uint16_t bucket_count;
+  const uint16_t* slots;
+  uint16_t slot_count;
+} dbc_name_hash_t;
+
+// FNV-1a over the little-endian frame ID and the normalized name; must match dbc_codegen.py.
+static inline uint32_t dbc_name_hash(uint32_t id, const char* name, uint32_t seed) {
+  uint32_t h = 2166136261UL ^ (seed * 0x9E3779B1UL);
+  for (uint8_t i = 0; i < 4; i++) {
+    h ^= (id >> (8U * i)) & 0xFFU;
+    h *= 16777619UL;
+  }
+  while (*name) {
+    h ^= (uint8_t)*name++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+// Extraction plan precompiled from a signal descriptor: byte-aligned 8/16-bit fields read bytes
+// directly, everything else is one shift and mask of the frame loaded as a 64-bit word.
+enum {
+  DBC_EXTRACT_NONE = 0,
+  DBC_EXTRACT_U8,
+  DBC_EXTRACT_U16_LE,
+  DBC_EXTRACT_U16_BE,
+  DBC_EXTRACT_WORD_LE,
+  DBC_EXTRACT_WORD_BE,
+};
+
+typedef struct {
+  uint8_t kind;
+  uint8_t byte;  // first byte for the aligned kinds
+  uint8_t shift; // right shift of the word for the word kinds
+  uint8_t length;
+} dbc_extract_plan_t;
+
+static inline dbc_extract_plan_t dbc_plan_extract(uint16_t start_bit, uint8_t length, uint8_t is_little_endian) {
+  dbc_extract_plan_t plan = {DBC_EXTRACT_NONE, 0, 0, length};
+  if (length == 0 || length > 64 || start_bit > 63) {
+    return plan;
   }
+  const uint8_t byte = (uint8_t)(start_bit / 8U);
+  const uint8_t bit = (uint8_t)(start_bit % 8U);
   if (is_little_endian) {
-    uint64_t raw = 0;
-    for (uint8_t i = 0; i < 8; i++) {
-      raw |= ((uint64_t)data[i]) << (8U * i);
+    if (bit == 0 && length == 8) {
+      plan.kind = DBC_EXTRACT_U8;
+      plan.byte = byte;
+    } else if (bit == 0 && length == 16 && byte < 7) {
+      plan.kind = DBC_EXTRACT_U16_LE;
+      plan.byte = byte;
+    } else {
+      plan.kind = DBC_EXTRACT_WORD_LE;
+      plan.shift = (uint8_t)start_bit;
     }
-    raw >>= start_bit;
-    if (length == 64) {
-      return raw;
-    }
-    return raw & ((1ULL << length) - 1ULL);
+    return plan;
   }
 
-  uint64_t raw = 0;
-  for (uint16_t i = 0; i < length; i++) {
-    int bit_index = (int)start_bit - (int)i;
-    int byte_index = bit_index / 8;
-    int bit_in_byte = 7 - (bit_index % 8);
-    uint8_t bit = (data[byte_index] >> bit_in_byte) & 0x1;
-    raw = (raw << 1) | bit;
+  // Motorola: start_bit is the MSB in sawtooth numbering. In the frame read as a big-endian word
+  // that bit sits at (7 - byte) * 8 + bit and the rest of the signal follows contiguously below it.
+  if (bit == 7 && length == 8) {
+    plan.kind = DBC_EXTRACT_U8;
+    plan.byte = byte;
+    return plan;
+  }
+  if (bit == 7 && length == 16 && byte < 7) {
+    plan.kind = DBC_EXTRACT_U16_BE;
+    plan.byte = byte;
+    return plan;
   }
-  return raw;
+  const int msb = (7 - (int)byte) * 8 + (int)bit;
+  const int lsb = msb - (int)length + 1;
+  if (lsb < 0) {
+    return plan; // runs past the last byte
+  }
+  plan.kind = DBC_EXTRACT_WORD_BE;
+  plan.shift = (uint8_t)lsb;
+  return plan;
 }
 
-static inline float dbc_decode_signal(const dbc_signal_t* sig, const uint8_t* data) {
-  uint64_t raw = dbc_extract_raw(data, sig->start_bit, sig->length, sig->is_little_endian);
+static inline uint64_t dbc_extract_planned(const uint8_t* data, dbc_extract_plan_t plan) {
+  const uint64_t mask = (plan.length >= 64) ? ~0ULL : ((1ULL << plan.length) - 1ULL);
+  uint64_t word = 0;
+  switch (plan.kind) {
+  case DBC_EXTRACT_U8:
+    return data[plan.byte];
+  case DBC_EXTRACT_U16_LE:
+    return (uint64_t)data[plan.byte] | ((uint64_t)data[plan.byte + 1] << 8);
+  case DBC_EXTRACT_U16_BE:
+    return ((uint64_t)data[plan.byte] << 8) | (uint64_t)data[plan.byte + 1];
+  case DBC_EXTRACT_WORD_LE:
+    memcpy(&word, data, sizeof(word)); // ESP32 and hosts are little-endian
+    return (word >> plan.shift) & mask;
+  case DBC_EXTRACT_WORD_BE:
+    memcpy(&word, data, sizeof(word));
+    return (__builtin_bswap64(word) >> plan.shift) & mask;
+  default:
+    return 0;
+  }
+}
+
+static inline uint64_t dbc_extract_raw(const uint8_t* data, uint16_t start_bit, uint8_t length,
+                                       uint8_t is_little_endian) {
+  return dbc_extract_planned(data, dbc_plan_extract(start_bit, length, is_little_endian));
+}
+
+static inline float dbc_decode_raw(const dbc_signal_t* sig, uint64_t raw) {
   if (!sig->is_signed) {
     return ((float)raw * sig->factor) + sig->offset;
   }
@@ -59,3 +150,121 @@ static inline float dbc_decode_signal(const dbc_signal_t* sig, const uint8_t* da
   int64_t sraw = (raw & sign_mask) ? (int64_t)(raw | (~((1ULL << sig->length) - 1ULL))) : (int64_t)raw;
   return ((float)sraw * sig->factor) + sig->offset;
 }
+
+static inline float dbc_decode_planned(const dbc_signal_t* sig, dbc_extract_plan_t plan, const uint8_t* data) {
+  return dbc_decode_raw(sig, dbc_extract_planned(data, plan));
+}
+
+static inline float dbc_decode_signal(const dbc_signal_t* sig, const uint8_t* data) {
+  return dbc_decode_planned(sig, dbc_plan_extract(sig->start_bit, sig->length, sig->is_little_endian), data);
+}
+
+// Tagged decode result. Integral signals (factor 1, integral offset) decode to INT; signals whose
+// factor and offset are exact multiples of 1/10^k or 1/2^k decode to FIXED, i.e. mant / den, with
+// no float math. Everything else falls back to FLOAT.
+enum {
+  DBC_VALUE_INT = 0,
+  DBC_VALUE_FIXED,
+  DBC_VALUE_FLOAT,
+};
+
+typedef struct {
+  uint8_t kind;
+  uint32_t den; // 1 for INT
+  int64_t mant; // INT/FIXED: value * den
+  float f;      // FLOAT only
+} dbc_value_t;
+
+typedef struct {
+  uint8_t kind;
+  uint32_t den;
+  int32_t mul; // factor * den
+  int32_t add; // offset * den
+} dbc_value_plan_t;
+
+static inline bool dbc_scaled_integral(double value, double scale, int32_t& out) {
+  const double scaled = value * scale;
+  const double rounded = floor(scaled + 0.5);
+  // Factors come from float literals, so allow float rounding noise.
+  if (fabs(scaled - rounded) > 1e-6 * (fabs(scaled) > 1.0 ? fabs(scaled) : 1.0) || fabs(rounded) > 2147483647.0) {
+    return false;
+  }
+  out = (int32_t)rounded;
+  return true;
+}
+
+static inline dbc_value_plan_t dbc_plan_value(const dbc_signal_t* sig) {
+  dbc_value_plan_t plan = {DBC_VALUE_FLOAT, 1, 0, 0};
+  if (!sig || sig->length == 0 || sig->length > 32 || sig->factor == 0.0f) {
+    return plan;
+  }
+  static const uint32_t k_dens[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024};
+  for (size_t i = 0; i < sizeof(k_dens) / sizeof(k_dens[0]); i++) {
+    int32_t mul = 0;
+    int32_t add = 0;
+    // |mul| <= 2^24 keeps raw * mul + add inside int64 for 32-bit raws.
+    if (!dbc_scaled_integral(sig->factor, k_dens[i], mul) || mul == 0 || mul > (1 << 24) || mul < -(1 << 24) ||
+        !dbc_scaled_integral(sig->offset, k_dens[i], add)) {
+      continue;
+    }
+    plan.kind = (k_dens[i] == 1) ? DBC_VALUE_INT : DBC_VALUE_FIXED;
+    plan.den = k_dens[i];
+    plan.mul = mul;
+    plan.add = add;
+    return plan;
+  }
+  return plan;
+}
+
+static inline int64_t dbc_sign_extend(uint64_t raw, uint8_t length) {
+  if (length == 0 || length >= 64) {
+    return (int64_t)raw;
+  }
+  const uint64_t sign_mask = 1ULL << (length - 1U);
+  return (raw & sign_mask) ? (int64_t)(raw | (~((1ULL << length) - 1ULL))) : (int64_t)raw;
+}
+
+static inline dbc_value_t dbc_decode_value(const dbc_signal_t* sig, dbc_value_plan_t value_plan,
+                                           dbc_extract_plan_t plan, const uint8_t* data) {
+  dbc_value_t out = {value_plan.kind, value_plan.den, 0, 0.0f};
+  const uint64_t raw = dbc_extract_planned(data, plan);
+  if (value_plan.kind == DBC_VALUE_FLOAT) {
+    out.f = dbc_decode_raw(sig, raw);
+    return out;
+  }
+  const int64_t sraw = sig->is_signed ? dbc_sign_extend(raw, sig->length) : (int64_t)raw;
+  out.mant = (sraw * value_plan.mul) + value_plan.add;
+  return out;
+}
+
+static inline bool dbc_value_valid(const dbc_value_t& v) {
+  return v.kind != DBC_VALUE_FLOAT || isfinite(v.f);
+}
+
+static inline bool dbc_value_negative(const dbc_value_t& v) {
+  return (v.kind == DBC_VALUE_FLOAT) ? (v.f < 0.0f) : (v.mant < 0);
+}
+
+// Rounds half away from zero, like lroundf().
+static inline int64_t dbc_value_round(const dbc_value_t& v) {
+  if (v.kind == DBC_VALUE_FLOAT) {
+    return (int64_t)lroundf(v.f);
+  }
+  if (v.den <= 1) {
+    return v.mant;
+  }
+  const int64_t half = (int64_t)(v.den / 2U);
+  return (v.mant >= 0) ? ((v.mant + half) / (int64_t)v.den) : -((-v.mant + half) / (int64_t)v.den);
+}
+
+static inline float dbc_value_to_float(const dbc_value_t& v) {
+  if (v.kind == DBC_VALUE_FLOAT) {
+    return v.f;
+  }
+  if (v.den <= 1) {
+    return (float)v.mant;
+  }
+  // Float math: the S3 FPU has no double unit. den is at most 10^6, so both operands are exact while
+  // |mant| < 2^24 and the quotient is the correctly rounded float; past that it is off by an ulp at most.
+  return (float)v.mant / (float)v.den;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "functions/canview/dbc_common.h"
+
+// ID-sorted signal table: the generated compiled tables, or one parsed from a LittleFS DBC override
+// at boot. Never freed, so signal pointers handed out stay valid for the life of the firmware.
+struct dbc_table_t {
+  const char* name;
+  const char* source;
+  const dbc_signal_t* signals;
+  uint16_t signal_count;
+  const dbc_frame_index_t* frames;
+  uint16_t frame_count;
+  const dbc_name_hash_t* name_hash; // nullptr for tables loaded at runtime
+  const dbc_extract_plan_t* plans;  // one per signal, same order
+  uint32_t pool_bytes;
+  uint32_t ram_bytes;
+  uint32_t load_us;
+};
+
+void dbcTablesInit();
+const dbc_table_t* dbcActiveChassisTable();
+const dbc_frame_index_t* dbcFindFrame(const dbc_table_t* table, uint32_t id);
+const dbc_signal_t* dbcFindMuxSignal(const dbc_table_t* table, uint32_t id);
+// name/unit are mapping-key tokens: underscores as spaces, trimmed, lowercase.
+const dbc_signal_t* dbcFindSignal(const dbc_table_t* table, uint32_t id, const char* name, const char* unit);
+dbc_extract_plan_t dbcSignalPlan(const dbc_table_t* table, const dbc_signal_t* sig);
+void dbcWriteStatusJson(JsonObject out);
@@ -5,5 +5,8 @@
 
 extern const dbc_signal_t k_vw_mqb_chassis_signals[];
 extern const uint16_t k_vw_mqb_chassis_signal_count;
+extern const dbc_frame_index_t k_vw_mqb_chassis_frames[];
+extern const uint16_t k_vw_mqb_chassis_frame_count;
+extern const dbc_name_hash_t k_vw_mqb_chassis_name_hash;
 
 #endif
@@ -13,6 +13,30 @@
 // Feature toggles
 #define OH_ENABLE_EEP_TASK 1
 #define OH_EEP_START_DELAY_MS 15000
+// Settings changes must be quiet this long before writeEEP persists them (coalesces slider drags).
+#define OH_EEP_SETTLE_MS 750
+
+// Host-native build (env:native): CAN goes through the host backend instead of the ESP-IDF drivers.
+#ifndef OH_HOST
+#define OH_HOST 0
+#endif
+
+// Bench self-test: both CAN buses run on the synthetic traffic backend (functions/can/can_loadgen.h)
+// instead of the controllers, at OH_CAN_LOADGEN_LOAD percent of 500 kbit/s. Never for a car build.
+#ifndef OH_CAN_LOADGEN
+#define OH_CAN_LOADGEN 0
+#endif
+
+#ifndef OH_CAN_LOADGEN_LOAD
+#define OH_CAN_LOADGEN_LOAD 100
+#endif
+
+// Microbenchmark suite (functions/bench) on the device as GET /api/bench. Off in release firmware: it
+// runs against live state on the diag worker. env:lilygo-t2can-s3-bench turns it on; host builds always
+// compile the suite.
+#ifndef OH_BENCH_API
+#define OH_BENCH_API 0
+#endif
 
 // ESP32-S3 core assignment.
 // Keep CAN receive/bridge/frame generation on one core and app/network/UI helpers on the other.
@@ -4,6 +4,8 @@
 
 #include "functions/can/standalone_can.h"
 
+// get_lock_target_adjustment steps the release smoother; call it from the control path only.
+float get_lock_target_raw();
 float get_lock_target_adjustment();
 uint8_t get_lock_target_adjusted_value(uint8_t value, bool invert);
 void getLockData(twai_message_t& rx_message_chs);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "functions/canview/dbc_common.h"
 #include "functions/core/state_model.h"
 
 #include <Arduino.h>
@@ -41,6 +42,56 @@ struct mode_trigger_config_t {
   bool broadcastOpenHaldexOverCAN;
 };
 
+// Extra mode-trigger rules, checked after the primary trigger above. Each rule combines up to
+// MODE_TRIGGER_TERM_MAX signal conditions with AND/OR; the first active rule picks the mode.
+#define MODE_TRIGGER_RULE_MAX 4
+#define MODE_TRIGGER_TERM_MAX 4
+
+enum mode_trigger_combine_t { MODE_TRIGGER_ALL, MODE_TRIGGER_ANY, mode_trigger_combine_t_MAX };
+
+struct mode_trigger_term_t {
+  String signal;
+  mode_trigger_operator_t op;
+  float value;
+  float hysteresis; // release band for gt/gte/lt/lte, in signal units
+};
+
+struct mode_trigger_rule_t {
+  bool enabled;
+  mode_trigger_combine_t combine;
+  uint16_t debounceMs; // the combined condition must hold (or clear) this long before the rule switches
+  openhaldex_mode_t mode;
+  bool broadcastOpenHaldexOverCAN;
+  uint8_t termCount;
+  mode_trigger_term_t terms[MODE_TRIGGER_TERM_MAX];
+};
+
+struct mode_trigger_rules_t {
+  uint8_t count;
+  mode_trigger_rule_t rules[MODE_TRIGGER_RULE_MAX];
+};
+
+// Global config epoch: bumped by every setter in state.cpp (mapped inputs, mode trigger, dashboard
+// signals, lock-table publish). Readers poll it lock-free and re-fetch only when it moves.
+uint32_t configEpoch();
+void configEpochBump();
+
+enum mapped_bus_t { MAPPED_BUS_UNKNOWN = 0, MAPPED_BUS_ANY, MAPPED_BUS_CHASSIS, MAPPED_BUS_HALDEX };
+
+// Mapping key "bus|frame|signal|unit" parsed once when it is set. Tokens are trimmed and lowercased,
+// ready for dbcFindSignal(); RX tasks only re-resolve when configEpoch() moves.
+#define MAPPED_SIGNAL_TOKEN_MAX 64
+struct mapped_signal_key_t {
+  bool configured; // a non-empty key was set
+  bool valid;      // and it parsed
+  mapped_bus_t bus;
+  uint32_t frameId;
+  char signal[MAPPED_SIGNAL_TOKEN_MAX];
+  char unit[MAPPED_SIGNAL_TOKEN_MAX];
+};
+
+typedef mapped_signal_key_t mode_trigger_rule_keys_t[MODE_TRIGGER_RULE_MAX][MODE_TRIGGER_TERM_MAX];
+
 struct mode_trigger_runtime_t {
   bool active;
   bool seen;
@@ -81,6 +132,8 @@ extern uint8_t received_haldex_state;
 extern uint8_t received_haldex_engagement_raw;
 extern uint8_t received_haldex_engagement;
 extern uint8_t appliedTorque;
+// millis() at the first controller-generated Haldex frame after boot (0 until then).
+extern volatile uint32_t bootFirstControlFrameMs;
 
 extern uint8_t haldexLearnTable[101];
 extern bool haldexLearnTableValid;
@@ -132,25 +185,40 @@ void mappedInputSignalsInit();
 bool mappedInputSignalsGet(String& speed, String& throttle, String& rpm, uint32_t timeout_ms = 0);
 bool mappedInputSignalsSet(const String& speed, const String& throttle, const String& rpm, uint32_t timeout_ms = 50);
 bool mappedInputSignalsConfigured();
+bool mappedInputKeysGet(mapped_signal_key_t& speed, mapped_signal_key_t& throttle, mapped_signal_key_t& rpm,
+                        uint32_t timeout_ms = 0);
+bool mappedSignalKeyParse(const String& raw, mapped_signal_key_t& out);
 
 void modeTriggerInit();
 bool modeTriggerConfigGet(mode_trigger_config_t& config, uint32_t timeout_ms = 0);
 bool modeTriggerConfigSet(const mode_trigger_config_t& config, uint32_t timeout_ms = 50);
+bool modeTriggerKeyGet(mapped_signal_key_t& key, uint32_t timeout_ms = 0);
 void modeTriggerRuntimeGet(mode_trigger_runtime_t& runtime);
-void modeTriggerRuntimeUpdate(bool active, float value, uint32_t seen_ms);
+// Chassis task, per primary-trigger frame. value stays tagged; modeTriggerRuntimeGet converts it.
+void modeTriggerRuntimeUpdate(bool active, const dbc_value_t& value, uint32_t seen_ms);
 void modeTriggerRuntimeReset();
 bool modeTriggerOverrideActive();
+bool modeTriggerRulesGet(mode_trigger_rules_t& rules, uint32_t timeout_ms = 0);
+bool modeTriggerRulesSet(const mode_trigger_rules_t& rules, uint32_t timeout_ms = 50);
+bool modeTriggerRuleKeysGet(mode_trigger_rule_keys_t& keys, uint32_t timeout_ms = 0);
+void modeTriggerRuleRuntimeUpdate(int8_t active_rule, uint32_t seen_ms);
+int8_t modeTriggerActiveRule(); // -1 when no rule is overriding the mode
 openhaldex_mode_t openhaldexEffectiveMode();
 bool openhaldexEffectiveBroadcastOpenHaldexOverCAN();
 const char* modeTriggerOperatorName(mode_trigger_operator_t op);
 bool modeTriggerOperatorFromString(const String& raw, mode_trigger_operator_t& op);
+const char* modeTriggerCombineName(mode_trigger_combine_t combine);
+bool modeTriggerCombineFromString(const String& raw, mode_trigger_combine_t& combine);
 
 extern bool modeTriggerSuppressed;
 
 #define DASHBOARD_SIGNAL_SLOT_COUNT 8
+#define MAPPED_SIGNAL_KEY_MAX 160 // longest signal key the config store keeps
 void dashboardSignalsInit();
 bool dashboardSignalsGet(String* slots, size_t count, uint32_t timeout_ms = 0);
 bool dashboardSignalsSet(const String* slots, size_t count, uint32_t timeout_ms = 50);
+// Slot keys as parsed when they were set; canview binds them to DBC signals once per config epoch.
+bool dashboardSignalKeysGet(mapped_signal_key_t* keys, size_t count, uint32_t timeout_ms = 0);
 
 extern long lastCANChassisTick;
 extern long lastCANHaldexTick;
@@ -189,6 +257,30 @@ extern uint16_t map_speed_bins[MAP_SPEED_BINS];
 extern uint8_t map_throttle_bins[MAP_THROTTLE_BINS];
 extern uint8_t map_lock_table[MAP_THROTTLE_BINS][MAP_SPEED_BINS];
 
+// Read-only snapshot of the curve/map tables used by the lock calculation.
+// Editors change the working arrays above, then call lockTablesPublish(); the CAN path only
+// ever sees whole published snapshots (RCU-style pointer swap, no lock on the read side).
+struct lock_tables_t {
+  uint8_t speed_curve_count;
+  uint16_t speed_curve_bins[CURVE_POINTS_MAX];
+  uint8_t speed_curve_lock[CURVE_POINTS_MAX];
+  uint8_t throttle_curve_count;
+  uint8_t throttle_curve_bins[CURVE_POINTS_MAX];
+  uint8_t throttle_curve_lock[CURVE_POINTS_MAX];
+  uint8_t rpm_curve_count;
+  uint16_t rpm_curve_bins[CURVE_POINTS_MAX];
+  uint8_t rpm_curve_lock[CURVE_POINTS_MAX];
+  uint16_t map_speed_bins[MAP_SPEED_BINS];
+  uint8_t map_throttle_bins[MAP_THROTTLE_BINS];
+  uint8_t map_lock_table[MAP_THROTTLE_BINS][MAP_SPEED_BINS];
+};
+
+void lockTablesInit();
+bool lockTablesPublish(uint32_t timeout_ms = 100);
+const lock_tables_t* lockTablesReadBegin();
+void lockTablesReadEnd();
+uint32_t lockTablesGeneration();
+
 // Debug stack markers
 extern uint32_t stackCHS;
 extern uint32_t stackHDX;
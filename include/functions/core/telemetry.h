@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+
+// One coherent copy of the live CAN telemetry. The chassis RX task is the only writer and publishes
+// it at OH_TELEMETRY_PUBLISH_MS; API, broadcast and learn code read the snapshot instead of the
+// individual globals the CAN tasks update.
+struct telemetry_snapshot_t {
+  uint32_t sequence; // publish count; 0 until the first publish
+  uint32_t publishedMs;
+  uint16_t speed;
+  uint16_t rpm;
+  uint16_t boost;
+  float throttle;
+  float lockTarget;
+  uint8_t haldexState;
+  uint8_t haldexEngagement;
+  uint8_t haldexEngagementRaw;
+  bool clutch1Report;
+  bool clutch2Report;
+  bool tempProtection;
+  bool couplingOpen;
+  bool speedLimit;
+  bool modeOverride;
+  float awdRequested;
+  float awdActual;
+};
+
+#ifndef OH_TELEMETRY_PUBLISH_MS
+#define OH_TELEMETRY_PUBLISH_MS 20
+#endif
+
+// Writer side (CAN core). Publishes only when the interval has elapsed; returns true when it did.
+bool telemetryPublishIfDue(uint32_t now_ms);
+void telemetryPublish(uint32_t now_ms);
+// Reader side (any core). Seqlock read; retries while a publish is in flight.
+void telemetryRead(telemetry_snapshot_t& out);
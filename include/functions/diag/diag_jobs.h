@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Diagnostic requests (UDS/KWP) run on one worker task so a multi-second transaction never blocks
+// the async web server. Handlers submit a job and get an ID back; clients poll for the result.
+// The same task runs the measured-value poller between jobs, so the two never contend for the bus.
+#define OH_DIAG_JOB_SLOTS 4
+#define OH_DIAG_JOB_ARG_MAX 16
+#define OH_DIAG_POLL_MAX 16
+#define OH_DIAG_POLL_DATA_MAX 64 // cached bytes per DID
+#define OH_DIAG_POLL_IDLE_INTERVALS 5 // unread cycles before the poller turns itself off
+#define OH_DIAG_POLL_IDLE_MIN_MS 10000
+
+enum diag_job_state_t : uint8_t {
+  DIAG_JOB_UNKNOWN = 0,
+  DIAG_JOB_QUEUED,
+  DIAG_JOB_RUNNING,
+  DIAG_JOB_DONE,
+};
+
+struct diag_job_args_t {
+  uint32_t values[OH_DIAG_JOB_ARG_MAX];
+  uint8_t count;
+};
+
+// Runs on the worker task; everything written to doc becomes the job result.
+typedef void (*diag_job_fn_t)(const diag_job_args_t& args, JsonDocument& doc);
+
+struct diag_job_info_t {
+  uint32_t id;
+  diag_job_state_t state;
+  const char* kind;
+  uint32_t ageMs;
+  uint32_t runMs;
+  uint8_t queuedAhead;
+  String result; // serialized JSON, set once state is DIAG_JOB_DONE
+};
+
+void diagJobsInit();
+// Returns the job ID, or 0 when every slot holds a queued or running job.
+uint32_t diagJobSubmit(const char* kind, diag_job_fn_t fn, const diag_job_args_t& args);
+bool diagJobGet(uint32_t id, diag_job_info_t& out);
+const char* diagJobStateName(diag_job_state_t state);
+void diagJobsWriteStatusJson(JsonObject out);
+
+// Gen 5 measured-value poller: reads a fixed DID set every intervalMs and caches the results.
+// Unless it is logging, it turns itself off once nobody has read the cache for
+// OH_DIAG_POLL_IDLE_INTERVALS cycles (and at least OH_DIAG_POLL_IDLE_MIN_MS), so a closed page
+// does not leave it occupying the bus.
+struct diag_poll_config_t {
+  bool enabled;
+  bool log; // also write each successful read to the CAN log
+  uint16_t intervalMs;
+  uint8_t count;
+  uint16_t dids[OH_DIAG_POLL_MAX];
+  uint16_t lengths[OH_DIAG_POLL_MAX]; // expected data bytes, 0 = unknown
+};
+
+void diagPollConfigGet(diag_poll_config_t& out);
+// Rejects intervals outside 200..60000 ms; a new DID set clears the cache.
+bool diagPollConfigSet(const diag_poll_config_t& in);
+void diagPollWriteJson(JsonObject out);
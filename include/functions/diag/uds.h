@@ -5,6 +5,7 @@
 #include <driver/twai.h>
 
 #define OH_UDS_MAX_PAYLOAD 256
+#define OH_UDS_DID_BATCH_MAX 8
 
 struct diag_uds_route_t {
   const char* name;
@@ -31,6 +32,31 @@ struct diag_uds_result_t {
   const diag_uds_route_t* route;
 };
 
+// ISO 15765-2 knobs. The block size and STmin are what we advertise in our own flow control;
+// N_Bs bounds the wait for the ECU's flow control, N_Cr the gap between its consecutive frames.
+struct diag_isotp_config_t {
+  uint8_t rxBlockSize; // 0 = send everything without further flow control
+  uint8_t rxStMin;     // raw encoding: 0x00-0x7F ms, 0xF1-0xF9 100-900 us
+  uint16_t nBsMs;
+  uint16_t nCrMs;
+};
+
+// One DID of a batched read. expectedLen (data bytes after the DID echo, from the measured-value
+// catalog) is what lets a combined 0x62 response be split; a DID with unknown length (0) can only be
+// the last one in a request.
+struct diag_uds_did_read_t {
+  uint16_t did;
+  uint16_t expectedLen;
+  bool ok;
+  bool batched;
+  bool negative;
+  uint8_t nrc;
+  const char* status;
+  const char* message;
+  uint16_t dataOffset; // into the caller's data buffer
+  uint16_t dataLen;
+};
+
 void diagUdsInit();
 
 // Called from the Haldex receive loop. Returns true when a frame belongs to an
@@ -39,11 +65,24 @@ bool diagUdsObserveHaldexFrame(const twai_message_t& frame);
 
 bool diagUdsProbeHaldex(diag_uds_result_t& out, uint32_t timeout_ms = 900);
 bool diagUdsReadDataByIdentifier(uint16_t did, diag_uds_result_t& out, uint32_t timeout_ms = 1200);
+// Packs up to OH_UDS_DID_BATCH_MAX DIDs per 0x22 request and splits the response. Falls back to one
+// DID per request when the module rejects the batch (NRC 0x13/0x31) or the response does not split
+// cleanly; those single reads record each DID's real length and which DIDs the module refuses, so
+// later batches split and leave refused DIDs out. Stops at a timeout or busy result. Returns the
+// number of DIDs read; last holds the final transaction.
+uint8_t diagUdsReadDataByIdentifiers(diag_uds_did_read_t* reads, uint8_t count, uint8_t* data, uint16_t data_size,
+                                     diag_uds_result_t& last, uint32_t timeout_ms = 1200);
 bool diagUdsReadDtcByStatus(uint8_t status_mask, diag_uds_result_t& out, uint32_t timeout_ms = 2500);
 bool diagUdsClearDtc(uint32_t group_of_dtc, diag_uds_result_t& out, uint32_t timeout_ms = 3000);
 bool diagKwpTp20ReadLocalIdentifier(uint8_t local_id, diag_uds_result_t& out, uint32_t timeout_ms = 5000);
 bool diagKwpTp20ClearDtc(uint32_t group_of_dtc, diag_uds_result_t& out, uint32_t timeout_ms = 5000);
+// KWP requests share one TP2.0 channel that stays open between them. Call periodically from the
+// diagnostic worker: sends channel tests and disconnects once idle. Returns the ms until the next
+// call is due, or 0 when no channel is open.
+uint32_t diagKwpTp20SessionService();
 
+void diagUdsIsoTpConfigGet(diag_isotp_config_t& out);
+bool diagUdsIsoTpConfigSet(const diag_isotp_config_t& in);
 bool diagUdsHasSelectedRoute();
 const diag_uds_route_t* diagUdsSelectedRoute();
 const char* diagUdsNrcName(uint8_t nrc);
@@ -16,8 +16,22 @@ void filelogLogWarn(const String& tag, const String& message);
 void filelogLogEvent(const String& tag, const String& message);
 void filelogLogError(const String& tag, const String& message);
 void filelogLogCanFrame(const twai_message_t& msg, uint8_t bus, uint8_t dir, bool generated);
+// Measured-value poll result, written to the CAN log in the same column layout as a Haldex RX frame.
+void filelogLogMeasuredValue(uint16_t did, const uint8_t* data, uint16_t len);
+
+// Byte window [start, end) of a log file resolved for streaming reads.
+struct filelog_range_t {
+  size_t start;
+  size_t end;
+  size_t size;
+  bool indexed;
+};
 
 void filelogList(JsonArray out);
 bool filelogRead(const String& path, String& out, size_t max_bytes = 32768);
+bool filelogResolveByteRange(const String& path, size_t from, size_t to, filelog_range_t& out);
+bool filelogResolveTimeRange(const String& path, uint32_t since_ms, uint32_t until_ms, filelog_range_t& out);
+// Returns false only when the logger is busy; read_len == 0 marks end of data.
+bool filelogReadChunk(const String& path, size_t offset, uint8_t* buffer, size_t max_len, size_t& read_len);
 bool filelogDelete(const String& path);
 bool filelogClearScope(const String& scope);
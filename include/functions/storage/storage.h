@@ -3,20 +3,35 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
+// Settings the power module needs before storageInit/storageLoad run.
+struct storage_boot_config_t {
+  uint8_t generation;
+  bool lowPowerSleepEnabled;
+  uint32_t lowPowerSleepDelayMs;
+  uint32_t lowPowerWakeTimerSeconds;
+  uint32_t lowPowerProbeDurationMs;
+};
+
 void storageInit();
 void storageLoad();
 void storageSave();
+bool storageReadBootConfig(storage_boot_config_t& out);
 
 bool storageFsReady();
 
 void storageMarkDirty();
 bool storageIsDirty();
 void storageClearDirty();
+uint32_t storageDirtyAgeMs();
+void storageWriteStatusJson(JsonObject out);
 
 bool storageLoadMapPath(const String& path);
 bool storageSaveMapName(const String& name, String& outPath);
 bool storageDeleteMapPath(const String& path);
 void storageListMaps(JsonArray out);
+bool storageExportMap(const String& path, bool asTxt, String& out);
+bool storageImportMapJson(const String& name, JsonVariantConst data, String& outPath);
+bool storageImportMapTxt(const String& name, const String& text, String& outPath);
 String storageGetCurrentMapPath();
 void storageSetCurrentMapPath(const String& path);
 
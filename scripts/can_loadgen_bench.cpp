@@ -0,0 +1,207 @@
+// Stress test for the bridge under synthetic chassis load: both buses are bound to can_hal_loadgen
+// (functions/can/can_loadgen.h), which plays a PQ or MQB chassis bus at the requested load into a
+// 2048-deep RX queue, and the bridge passes run once per 1 ms tick as parseCAN_chs/parseCAN_hdx do
+// with vTaskDelay(1). Time is virtual, so ten seconds of full-load traffic take a fraction of that.
+// One line per run reports bus load, RX drops and queue high-water mark, arrival-to-forward latency,
+// the largest burst one pass drained (the bridge yields every 64 frames) and host CPU per frame.
+//
+//   g++ -O2 -std=gnu++17 -DARDUINO=10800 -DOH_HOST=1 -Ihost/include -Iinclude
+//       -I.pio/libdeps/native/ArduinoJson/src scripts/can_loadgen_bench.cpp host/src/*.cpp
+//       src/functions/core/*.cpp src/functions/can/*.cpp src/functions/canview/*.cpp src/functions/diag/*.cpp
+//       -o can_loadgen_bench
+//   ./can_loadgen_bench --gen 1,5 --load 50,100
+//   ./can_loadgen_bench --gen 5 --load 100 --stall-ms 0
+//
+// Gen 1, 2 and 4 play the same PQ chassis mix, so one of them covers all three.
+// Each run holds the bridge off for --stall-ms (400 by default) one second in, as a blocked CAN task
+// would, so the backlog reaches well into the RX queue; a run whose high-water mark stays below a
+// quarter of the queue says so. PASS needs every run free of RX drops with every received chassis
+// frame forwarded.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+#include "functions/can/can.h"
+#include "functions/can/can_loadgen.h"
+#include "functions/canview/dbc_table.h"
+#include "functions/core/state.h"
+#include "functions/diag/uds.h"
+#include "host/clock.h"
+
+struct bench_options_t {
+  std::vector<int> generations;
+  std::vector<int> loads;
+  const char* mode = nullptr;
+  unsigned seconds = 10;
+  unsigned stallMs = 400;
+};
+
+static const uint64_t k_tick_us = 1000;
+static const uint64_t k_stall_at_us = 1000000ULL;
+static const uint16_t k_rx_burst_yield_frames = 64; // as in canBridgeChassisPass
+static const uint16_t k_rx_depth_exercised = CAN_LOADGEN_RX_QUEUE_LEN / 4;
+
+static uint64_t cpuNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool parseList(const char* text, std::vector<int>& out) {
+  out.clear();
+  const char* p = text;
+  while (*p) {
+    char* end = nullptr;
+    const long value = strtol(p, &end, 10);
+    if (end == p) {
+      return false;
+    }
+    out.push_back((int)value);
+    p = (*end == ',') ? end + 1 : end;
+  }
+  return !out.empty();
+}
+
+static bool setupBridge(const bench_options_t& options) {
+  if (options.mode) {
+    bool found = false;
+    for (int m = 0; m < openhaldex_mode_t_MAX; m++) {
+      if (strcasecmp(options.mode, get_openhaldex_mode_string((openhaldex_mode_t)m)) == 0) {
+        state.mode = (openhaldex_mode_t)m;
+        found = true;
+      }
+    }
+    if (!found) {
+      fprintf(stderr, "unknown mode %s\n", options.mode);
+      return false;
+    }
+  }
+
+  // Firmware boot order (main.cpp), minus storage; bus 0 starts generating once canInit begins it.
+  haldexGeneration = (uint8_t)options.generations.front();
+  mappedInputSignalsInit();
+  modeTriggerInit();
+  dashboardSignalsInit();
+  lockTablesInit();
+  (void)lockTablesPublish(50);
+  canHalSetBackend(0, &can_hal_loadgen);
+  canHalSetBackend(1, &can_hal_loadgen);
+  canInit();
+  dbcTablesInit();
+  diagUdsInit();
+  return can_ready;
+}
+
+static bool runOnce(const bench_options_t& options, int generation, int load) {
+  haldexGeneration = (uint8_t)generation;
+  if (!canLoadgenConfigure((uint8_t)generation, (uint8_t)load) || !canHalBegin(0, TWAI_MODE_NO_ACK)) {
+    fprintf(stderr, "cannot generate gen=%d load=%d\n", generation, load);
+    return false;
+  }
+
+  uint64_t cpu_ns = 0;
+  uint32_t max_burst = 0;
+  uint32_t yields = 0;
+  can_loadgen_stats_t stats = {};
+  const uint64_t start_us = hostClockUs();
+  const uint64_t stop_us = start_us + (uint64_t)options.seconds * 1000000ULL;
+  for (uint64_t now_us = start_us + k_tick_us; now_us <= stop_us; now_us += k_tick_us) {
+    hostClockAdvanceTo(now_us);
+    const uint64_t since_start = now_us - start_us;
+    if (since_start >= k_stall_at_us && since_start < k_stall_at_us + options.stallMs * 1000ULL) {
+      continue;
+    }
+    canLoadgenGetStats(stats);
+    const uint32_t received_before = stats.received;
+    const uint64_t started_ns = cpuNs();
+    canBridgeChassisPass();
+    canBridgeHaldexPass();
+    cpu_ns += cpuNs() - started_ns;
+    canLoadgenGetStats(stats);
+    const uint32_t burst = stats.received - received_before;
+    yields += burst / k_rx_burst_yield_frames;
+    if (burst > max_burst) {
+      max_burst = burst;
+    }
+  }
+
+  canLoadgenGetStats(stats);
+  const double bus_load = stats.elapsedUs ? 100.0 * stats.busyUs / stats.elapsedUs : 0.0;
+  printf("loadgen gen=%d load=%u native=%.1f bus_load=%.1f frames=%u overwritten=%u rx=%u rx_dropped=%u "
+         "rx_high_water=%u forwarded=%u latency_avg_us=%.0f latency_p50_us=%u latency_p99_us=%u "
+         "latency_max_us=%u max_burst=%u burst_yields=%u cpu_ns_per_frame=%.0f\n",
+         generation, stats.loadPercent, canLoadgenNativeLoad((uint8_t)generation), bus_load, stats.generated,
+         stats.overwritten, stats.received, stats.rxDropped, stats.rxHighWater, stats.forwarded,
+         stats.forwarded ? (double)stats.latencySumUs / stats.forwarded : 0.0,
+         canLoadgenLatencyPercentileUs(stats, 50), canLoadgenLatencyPercentileUs(stats, 99), stats.latencyMaxUs,
+         max_burst, yields, stats.received ? (double)cpu_ns / stats.received : 0.0);
+  if (stats.rxHighWater < k_rx_depth_exercised) {
+    printf("note: rx queue peaked at %u of %u frames; queue depth not exercised (raise --stall-ms)\n",
+           stats.rxHighWater, (unsigned)CAN_LOADGEN_RX_QUEUE_LEN);
+  }
+  return stats.rxDropped == 0 && stats.forwarded == stats.received;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: can_loadgen_bench [--gen N[,N...]] [--load PCT[,PCT...]] [--seconds S] [--mode NAME]\n"
+                  "                         [--stall-ms MS]\n");
+}
+
+static bool parseArgs(int argc, char** argv, bench_options_t& options) {
+  options.generations = {5};
+  options.loads = {100};
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const bool has_value = (i + 1) < argc;
+    if (strcmp(arg, "--gen") == 0 && has_value) {
+      if (!parseList(argv[++i], options.generations)) {
+        return false;
+      }
+    } else if (strcmp(arg, "--load") == 0 && has_value) {
+      if (!parseList(argv[++i], options.loads)) {
+        return false;
+      }
+    } else if (strcmp(arg, "--seconds") == 0 && has_value) {
+      options.seconds = (unsigned)strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(arg, "--mode") == 0 && has_value) {
+      options.mode = argv[++i];
+    } else if (strcmp(arg, "--stall-ms") == 0 && has_value) {
+      options.stallMs = (unsigned)strtoul(argv[++i], nullptr, 10);
+    } else {
+      return false;
+    }
+  }
+  return options.seconds > 0;
+}
+
+int main(int argc, char** argv) {
+  bench_options_t options;
+  if (!parseArgs(argc, argv, options)) {
+    usage();
+    return 2;
+  }
+
+  hostClockReset();
+  // Start away from millis() == 0, which the firmware reads as "never".
+  hostClockAdvanceTo(1000000ULL);
+  if (!setupBridge(options)) {
+    fprintf(stderr, "bridge setup failed\n");
+    return 2;
+  }
+
+  bool ok = true;
+  for (int generation : options.generations) {
+    for (int load : options.loads) {
+      if (!runOnce(options, generation, load)) {
+        ok = false;
+      }
+    }
+  }
+  canDeinit();
+  printf("%s\n", ok ? "PASS" : "FAIL");
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,423 @@
+// Replays recorded CAN traffic through the real bridge pipeline on the host: chassis frames go through
+// canBridgeChassisPass() (parseCAN_chs, getLockData, haldex_can_send) and Haldex frames through
+// canBridgeHaldexPass(), on the loopback host CAN backend. Every frame the bridge sends and every lock
+// target change is written out in the CAN View dump columns, so two runs (or a run and a golden file)
+// diff line by line. Throughput and per-frame CPU time go to stderr.
+//
+//   g++ -O2 -std=gnu++17 -DARDUINO=10800 -DOH_HOST=1 -Ihost/include -Iinclude
+//       -I.pio/libdeps/native/ArduinoJson/src scripts/can_replay.cpp host/src/*.cpp
+//       src/functions/core/*.cpp src/functions/can/*.cpp src/functions/canview/*.cpp src/functions/diag/*.cpp
+//       -o can_replay
+//   ./can_replay --gen 4 --mode 5050 trace.txt > out.txt
+//   ./can_replay --gen 4 --mode 5050 --golden golden.txt trace.txt
+//
+// Input formats, detected per line: the CAN View dump (/api/canview/dump), the CAN text log written
+// by the file logger, and candump -l / candump -ta output. Dump and log files carry both directions;
+// only RX frames are replayed. candump frames are chassis traffic unless their interface matches
+// --haldex-if. By default frames run back to back in virtual time (timestamps still drive millis());
+// --realtime paces them at their recorded spacing.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "functions/can/can.h"
+#include "functions/canview/dbc_table.h"
+#include "functions/core/state.h"
+#include "functions/diag/uds.h"
+#include "host/can_host.h"
+#include "host/clock.h"
+
+struct replay_frame_t {
+  uint64_t tsUs; // as recorded, converted to microseconds
+  uint8_t bus;
+  twai_message_t msg;
+};
+
+struct replay_options_t {
+  int generation = 4;
+  const char* mode = nullptr;
+  bool standalone = false;
+  bool realtime = false;
+  unsigned repeat = 1;
+  const char* haldexIf = nullptr;
+  const char* outPath = nullptr;
+  const char* goldenPath = nullptr;
+  std::vector<const char*> traces;
+};
+
+// Gap in front of every run, so that no replayed frame lands on millis() == 0 (used as "never").
+static const uint64_t k_replay_start_us = 1000000ULL;
+
+static bool parseHexBytes(const char* text, twai_message_t& msg, uint8_t dlc) {
+  uint8_t count = 0;
+  const char* p = text;
+  while (*p && count < 8) {
+    while (*p == ' ' || *p == '\t') {
+      p++;
+    }
+    if (!isxdigit((unsigned char)p[0]) || !isxdigit((unsigned char)p[1])) {
+      break;
+    }
+    char byte[3] = {p[0], p[1], 0};
+    msg.data[count++] = (uint8_t)strtoul(byte, nullptr, 16);
+    p += 2;
+  }
+  msg.data_length_code = count;
+  return count == dlc;
+}
+
+static void setIdentifier(twai_message_t& msg, uint32_t id, bool extended) {
+  msg.identifier = id;
+  msg.extd = (extended || id > 0x7FF) ? 1 : 0;
+}
+
+static std::vector<std::string> splitTabs(const std::string& line) {
+  std::vector<std::string> fields;
+  size_t start = 0;
+  while (true) {
+    const size_t tab = line.find('\t', start);
+    fields.push_back(line.substr(start, tab == std::string::npos ? std::string::npos : tab - start));
+    if (tab == std::string::npos) {
+      return fields;
+    }
+    start = tab + 1;
+  }
+}
+
+// CAN View dump: ts_ms bus dir gen id dlc data. CAN log: the same after a "CAN" column.
+static bool parseDumpOrLog(const std::string& line, replay_frame_t& out) {
+  std::vector<std::string> f = splitTabs(line);
+  if (f.size() == 8 && f[1] == "CAN") {
+    f.erase(f.begin() + 1);
+  }
+  if (f.size() != 7 || f[0].empty() || !isdigit((unsigned char)f[0][0]) || f[2] != "RX") {
+    return false;
+  }
+  if (f[1] != "chassis" && f[1] != "haldex") {
+    return false;
+  }
+  out = {};
+  out.tsUs = strtoull(f[0].c_str(), nullptr, 10) * 1000ULL;
+  out.bus = (f[1] == "haldex") ? 1 : 0;
+  setIdentifier(out.msg, (uint32_t)strtoul(f[4].c_str(), nullptr, 16), false);
+  const uint8_t dlc = (uint8_t)strtoul(f[5].c_str(), nullptr, 10);
+  return dlc <= 8 && parseHexBytes(f[6].c_str(), out.msg, dlc);
+}
+
+// candump -l: "(1436509052.249713) can0 123#DEADBEEF"
+// candump -ta: "(1436509052.249713)  can0  123   [4]  DE AD BE EF"
+static bool parseCandump(const std::string& line, const char* haldex_if, replay_frame_t& out) {
+  const char* p = line.c_str();
+  while (*p == ' ') {
+    p++;
+  }
+  if (*p != '(') {
+    return false;
+  }
+  char* end = nullptr;
+  const double seconds = strtod(p + 1, &end);
+  if (!end || *end != ')') {
+    return false;
+  }
+  char iface[32] = {};
+  char frame[64] = {};
+  int consumed = 0;
+  if (sscanf(end + 1, " %31s %63s %n", iface, frame, &consumed) < 2) {
+    return false;
+  }
+
+  out = {};
+  out.tsUs = (uint64_t)(seconds * 1000000.0 + 0.5);
+  out.bus = (haldex_if && strcmp(iface, haldex_if) == 0) ? 1 : 0;
+
+  const char* hash = strchr(frame, '#');
+  if (hash) {
+    const size_t id_len = (size_t)(hash - frame);
+    setIdentifier(out.msg, (uint32_t)strtoul(frame, nullptr, 16), id_len > 3);
+    if (hash[1] == 'R') {
+      out.msg.rtr = 1;
+      return true;
+    }
+    const uint8_t dlc = (uint8_t)(strlen(hash + 1) / 2);
+    return dlc <= 8 && parseHexBytes(hash + 1, out.msg, dlc);
+  }
+
+  setIdentifier(out.msg, (uint32_t)strtoul(frame, nullptr, 16), strlen(frame) > 3);
+  const char* rest = end + 1 + consumed;
+  unsigned dlc = 0;
+  int dlc_len = 0;
+  if (sscanf(rest, " [%u]%n", &dlc, &dlc_len) < 1 || dlc > 8) {
+    return false;
+  }
+  return parseHexBytes(rest + dlc_len, out.msg, (uint8_t)dlc);
+}
+
+static bool loadTrace(const char* path, const char* haldex_if, std::vector<replay_frame_t>& frames) {
+  FILE* fp = fopen(path, "r");
+  if (!fp) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+  char buf[512];
+  size_t skipped = 0;
+  const size_t first = frames.size();
+  while (fgets(buf, sizeof(buf), fp)) {
+    std::string line(buf);
+    while (!line.empty() && (line.back() == '\n' || line.back() == '\r')) {
+      line.pop_back();
+    }
+    replay_frame_t frame;
+    if (parseDumpOrLog(line, frame) || parseCandump(line, haldex_if, frame)) {
+      frames.push_back(frame);
+    } else if (!line.empty()) {
+      skipped++;
+    }
+  }
+  fclose(fp);
+  fprintf(stderr, "%s: %zu frames, %zu other lines\n", path, frames.size() - first, skipped);
+  return true;
+}
+
+static void formatFrame(std::string& out, uint32_t ts_ms, uint8_t bus, const twai_message_t& msg, bool generated) {
+  char line[96];
+  int n = snprintf(line, sizeof(line), "%lu\t%s\tTX\t%s\t0x%lx\t%u\t", (unsigned long)ts_ms,
+                   bus == 0 ? "chassis" : "haldex", generated ? "GEN" : "-", (unsigned long)msg.identifier,
+                   msg.data_length_code);
+  for (uint8_t i = 0; i < msg.data_length_code && i < 8; i++) {
+    n += snprintf(line + n, sizeof(line) - n, i ? " %02x" : "%02x", msg.data[i]);
+  }
+  out += line;
+  out += "\n";
+}
+
+static bool sameFrame(const twai_message_t& a, const twai_message_t& b) {
+  return a.identifier == b.identifier && a.data_length_code == b.data_length_code &&
+         memcmp(a.data, b.data, a.data_length_code) == 0;
+}
+
+static uint64_t cpuNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static bool setupBridge(const replay_options_t& options) {
+  haldexGeneration = (uint8_t)options.generation;
+  isStandalone = options.standalone;
+  if (options.mode) {
+    bool found = false;
+    for (int m = 0; m < openhaldex_mode_t_MAX; m++) {
+      if (strcasecmp(options.mode, get_openhaldex_mode_string((openhaldex_mode_t)m)) == 0) {
+        state.mode = (openhaldex_mode_t)m;
+        found = true;
+      }
+    }
+    if (!found) {
+      fprintf(stderr, "unknown mode %s\n", options.mode);
+      return false;
+    }
+  }
+
+  // Firmware boot order (main.cpp), minus storage: settings stay at their compiled-in defaults.
+  mappedInputSignalsInit();
+  modeTriggerInit();
+  dashboardSignalsInit();
+  lockTablesInit();
+  (void)lockTablesPublish(50);
+  canHostConfigure(0, "loopback");
+  canHostConfigure(1, "loopback");
+  canInit();
+  dbcTablesInit();
+  diagUdsInit();
+  return can_ready;
+}
+
+// Runs the trace once; returns the recorded output. Only the bridge passes count towards cpu_ns.
+static std::string replayOnce(const std::vector<replay_frame_t>& frames, const replay_options_t& options,
+                              uint64_t& cpu_ns) {
+  std::string out;
+  out.reserve(frames.size() * 48);
+  float last_lock = -1.0f;
+  const uint64_t first_us = frames.empty() ? 0 : frames.front().tsUs;
+
+  hostClockAdvanceTo(hostClockUs() + k_replay_start_us);
+  if (options.realtime) {
+    hostClockSetRealTime(true);
+  }
+  const uint64_t base_us = hostClockUs();
+  for (const replay_frame_t& frame : frames) {
+    const uint64_t due_us = base_us + (frame.tsUs >= first_us ? frame.tsUs - first_us : 0);
+    if (options.realtime) {
+      if (due_us > hostClockUs()) {
+        hostClockSleepUs(due_us - hostClockUs());
+      }
+    } else {
+      hostClockAdvanceTo(due_us);
+    }
+
+    if (!canHostInject(frame.bus, frame.msg)) {
+      out += "# rx queue full\n";
+      continue;
+    }
+    const uint64_t started_ns = cpuNs();
+    if (frame.bus == 0) {
+      canBridgeChassisPass();
+    } else {
+      canBridgeHaldexPass();
+    }
+    cpu_ns += cpuNs() - started_ns;
+
+    const uint32_t ts_ms = (uint32_t)((due_us - base_us) / 1000ULL);
+    for (uint8_t bus = 0; bus < 2; bus++) {
+      twai_message_t sent = {};
+      while (canHostTake(bus, sent)) {
+        // Frames forwarded unchanged are marked "-", rewritten ones GEN, as in the CAN View dump.
+        formatFrame(out, ts_ms, bus, sent, !sameFrame(sent, frame.msg));
+      }
+    }
+    if (lock_target != last_lock) {
+      char line[48];
+      snprintf(line, sizeof(line), "%lu\tlock\t%.2f\n", (unsigned long)ts_ms, lock_target);
+      out += line;
+      last_lock = lock_target;
+    }
+  }
+  if (options.realtime) {
+    hostClockSetRealTime(false);
+  }
+  return out;
+}
+
+static bool compareGolden(const std::string& output, const char* path) {
+  FILE* fp = fopen(path, "r");
+  if (!fp) {
+    fprintf(stderr, "cannot open golden %s\n", path);
+    return false;
+  }
+  std::string golden;
+  char buf[4096];
+  size_t n = 0;
+  while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+    golden.append(buf, n);
+  }
+  fclose(fp);
+  if (golden == output) {
+    return true;
+  }
+
+  size_t line_no = 1;
+  size_t pos = 0;
+  while (pos < output.size() && pos < golden.size() && output[pos] == golden[pos]) {
+    if (output[pos] == '\n') {
+      line_no++;
+    }
+    pos++;
+  }
+  const size_t out_start = output.rfind('\n', pos ? pos - 1 : 0);
+  const size_t gold_start = golden.rfind('\n', pos ? pos - 1 : 0);
+  const size_t out_from = (out_start == std::string::npos || pos == 0) ? 0 : out_start + 1;
+  const size_t gold_from = (gold_start == std::string::npos || pos == 0) ? 0 : gold_start + 1;
+  fprintf(stderr, "golden mismatch at line %zu\n  expected: %s\n  actual:   %s\n", line_no,
+          golden.substr(gold_from, golden.find('\n', gold_from) - gold_from).c_str(),
+          output.substr(out_from, output.find('\n', out_from) - out_from).c_str());
+  return false;
+}
+
+static void usage() {
+  fprintf(stderr, "usage: can_replay [--gen N] [--mode NAME] [--standalone] [--realtime] [--repeat N]\n"
+                  "                  [--haldex-if IFACE] [--out FILE] [--golden FILE] trace...\n");
+}
+
+static bool parseArgs(int argc, char** argv, replay_options_t& options) {
+  for (int i = 1; i < argc; i++) {
+    const char* arg = argv[i];
+    const bool has_value = (i + 1) < argc;
+    if (strcmp(arg, "--gen") == 0 && has_value) {
+      options.generation = atoi(argv[++i]);
+    } else if (strcmp(arg, "--mode") == 0 && has_value) {
+      options.mode = argv[++i];
+    } else if (strcmp(arg, "--standalone") == 0) {
+      options.standalone = true;
+    } else if (strcmp(arg, "--realtime") == 0) {
+      options.realtime = true;
+    } else if (strcmp(arg, "--repeat") == 0 && has_value) {
+      options.repeat = (unsigned)strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(arg, "--haldex-if") == 0 && has_value) {
+      options.haldexIf = argv[++i];
+    } else if (strcmp(arg, "--out") == 0 && has_value) {
+      options.outPath = argv[++i];
+    } else if (strcmp(arg, "--golden") == 0 && has_value) {
+      options.goldenPath = argv[++i];
+    } else if (arg[0] == '-') {
+      return false;
+    } else {
+      options.traces.push_back(arg);
+    }
+  }
+  return !options.traces.empty() && options.repeat > 0;
+}
+
+int main(int argc, char** argv) {
+  replay_options_t options;
+  if (!parseArgs(argc, argv, options)) {
+    usage();
+    return 2;
+  }
+
+  std::vector<replay_frame_t> frames;
+  for (const char* path : options.traces) {
+    if (!loadTrace(path, options.haldexIf, frames)) {
+      return 2;
+    }
+  }
+
+  hostClockReset();
+  if (!setupBridge(options)) {
+    fprintf(stderr, "bridge setup failed\n");
+    return 2;
+  }
+
+  // Later repeats only add timing samples; the bridge state carries over as it would on the car.
+  uint64_t cpu_ns = 0;
+  const uint64_t harness_start_ns = cpuNs();
+  const std::string output = replayOnce(frames, options, cpu_ns);
+  for (unsigned i = 1; i < options.repeat; i++) {
+    (void)replayOnce(frames, options, cpu_ns);
+  }
+  const uint64_t harness_ns = cpuNs() - harness_start_ns;
+
+  const uint64_t replayed = (uint64_t)frames.size() * options.repeat;
+  fprintf(stderr, "replay frames=%llu repeat=%u cpu_ns_per_frame=%.0f bridge_frames_per_s=%.0f harness_ns=%llu\n",
+          (unsigned long long)frames.size(), options.repeat, replayed ? (double)cpu_ns / replayed : 0.0,
+          cpu_ns ? replayed * 1e9 / cpu_ns : 0.0, (unsigned long long)harness_ns);
+  can_host_stats_t chassis = {};
+  can_host_stats_t haldex = {};
+  canHostGetStats(0, chassis);
+  canHostGetStats(1, haldex);
+  fprintf(stderr, "bus chassis rx=%u tx=%u haldex rx=%u tx=%u\n", chassis.rx, chassis.tx, haldex.rx, haldex.tx);
+
+  if (options.outPath) {
+    FILE* fp = fopen(options.outPath, "w");
+    if (!fp) {
+      fprintf(stderr, "cannot write %s\n", options.outPath);
+      return 2;
+    }
+    fwrite(output.data(), 1, output.size(), fp);
+    fclose(fp);
+  } else if (!options.goldenPath) {
+    fwrite(output.data(), 1, output.size(), stdout);
+  }
+
+  if (options.goldenPath) {
+    const bool match = compareGolden(output, options.goldenPath);
+    printf("%s\n", match ? "PASS" : "FAIL");
+    return match ? 0 : 1;
+  }
+  return 0;
+}
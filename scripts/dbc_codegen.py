@@ -0,0 +1,231 @@
+"""Generate the compiled chassis DBC tables from the .dbc sources.
+
+Runs as a PlatformIO pre-script and regenerates a table only when its .dbc is newer than the
+generated .cpp (or the content differs). Can also be run by hand: python scripts/dbc_codegen.py
+"""
+
+from pathlib import Path
+import re
+import sys
+
+try:
+    Import("env")
+    project_dir = Path(env["PROJECT_DIR"])
+except NameError:
+    project_dir = Path(__file__).resolve().parent.parent
+
+CANVIEW_DIR = project_dir / "src" / "functions" / "canview"
+
+# (dbc source, generated translation unit, header, symbol prefix)
+TABLES = [
+    ("vw_mqb.dbc", "vw_mqb_chassis_dbc.cpp", "vw_mqb_chassis_dbc.h", "k_vw_mqb_chassis"),
+    ("vw_pq.dbc", "vw_pq_chassis_dbc.cpp", "vw_pq_chassis_dbc.h", "k_vw_pq_chassis"),
+]
+
+# Must match dbc_name_hash() in include/functions/canview/dbc_common.h.
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+SEED_MIX = 0x9E3779B1
+MAX_SEED = 0xFFFF
+
+BO_RE = re.compile(r"^BO_\s+(\d+)\s+(\w+)\s*:")
+SG_RE = re.compile(
+    r"^SG_\s+(\w+)\s*(M|m\d+M?)?\s*:\s*(\d+)\|(\d+)@([01])([+-])\s*"
+    r"\(\s*([^,]+),\s*([^)]+)\)\s*\[\s*([^|]+)\|([^\]]+)\]\s*\"([^\"]*)\""
+)
+
+
+def dbc_name_hash(frame_id, name, seed):
+    h = (FNV_OFFSET ^ ((seed * SEED_MIX) & 0xFFFFFFFF)) & 0xFFFFFFFF
+    for i in range(4):
+        h ^= (frame_id >> (8 * i)) & 0xFF
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    for b in name.encode("ascii", "replace"):
+        h ^= b
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def normalize_name(name):
+    # Same token the mapping keys use: underscores to spaces, trimmed, lowercase.
+    return name.replace("_", " ").strip().lower()
+
+
+def parse_dbc(path):
+    signals = []
+    frame_id = None
+    for line_no, raw in enumerate(path.read_text(encoding="latin-1").splitlines(), 1):
+        line = raw.strip()
+        m = BO_RE.match(line)
+        if m:
+            raw_id = int(m.group(1))
+            # 0xC0000000 is the DBC pseudo-frame for unassigned signals.
+            frame_id = None if raw_id == 0xC0000000 else (raw_id & 0x1FFFFFFF)
+            continue
+        if not line.startswith("SG_ "):
+            continue
+        m = SG_RE.match(line)
+        if not m or frame_id is None:
+            raise ValueError("%s:%d: unsupported signal line" % (path.name, line_no))
+        mux_token = m.group(2) or ""
+        if mux_token == "M":
+            mux = -2
+        elif mux_token.startswith("m"):
+            mux = int(mux_token[1:].rstrip("M"))
+        else:
+            mux = -1
+        signals.append(
+            {
+                "id": frame_id,
+                "name": m.group(1),
+                "start": int(m.group(3)),
+                "length": int(m.group(4)),
+                "little": int(m.group(5)),
+                "signed": 1 if m.group(6) == "-" else 0,
+                "factor": float(m.group(7)),
+                "offset": float(m.group(8)),
+                "min": float(m.group(9)),
+                "max": float(m.group(10)),
+                "unit": m.group(11),
+                "mux": mux,
+                "order": len(signals),
+            }
+        )
+    # Sorted by frame ID; DBC order is kept inside a frame.
+    signals.sort(key=lambda s: (s["id"], s["order"]))
+    return signals
+
+
+def build_frames(signals):
+    frames = []
+    for index, sig in enumerate(signals):
+        if not frames or frames[-1]["id"] != sig["id"]:
+            frames.append({"id": sig["id"], "first": index, "count": 0, "mux": -1})
+        frame = frames[-1]
+        if sig["mux"] == -2 and frame["mux"] < 0:
+            frame["mux"] = frame["count"]
+        frame["count"] += 1
+    return frames
+
+
+def build_name_hash(signals):
+    """Hash-and-displace minimal perfect hash over (frame ID, normalized name)."""
+    keys = {}
+    for index, sig in enumerate(signals):
+        # Duplicate names inside a frame keep the first; the runtime falls back to a range scan on a unit mismatch.
+        keys.setdefault((sig["id"], normalize_name(sig["name"])), index)
+    items = list(keys.items())
+    slot_count = len(items)
+
+    bucket_count = max(1, (slot_count + 3) // 4)
+    while True:
+        buckets = [[] for _ in range(bucket_count)]
+        for key, index in items:
+            buckets[dbc_name_hash(key[0], key[1], 0) % bucket_count].append((key, index))
+        seeds = [0] * bucket_count
+        slots = [0xFFFF] * slot_count
+        ok = True
+        for bucket_index in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+            bucket = buckets[bucket_index]
+            if not bucket:
+                continue
+            for seed in range(1, MAX_SEED + 1):
+                picked = [dbc_name_hash(k[0], k[1], seed) % slot_count for k, _ in bucket]
+                if len(set(picked)) == len(picked) and all(slots[p] == 0xFFFF for p in picked):
+                    for p, (_, index) in zip(picked, bucket):
+                        slots[p] = index
+                    seeds[bucket_index] = seed
+                    break
+            else:
+                ok = False
+                break
+        if ok:
+            return seeds, slots
+        bucket_count *= 2
+
+
+def c_float(value):
+    text = repr(float(value))
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def c_string(value):
+    return '"' + value.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def render_u16_rows(values, indent="  ", per_line=16):
+    rows = []
+    for i in range(0, len(values), per_line):
+        rows.append(indent + ", ".join(str(v) for v in values[i : i + per_line]) + ",")
+    return "\n".join(rows)
+
+
+def render_table(source, header, prefix, signals):
+    frames = build_frames(signals)
+    seeds, slots = build_name_hash(signals)
+    out = []
+    out.append("// Generated by scripts/dbc_codegen.py from %s; do not edit by hand." % source)
+    out.append('#include "functions/canview/%s"' % header)
+    out.append("")
+    out.append("constexpr dbc_signal_t %s_signals[] = {" % prefix)
+    for sig in signals:
+        out.append(
+            "  {%d, %s, %d, %d, %d, %d, %s, %s, %s, %s, %s, %d},"
+            % (
+                sig["id"],
+                c_string(sig["name"]),
+                sig["start"],
+                sig["length"],
+                sig["little"],
+                sig["signed"],
+                c_float(sig["factor"]),
+                c_float(sig["offset"]),
+                c_float(sig["min"]),
+                c_float(sig["max"]),
+                c_string(sig["unit"]),
+                sig["mux"],
+            )
+        )
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t %s_signal_count = (uint16_t)(sizeof(%s_signals) / sizeof(%s_signals[0]));" % (prefix, prefix, prefix))
+    out.append("")
+    out.append("constexpr dbc_frame_index_t %s_frames[] = {" % prefix)
+    for frame in frames:
+        out.append("  {%d, %d, %d, %d}," % (frame["id"], frame["first"], frame["count"], frame["mux"]))
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t %s_frame_count = (uint16_t)(sizeof(%s_frames) / sizeof(%s_frames[0]));" % (prefix, prefix, prefix))
+    out.append("")
+    out.append("static constexpr uint16_t k_name_hash_seeds[] = {")
+    out.append(render_u16_rows(seeds))
+    out.append("};")
+    out.append("")
+    out.append("static constexpr uint16_t k_name_hash_slots[] = {")
+    out.append(render_u16_rows(slots))
+    out.append("};")
+    out.append("")
+    out.append("const dbc_name_hash_t %s_name_hash = {k_name_hash_seeds, %d, k_name_hash_slots, %d};" % (prefix, len(seeds), len(slots)))
+    out.append("")
+    return "\n".join(out)
+
+
+def generate(force=False):
+    for source, target, header, prefix in TABLES:
+        source_path = CANVIEW_DIR / source
+        target_path = CANVIEW_DIR / target
+        if not source_path.exists():
+            print("dbc_codegen: %s missing, keeping %s" % (source, target))
+            continue
+        if not force and target_path.exists() and target_path.stat().st_mtime >= source_path.stat().st_mtime:
+            continue
+        text = render_table(source, header, prefix, parse_dbc(source_path))
+        if target_path.exists() and target_path.read_text(encoding="utf-8") == text:
+            continue
+        target_path.write_text(text, encoding="utf-8", newline="\n")
+        print("dbc_codegen: wrote %s" % target)
+
+
+generate(force=(__name__ == "__main__" and "--force" in sys.argv))
@@ -0,0 +1,175 @@
+// Host microbenchmark for DBC signal extraction over every signal of both compiled chassis tables.
+// Checks the planned extractors against a bit-by-bit reference, then times them against the old
+// byte/bit loop.
+//
+//   g++ -O2 -std=gnu++17 -Iinclude scripts/dbc_extract_bench.cpp src/functions/canview/vw_mqb_chassis_dbc.cpp
+//       src/functions/canview/vw_pq_chassis_dbc.cpp -o dbc_extract_bench && ./dbc_extract_bench
+
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#include "functions/canview/vw_mqb_chassis_dbc.h"
+#include "functions/canview/vw_pq_chassis_dbc.h"
+
+static const size_t FRAME_COUNT = 256;
+static const int ROUNDS = 200;
+
+// DBC definition, one bit at a time: Intel counts up from start_bit, Motorola walks the sawtooth
+// down from the MSB at start_bit.
+static uint64_t reference_extract(const uint8_t* data, uint16_t start_bit, uint8_t length, uint8_t is_little_endian) {
+  if (length == 0 || length > 64 || start_bit > 63) {
+    return 0;
+  }
+  uint64_t raw = 0;
+  if (is_little_endian) {
+    for (uint8_t i = 0; i < length; i++) {
+      const unsigned pos = start_bit + i;
+      if (pos > 63) {
+        break;
+      }
+      raw |= (uint64_t)((data[pos / 8] >> (pos % 8)) & 1U) << i;
+    }
+    return raw;
+  }
+  int byte = start_bit / 8;
+  int bit = start_bit % 8;
+  for (uint8_t i = 0; i < length; i++) {
+    if (byte > 7) {
+      return 0;
+    }
+    raw = (raw << 1) | ((data[byte] >> bit) & 1U);
+    if (bit == 0) {
+      byte++;
+      bit = 7;
+    } else {
+      bit--;
+    }
+  }
+  return raw;
+}
+
+// The previous dbc_extract_raw(): word assembled byte by byte, Motorola walked bit by bit.
+static uint64_t legacy_extract(const uint8_t* data, uint16_t start_bit, uint8_t length, uint8_t is_little_endian) {
+  if (length == 0 || length > 64) {
+    return 0;
+  }
+  if (is_little_endian) {
+    uint64_t raw = 0;
+    for (uint8_t i = 0; i < 8; i++) {
+      raw |= ((uint64_t)data[i]) << (8U * i);
+    }
+    raw >>= start_bit;
+    if (length == 64) {
+      return raw;
+    }
+    return raw & ((1ULL << length) - 1ULL);
+  }
+  uint64_t raw = 0;
+  for (uint16_t i = 0; i < length; i++) {
+    int bit_index = (int)start_bit - (int)i;
+    if (bit_index < 0) {
+      return 0;
+    }
+    int byte_index = bit_index / 8;
+    int bit_in_byte = 7 - (bit_index % 8);
+    uint8_t bit = (data[byte_index] >> bit_in_byte) & 0x1;
+    raw = (raw << 1) | bit;
+  }
+  return raw;
+}
+
+struct bench_table_t {
+  const char* name;
+  const dbc_signal_t* signals;
+  uint16_t count;
+};
+
+static uint64_t sink = 0;
+
+template <typename Fn>
+static double time_ns_per_signal(const bench_table_t& table, const std::vector<uint8_t>& frames, Fn fn) {
+  const auto started = std::chrono::steady_clock::now();
+  uint64_t acc = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    for (size_t f = 0; f < FRAME_COUNT; f++) {
+      const uint8_t* data = &frames[f * 8];
+      for (uint16_t i = 0; i < table.count; i++) {
+        acc += fn(data, i);
+      }
+    }
+  }
+  sink += acc;
+  const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - started).count();
+  return ns / ((double)ROUNDS * FRAME_COUNT * table.count);
+}
+
+int main() {
+  const bench_table_t tables[] = {
+    {"mqb", k_vw_mqb_chassis_signals, k_vw_mqb_chassis_signal_count},
+    {"pq", k_vw_pq_chassis_signals, k_vw_pq_chassis_signal_count},
+  };
+
+  std::vector<uint8_t> frames(FRAME_COUNT * 8);
+  uint32_t lcg = 0x12345678;
+  for (size_t i = 0; i < frames.size(); i++) {
+    lcg = lcg * 1664525U + 1013904223U;
+    frames[i] = (uint8_t)(lcg >> 24);
+  }
+
+  int failures = 0;
+  for (const bench_table_t& table : tables) {
+    std::vector<dbc_extract_plan_t> plans(table.count);
+    unsigned kinds[6] = {};
+    for (uint16_t i = 0; i < table.count; i++) {
+      const dbc_signal_t& sig = table.signals[i];
+      plans[i] = dbc_plan_extract(sig.start_bit, sig.length, sig.is_little_endian);
+      kinds[plans[i].kind]++;
+    }
+
+    unsigned mismatches = 0;
+    unsigned legacy_diffs = 0;
+    std::vector<bool> legacy_reported(table.count, false);
+    for (size_t f = 0; f < FRAME_COUNT; f++) {
+      const uint8_t* data = &frames[f * 8];
+      for (uint16_t i = 0; i < table.count; i++) {
+        const dbc_signal_t& sig = table.signals[i];
+        const uint64_t expected = reference_extract(data, sig.start_bit, sig.length, sig.is_little_endian);
+        if (dbc_extract_planned(data, plans[i]) != expected ||
+            dbc_extract_raw(data, sig.start_bit, sig.length, sig.is_little_endian) != expected) {
+          if (mismatches++ < 5) {
+            printf("  mismatch %s 0x%X %s\n", table.name, (unsigned)sig.id, sig.name);
+          }
+        }
+        if (!legacy_reported[i] && legacy_extract(data, sig.start_bit, sig.length, sig.is_little_endian) != expected) {
+          legacy_reported[i] = true;
+          printf("  legacy differs (Motorola bit order): %s 0x%X %s %u|%u@0\n", table.name, (unsigned)sig.id,
+                 sig.name, (unsigned)sig.start_bit, (unsigned)sig.length);
+          legacy_diffs++;
+        }
+      }
+    }
+    failures += (int)mismatches;
+
+    const double legacy_ns = time_ns_per_signal(table, frames, [&](const uint8_t* data, uint16_t i) {
+      const dbc_signal_t& sig = table.signals[i];
+      return legacy_extract(data, sig.start_bit, sig.length, sig.is_little_endian);
+    });
+    const double inline_ns = time_ns_per_signal(table, frames, [&](const uint8_t* data, uint16_t i) {
+      const dbc_signal_t& sig = table.signals[i];
+      return dbc_extract_raw(data, sig.start_bit, sig.length, sig.is_little_endian);
+    });
+    const double planned_ns = time_ns_per_signal(
+      table, frames, [&](const uint8_t* data, uint16_t i) { return dbc_extract_planned(data, plans[i]); });
+
+    printf("%s: signals=%u u8=%u u16le=%u u16be=%u wordle=%u wordbe=%u none=%u\n", table.name, (unsigned)table.count,
+           kinds[DBC_EXTRACT_U8], kinds[DBC_EXTRACT_U16_LE], kinds[DBC_EXTRACT_U16_BE], kinds[DBC_EXTRACT_WORD_LE],
+           kinds[DBC_EXTRACT_WORD_BE], kinds[DBC_EXTRACT_NONE]);
+    printf("  mismatches=%u legacyMotorolaDiffs=%u\n", mismatches, legacy_diffs);
+    printf("  legacy %.2f ns/signal, planned-per-call %.2f ns/signal (%.1fx), precompiled %.2f ns/signal (%.1fx)\n",
+           legacy_ns, inline_ns, legacy_ns / inline_ns, planned_ns, legacy_ns / planned_ns);
+  }
+
+  printf("%s (sink %llu)\n", failures == 0 ? "PASS" : "FAIL", (unsigned long long)(sink & 0xFF));
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,512 @@
+// Host regression checks and transport benchmark for the UDS/KWP diagnostic layer. Runs the real
+// src/functions/diag/uds.cpp against the simulated Haldex module (host/sim) on the in-memory CAN bus,
+// in virtual time: every exported diagUds*/diagKwp* function is checked, then request latency and
+// ISO-TP / TP2.0 throughput are measured as bus time and host CPU time per request.
+//
+//   g++ -O2 -std=gnu++17 -DARDUINO=10800 -DOH_HOST=1 -Ihost/include -Ihost/sim -Iinclude
+//       -I.pio/libdeps/lilygo-t2can-s3/ArduinoJson/src scripts/diag_sim_bench.cpp host/sim/haldex_ecu_sim.cpp
+//       host/src/*.cpp src/functions/diag/uds.cpp -o diag_sim_bench && ./diag_sim_bench
+//
+// ArduinoJson comes from the PlatformIO library folder, so build the firmware once first. OH_HOST_LOG=1
+// prints the diag layer's log lines.
+
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+#include "functions/diag/uds.h"
+#include "haldex_ecu_sim.h"
+#include "host/clock.h"
+#include "host/vcan.h"
+
+// The parts of the CAN module and shared state that uds.cpp links against.
+bool can_ready = true;
+bool can1_ready = true;
+
+bool haldex_can_send(const twai_message_t& msg, TickType_t timeout_ticks, bool generated) {
+  (void)timeout_ticks;
+  (void)generated;
+  return hostVcanTransmit(msg);
+}
+
+static int g_checks = 0;
+static int g_failures = 0;
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+static void check(bool ok, const char* what, int line) {
+  g_checks++;
+  if (!ok) {
+    g_failures++;
+    printf("  FAIL line %d: %s\n", line, what);
+  }
+}
+
+// Fresh bus and module. The clock keeps running across tests so the diag layer's timestamps stay
+// monotonic.
+static void startSim(const ecu_sim_config_t& config) {
+  hostVcanReset(500000);
+  hostVcanSetReceiver(diagUdsObserveHaldexFrame);
+  ecuSimInit(config);
+}
+
+static void startDefaultSim() {
+  ecu_sim_config_t config;
+  ecuSimDefaultConfig(config);
+  startSim(config);
+}
+
+// Services the TP2.0 channel the way the diag worker does until it has nothing more to do.
+static void runTp20Service() {
+  uint32_t next_ms = 0;
+  while ((next_ms = diagKwpTp20SessionService()) > 0) {
+    hostClockSleepUs((uint64_t)next_ms * 1000ULL);
+  }
+}
+
+// A timeout drops the selected route (and the multi-DID rejection with it); the probe picks it again.
+static void reselectRoute() {
+  diag_uds_result_t result = {};
+  ecuSimSetSilent(true);
+  (void)diagUdsReadDataByIdentifier(0xF187, result, 200);
+  ecuSimSetSilent(false);
+  (void)diagUdsProbeHaldex(result, 900);
+}
+
+static bool payloadEquals(const diag_uds_result_t& result, const uint8_t* expected, uint16_t len) {
+  return result.payloadLen == len && memcmp(result.payload, expected, len) == 0;
+}
+
+static void testNrcNames() {
+  CHECK(strcmp(diagUdsNrcName(0x31), diagUdsNrcName(0x78)) != 0);
+  CHECK(strlen(diagUdsNrcName(0x22)) > 0);
+  CHECK(strlen(diagUdsNrcName(0xEE)) > 0);
+}
+
+static void testIsoTpConfig() {
+  diag_isotp_config_t config = {};
+  diagUdsIsoTpConfigGet(config);
+  CHECK(config.rxBlockSize == 0 && config.rxStMin == 0 && config.nBsMs == 1000 && config.nCrMs == 1000);
+
+  diag_isotp_config_t bad = config;
+  bad.rxStMin = 0x80;
+  CHECK(!diagUdsIsoTpConfigSet(bad));
+  bad = config;
+  bad.nCrMs = 20;
+  CHECK(!diagUdsIsoTpConfigSet(bad));
+
+  const diag_isotp_config_t good = {4, 0xF5, 500, 400};
+  CHECK(diagUdsIsoTpConfigSet(good));
+  diag_isotp_config_t readback = {};
+  diagUdsIsoTpConfigGet(readback);
+  CHECK(readback.rxBlockSize == 4 && readback.rxStMin == 0xF5 && readback.nBsMs == 500 && readback.nCrMs == 400);
+  CHECK(diagUdsIsoTpConfigSet(config));
+}
+
+static void testProbe() {
+  diag_uds_result_t result = {};
+
+  startDefaultSim();
+  CHECK(diagUdsProbeHaldex(result));
+  CHECK(diagUdsHasSelectedRoute());
+  CHECK(diagUdsSelectedRoute() && diagUdsSelectedRoute()->requestId == 0x70F);
+
+  // Module only on the 29-bit route: the probe times out on the selected route, then walks the rest.
+  ecu_sim_config_t config;
+  ecuSimDefaultConfig(config);
+  config.udsRequestId = 0x1C40000F;
+  config.udsResponseId = 0x1C42000F;
+  config.udsExtended = true;
+  startSim(config);
+  CHECK(diagUdsProbeHaldex(result));
+  CHECK(diagUdsSelectedRoute() && diagUdsSelectedRoute()->extended);
+
+  startDefaultSim();
+  ecuSimSetSilent(true);
+  CHECK(!diagUdsProbeHaldex(result, 300));
+  CHECK(result.timeout);
+  CHECK(!diagUdsHasSelectedRoute());
+  CHECK(diagUdsSelectedRoute() == nullptr);
+
+  ecuSimSetSilent(false);
+  CHECK(diagUdsProbeHaldex(result));
+  CHECK(diagUdsSelectedRoute() && diagUdsSelectedRoute()->requestId == 0x70F);
+}
+
+static void testObserveFrame() {
+  twai_message_t frame = {};
+  frame.identifier = 0x779;
+  frame.data_length_code = 8;
+  CHECK(!diagUdsObserveHaldexFrame(frame)); // no request in flight
+  frame.identifier = 0x300;
+  CHECK(!diagUdsObserveHaldexFrame(frame));
+}
+
+static void testReadDid() {
+  startDefaultSim();
+  diag_uds_result_t result = {};
+
+  CHECK(diagUdsReadDataByIdentifier(0x0286, result));
+  const uint8_t expected_sf[] = {0x62, 0x02, 0x86, 0x5A};
+  CHECK(payloadEquals(result, expected_sf, sizeof(expected_sf)));
+  CHECK(result.ok && !result.negative && strcmp(result.status, "positive") == 0);
+
+  CHECK(diagUdsReadDataByIdentifier(0xF19E, result));
+  CHECK(result.payloadLen == 3 + 20 && memcmp(&result.payload[3], "EV_AllWheeDrivHalde5", 20) == 0);
+
+  CHECK(!diagUdsReadDataByIdentifier(0xBEEF, result));
+  CHECK(result.negative && result.nrc == 0x31 && !result.timeout);
+  CHECK(diagUdsHasSelectedRoute()); // a negative answer keeps the route
+
+  ecuSimInjectNrc(0x22, 0x22, 1);
+  CHECK(!diagUdsReadDataByIdentifier(0x0286, result));
+  CHECK(result.negative && result.nrc == 0x22);
+  CHECK(diagUdsReadDataByIdentifier(0x0286, result));
+
+  ecuSimInjectPending(0x22, 3, 50000);
+  CHECK(diagUdsReadDataByIdentifier(0xF187, result));
+  CHECK(result.pendingSeen && result.payloadLen == 3 + 11);
+
+  // 200-byte DID, received in blocks of four frames with 0.5 ms STmin.
+  uint8_t big[200];
+  for (uint16_t i = 0; i < sizeof(big); i++) {
+    big[i] = (uint8_t)(i * 7 + 1);
+  }
+  ecuSimSetDid(0x3000, big, sizeof(big));
+  const diag_isotp_config_t blocks = {4, 0xF5, 1000, 1000};
+  diag_isotp_config_t saved = {};
+  diagUdsIsoTpConfigGet(saved);
+  CHECK(diagUdsIsoTpConfigSet(blocks));
+  CHECK(diagUdsReadDataByIdentifier(0x3000, result));
+  CHECK(result.payloadLen == 3 + sizeof(big) && memcmp(&result.payload[3], big, sizeof(big)) == 0);
+  ecu_sim_stats_t stats = {};
+  ecuSimGetStats(stats);
+  CHECK(diagUdsIsoTpConfigSet(saved));
+
+  // Response larger than OH_UDS_MAX_PAYLOAD.
+  uint8_t huge[300] = {};
+  ecuSimSetDid(0x3001, huge, sizeof(huge));
+  CHECK(!diagUdsReadDataByIdentifier(0x3001, result));
+  CHECK(strcmp(result.status, "payload_too_large") == 0);
+
+  // A silent module times out and drops the route.
+  ecuSimSetSilent(true);
+  CHECK(!diagUdsReadDataByIdentifier(0x0286, result, 300));
+  CHECK(result.timeout && !diagUdsHasSelectedRoute());
+  ecuSimSetSilent(false);
+  CHECK(diagUdsReadDataByIdentifier(0x0286, result)); // probes again first
+
+  can_ready = false;
+  CHECK(!diagUdsReadDataByIdentifier(0x0286, result));
+  CHECK(strcmp(result.status, "can_not_ready") == 0);
+  can_ready = true;
+}
+
+static void testReadDids() {
+  ecu_sim_config_t config;
+  ecuSimDefaultConfig(config);
+  config.blockSize = 1; // our 17-byte request goes out one consecutive frame per flow control
+  config.stMin = 0x01;
+  startSim(config);
+  reselectRoute();
+
+  const uint16_t dids[] = {0x0286, 0x2BE6, 0x02BD, 0x1F60, 0xF189, 0xF187, 0xF197, 0xF19E};
+  const uint16_t lens[] = {1, 2, 2, 4, 4, 11, 11, 20};
+  diag_uds_did_read_t reads[8] = {};
+  for (uint8_t i = 0; i < 8; i++) {
+    reads[i].did = dids[i];
+    reads[i].expectedLen = lens[i];
+  }
+  uint8_t data[256] = {};
+  diag_uds_result_t last = {};
+
+  ecu_sim_stats_t before = {};
+  ecuSimGetStats(before);
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), last) == 8);
+  ecu_sim_stats_t after = {};
+  ecuSimGetStats(after);
+  CHECK(after.udsRequests - before.udsRequests == 1);
+  CHECK(after.flowControls - before.flowControls >= 2);
+  bool all_ok = true;
+  for (uint8_t i = 0; i < 8; i++) {
+    all_ok = all_ok && reads[i].ok && reads[i].batched && reads[i].dataLen == lens[i];
+  }
+  CHECK(all_ok);
+  CHECK(data[reads[0].dataOffset] == 0x5A);
+  CHECK(memcmp(&data[reads[7].dataOffset], "EV_AllWheeDrivHalde5", 20) == 0);
+
+  // Unknown DID in the batch: the combined answer does not split, so each DID is read alone.
+  reads[2].did = 0xBEEF;
+  ecuSimGetStats(before);
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), last) == 7);
+  ecuSimGetStats(after);
+  CHECK(after.udsRequests - before.udsRequests == 9);
+  CHECK(!reads[2].ok && reads[2].negative && reads[2].nrc == 0x31);
+  CHECK(reads[3].ok && !reads[3].batched && memcmp(&data[reads[3].dataOffset], "\x12\x34\x56\x78", 4) == 0);
+  // Next cycle: the refused DID is read alone and the DIDs around it batch again.
+  ecuSimGetStats(before);
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), last) == 7);
+  ecuSimGetStats(after);
+  CHECK(after.udsRequests - before.udsRequests == 3);
+  CHECK(reads[0].batched && reads[3].batched && !reads[2].ok && reads[2].nrc == 0x31);
+  reads[2].did = 0x02BD;
+
+  // Module that takes one DID per request: NRC 0x13 once, then single reads until the route changes.
+  config.maxDidsPerRequest = 1;
+  startSim(config);
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), last) == 8);
+  CHECK(!reads[0].batched && reads[0].ok);
+  ecuSimGetStats(before);
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), last) == 8);
+  ecuSimGetStats(after);
+  CHECK(after.udsRequests - before.udsRequests == 8 && after.negativeResponses == before.negativeResponses);
+
+  // Too little room: DIDs that do not fit are reported, the rest still read.
+  startDefaultSim();
+  reselectRoute();
+  CHECK(diagUdsReadDataByIdentifiers(reads, 8, data, 20, last) < 8);
+
+  CHECK(diagUdsReadDataByIdentifiers(reads, 0, data, sizeof(data), last) == 0);
+}
+
+static void testDtc() {
+  startDefaultSim();
+  reselectRoute();
+  diag_uds_result_t result = {};
+
+  CHECK(diagUdsReadDtcByStatus(0xFF, result));
+  const uint8_t all[] = {0x59, 0x02, 0xFF, 0x01, 0x31, 0x4F, 0x2F, 0x05, 0x62, 0x00, 0x08};
+  CHECK(payloadEquals(result, all, sizeof(all)));
+  CHECK(diagUdsReadDtcByStatus(0x01, result));
+  CHECK(result.payloadLen == 3 + 4);
+
+  ecuSimInjectPending(0x14, 2, 100000);
+  CHECK(diagUdsClearDtc(0xFFFFFF, result));
+  CHECK(result.pendingSeen && result.payloadLen == 1 && result.payload[0] == 0x54);
+  CHECK(ecuSimDtcCount() == 0);
+  CHECK(diagUdsReadDtcByStatus(0xFF, result));
+  CHECK(result.payloadLen == 3);
+
+  ecuSimInjectNrc(0x14, 0x22, 1);
+  CHECK(!diagUdsClearDtc(0xFFFFFF, result));
+  CHECK(result.negative && result.nrc == 0x22);
+}
+
+static void testKwp() {
+  startDefaultSim();
+  runTp20Service();
+  diag_uds_result_t result = {};
+
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x01, result));
+  CHECK(result.payloadLen == 2 + 12 && result.payload[0] == 0x61 && result.payload[1] == 0x01);
+  const uint32_t cold_ms = result.elapsedMs;
+  CHECK(ecuSimTp20ChannelOpen());
+
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x04, result));
+  CHECK(result.payloadLen == 2 + 9 && result.payload[2] == 0x06);
+  CHECK(result.elapsedMs < cold_ms);
+
+  CHECK(!diagKwpTp20ReadLocalIdentifier(0x7F, result));
+  CHECK(result.negative && result.nrc == 0x31);
+
+  ecuSimInjectPending(0x21, 2, 100000);
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x03, result));
+  CHECK(result.pendingSeen && result.payloadLen == 2 + 3);
+
+  ecu_sim_stats_t stats = {};
+  ecuSimGetStats(stats);
+  CHECK(stats.tp20Opens == 1); // one channel for every request above
+
+  CHECK(diagKwpTp20ClearDtc(0xFFFFFF, result));
+  CHECK(result.payload[0] == 0x54 && ecuSimDtcCount() == 0);
+
+  ecuSimInjectNrc(0x14, 0x22, 1);
+  CHECK(!diagKwpTp20ClearDtc(0xFFFFFF, result));
+  CHECK(result.negative && result.nrc == 0x22);
+
+  can1_ready = false;
+  CHECK(!diagKwpTp20ReadLocalIdentifier(0x01, result));
+  CHECK(strcmp(result.status, "can_not_ready") == 0);
+  can1_ready = true;
+
+  ecuSimSetSilent(true);
+  runTp20Service(); // the channel test goes unanswered
+  ecuSimSetSilent(false);
+  CHECK(diagKwpTp20SessionService() == 0);
+  CHECK(!diagKwpTp20ReadLocalIdentifier(0x01, result, 300) || ecuSimTp20ChannelOpen());
+}
+
+static void testTp20Session() {
+  startDefaultSim();
+  runTp20Service();
+  diag_uds_result_t result = {};
+  CHECK(diagKwpTp20SessionService() == 0);
+
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x02, result));
+  const uint32_t next_ms = diagKwpTp20SessionService();
+  CHECK(next_ms > 0 && next_ms <= 1000);
+
+  // Kept alive with channel tests until 10 s without a request, then disconnected.
+  runTp20Service();
+  ecu_sim_stats_t stats = {};
+  ecuSimGetStats(stats);
+  CHECK(stats.tp20ChannelTests >= 8 && stats.tp20ChannelTests <= 10);
+  CHECK(stats.tp20Disconnects == 1 && !ecuSimTp20ChannelOpen());
+
+  // A module that drops idle channels: the reused channel goes unanswered, and the request is
+  // retried on a new one.
+  ecu_sim_config_t config;
+  ecuSimDefaultConfig(config);
+  config.tp20InactivityMs = 500;
+  startSim(config);
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x02, result));
+  hostClockSleepUs(2000000); // no keep-alive
+  CHECK(diagKwpTp20ReadLocalIdentifier(0x02, result));
+  ecuSimGetStats(stats);
+  CHECK(stats.tp20Opens == 2 && stats.tp20Dropped == 1);
+  runTp20Service();
+
+  // Setup rejected or unanswered.
+  ecuSimSetSilent(true);
+  CHECK(!diagKwpTp20ReadLocalIdentifier(0x02, result, 300));
+  CHECK(result.timeout && strcmp(result.status, "setup_timeout") == 0);
+  CHECK(diagKwpTp20SessionService() == 0);
+  ecuSimSetSilent(false);
+}
+
+static void testJson() {
+  startDefaultSim();
+  reselectRoute();
+  diag_uds_result_t result = {};
+  CHECK(diagUdsReadDataByIdentifier(0x0286, result));
+
+  JsonDocument status;
+  diagUdsWriteStatusJson(status.to<JsonObject>());
+  CHECK(status["supported"].as<bool>());
+  CHECK(status["isoTp"]["nBsMs"].as<uint32_t>() == 1000);
+  CHECK(status["route"]["name"].as<String>() == "allwheel-70f");
+  CHECK(status["last"]["available"].as<bool>());
+  CHECK(!status["tp20Session"]["open"].isNull());
+
+  JsonDocument doc;
+  diagUdsWriteResultJson(doc.to<JsonObject>(), result);
+  String text;
+  serializeJson(doc, text);
+  CHECK(text.indexOf("5A") >= 0);
+}
+
+// --- benchmark ---
+
+struct bench_result_t {
+  double virtUsPerOp;
+  double hostNsPerOp;
+};
+
+template <typename Fn> static bench_result_t runBench(unsigned count, Fn fn) {
+  const uint64_t virt_start = hostClockUs();
+  const auto host_start = std::chrono::steady_clock::now();
+  unsigned ok = 0;
+  for (unsigned i = 0; i < count; i++) {
+    ok += fn() ? 1 : 0;
+  }
+  const double host_ns =
+    std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - host_start).count();
+  check(ok == count, "benchmark request failed", __LINE__);
+  return {(double)(hostClockUs() - virt_start) / count, host_ns / count};
+}
+
+static void printBench(const char* name, unsigned count, const bench_result_t& r, unsigned bytes_per_op) {
+  printf("bench %-22s n=%-4u bus_us_per_req=%9.1f host_ns_per_req=%9.0f", name, count, r.virtUsPerOp,
+         r.hostNsPerOp);
+  if (bytes_per_op > 0) {
+    printf(" payload_bytes_per_s=%8.0f", bytes_per_op * 1e6 / r.virtUsPerOp);
+  }
+  printf("\n");
+}
+
+static void runBenchmarks() {
+  const unsigned n = 200;
+  diag_uds_result_t result = {};
+  diag_isotp_config_t saved = {};
+  diagUdsIsoTpConfigGet(saved);
+
+  startDefaultSim();
+  reselectRoute();
+  printBench("uds_did_single_frame", n, runBench(n, [&] { return diagUdsReadDataByIdentifier(0x0286, result); }), 1);
+
+  uint8_t big[240];
+  memset(big, 0x5C, sizeof(big));
+  ecuSimSetDid(0x3000, big, sizeof(big));
+  printBench("uds_did_240B_bs0", n, runBench(n, [&] { return diagUdsReadDataByIdentifier(0x3000, result); }),
+             sizeof(big));
+  const diag_isotp_config_t paced = {8, 0x01, 1000, 1000};
+  diagUdsIsoTpConfigSet(paced);
+  printBench("uds_did_240B_bs8_st1ms", n, runBench(n, [&] { return diagUdsReadDataByIdentifier(0x3000, result); }),
+             sizeof(big));
+  diagUdsIsoTpConfigSet(saved);
+
+  const uint16_t dids[] = {0x0286, 0x2BE6, 0x02BD, 0x1F60, 0xF189, 0xF187, 0xF197, 0xF19E};
+  const uint16_t lens[] = {1, 2, 2, 4, 4, 11, 11, 20};
+  diag_uds_did_read_t reads[8] = {};
+  for (uint8_t i = 0; i < 8; i++) {
+    reads[i].did = dids[i];
+    reads[i].expectedLen = lens[i];
+  }
+  uint8_t data[256];
+  printBench("uds_8dids_batched", n, runBench(n, [&] {
+               return diagUdsReadDataByIdentifiers(reads, 8, data, sizeof(data), result) == 8;
+             }),
+             55);
+  printBench("uds_8dids_one_by_one", n / 4, runBench(n / 4, [&] {
+               bool ok = true;
+               for (uint8_t i = 0; i < 8; i++) {
+                 ok = diagUdsReadDataByIdentifier(dids[i], result) && ok;
+               }
+               return ok;
+             }),
+             55);
+
+  // KWP over TP2.0: a fresh channel per read against the kept-open channel.
+  runTp20Service();
+  const unsigned kwp_n = 50;
+  uint64_t cold_virt_us = 0;
+  double cold_host_ns = 0;
+  for (unsigned i = 0; i < kwp_n; i++) {
+    const bench_result_t one = runBench(1, [&] { return diagKwpTp20ReadLocalIdentifier(0x01, result); });
+    cold_virt_us += (uint64_t)one.virtUsPerOp;
+    cold_host_ns += one.hostNsPerOp;
+    runTp20Service();
+  }
+  printBench("kwp_lid_new_channel", kwp_n, {(double)cold_virt_us / kwp_n, cold_host_ns / kwp_n}, 12);
+  (void)diagKwpTp20ReadLocalIdentifier(0x01, result);
+  printBench("kwp_lid_open_channel", kwp_n,
+             runBench(kwp_n, [&] { return diagKwpTp20ReadLocalIdentifier(0x01, result); }), 12);
+  runTp20Service();
+
+  host_vcan_stats_t bus = {};
+  hostVcanGetStats(bus);
+  printf("bus frames_from_firmware=%u frames_from_module=%u busy_us=%llu\n", bus.firmwareTx, bus.nodeTx,
+         (unsigned long long)bus.busyUs);
+}
+
+int main() {
+  hostClockReset();
+  diagUdsInit();
+
+  testNrcNames();
+  testIsoTpConfig();
+  testProbe();
+  testObserveFrame();
+  testReadDid();
+  testReadDids();
+  testDtc();
+  testKwp();
+  testTp20Session();
+  testJson();
+  printf("checks=%d failures=%d\n", g_checks, g_failures);
+
+  runBenchmarks();
+
+  printf("%s\n", g_failures == 0 ? "PASS" : "FAIL");
+  return g_failures == 0 ? 0 : 1;
+}
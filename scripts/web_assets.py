@@ -0,0 +1,104 @@
+"""Stage data/ for the LittleFS image with gzipped, content-hashed web assets.
+
+app.js and styles.css are written as /assets/<name>.<hash>.<ext>.gz and the HTML pages are rewritten
+to reference them, so the browser may cache them forever (a new build changes the name). HTML and
+the other text files are gzipped in place; maps and anything else are copied unchanged.
+
+Runs as a PlatformIO pre-script and points the filesystem image at the staged tree. Can also be run
+by hand: python scripts/web_assets.py [out_dir]
+"""
+
+from pathlib import Path
+import gzip
+import hashlib
+import shutil
+import sys
+
+try:
+    Import("env")
+    project_dir = Path(env["PROJECT_DIR"])
+    stage_dir = Path(env.subst("$BUILD_DIR")) / "www"
+except NameError:
+    env = None
+    project_dir = Path(__file__).resolve().parent.parent
+    stage_dir = Path(sys.argv[1]) if len(sys.argv) > 1 else project_dir / ".pio" / "www"
+
+DATA_DIR = project_dir / "data"
+
+# Assets referenced from every page; served from /assets/ with immutable caching.
+HASHED_ASSETS = ["app.js", "styles.css"]
+# Top-level files served only over HTTP; the firmware never opens these itself.
+GZIP_SUFFIXES = {".html", ".js", ".css", ".json"}
+HASH_LEN = 8
+
+
+def gzip_bytes(raw):
+    # mtime=0 keeps the output byte-identical across builds.
+    return gzip.compress(raw, compresslevel=9, mtime=0)
+
+
+def write_if_changed(path, raw):
+    if path.exists() and path.read_bytes() == raw:
+        return
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(raw)
+
+
+def stage():
+    expected = set()
+    renames = {}
+    total_raw = 0
+    total_gz = 0
+
+    for name in HASHED_ASSETS:
+        raw = (DATA_DIR / name).read_bytes()
+        digest = hashlib.sha256(raw).hexdigest()[:HASH_LEN]
+        stem, ext = name.rsplit(".", 1)
+        hashed = "assets/%s.%s.%s" % (stem, digest, ext)
+        renames[name] = hashed
+        packed = gzip_bytes(raw)
+        write_if_changed(stage_dir / (hashed + ".gz"), packed)
+        expected.add(hashed + ".gz")
+        total_raw += len(raw)
+        total_gz += len(packed)
+
+    for src in sorted(DATA_DIR.rglob("*")):
+        if not src.is_file():
+            continue
+        rel = src.relative_to(DATA_DIR).as_posix()
+        if rel in renames:
+            continue
+        raw = src.read_bytes()
+        top_level = "/" not in rel
+        if top_level and src.suffix == ".html":
+            text = raw.decode("utf-8")
+            for name, hashed in renames.items():
+                text = text.replace('"./%s"' % name, '"./%s"' % hashed)
+            raw = text.encode("utf-8")
+        if top_level and src.suffix in GZIP_SUFFIXES:
+            packed = gzip_bytes(raw)
+            write_if_changed(stage_dir / (rel + ".gz"), packed)
+            expected.add(rel + ".gz")
+            total_raw += len(raw)
+            total_gz += len(packed)
+        else:
+            write_if_changed(stage_dir / rel, raw)
+            expected.add(rel)
+
+    # Drop outputs of earlier builds (old hashes, files removed from data/).
+    for old in sorted(stage_dir.rglob("*"), reverse=True):
+        rel = old.relative_to(stage_dir).as_posix()
+        if old.is_file() and rel not in expected:
+            old.unlink()
+        elif old.is_dir() and not any(old.iterdir()):
+            old.rmdir()
+
+    print("web_assets: %d -> %d bytes gzipped (%s)" % (total_raw, total_gz, ", ".join(sorted(renames.values()))))
+
+
+if DATA_DIR.exists():
+    stage()
+    if env is not None:
+        env.Replace(PROJECT_DATA_DIR=str(stage_dir))
+else:
+    print("web_assets: data/ missing, filesystem image uses the default data_dir")
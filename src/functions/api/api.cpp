@@ -8,17 +8,26 @@
 
 #include "functions/api/api.h"
 #include "functions/core/state.h"
+#include "functions/core/telemetry.h"
+#include "functions/config/config.h"
 #include "functions/config/pins.h"
 #include "functions/storage/storage.h"
 #include "functions/storage/filelog.h"
 #include "functions/canview/canview.h"
+#include "functions/canview/dbc_table.h"
 #include "functions/can/can_id.h"
+#include "functions/can/can_loadgen.h"
 #include "functions/net/update.h"
 #include "functions/tasks/tasks.h"
 #include "functions/power/power.h"
+#include "functions/diag/diag_jobs.h"
 #include "functions/diag/uds.h"
+#if OH_BENCH_API
+#include "functions/bench/bench.h"
+#endif
 
 #include <optional>
+#include <utility>
 
 extern bool wifiInternetOk();
 extern void wifiApplySettings();
@@ -155,12 +164,14 @@ static bool parseModeName(const String& mode_raw, openhaldex_mode_t& out_mode) {
 static String sanitizeMappedSignalKey(const String& raw) {
   String value = raw;
   value.trim();
-  if (value.length() > 160) {
-    value = value.substring(0, 160);
-  }
   return value;
 }
 
+// Longer keys are rejected, not cut: a truncated key would persist a binding the client never sent.
+static bool mappedSignalKeyFits(const String& key) {
+  return key.length() <= MAPPED_SIGNAL_KEY_MAX;
+}
+
 static String mappingKeySignalToken(const char* value) {
   String token = String(value ? value : "");
   token.replace("_", " ");
@@ -268,6 +279,77 @@ static bool seedModeTriggerForGeneration(uint8_t generation, mode_trigger_config
   return changed;
 }
 
+static void writeModeTriggerRulesJson(JsonArray out, const mode_trigger_rules_t& rules) {
+  for (uint8_t r = 0; r < rules.count; r++) {
+    const mode_trigger_rule_t& rule = rules.rules[r];
+    JsonObject item = out.add<JsonObject>();
+    item["enabled"] = rule.enabled;
+    item["combine"] = modeTriggerCombineName(rule.combine);
+    item["debounceMs"] = rule.debounceMs;
+    item["mode"] = modeName(rule.mode);
+    item["broadcastOpenHaldexOverCAN"] = rule.broadcastOpenHaldexOverCAN;
+    JsonArray terms = item["terms"].to<JsonArray>();
+    for (uint8_t t = 0; t < rule.termCount; t++) {
+      JsonObject term = terms.add<JsonObject>();
+      term["signal"] = rule.terms[t].signal;
+      term["operator"] = modeTriggerOperatorName(rule.terms[t].op);
+      term["value"] = rule.terms[t].value;
+      term["hysteresis"] = rule.terms[t].hysteresis;
+    }
+  }
+}
+
+// Full replacement of the rule list; returns the error text for a 400 on bad input.
+static const char* parseModeTriggerRules(JsonArrayConst in, mode_trigger_rules_t& out) {
+  if (in.size() > MODE_TRIGGER_RULE_MAX) {
+    return "too many modeTriggerRules";
+  }
+  out = {};
+  for (JsonObjectConst item : in) {
+    if (item.isNull()) {
+      return "invalid modeTriggerRules entry";
+    }
+    mode_trigger_rule_t& rule = out.rules[out.count++];
+    rule.enabled = item["enabled"] | true;
+    rule.combine = MODE_TRIGGER_ALL;
+    if (item.containsKey("combine") && !modeTriggerCombineFromString(String(item["combine"] | ""), rule.combine)) {
+      return "invalid modeTriggerRules.combine";
+    }
+    const uint32_t debounce = item["debounceMs"] | 0U;
+    rule.debounceMs = (uint16_t)std::min<uint32_t>(debounce, 10000U);
+    rule.mode = MODE_MAP;
+    if (item.containsKey("mode") && !parseModeName(String(item["mode"] | ""), rule.mode)) {
+      return "invalid modeTriggerRules.mode";
+    }
+    rule.broadcastOpenHaldexOverCAN = item["broadcastOpenHaldexOverCAN"] | broadcastOpenHaldexOverCAN;
+
+    JsonArrayConst terms = item["terms"].as<JsonArrayConst>();
+    if (terms.isNull() || terms.size() == 0 || terms.size() > MODE_TRIGGER_TERM_MAX) {
+      return "invalid modeTriggerRules.terms";
+    }
+    for (JsonObjectConst term_json : terms) {
+      mode_trigger_term_t& term = rule.terms[rule.termCount++];
+      term.signal = sanitizeMappedSignalKey(term_json["signal"] | "");
+      if (term.signal.length() == 0 || !mappedSignalKeyFits(term.signal)) {
+        return "invalid modeTriggerRules.terms.signal";
+      }
+      term.op = MODE_TRIGGER_GTE;
+      if (term_json.containsKey("operator") &&
+          !modeTriggerOperatorFromString(String(term_json["operator"] | ""), term.op)) {
+        return "invalid modeTriggerRules.terms.operator";
+      }
+      term.value = term_json["value"] | 1.0f;
+      term.hysteresis = term_json["hysteresis"] | 0.0f;
+      if (!isfinite(term.value) || !isfinite(term.hysteresis) || term.hysteresis < 0.0f) {
+        return "invalid modeTriggerRules.terms.value";
+      }
+      term.value = constrain(term.value, -1000000.0f, 1000000.0f);
+      term.hysteresis = std::min(term.hysteresis, 1000000.0f);
+    }
+  }
+  return nullptr;
+}
+
 static bool seedMissingInputMappingsForGeneration(uint8_t generation, String& speed, String& throttle, String& rpm) {
   String default_speed;
   String default_throttle;
@@ -537,6 +619,53 @@ static bool parseHexList(const String& raw, uint32_t max_value, uint32_t* values
   return count > 0;
 }
 
+// "DID[:len]" entries, as in dids=0286:1,2BE6:2,F19E. Packs (len << 16) | DID; len is decimal.
+static bool parseDidLengthList(const String& raw, uint32_t* values, uint8_t& count, uint8_t max_count) {
+  String text = raw;
+  String dids = "";
+  uint16_t lengths[OH_DIAG_JOB_ARG_MAX] = {};
+  uint8_t entries = 0;
+  text.replace(";", ",");
+  int start = 0;
+  while (start <= (int)text.length()) {
+    int comma = text.indexOf(',', start);
+    if (comma < 0) {
+      comma = text.length();
+    }
+    String token = text.substring(start, comma);
+    token.trim();
+    if (token.length() > 0) {
+      if (entries >= max_count || entries >= OH_DIAG_JOB_ARG_MAX) {
+        return false;
+      }
+      const int colon = token.indexOf(':');
+      if (colon >= 0) {
+        const long len = token.substring(colon + 1).toInt();
+        if (len <= 0 || len > OH_UDS_MAX_PAYLOAD - 3) {
+          return false;
+        }
+        lengths[entries] = (uint16_t)len;
+        token = token.substring(0, colon);
+      }
+      dids += token;
+      dids += ",";
+      entries++;
+    }
+    if (comma >= (int)text.length()) {
+      break;
+    }
+    start = comma + 1;
+  }
+
+  if (!parseHexList(dids, 0xFFFF, values, count, max_count) || count != entries) {
+    return false;
+  }
+  for (uint8_t i = 0; i < count; i++) {
+    values[i] |= (uint32_t)lengths[i] << 16;
+  }
+  return true;
+}
+
 static void writeUdsDtcStatusLabels(JsonArray labels, uint8_t status) {
   if (status & 0x01) labels.add("testFailed");
   if (status & 0x02) labels.add("testFailedThisOperationCycle");
@@ -617,10 +746,16 @@ static const uds_identity_did_t k_uds_identity_dids[] = {
   {0xF1A1, "VW Data Set Version", "dataSetVersion", true},
 };
 
-// Aggregated status endpoint used by Home and Diagnostics pages.
-static void handleStatus(AsyncWebServerRequest* request) {
-  JsonDocument doc;
+// /api/status is assembled from named sections. ?fields=a,b builds only those sections; the
+// config-only sections are also served together from a cached body via ?fields=config with an ETag.
+// Pollers ask for configEtag alongside their live sections and re-fetch the config body when it moves.
+
+// Per-response inputs shared by the section writers: telemetry and frameDiag describe one snapshot.
+struct status_build_t {
+  telemetry_snapshot_t telemetry;
+};
 
+static void writeStatusCore(JsonDocument& doc, const status_build_t& build) {
   doc["version"] = OPENHALDEX_VERSION;
   doc["mode"] = modeName(state.mode);
   doc["effectiveMode"] = modeName(openhaldexEffectiveMode());
@@ -634,7 +769,9 @@ static void handleStatus(AsyncWebServerRequest* request) {
   doc["disableSpeed"] = disableSpeed;
   doc["lockReleaseRatePctPerSec"] = lockReleaseRatePctPerSec;
   doc["uptimeMs"] = millis();
+}
 
+static void writeStatusLogging(JsonDocument& doc, const status_build_t& build) {
   JsonObject logging = doc["logging"].to<JsonObject>();
   logging["masterEnabled"] = logToFileEnabled || logSerialEnabled || logCanToFileEnabled || logErrorToFileEnabled ||
                              logDebugFirmwareEnabled || logDebugNetworkEnabled || logDebugCanEnabled;
@@ -646,7 +783,9 @@ static void handleStatus(AsyncWebServerRequest* request) {
   logging["debugNetworkEnabled"] = logDebugNetworkEnabled;
   logging["debugCanEnabled"] = logDebugCanEnabled;
   logging["debugCaptureActive"] = loggingDebugCaptureActive();
+}
 
+static void writeStatusCan(JsonDocument& doc, const status_build_t& build) {
   JsonObject can = doc["can"].to<JsonObject>();
   can["ready"] = can_ready;
   can["chassis"] = hasCANChassis;
@@ -654,40 +793,98 @@ static void handleStatus(AsyncWebServerRequest* request) {
   can["busFailure"] = isBusFailure;
   can["lastChassisMs"] = lastCANChassisTick > 0 ? (millis() - lastCANChassisTick) : 0;
   can["lastHaldexMs"] = lastCANHaldexTick > 0 ? (millis() - lastCANHaldexTick) : 0;
+#if OH_CAN_LOADGEN
+  can_loadgen_stats_t stats;
+  canLoadgenGetStats(stats);
+  JsonObject loadgen = can["loadgen"].to<JsonObject>();
+  loadgen["generation"] = stats.generation;
+  loadgen["load"] = stats.loadPercent;
+  loadgen["busLoad"] = stats.elapsedUs ? 100.0f * stats.busyUs / stats.elapsedUs : 0.0f;
+  loadgen["frames"] = stats.generated;
+  loadgen["overwritten"] = stats.overwritten;
+  loadgen["rxDropped"] = stats.rxDropped;
+  loadgen["rxHighWater"] = stats.rxHighWater;
+  loadgen["forwarded"] = stats.forwarded;
+  loadgen["latencyP50Us"] = canLoadgenLatencyPercentileUs(stats, 50);
+  loadgen["latencyP99Us"] = canLoadgenLatencyPercentileUs(stats, 99);
+  loadgen["latencyMaxUs"] = stats.latencyMaxUs;
+#endif
+}
 
-  JsonObject power = doc["power"].to<JsonObject>();
-  powerWriteStatusJson(power);
+static void writeStatusPower(JsonDocument& doc, const status_build_t& build) {
+  powerWriteStatusJson(doc["power"].to<JsonObject>());
+}
 
-  JsonObject uds = doc["uds"].to<JsonObject>();
-  diagUdsWriteStatusJson(uds);
+static void writeStatusStorage(JsonDocument& doc, const status_build_t& build) {
+  storageWriteStatusJson(doc["storage"].to<JsonObject>());
+}
+
+static void writeStatusDbc(JsonDocument& doc, const status_build_t& build) {
+  dbcWriteStatusJson(doc["dbc"].to<JsonObject>());
+}
+
+static void writeStatusUds(JsonDocument& doc, const status_build_t& build) {
+  diagUdsWriteStatusJson(doc["uds"].to<JsonObject>());
+}
 
+static void writeStatusTelemetry(JsonDocument& doc, const status_build_t& build) {
+  const telemetry_snapshot_t& snapshot = build.telemetry;
   JsonObject telemetry = doc["telemetry"].to<JsonObject>();
-  telemetry["speed"] = received_vehicle_speed;
-  telemetry["rpm"] = received_vehicle_rpm;
-  telemetry["boost"] = received_vehicle_boost;
-  telemetry["throttle"] = received_pedal_value;
-  telemetry["spec"] = lock_target;
-  telemetry["act"] = received_haldex_engagement;
-  telemetry["haldexState"] = received_haldex_state;
-  telemetry["haldexEngagement"] = received_haldex_engagement;
-  telemetry["haldexEngagementRaw"] = received_haldex_engagement_raw;
-  telemetry["clutch1Report"] = received_report_clutch1;
-  telemetry["clutch2Report"] = received_report_clutch2;
-  telemetry["tempProtection"] = received_temp_protection;
-  telemetry["couplingOpen"] = received_coupling_open;
-  telemetry["speedLimit"] = received_speed_limit;
+  telemetry["speed"] = snapshot.speed;
+  telemetry["rpm"] = snapshot.rpm;
+  telemetry["boost"] = snapshot.boost;
+  telemetry["throttle"] = snapshot.throttle;
+  telemetry["spec"] = snapshot.lockTarget;
+  telemetry["act"] = snapshot.haldexEngagement;
+  telemetry["haldexState"] = snapshot.haldexState;
+  telemetry["haldexEngagement"] = snapshot.haldexEngagement;
+  telemetry["haldexEngagementRaw"] = snapshot.haldexEngagementRaw;
+  telemetry["clutch1Report"] = snapshot.clutch1Report;
+  telemetry["clutch2Report"] = snapshot.clutch2Report;
+  telemetry["tempProtection"] = snapshot.tempProtection;
+  telemetry["couplingOpen"] = snapshot.couplingOpen;
+  telemetry["speedLimit"] = snapshot.speedLimit;
   telemetry["inputsMapped"] = inputsMappedForControl();
+  telemetry["sequence"] = snapshot.sequence;
+  telemetry["ageMs"] = snapshot.sequence ? (millis() - snapshot.publishedMs) : 0;
+}
 
+static void writeStatusFrameDiag(JsonDocument& doc, const status_build_t& build) {
   JsonObject frameDiag = doc["frameDiag"].to<JsonObject>();
-  frameDiag["lockTarget"] = lock_target;
+  frameDiag["lockTarget"] = build.telemetry.lockTarget;
   frameDiag["haldexGen"] = haldexGeneration;
 
+  auto addFrameDiag = [&](const char* key, uint32_t id) {
+    canview_last_tx_t frame;
+    JsonObject f = frameDiag[key].to<JsonObject>();
+    f["id"] = id;
+    if (!canviewGetLastTxFrame(1, id, frame)) {
+      f["ok"] = false;
+      return;
+    }
+    f["ok"] = true;
+    f["generated"] = frame.generated;
+    f["ageMs"] = frame.ageMs;
+    f["dlc"] = frame.dlc;
+    f["data"] = frameDataHex(frame);
+  };
+
+  addFrameDiag("motor1", MOTOR1_ID);
+  addFrameDiag("motor3", MOTOR3_ID);
+  addFrameDiag("brakes1", BRAKES1_ID);
+  addFrameDiag("brakes2", BRAKES2_ID);
+  addFrameDiag("brakes3", BRAKES3_ID);
+}
+
+static void writeStatusLearn(JsonDocument& doc, const status_build_t& build) {
   JsonObject learn = doc["learn"].to<JsonObject>();
   learn["active"] = (bool)haldexLearnActive;
   learn["tableValid"] = haldexLearnTableValid;
   learn["progress"] = (uint8_t)haldexLearnStep;
   learn["currentCF"] = (uint8_t)haldexLearnCF;
+}
 
+static void writeStatusInputMappings(JsonDocument& doc, const status_build_t& build) {
   String mapped_speed;
   String mapped_throttle;
   String mapped_rpm;
@@ -697,7 +894,9 @@ static void handleStatus(AsyncWebServerRequest* request) {
   inputMappings["speed"] = mapped_speed;
   inputMappings["throttle"] = mapped_throttle;
   inputMappings["rpm"] = mapped_rpm;
+}
 
+static void writeStatusModeTrigger(JsonDocument& doc, const status_build_t& build) {
   mode_trigger_config_t mode_trigger_config = {};
   if (!modeTriggerConfigGet(mode_trigger_config, 2)) {
     (void)getRecommendedModeTriggerForGeneration(haldexGeneration, mode_trigger_config);
@@ -723,15 +922,53 @@ static void handleStatus(AsyncWebServerRequest* request) {
   modeTrigger["ageMs"] = mode_trigger_runtime.ageMs;
   modeTrigger["effectiveMode"] = modeName(openhaldexEffectiveMode());
   modeTrigger["effectiveBroadcastOpenHaldexOverCAN"] = openhaldexEffectiveBroadcastOpenHaldexOverCAN();
+  modeTrigger["activeRule"] = modeTriggerActiveRule();
+}
+
+static void writeStatusModeTriggerRules(JsonDocument& doc, const status_build_t& build) {
+  mode_trigger_rules_t mode_trigger_rules = {};
+  JsonArray modeTriggerRules = doc["modeTriggerRules"].to<JsonArray>();
+  if (modeTriggerRulesGet(mode_trigger_rules, 2)) {
+    writeModeTriggerRulesJson(modeTriggerRules, mode_trigger_rules);
+  }
+}
 
+static void writeStatusDashMappings(JsonDocument& doc, const status_build_t& build) {
   String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
   getDashboardSignalSnapshot(dashboard_slots);
 
   JsonObject dashMappings = doc["dashMappings"].to<JsonObject>();
+  for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    dashMappings[String("dash_") + String(i + 1)] = dashboard_slots[i];
+  }
+}
+
+// Value half of a dashboard slot, shared by the legacy dashboardSignals and the live dashboardValues.
+static void writeDashboardValue(JsonObject slot, const canview_resolved_signal_t& resolved, bool found) {
+  if (found && resolved.numeric) {
+    slot["numeric"] = true;
+    if (resolved.integral) {
+      slot["value"] = resolved.integerValue;
+    } else {
+      slot["value"] = resolved.numericValue;
+    }
+    slot["display"] = formatDashboardNumericValue(resolved.numericValue, resolved.unit, resolved.name);
+  } else if (found) {
+    slot["numeric"] = false;
+    slot["display"] = resolved.textValue;
+  } else {
+    slot["numeric"] = false;
+    slot["display"] = "--";
+  }
+}
+
+static void writeStatusDashboardSignals(JsonDocument& doc, const status_build_t& build) {
+  String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+  getDashboardSignalSnapshot(dashboard_slots);
+
   JsonArray dashboardSignals = doc["dashboardSignals"].to<JsonArray>();
   for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
     const String slot_key = String("dash_") + String(i + 1);
-    dashMappings[slot_key] = dashboard_slots[i];
 
     JsonObject slot = dashboardSignals.add<JsonObject>();
     slot["slot"] = slot_key;
@@ -740,7 +977,7 @@ static void handleStatus(AsyncWebServerRequest* request) {
     slot["mapped"] = mapped;
 
     canview_resolved_signal_t resolved = {};
-    const bool found = mapped && canviewResolveMappedSignal(dashboard_slots[i], resolved);
+    const bool found = mapped && canviewResolveDashboardSlot((uint8_t)i, resolved);
     const String label = found ? String(resolved.name) : dashboardSignalLabelFromKey(dashboard_slots[i]);
     slot["found"] = found;
     slot["label"] = label;
@@ -749,47 +986,207 @@ static void handleStatus(AsyncWebServerRequest* request) {
     slot["unit"] = found ? resolved.unit : "";
     slot["generated"] = found ? resolved.generated : false;
     slot["ageMs"] = found ? resolved.ageMs : 0;
-    if (found && resolved.numeric) {
-      slot["numeric"] = true;
-      slot["value"] = resolved.numericValue;
-      slot["display"] = formatDashboardNumericValue(resolved.numericValue, resolved.unit, resolved.name);
-    } else if (found) {
-      slot["numeric"] = false;
-      slot["display"] = resolved.textValue;
-    } else {
-      slot["numeric"] = false;
-      slot["display"] = "--";
+    writeDashboardValue(slot, resolved, found);
+  }
+}
+
+// Bindings half of the dashboard: which signal each slot shows and its label. Config-only, so it rides
+// the cached ?fields=config body instead of being rebuilt on every poll.
+static void writeStatusDashboardSlots(JsonDocument& doc, const status_build_t& build) {
+  String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+  getDashboardSignalSnapshot(dashboard_slots);
+
+  JsonArray dashboardSlots = doc["dashboardSlots"].to<JsonArray>();
+  for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    JsonObject slot = dashboardSlots.add<JsonObject>();
+    slot["slot"] = String("dash_") + String(i + 1);
+    slot["signalId"] = dashboard_slots[i];
+    slot["mapped"] = dashboard_slots[i].length() > 0;
+    const char* name = canviewDashboardSlotName((uint8_t)i);
+    slot["label"] = name ? String(name) : dashboardSignalLabelFromKey(dashboard_slots[i]);
+  }
+}
+
+// Live half: one entry per slot, in slot order, holding only what changes between polls.
+static void writeStatusDashboardValues(JsonDocument& doc, const status_build_t& build) {
+  JsonArray dashboardValues = doc["dashboardValues"].to<JsonArray>();
+  for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    JsonObject slot = dashboardValues.add<JsonObject>();
+    canview_resolved_signal_t resolved = {};
+    const bool found = canviewResolveDashboardSlot((uint8_t)i, resolved);
+    slot["found"] = found;
+    if (found) {
+      slot["dir"] = resolved.dir;
+      slot["generated"] = resolved.generated;
+      slot["ageMs"] = resolved.ageMs;
     }
+    writeDashboardValue(slot, resolved, found);
   }
+}
 
+static void writeStatusDisengage(JsonDocument& doc, const status_build_t& build) {
   JsonObject disengage = doc["disengageUnderSpeed"].to<JsonObject>();
   disengage["map"] = disengageUnderSpeedMap;
   disengage["speed"] = disengageUnderSpeedSpeedMode;
   disengage["throttle"] = disengageUnderSpeedThrottleMode;
   disengage["rpm"] = disengageUnderSpeedRpmMode;
+}
 
-  auto addFrameDiag = [&](const char* key, uint32_t id) {
-    canview_last_tx_t frame;
-    JsonObject f = frameDiag[key].to<JsonObject>();
-    f["id"] = id;
-    if (!canviewGetLastTxFrame(1, id, frame)) {
-      f["ok"] = false;
+struct status_section_t {
+  const char* name;
+  bool config; // changes only through settings; part of the cached ?fields=config body
+  void (*write)(JsonDocument& doc, const status_build_t& build);
+};
+
+static const status_section_t k_status_sections[] = {
+  {"core", false, writeStatusCore},
+  {"logging", true, writeStatusLogging},
+  {"can", false, writeStatusCan},
+  {"power", false, writeStatusPower},
+  {"storage", false, writeStatusStorage},
+  {"dbc", true, writeStatusDbc},
+  {"uds", false, writeStatusUds},
+  {"telemetry", false, writeStatusTelemetry},
+  {"frameDiag", false, writeStatusFrameDiag},
+  {"learn", false, writeStatusLearn},
+  {"inputMappings", true, writeStatusInputMappings},
+  {"modeTrigger", false, writeStatusModeTrigger},
+  {"modeTriggerRules", true, writeStatusModeTriggerRules},
+  {"dashMappings", true, writeStatusDashMappings},
+  {"dashboardSignals", false, writeStatusDashboardSignals},
+  {"dashboardSlots", true, writeStatusDashboardSlots},
+  {"dashboardValues", false, writeStatusDashboardValues},
+  {"disengageUnderSpeed", true, writeStatusDisengage},
+};
+static const size_t k_status_section_count = sizeof(k_status_sections) / sizeof(k_status_sections[0]);
+
+// Everything the config sections read. Settings that live in state.cpp move configEpoch(); the
+// plain globals are compared directly, so no setter has to remember to invalidate the cache.
+struct status_config_key_t {
+  uint32_t epoch;
+  uint16_t disengage[4];
+  uint8_t haldexGeneration;
+  bool logging[7];
+};
+
+static status_config_key_t status_config_key_now() {
+  status_config_key_t key;
+  memset(&key, 0, sizeof(key));
+  key.epoch = configEpoch();
+  key.disengage[0] = disengageUnderSpeedMap;
+  key.disengage[1] = disengageUnderSpeedSpeedMode;
+  key.disengage[2] = disengageUnderSpeedThrottleMode;
+  key.disengage[3] = disengageUnderSpeedRpmMode;
+  key.haldexGeneration = haldexGeneration;
+  key.logging[0] = logToFileEnabled;
+  key.logging[1] = logCanToFileEnabled;
+  key.logging[2] = logErrorToFileEnabled;
+  key.logging[3] = logSerialEnabled;
+  key.logging[4] = logDebugFirmwareEnabled;
+  key.logging[5] = logDebugNetworkEnabled;
+  key.logging[6] = logDebugCanEnabled;
+  return key;
+}
+
+static String status_config_body;
+static String status_config_etag;
+static status_config_key_t status_config_key = {};
+static bool status_config_valid = false;
+
+// Rebuilds the cached config body only when its inputs moved. Runs on the async web task only.
+static void refreshStatusConfigCache() {
+  const status_config_key_t key = status_config_key_now();
+  if (status_config_valid && memcmp(&key, &status_config_key, sizeof(key)) == 0) {
+    return;
+  }
+
+  JsonDocument doc;
+  const status_build_t build = {};
+  for (size_t i = 0; i < k_status_section_count; i++) {
+    if (k_status_sections[i].config) {
+      k_status_sections[i].write(doc, build);
+    }
+  }
+  status_config_body = "";
+  serializeJson(doc, status_config_body);
+
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < status_config_body.length(); i++) {
+    hash = (hash ^ (uint8_t)status_config_body[i]) * 16777619u;
+  }
+  char etag[16];
+  snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)hash);
+  status_config_etag = etag;
+  status_config_key = key;
+  status_config_valid = true;
+}
+
+static bool statusFieldSelected(const String& fields, const char* name) {
+  const size_t name_len = strlen(name);
+  int start = 0;
+  while (start <= (int)fields.length()) {
+    int end = fields.indexOf(',', start);
+    if (end < 0) {
+      end = fields.length();
+    }
+    String token = fields.substring(start, end);
+    token.trim();
+    if (token.length() == name_len && token.equalsIgnoreCase(name)) {
+      return true;
+    }
+    start = end + 1;
+  }
+  return false;
+}
+
+static void sendStatusBody(AsyncWebServerRequest* request, const String& body, const String& etag,
+                           uint32_t started_us) {
+  AsyncWebServerResponse* response = request->beginResponse(200, "application/json", body);
+  response->addHeader("Cache-Control", "no-cache");
+  if (etag.length() > 0) {
+    response->addHeader("ETag", etag);
+  }
+  // Handler cost for before/after comparisons in the browser network panel.
+  response->addHeader("Server-Timing", String("build;dur=") + String((micros() - started_us) / 1000.0f, 2));
+  request->send(response);
+}
+
+// Aggregated status endpoint used by Home and Diagnostics pages.
+//   /api/status                     every section (legacy shape) plus configEtag
+//   /api/status?fields=core,can     only the named sections; add configEtag to get the current tag
+//   /api/status?fields=config       cached config sections; honours If-None-Match
+static void handleStatus(AsyncWebServerRequest* request) {
+  const uint32_t started_us = micros();
+  const String fields = request->hasParam("fields") ? request->getParam("fields")->value() : String();
+
+  if (fields == "config") {
+    refreshStatusConfigCache();
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == status_config_etag) {
+      AsyncWebServerResponse* response = request->beginResponse(304);
+      response->addHeader("ETag", status_config_etag);
+      request->send(response);
       return;
     }
-    f["ok"] = true;
-    f["generated"] = frame.generated;
-    f["ageMs"] = frame.ageMs;
-    f["dlc"] = frame.dlc;
-    f["data"] = frameDataHex(frame);
-  };
+    sendStatusBody(request, status_config_body, status_config_etag, started_us);
+    return;
+  }
 
-  addFrameDiag("motor1", MOTOR1_ID);
-  addFrameDiag("motor3", MOTOR3_ID);
-  addFrameDiag("brakes1", BRAKES1_ID);
-  addFrameDiag("brakes2", BRAKES2_ID);
-  addFrameDiag("brakes3", BRAKES3_ID);
+  status_build_t build = {};
+  telemetryRead(build.telemetry);
+  JsonDocument doc;
+  for (size_t i = 0; i < k_status_section_count; i++) {
+    if (fields.length() == 0 || statusFieldSelected(fields, k_status_sections[i].name)) {
+      k_status_sections[i].write(doc, build);
+    }
+  }
+  if (fields.length() == 0 || statusFieldSelected(fields, "configEtag")) {
+    refreshStatusConfigCache();
+    doc["configEtag"] = status_config_etag;
+  }
 
-  sendJson(request, 200, doc);
+  String out;
+  serializeJson(doc, out);
+  sendStatusBody(request, out, String(), started_us);
 }
 
 static void handleLearnStatus(AsyncWebServerRequest* request) {
@@ -893,6 +1290,53 @@ static void handleModeJson(AsyncWebServerRequest* request, const String& body) {
   sendJson(request, 200, resp);
 }
 
+// Reply body of /api/settings (GET and POST): the runtime toggles plus the mappings and trigger config.
+static void writeSettingsJson(JsonDocument& resp, const String& mapped_speed, const String& mapped_throttle,
+                              const String& mapped_rpm, const mode_trigger_config_t& mode_trigger_config) {
+  resp["debugCaptureActive"] = loggingDebugCaptureActive();
+  resp["disableController"] = disableController;
+  resp["broadcastOpenHaldexOverCAN"] = broadcastOpenHaldexOverCAN;
+  resp["effectiveBroadcastOpenHaldexOverCAN"] = openhaldexEffectiveBroadcastOpenHaldexOverCAN();
+  resp["haldexGeneration"] = haldexGeneration;
+  resp["isStandalone"] = isStandalone;
+  JsonObject respPower = resp["lowPower"].to<JsonObject>();
+  respPower["sleepEnabled"] = lowPowerSleepEnabled;
+  respPower["sleepDelayMs"] = lowPowerSleepDelayMs;
+  respPower["wakeTimerSeconds"] = lowPowerWakeTimerSeconds;
+  respPower["probeDurationMs"] = lowPowerProbeDurationMs;
+  JsonObject respMappings = resp["inputMappings"].to<JsonObject>();
+  respMappings["speed"] = mapped_speed;
+  respMappings["throttle"] = mapped_throttle;
+  respMappings["rpm"] = mapped_rpm;
+  mode_trigger_config_t resp_default_trigger = {};
+  const bool resp_has_default_trigger = getRecommendedModeTriggerForGeneration(haldexGeneration, resp_default_trigger);
+  const String resp_mode_trigger_signal = mode_trigger_config.signal.length() > 0
+                                            ? mode_trigger_config.signal
+                                            : (resp_has_default_trigger ? resp_default_trigger.signal : "");
+  mode_trigger_runtime_t resp_mode_trigger_runtime = {};
+  modeTriggerRuntimeGet(resp_mode_trigger_runtime);
+  JsonObject respTrigger = resp["modeTrigger"].to<JsonObject>();
+  respTrigger["enabled"] = mode_trigger_config.enabled;
+  respTrigger["signal"] = resp_mode_trigger_signal;
+  respTrigger["defaultSignal"] = resp_has_default_trigger ? resp_default_trigger.signal : "";
+  respTrigger["operator"] = modeTriggerOperatorName(mode_trigger_config.op);
+  respTrigger["value"] = mode_trigger_config.value;
+  respTrigger["mode"] = modeName(mode_trigger_config.mode);
+  respTrigger["broadcastOpenHaldexOverCAN"] = mode_trigger_config.broadcastOpenHaldexOverCAN;
+  respTrigger["active"] = resp_mode_trigger_runtime.active;
+  respTrigger["seen"] = resp_mode_trigger_runtime.seen;
+  respTrigger["lastValue"] = resp_mode_trigger_runtime.lastValue;
+  respTrigger["ageMs"] = resp_mode_trigger_runtime.ageMs;
+  respTrigger["effectiveMode"] = modeName(openhaldexEffectiveMode());
+  respTrigger["effectiveBroadcastOpenHaldexOverCAN"] = openhaldexEffectiveBroadcastOpenHaldexOverCAN();
+  respTrigger["activeRule"] = modeTriggerActiveRule();
+  mode_trigger_rules_t resp_mode_trigger_rules = {};
+  JsonArray respRules = resp["modeTriggerRules"].to<JsonArray>();
+  if (modeTriggerRulesGet(resp_mode_trigger_rules, 2)) {
+    writeModeTriggerRulesJson(respRules, resp_mode_trigger_rules);
+  }
+}
+
 // Central settings mutator. This endpoint is authoritative for runtime toggles.
 static void handleSettingsJson(AsyncWebServerRequest* request, const String& body) {
   JsonDocument doc;
@@ -971,6 +1415,8 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
   bool dashboard_mappings_changed = false;
   bool mode_trigger_changed = false;
   mode_trigger_config_t next_mode_trigger = mode_trigger_config;
+  bool mode_trigger_rules_changed = false;
+  mode_trigger_rules_t next_mode_trigger_rules = {};
 
   if (doc.containsKey("inputMappings")) {
     JsonObject inputMappings = doc["inputMappings"].as<JsonObject>();
@@ -991,6 +1437,11 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
       mapped_rpm = sanitizeMappedSignalKey(inputMappings["rpm"] | "");
       mappings_changed = true;
     }
+    if (!mappedSignalKeyFits(mapped_speed) || !mappedSignalKeyFits(mapped_throttle) ||
+        !mappedSignalKeyFits(mapped_rpm)) {
+      sendError(request, 400, "inputMappings key too long");
+      return;
+    }
   }
 
   if (doc.containsKey("disableController")) {
@@ -1183,6 +1634,10 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
       const String slot_key = String("dash_") + String(i + 1);
       if (dashMappings.containsKey(slot_key)) {
         dashboard_slots[i] = sanitizeMappedSignalKey(dashMappings[slot_key] | "");
+        if (!mappedSignalKeyFits(dashboard_slots[i])) {
+          sendError(request, 400, "dashMappings key too long");
+          return;
+        }
         dashboard_mappings_changed = true;
       }
     }
@@ -1201,6 +1656,10 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
     }
     if (trigger.containsKey("signal")) {
       next_mode_trigger.signal = sanitizeMappedSignalKey(trigger["signal"] | "");
+      if (!mappedSignalKeyFits(next_mode_trigger.signal)) {
+        sendError(request, 400, "modeTrigger.signal too long");
+        return;
+      }
       mode_trigger_changed = true;
     }
     if (trigger.containsKey("operator")) {
@@ -1240,6 +1699,20 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
     }
   }
 
+  if (doc.containsKey("modeTriggerRules")) {
+    JsonArrayConst rules = doc["modeTriggerRules"].as<JsonArrayConst>();
+    if (rules.isNull()) {
+      sendError(request, 400, "invalid modeTriggerRules");
+      return;
+    }
+    const char* rules_error = parseModeTriggerRules(rules, next_mode_trigger_rules);
+    if (rules_error) {
+      sendError(request, 400, rules_error);
+      return;
+    }
+    mode_trigger_rules_changed = true;
+  }
+
   const uint8_t effective_haldex_generation = haldex_generation_set ? next_haldex_generation : haldexGeneration;
   if (haldex_generation_set && !low_power_sleep_set) {
     low_power_sleep_set = true;
@@ -1282,6 +1755,15 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
     dirty = true;
   }
 
+  if (mode_trigger_rules_changed) {
+    if (!modeTriggerRulesSet(next_mode_trigger_rules, 20)) {
+      sendError(request, 503, "mode trigger rules update busy");
+      return;
+    }
+    modeTriggerRuntimeReset();
+    dirty = true;
+  }
+
   if (disable_controller_set) {
     if (next_disable_controller) {
       applyRuntimeMode(MODE_STOCK);
@@ -1426,42 +1908,25 @@ static void handleSettingsJson(AsyncWebServerRequest* request, const String& bod
 
   JsonDocument resp;
   resp["ok"] = true;
-  resp["debugCaptureActive"] = loggingDebugCaptureActive();
-  resp["disableController"] = disableController;
-  resp["broadcastOpenHaldexOverCAN"] = broadcastOpenHaldexOverCAN;
-  resp["effectiveBroadcastOpenHaldexOverCAN"] = openhaldexEffectiveBroadcastOpenHaldexOverCAN();
-  resp["haldexGeneration"] = haldexGeneration;
-  resp["isStandalone"] = isStandalone;
-  JsonObject respPower = resp["lowPower"].to<JsonObject>();
-  respPower["sleepEnabled"] = lowPowerSleepEnabled;
-  respPower["sleepDelayMs"] = lowPowerSleepDelayMs;
-  respPower["wakeTimerSeconds"] = lowPowerWakeTimerSeconds;
-  respPower["probeDurationMs"] = lowPowerProbeDurationMs;
-  JsonObject respMappings = resp["inputMappings"].to<JsonObject>();
-  respMappings["speed"] = mapped_speed;
-  respMappings["throttle"] = mapped_throttle;
-  respMappings["rpm"] = mapped_rpm;
-  mode_trigger_config_t resp_default_trigger = {};
-  const bool resp_has_default_trigger = getRecommendedModeTriggerForGeneration(haldexGeneration, resp_default_trigger);
-  const String resp_mode_trigger_signal = mode_trigger_config.signal.length() > 0
-                                            ? mode_trigger_config.signal
-                                            : (resp_has_default_trigger ? resp_default_trigger.signal : "");
-  mode_trigger_runtime_t resp_mode_trigger_runtime = {};
-  modeTriggerRuntimeGet(resp_mode_trigger_runtime);
-  JsonObject respTrigger = resp["modeTrigger"].to<JsonObject>();
-  respTrigger["enabled"] = mode_trigger_config.enabled;
-  respTrigger["signal"] = resp_mode_trigger_signal;
-  respTrigger["defaultSignal"] = resp_has_default_trigger ? resp_default_trigger.signal : "";
-  respTrigger["operator"] = modeTriggerOperatorName(mode_trigger_config.op);
-  respTrigger["value"] = mode_trigger_config.value;
-  respTrigger["mode"] = modeName(mode_trigger_config.mode);
-  respTrigger["broadcastOpenHaldexOverCAN"] = mode_trigger_config.broadcastOpenHaldexOverCAN;
-  respTrigger["active"] = resp_mode_trigger_runtime.active;
-  respTrigger["seen"] = resp_mode_trigger_runtime.seen;
-  respTrigger["lastValue"] = resp_mode_trigger_runtime.lastValue;
-  respTrigger["ageMs"] = resp_mode_trigger_runtime.ageMs;
-  respTrigger["effectiveMode"] = modeName(openhaldexEffectiveMode());
-  respTrigger["effectiveBroadcastOpenHaldexOverCAN"] = openhaldexEffectiveBroadcastOpenHaldexOverCAN();
+  writeSettingsJson(resp, mapped_speed, mapped_throttle, mapped_rpm, mode_trigger_config);
+  sendJson(request, 200, resp);
+}
+
+// Same body as a POST /api/settings reply, from the current state; lets the setup page read back what it
+// cannot see in its own form, such as modeTriggerRules.
+static void handleSettingsGet(AsyncWebServerRequest* request) {
+  String mapped_speed;
+  String mapped_throttle;
+  String mapped_rpm;
+  getMappedInputSnapshot(mapped_speed, mapped_throttle, mapped_rpm);
+  mode_trigger_config_t mode_trigger_config = {};
+  if (!modeTriggerConfigGet(mode_trigger_config, 2)) {
+    (void)getRecommendedModeTriggerForGeneration(haldexGeneration, mode_trigger_config);
+  }
+
+  JsonDocument resp;
+  resp["ok"] = true;
+  writeSettingsJson(resp, mapped_speed, mapped_throttle, mapped_rpm, mode_trigger_config);
   sendJson(request, 200, resp);
 }
 
@@ -1562,12 +2027,17 @@ static void handleMapPost(AsyncWebServerRequest* request, const String& body) {
     return;
   }
 
+  // Stage the whole payload first so a bad row never leaves a partially edited map behind.
+  uint16_t staged_speed_bins[MAP_SPEED_BINS];
+  uint8_t staged_throttle_bins[MAP_THROTTLE_BINS];
+  uint8_t staged_lock_table[MAP_THROTTLE_BINS][MAP_SPEED_BINS];
+
   for (uint8_t i = 0; i < MAP_SPEED_BINS; i++) {
-    map_speed_bins[i] = (uint16_t)(speedBins[i] | 0);
+    staged_speed_bins[i] = (uint16_t)(speedBins[i] | 0);
   }
 
   for (uint8_t i = 0; i < MAP_THROTTLE_BINS; i++) {
-    map_throttle_bins[i] = (uint8_t)(throttleBins[i] | 0);
+    staged_throttle_bins[i] = (uint8_t)(throttleBins[i] | 0);
   }
 
   for (uint8_t t = 0; t < MAP_THROTTLE_BINS; t++) {
@@ -1583,10 +2053,24 @@ static void handleMapPost(AsyncWebServerRequest* request, const String& body) {
         v = 0;
       if (v > 100)
         v = 100;
-      map_lock_table[t][s] = (uint8_t)v;
+      staged_lock_table[t][s] = (uint8_t)v;
     }
   }
 
+  // Swap the staged map in; on a publish timeout swap the old one back, so a later publish or save
+  // cannot pick up a change the client was told failed.
+  std::swap(map_speed_bins, staged_speed_bins);
+  std::swap(map_throttle_bins, staged_throttle_bins);
+  std::swap(map_lock_table, staged_lock_table);
+  if (!lockTablesPublish()) {
+    std::swap(map_speed_bins, staged_speed_bins);
+    std::swap(map_throttle_bins, staged_throttle_bins);
+    std::swap(map_lock_table, staged_lock_table);
+    filelogLogError("map", "lock table publish timed out");
+    sendError(request, 503, "map busy");
+    return;
+  }
+
   storageMarkDirty();
   filelogLogEvent("map", "active map updated");
 
@@ -1675,6 +2159,63 @@ static void handleMapDelete(AsyncWebServerRequest* request, const String& body)
   sendJson(request, 200, resp);
 }
 
+// Human-readable copy of a stored map (or the active map when no path is given).
+static void handleMapExport(AsyncWebServerRequest* request) {
+  String path = request->hasParam("path") ? request->getParam("path")->value() : String();
+  const bool asTxt = request->hasParam("format") && request->getParam("format")->value() == "txt";
+
+  String out;
+  if (!storageExportMap(path, asTxt, out)) {
+    sendError(request, 404, "export failed");
+    return;
+  }
+
+  String name = path.length() > 0 ? path.substring(path.lastIndexOf('/') + 1) : String("openhaldex-map");
+  const int dot = name.lastIndexOf('.');
+  if (dot > 0) {
+    name = name.substring(0, dot);
+  }
+  AsyncWebServerResponse* response = request->beginResponse(200, asTxt ? "text/plain" : "application/json", out);
+  response->addHeader("Content-Disposition",
+                      String("attachment; filename=\"") + name + (asTxt ? ".txt\"" : ".json\""));
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+// Store a JSON or TXT map as a binary library map; the active map is left untouched.
+static void handleMapImport(AsyncWebServerRequest* request, const String& body) {
+  JsonDocument doc;
+  if (deserializeJson(doc, body) != DeserializationError::Ok) {
+    sendError(request, 400, "invalid json");
+    return;
+  }
+
+  String name = doc["name"] | "";
+  if (name.length() == 0) {
+    sendError(request, 400, "missing name");
+    return;
+  }
+
+  String outPath;
+  bool ok = false;
+  if (doc["text"].is<const char*>()) {
+    ok = storageImportMapTxt(name, String(doc["text"].as<const char*>()), outPath);
+  } else if (doc["map"].is<JsonObject>()) {
+    ok = storageImportMapJson(name, doc["map"].as<JsonVariantConst>(), outPath);
+  } else {
+    ok = storageImportMapJson(name, doc.as<JsonVariantConst>(), outPath);
+  }
+  if (!ok) {
+    sendError(request, 400, "import failed");
+    return;
+  }
+
+  JsonDocument resp;
+  resp["ok"] = true;
+  resp["path"] = outPath;
+  sendJson(request, 200, resp);
+}
+
 static void handleWifiGet(AsyncWebServerRequest* request) {
   JsonDocument doc;
   String ssid;
@@ -1792,6 +2333,56 @@ static void handleLogsList(AsyncWebServerRequest* request) {
   sendJson(request, 200, doc);
 }
 
+static uint32_t logsParamU32(AsyncWebServerRequest* request, const char* name) {
+  if (!request->hasParam(name)) {
+    return 0;
+  }
+  return (uint32_t)strtoul(request->getParam(name)->value().c_str(), nullptr, 10);
+}
+
+// Range mode: from/to select bytes, since/until select millis via the sparse index; streamed in chunks.
+static void handleLogsReadRange(AsyncWebServerRequest* request, const String& path) {
+  filelog_range_t range = {};
+  const bool by_time = request->hasParam("since") || request->hasParam("until");
+  bool ok = false;
+  if (by_time) {
+    ok = filelogResolveTimeRange(path, logsParamU32(request, "since"), logsParamU32(request, "until"), range);
+  } else {
+    ok = filelogResolveByteRange(path, logsParamU32(request, "from"), logsParamU32(request, "to"), range);
+  }
+  if (!ok) {
+    sendError(request, 404, "log read failed");
+    return;
+  }
+
+  const size_t start = range.start;
+  const size_t end = range.end;
+  AsyncWebServerResponse* response = request->beginChunkedResponse(
+    "text/plain", [path, start, end](uint8_t* buffer, size_t max_len, size_t index) -> size_t {
+      const size_t offset = start + index;
+      if (offset >= end) {
+        return 0;
+      }
+      const size_t want = (end - offset) < max_len ? (end - offset) : max_len;
+      size_t got = 0;
+      if (!filelogReadChunk(path, offset, buffer, want, got)) {
+        return RESPONSE_TRY_AGAIN;
+      }
+      return got;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  response->addHeader("X-Log-Size", String(range.size));
+  response->addHeader("X-Log-Range", String(start) + "-" + String(end));
+  if (by_time) {
+    response->addHeader("X-Log-Indexed", range.indexed ? "1" : "0");
+  }
+  if (request->hasParam("download")) {
+    String name = path.substring(path.lastIndexOf('/') + 1);
+    response->addHeader("Content-Disposition", String("attachment; filename=\"") + name + "\"");
+  }
+  request->send(response);
+}
+
 static void handleLogsRead(AsyncWebServerRequest* request) {
   if (!request->hasParam("path")) {
     sendError(request, 400, "missing path");
@@ -1799,6 +2390,12 @@ static void handleLogsRead(AsyncWebServerRequest* request) {
   }
 
   String path = request->getParam("path")->value();
+  if (request->hasParam("from") || request->hasParam("to") || request->hasParam("since") ||
+      request->hasParam("until")) {
+    handleLogsReadRange(request, path);
+    return;
+  }
+
   size_t max_bytes = 32768;
   if (request->hasParam("max")) {
     int max = request->getParam("max")->value().toInt();
@@ -1902,11 +2499,25 @@ static void handleSpeedCurvePost(AsyncWebServerRequest* request, const String& b
     return;
   }
 
+  const uint8_t prev_count = speed_curve_count;
+  uint16_t prev_bins[CURVE_POINTS_MAX];
+  uint8_t prev_locks[CURVE_POINTS_MAX];
+  memcpy(prev_bins, speed_curve_bins, sizeof(prev_bins));
+  memcpy(prev_locks, speed_curve_lock, sizeof(prev_locks));
   speed_curve_count = count;
   for (uint8_t i = 0; i < CURVE_POINTS_MAX; i++) {
     speed_curve_bins[i] = (i < count) ? bins[i] : 0;
     speed_curve_lock[i] = (i < count) ? locks[i] : 0;
   }
+  if (!lockTablesPublish()) {
+    // Not published, so not applied: restore the working curve too.
+    speed_curve_count = prev_count;
+    memcpy(speed_curve_bins, prev_bins, sizeof(prev_bins));
+    memcpy(speed_curve_lock, prev_locks, sizeof(prev_locks));
+    filelogLogError("curve/speed", "lock table publish timed out");
+    sendError(request, 503, "curve busy");
+    return;
+  }
 
   storageMarkDirty();
   filelogLogEvent("curve/speed", String("saved count=") + String(count));
@@ -1968,11 +2579,25 @@ static void handleThrottleCurvePost(AsyncWebServerRequest* request, const String
     return;
   }
 
+  const uint8_t prev_count = throttle_curve_count;
+  uint8_t prev_bins[CURVE_POINTS_MAX];
+  uint8_t prev_locks[CURVE_POINTS_MAX];
+  memcpy(prev_bins, throttle_curve_bins, sizeof(prev_bins));
+  memcpy(prev_locks, throttle_curve_lock, sizeof(prev_locks));
   throttle_curve_count = count;
   for (uint8_t i = 0; i < CURVE_POINTS_MAX; i++) {
     throttle_curve_bins[i] = (i < count) ? bins[i] : 0;
     throttle_curve_lock[i] = (i < count) ? locks[i] : 0;
   }
+  if (!lockTablesPublish()) {
+    // Not published, so not applied: restore the working curve too.
+    throttle_curve_count = prev_count;
+    memcpy(throttle_curve_bins, prev_bins, sizeof(prev_bins));
+    memcpy(throttle_curve_lock, prev_locks, sizeof(prev_locks));
+    filelogLogError("curve/throttle", "lock table publish timed out");
+    sendError(request, 503, "curve busy");
+    return;
+  }
 
   storageMarkDirty();
   filelogLogEvent("curve/throttle", String("saved count=") + String(count));
@@ -2032,11 +2657,25 @@ static void handleRpmCurvePost(AsyncWebServerRequest* request, const String& bod
     return;
   }
 
+  const uint8_t prev_count = rpm_curve_count;
+  uint16_t prev_bins[CURVE_POINTS_MAX];
+  uint8_t prev_locks[CURVE_POINTS_MAX];
+  memcpy(prev_bins, rpm_curve_bins, sizeof(prev_bins));
+  memcpy(prev_locks, rpm_curve_lock, sizeof(prev_locks));
   rpm_curve_count = count;
   for (uint8_t i = 0; i < CURVE_POINTS_MAX; i++) {
     rpm_curve_bins[i] = (i < count) ? bins[i] : 0;
     rpm_curve_lock[i] = (i < count) ? locks[i] : 0;
   }
+  if (!lockTablesPublish()) {
+    // Not published, so not applied: restore the working curve too.
+    rpm_curve_count = prev_count;
+    memcpy(rpm_curve_bins, prev_bins, sizeof(prev_bins));
+    memcpy(rpm_curve_lock, prev_locks, sizeof(prev_locks));
+    filelogLogError("curve/rpm", "lock table publish timed out");
+    sendError(request, 503, "curve busy");
+    return;
+  }
 
   storageMarkDirty();
   filelogLogEvent("curve/rpm", String("saved count=") + String(count));
@@ -2129,36 +2768,190 @@ static void handleUdsStatus(AsyncWebServerRequest* request) {
   sendJson(request, 200, doc);
 }
 
-static void handleUdsProbe(AsyncWebServerRequest* request) {
-  diag_uds_result_t result = {};
-  const bool ok = diagUdsProbeHaldex(result, 900);
+// Partial update: omitted keys keep their current value. stMin uses the raw ISO 15765-2 byte.
+static void handleUdsIsoTpJson(AsyncWebServerRequest* request, const String& body) {
+  JsonDocument in;
+  DeserializationError err = deserializeJson(in, body);
+  if (err) {
+    sendError(request, 400, "invalid json");
+    return;
+  }
+
+  diag_isotp_config_t isotp;
+  diagUdsIsoTpConfigGet(isotp);
+  const uint32_t block_size = in["blockSize"] | (uint32_t)isotp.rxBlockSize;
+  const uint32_t st_min = in["stMin"] | (uint32_t)isotp.rxStMin;
+  const uint32_t n_bs = in["nBsMs"] | (uint32_t)isotp.nBsMs;
+  const uint32_t n_cr = in["nCrMs"] | (uint32_t)isotp.nCrMs;
+  if (block_size > 0xFF || st_min > 0xFF || n_bs > 0xFFFF || n_cr > 0xFFFF) {
+    sendError(request, 400, "invalid iso-tp parameters");
+    return;
+  }
+  isotp.rxBlockSize = (uint8_t)block_size;
+  isotp.rxStMin = (uint8_t)st_min;
+  isotp.nBsMs = (uint16_t)n_bs;
+  isotp.nCrMs = (uint16_t)n_cr;
+  if (!diagUdsIsoTpConfigSet(isotp)) {
+    sendError(request, 400, "invalid iso-tp parameters");
+    return;
+  }
+
   JsonDocument doc;
-  writeUdsEnvelope(doc, result, ok);
+  diagUdsWriteStatusJson(doc.to<JsonObject>());
+  sendJson(request, 200, doc);
+}
 
-  const uint8_t* data = nullptr;
-  uint16_t len = 0;
-  if (udsDidResponseData(result, 0xF19E, data, len)) {
-    doc["asamOdxFileIdentifier"] = decodeUdsDataValue(data, len, true);
+static void submitDiagJob(AsyncWebServerRequest* request, const char* kind, diag_job_fn_t fn,
+                          const diag_job_args_t& args) {
+  const uint32_t id = diagJobSubmit(kind, fn, args);
+  if (id == 0) {
+    sendError(request, 503, "diagnostic queue full");
+    return;
+  }
+  JsonDocument doc;
+  doc["ok"] = true;
+  doc["jobId"] = id;
+  doc["kind"] = kind;
+  doc["state"] = diagJobStateName(DIAG_JOB_QUEUED);
+  doc["poll"] = String("/api/diag/job?id=") + String(id);
+  sendJson(request, 202, doc);
+}
+
+#if OH_BENCH_API
+static void runBenchJob(const diag_job_args_t& args, JsonDocument& doc) {
+  doc["ok"] = true;
+  doc["env"] = benchEnvLine();
+  JsonArray lines = doc["lines"].to<JsonArray>();
+  benchRunSuite(
+    args.values[0], args.values[1], (uint8_t)args.values[2],
+    [](const bench_result_t& result, void* ctx) { ((JsonArray*)ctx)->add(benchResultLine(result)); }, &lines);
+}
+
+// Hidden, bench firmware only (OH_BENCH_API): the microbenchmark suite against live state
+// (functions/bench/bench.h). It runs as a diag job, so the web server stays responsive; diag requests
+// and the poller wait until it is done.
+static void handleBench(AsyncWebServerRequest* request) {
+  const String filter = request->hasParam("filter") ? request->getParam("filter")->value() : String();
+  const uint32_t cases = benchSelectCases(filter.c_str());
+  if (cases == 0) {
+    sendError(request, 400, "no matching benchmark");
+    return;
+  }
+  uint32_t scale = request->hasParam("scale") ? (uint32_t)request->getParam("scale")->value().toInt() : 1;
+  uint32_t repeat = request->hasParam("repeat") ? (uint32_t)request->getParam("repeat")->value().toInt() : 3;
+  diag_job_args_t args = {};
+  args.values[0] = cases;
+  args.values[1] = constrain(scale, 1U, 20U);
+  args.values[2] = constrain(repeat, 1U, 10U);
+  args.count = 3;
+  submitDiagJob(request, "bench", runBenchJob, args);
+}
+#endif
+
+static void handleDiagJob(AsyncWebServerRequest* request) {
+  if (!request->hasParam("id")) {
+    sendError(request, 400, "id query parameter required");
+    return;
+  }
+  const uint32_t id = (uint32_t)strtoul(request->getParam("id")->value().c_str(), nullptr, 10);
+  diag_job_info_t info;
+  if (!diagJobGet(id, info)) {
+    sendError(request, 404, "unknown or expired job");
+    return;
+  }
+
+  JsonDocument doc;
+  doc["jobId"] = info.id;
+  doc["kind"] = info.kind;
+  doc["state"] = diagJobStateName(info.state);
+  doc["ageMs"] = info.ageMs;
+  doc["runMs"] = info.runMs;
+  doc["queuedAhead"] = info.queuedAhead;
+  if (info.state == DIAG_JOB_DONE) {
+    doc["result"] = serialized(info.result);
   }
   sendJson(request, 200, doc);
 }
 
-static void handleUdsReadDid(AsyncWebServerRequest* request) {
-  if (!request->hasParam("did")) {
-    sendError(request, 400, "did query parameter required");
+static void handleDiagJobs(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  diagJobsWriteStatusJson(doc.to<JsonObject>());
+  sendJson(request, 200, doc);
+}
+
+// Cached measured values from the background poller; no bus traffic per request.
+static void handleDiagPollGet(AsyncWebServerRequest* request) {
+  JsonDocument doc;
+  doc["haldexGeneration"] = haldexGeneration;
+  diagPollWriteJson(doc.to<JsonObject>());
+  sendJson(request, 200, doc);
+}
+
+// Partial update: omitted keys keep their current value; dids uses the measured-value DID[:len] list.
+static void handleDiagPollJson(AsyncWebServerRequest* request, const String& body) {
+  JsonDocument in;
+  DeserializationError err = deserializeJson(in, body);
+  if (err) {
+    sendError(request, 400, "invalid json");
     return;
   }
 
-  uint32_t parsed = 0;
-  if (!parseHexU32(request->getParam("did")->value(), parsed) || parsed > 0xFFFF) {
-    sendError(request, 400, "invalid did");
+  diag_poll_config_t config;
+  diagPollConfigGet(config);
+  config.enabled = in["enabled"] | config.enabled;
+  config.log = in["log"] | config.log;
+  const uint32_t interval = in["intervalMs"] | (uint32_t)config.intervalMs;
+  if (interval > 0xFFFF) {
+    sendError(request, 400, "invalid intervalMs");
+    return;
+  }
+  config.intervalMs = (uint16_t)interval;
+
+  if (in.containsKey("dids")) {
+    uint32_t values[OH_DIAG_POLL_MAX] = {};
+    uint8_t count = 0;
+    const String raw = in["dids"] | "";
+    if (raw.length() > 0 && !parseDidLengthList(raw, values, count, OH_DIAG_POLL_MAX)) {
+      sendError(request, 400, "invalid did list");
+      return;
+    }
+    config.count = count;
+    for (uint8_t i = 0; i < count; i++) {
+      config.dids[i] = (uint16_t)(values[i] & 0xFFFF);
+      config.lengths[i] = (uint16_t)(values[i] >> 16);
+    }
+  }
+
+  if (!diagPollConfigSet(config)) {
+    sendError(request, 400, "invalid poll config");
     return;
   }
+  handleDiagPollGet(request);
+}
+
+static void runUdsProbeJob(const diag_job_args_t& args, JsonDocument& doc) {
+  (void)args;
+  diag_uds_result_t result = {};
+  const bool ok = diagUdsProbeHaldex(result, 900);
+  writeUdsEnvelope(doc, result, ok);
+
+  const uint8_t* data = nullptr;
+  uint16_t len = 0;
+  if (udsDidResponseData(result, 0xF19E, data, len)) {
+    doc["asamOdxFileIdentifier"] = decodeUdsDataValue(data, len, true);
+  }
+}
+
+static void handleUdsProbe(AsyncWebServerRequest* request) {
+  const diag_job_args_t args = {};
+  submitDiagJob(request, "probe", runUdsProbeJob, args);
+}
 
-  const uint16_t did = (uint16_t)parsed;
+// args: values[0] = DID
+static void runUdsReadDidJob(const diag_job_args_t& args, JsonDocument& doc) {
+  const uint16_t did = (uint16_t)args.values[0];
   diag_uds_result_t result = {};
   const bool ok = diagUdsReadDataByIdentifier(did, result, 1500);
-  JsonDocument doc;
   writeUdsEnvelope(doc, result, ok);
   doc["did"] = apiHexWord(did);
 
@@ -2168,7 +2961,24 @@ static void handleUdsReadDid(AsyncWebServerRequest* request) {
     doc["rawDataHex"] = apiBytesHex(data, len);
     doc["value"] = decodeUdsDataValue(data, len, true);
   }
-  sendJson(request, 200, doc);
+}
+
+static void handleUdsReadDid(AsyncWebServerRequest* request) {
+  if (!request->hasParam("did")) {
+    sendError(request, 400, "did query parameter required");
+    return;
+  }
+
+  uint32_t parsed = 0;
+  if (!parseHexU32(request->getParam("did")->value(), parsed) || parsed > 0xFFFF) {
+    sendError(request, 400, "invalid did");
+    return;
+  }
+
+  diag_job_args_t args = {};
+  args.values[0] = parsed;
+  args.count = 1;
+  submitDiagJob(request, "readDid", runUdsReadDidJob, args);
 }
 
 static void handleUdsReadDidJson(AsyncWebServerRequest* request, const String& body) {
@@ -2185,23 +2995,14 @@ static void handleUdsReadDidJson(AsyncWebServerRequest* request, const String& b
     return;
   }
 
-  diag_uds_result_t result = {};
-  const bool ok = diagUdsReadDataByIdentifier(did, result, 1500);
-  JsonDocument doc;
-  writeUdsEnvelope(doc, result, ok);
-  doc["did"] = apiHexWord(did);
-
-  const uint8_t* data = nullptr;
-  uint16_t len = 0;
-  if (udsDidResponseData(result, did, data, len)) {
-    doc["rawDataHex"] = apiBytesHex(data, len);
-    doc["value"] = decodeUdsDataValue(data, len, true);
-  }
-  sendJson(request, 200, doc);
+  diag_job_args_t args = {};
+  args.values[0] = did;
+  args.count = 1;
+  submitDiagJob(request, "readDid", runUdsReadDidJob, args);
 }
 
-static void handleUdsIdentity(AsyncWebServerRequest* request) {
-  JsonDocument doc;
+static void runUdsIdentityJob(const diag_job_args_t& args, JsonDocument& doc) {
+  (void)args;
   doc["ok"] = false;
   doc["haldexGeneration"] = haldexGeneration;
 
@@ -2212,7 +3013,6 @@ static void handleUdsIdentity(AsyncWebServerRequest* request) {
       diagUdsWriteResultJson(resultObj, probe);
       JsonObject uds = doc["uds"].to<JsonObject>();
       diagUdsWriteStatusJson(uds);
-      sendJson(request, 200, doc);
       return;
     }
   }
@@ -2265,7 +3065,22 @@ static void handleUdsIdentity(AsyncWebServerRequest* request) {
   doc["meaningfulPositiveResponseCount"] = meaningful_count;
   JsonObject uds = doc["uds"].to<JsonObject>();
   diagUdsWriteStatusJson(uds);
-  sendJson(request, 200, doc);
+}
+
+static void handleUdsIdentity(AsyncWebServerRequest* request) {
+  const diag_job_args_t args = {};
+  submitDiagJob(request, "identity", runUdsIdentityJob, args);
+}
+
+// args: values[0] = status mask
+static void runUdsDtcJob(const diag_job_args_t& args, JsonDocument& doc) {
+  const uint8_t status_mask = (uint8_t)args.values[0];
+  diag_uds_result_t result = {};
+  const bool ok = diagUdsReadDtcByStatus(status_mask, result, 3000);
+  writeUdsEnvelope(doc, result, ok);
+  doc["statusMask"] = apiHexByte(status_mask);
+  JsonObject parsed = doc["dtc"].to<JsonObject>();
+  parseUdsDtcPayload(parsed, result);
 }
 
 static void handleUdsDtc(AsyncWebServerRequest* request) {
@@ -2279,25 +3094,108 @@ static void handleUdsDtc(AsyncWebServerRequest* request) {
     status_mask = (uint8_t)parsed;
   }
 
-  diag_uds_result_t result = {};
-  const bool ok = diagUdsReadDtcByStatus(status_mask, result, 3000);
-  JsonDocument doc;
-  writeUdsEnvelope(doc, result, ok);
-  doc["statusMask"] = apiHexByte(status_mask);
-  JsonObject parsed = doc["dtc"].to<JsonObject>();
-  parseUdsDtcPayload(parsed, result);
-  sendJson(request, 200, doc);
+  diag_job_args_t args = {};
+  args.values[0] = status_mask;
+  args.count = 1;
+  submitDiagJob(request, "dtc", runUdsDtcJob, args);
 }
 
-static void handleMeasuredValues(AsyncWebServerRequest* request) {
-  static const uint8_t k_max_items = 16;
-  uint32_t ids[k_max_items] = {};
-  uint8_t id_count = 0;
+// args: (expected data length << 16) | DID, in order; length 0 when unknown
+static void runUdsMeasuredJob(const diag_job_args_t& args, JsonDocument& doc) {
+  static uint8_t did_data[2048]; // only the diag job worker runs this
+  diag_uds_did_read_t reads[OH_DIAG_JOB_ARG_MAX] = {};
+  for (uint8_t i = 0; i < args.count; i++) {
+    reads[i].did = (uint16_t)(args.values[i] & 0xFFFF);
+    reads[i].expectedLen = (uint16_t)(args.values[i] >> 16);
+  }
 
-  JsonDocument doc;
+  const uint32_t started_ms = millis();
+  diag_uds_result_t last = {};
+  const uint8_t positive_count =
+    diagUdsReadDataByIdentifiers(reads, args.count, did_data, sizeof(did_data), last, 1500);
+
+  doc["haldexGeneration"] = haldexGeneration;
+  JsonArray items = doc["items"].to<JsonArray>();
+  for (uint8_t i = 0; i < args.count; i++) {
+    const diag_uds_did_read_t& read = reads[i];
+    JsonObject row = items.add<JsonObject>();
+    row["id"] = apiHexWord(read.did);
+    row["did"] = apiHexWord(read.did);
+    row["ok"] = read.ok;
+    row["batched"] = read.batched;
+    row["status"] = read.status ? read.status : "";
+    row["message"] = read.message ? read.message : "";
+    if (read.ok) {
+      row["rawDataHex"] = apiBytesHex(&did_data[read.dataOffset], read.dataLen);
+      row["value"] = decodeUdsDataValue(&did_data[read.dataOffset], read.dataLen, false);
+    }
+    if (read.negative) {
+      row["nrc"] = apiHexByte(read.nrc);
+      row["nrcName"] = diagUdsNrcName(read.nrc);
+    }
+  }
+
+  doc["ok"] = positive_count > 0;
+  doc["transport"] = "uds_can";
+  doc["requestKind"] = "did";
+  doc["itemCount"] = args.count;
+  doc["positiveResponseCount"] = positive_count;
+  doc["elapsedMs"] = millis() - started_ms;
+  JsonObject uds = doc["uds"].to<JsonObject>();
+  diagUdsWriteStatusJson(uds);
+}
+
+// args: the KWP local identifiers to read, in order
+static void runKwpMeasuredJob(const diag_job_args_t& args, JsonDocument& doc) {
   doc["haldexGeneration"] = haldexGeneration;
   JsonArray items = doc["items"].to<JsonArray>();
 
+  uint8_t positive_count = 0;
+  for (uint8_t i = 0; i < args.count; i++) {
+    const uint8_t local_id = (uint8_t)args.values[i];
+    diag_uds_result_t result = {};
+    const bool ok = diagKwpTp20ReadLocalIdentifier(local_id, result, 5000);
+
+    JsonObject row = items.add<JsonObject>();
+    row["id"] = apiHexByte(local_id);
+    row["localIdentifier"] = apiHexByte(local_id);
+    row["ok"] = ok;
+    row["status"] = result.status ? result.status : "";
+    row["message"] = result.message ? result.message : "";
+
+    const uint8_t* data = nullptr;
+    uint16_t len = 0;
+    if (kwpLocalIdentifierResponseData(result, local_id, data, len)) {
+      row["rawDataHex"] = apiBytesHex(data, len);
+      row["value"] = decodeUdsDataValue(data, len, false);
+      positive_count++;
+    }
+    if (result.payloadLen > 0) {
+      row["responseHex"] = apiBytesHex(result.payload, result.payloadLen);
+    }
+    if (result.negative) {
+      row["nrc"] = apiHexByte(result.nrc);
+      row["nrcName"] = diagUdsNrcName(result.nrc);
+    }
+
+    if (result.timeout || result.busy) {
+      break;
+    }
+    vTaskDelay(pdMS_TO_TICKS(20));
+  }
+
+  doc["ok"] = positive_count > 0;
+  doc["transport"] = "kwp_tp20";
+  doc["requestKind"] = "localIdentifier";
+  doc["itemCount"] = args.count;
+  doc["positiveResponseCount"] = positive_count;
+  JsonObject uds = doc["uds"].to<JsonObject>();
+  diagUdsWriteStatusJson(uds);
+}
+
+static void handleMeasuredValues(AsyncWebServerRequest* request) {
+  diag_job_args_t args = {};
+
   if (haldexGeneration == 5) {
     String raw_ids = "";
     if (request->hasParam("dids")) {
@@ -2307,6 +3205,9 @@ static void handleMeasuredValues(AsyncWebServerRequest* request) {
     }
 
     if (raw_ids.length() == 0) {
+      JsonDocument doc;
+      doc["haldexGeneration"] = haldexGeneration;
+      doc["items"].to<JsonArray>();
       doc["ok"] = false;
       doc["transport"] = "uds_can";
       doc["requestKind"] = "did";
@@ -2318,53 +3219,11 @@ static void handleMeasuredValues(AsyncWebServerRequest* request) {
       return;
     }
 
-    if (!parseHexList(raw_ids, 0xFFFF, ids, id_count, k_max_items)) {
+    if (!parseDidLengthList(raw_ids, args.values, args.count, OH_DIAG_JOB_ARG_MAX)) {
       sendError(request, 400, "invalid did list");
       return;
     }
-
-    uint8_t positive_count = 0;
-    for (uint8_t i = 0; i < id_count; i++) {
-      const uint16_t did = (uint16_t)ids[i];
-      diag_uds_result_t result = {};
-      const bool ok = diagUdsReadDataByIdentifier(did, result, 1500);
-
-      JsonObject row = items.add<JsonObject>();
-      row["id"] = apiHexWord(did);
-      row["did"] = apiHexWord(did);
-      row["ok"] = ok;
-      row["status"] = result.status ? result.status : "";
-      row["message"] = result.message ? result.message : "";
-
-      const uint8_t* data = nullptr;
-      uint16_t len = 0;
-      if (udsDidResponseData(result, did, data, len)) {
-        row["rawDataHex"] = apiBytesHex(data, len);
-        row["value"] = decodeUdsDataValue(data, len, false);
-        positive_count++;
-      }
-      if (result.payloadLen > 0) {
-        row["responseHex"] = apiBytesHex(result.payload, result.payloadLen);
-      }
-      if (result.negative) {
-        row["nrc"] = apiHexByte(result.nrc);
-        row["nrcName"] = diagUdsNrcName(result.nrc);
-      }
-
-      if (result.timeout || result.busy) {
-        break;
-      }
-      vTaskDelay(pdMS_TO_TICKS(20));
-    }
-
-    doc["ok"] = positive_count > 0;
-    doc["transport"] = "uds_can";
-    doc["requestKind"] = "did";
-    doc["itemCount"] = id_count;
-    doc["positiveResponseCount"] = positive_count;
-    JsonObject uds = doc["uds"].to<JsonObject>();
-    diagUdsWriteStatusJson(uds);
-    sendJson(request, 200, doc);
+    submitDiagJob(request, "measured", runUdsMeasuredJob, args);
     return;
   }
 
@@ -2376,56 +3235,17 @@ static void handleMeasuredValues(AsyncWebServerRequest* request) {
       raw_ids = request->getParam("ids")->value();
     }
 
-    if (!parseHexList(raw_ids, 0xFF, ids, id_count, k_max_items)) {
+    if (!parseHexList(raw_ids, 0xFF, args.values, args.count, OH_DIAG_JOB_ARG_MAX)) {
       sendError(request, 400, "invalid local id list");
       return;
     }
-
-    uint8_t positive_count = 0;
-    for (uint8_t i = 0; i < id_count; i++) {
-      const uint8_t local_id = (uint8_t)ids[i];
-      diag_uds_result_t result = {};
-      const bool ok = diagKwpTp20ReadLocalIdentifier(local_id, result, 5000);
-
-      JsonObject row = items.add<JsonObject>();
-      row["id"] = apiHexByte(local_id);
-      row["localIdentifier"] = apiHexByte(local_id);
-      row["ok"] = ok;
-      row["status"] = result.status ? result.status : "";
-      row["message"] = result.message ? result.message : "";
-
-      const uint8_t* data = nullptr;
-      uint16_t len = 0;
-      if (kwpLocalIdentifierResponseData(result, local_id, data, len)) {
-        row["rawDataHex"] = apiBytesHex(data, len);
-        row["value"] = decodeUdsDataValue(data, len, false);
-        positive_count++;
-      }
-      if (result.payloadLen > 0) {
-        row["responseHex"] = apiBytesHex(result.payload, result.payloadLen);
-      }
-      if (result.negative) {
-        row["nrc"] = apiHexByte(result.nrc);
-        row["nrcName"] = diagUdsNrcName(result.nrc);
-      }
-
-      if (result.timeout || result.busy) {
-        break;
-      }
-      vTaskDelay(pdMS_TO_TICKS(20));
-    }
-
-    doc["ok"] = positive_count > 0;
-    doc["transport"] = "kwp_tp20";
-    doc["requestKind"] = "localIdentifier";
-    doc["itemCount"] = id_count;
-    doc["positiveResponseCount"] = positive_count;
-    JsonObject uds = doc["uds"].to<JsonObject>();
-    diagUdsWriteStatusJson(uds);
-    sendJson(request, 200, doc);
+    submitDiagJob(request, "measured", runKwpMeasuredJob, args);
     return;
   }
 
+  JsonDocument doc;
+  doc["haldexGeneration"] = haldexGeneration;
+  doc["items"].to<JsonArray>();
   doc["ok"] = false;
   doc["transport"] = "";
   doc["requestKind"] = "";
@@ -2436,6 +3256,25 @@ static void handleMeasuredValues(AsyncWebServerRequest* request) {
   sendJson(request, 200, doc);
 }
 
+// args: values[0] = group of DTC, values[1] = 1 for KWP TP2.0
+static void runClearDtcJob(const diag_job_args_t& args, JsonDocument& doc) {
+  const uint32_t group_of_dtc = args.values[0];
+  const bool kwp = args.values[1] != 0;
+  diag_uds_result_t result = {};
+  const bool ok =
+    kwp ? diagKwpTp20ClearDtc(group_of_dtc, result, 5000) : diagUdsClearDtc(group_of_dtc, result, 3000);
+
+  const uint8_t group_bytes[] = {
+    (uint8_t)((group_of_dtc >> 16) & 0xFF),
+    (uint8_t)((group_of_dtc >> 8) & 0xFF),
+    (uint8_t)(group_of_dtc & 0xFF),
+  };
+
+  writeUdsEnvelope(doc, result, ok);
+  doc["transport"] = kwp ? "kwp_tp20" : "uds_can";
+  doc["groupOfDTC"] = apiBytesHex(group_bytes, sizeof(group_bytes));
+}
+
 static void handleUdsClearDtc(AsyncWebServerRequest* request) {
   uint32_t group_of_dtc = 0xFFFFFFUL;
   if (request->hasParam("groupOfDTC")) {
@@ -2447,16 +3286,7 @@ static void handleUdsClearDtc(AsyncWebServerRequest* request) {
     group_of_dtc = parsed;
   }
 
-  diag_uds_result_t result = {};
-  bool ok = false;
-  const char* transport = "";
-  if (haldexGeneration == 5) {
-    transport = "uds_can";
-    ok = diagUdsClearDtc(group_of_dtc, result, 3000);
-  } else if (haldexGeneration == 2 || haldexGeneration == 4) {
-    transport = "kwp_tp20";
-    ok = diagKwpTp20ClearDtc(group_of_dtc, result, 5000);
-  } else {
+  if (haldexGeneration != 5 && haldexGeneration != 2 && haldexGeneration != 4) {
     JsonDocument doc;
     doc["ok"] = false;
     doc["haldexGeneration"] = haldexGeneration;
@@ -2469,17 +3299,11 @@ static void handleUdsClearDtc(AsyncWebServerRequest* request) {
     return;
   }
 
-  const uint8_t group_bytes[] = {
-    (uint8_t)((group_of_dtc >> 16) & 0xFF),
-    (uint8_t)((group_of_dtc >> 8) & 0xFF),
-    (uint8_t)(group_of_dtc & 0xFF),
-  };
-
-  JsonDocument doc;
-  writeUdsEnvelope(doc, result, ok);
-  doc["transport"] = transport;
-  doc["groupOfDTC"] = apiBytesHex(group_bytes, sizeof(group_bytes));
-  sendJson(request, 200, doc);
+  diag_job_args_t args = {};
+  args.values[0] = group_of_dtc;
+  args.values[1] = haldexGeneration == 5 ? 0 : 1;
+  args.count = 2;
+  submitDiagJob(request, "clearDtc", runClearDtcJob, args);
 }
 
 void setupApi(AsyncWebServer& server) {
@@ -2487,6 +3311,11 @@ void setupApi(AsyncWebServer& server) {
 
   server.on("/api/status", HTTP_GET, [](AsyncWebServerRequest* request) { handleStatus(request); });
   server.on("/api/uds/status", HTTP_GET, [](AsyncWebServerRequest* request) { handleUdsStatus(request); });
+  server.on(
+    "/api/uds/isotp", HTTP_POST, [](AsyncWebServerRequest* request) { (void)request; }, nullptr,
+    [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+      onJsonBody(request, data, len, index, total, handleUdsIsoTpJson);
+    });
   server.on("/api/uds/probe", HTTP_POST, [](AsyncWebServerRequest* request) { handleUdsProbe(request); });
   server.on("/api/uds/read", HTTP_GET, [](AsyncWebServerRequest* request) { handleUdsReadDid(request); });
   server.on(
@@ -2502,6 +3331,14 @@ void setupApi(AsyncWebServer& server) {
   server.on("/api/uds/measured", HTTP_GET, [](AsyncWebServerRequest* request) { handleMeasuredValues(request); });
   server.on("/api/uds/measured", HTTP_POST, [](AsyncWebServerRequest* request) { handleMeasuredValues(request); });
   server.on("/api/uds/clear-dtc", HTTP_POST, [](AsyncWebServerRequest* request) { handleUdsClearDtc(request); });
+  server.on("/api/diag/poll", HTTP_GET, [](AsyncWebServerRequest* request) { handleDiagPollGet(request); });
+  server.on(
+    "/api/diag/poll", HTTP_POST, [](AsyncWebServerRequest* request) { (void)request; }, nullptr,
+    [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+      onJsonBody(request, data, len, index, total, handleDiagPollJson);
+    });
+  server.on("/api/diag/job", HTTP_GET, [](AsyncWebServerRequest* request) { handleDiagJob(request); });
+  server.on("/api/diag/jobs", HTTP_GET, [](AsyncWebServerRequest* request) { handleDiagJobs(request); });
   server.on("/api/learn/status", HTTP_GET, [](AsyncWebServerRequest* request) { handleLearnStatus(request); });
   server.on("/api/learn/start", HTTP_POST, [](AsyncWebServerRequest* request) { handleLearnStart(request); });
   server.on("/api/learn/cancel", HTTP_POST, [](AsyncWebServerRequest* request) { handleLearnCancel(request); });
@@ -2513,6 +3350,7 @@ void setupApi(AsyncWebServer& server) {
       onJsonBody(request, data, len, index, total, handleModeJson);
     });
 
+  server.on("/api/settings", HTTP_GET, [](AsyncWebServerRequest* request) { handleSettingsGet(request); });
   server.on(
     "/api/settings", HTTP_POST, [](AsyncWebServerRequest* request) { (void)request; }, nullptr,
     [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
@@ -2549,6 +3387,13 @@ void setupApi(AsyncWebServer& server) {
     });
 
   server.on("/api/maps", HTTP_GET, [](AsyncWebServerRequest* request) { handleMapsList(request); });
+  server.on("/api/maps/export", HTTP_GET, [](AsyncWebServerRequest* request) { handleMapExport(request); });
+
+  server.on(
+    "/api/maps/import", HTTP_POST, [](AsyncWebServerRequest* request) { (void)request; }, nullptr,
+    [](AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+      onJsonBody(request, data, len, index, total, handleMapImport);
+    });
 
   server.on(
     "/api/maps/load", HTTP_POST, [](AsyncWebServerRequest* request) { (void)request; }, nullptr,
@@ -2593,6 +3438,9 @@ void setupApi(AsyncWebServer& server) {
   });
 
   server.on("/api/canview/dump", HTTP_GET, [](AsyncWebServerRequest* request) { handleCanviewDump(request); });
+#if OH_BENCH_API
+  server.on("/api/bench", HTTP_GET, [](AsyncWebServerRequest* request) { handleBench(request); });
+#endif
   server.on("/api/canview", HTTP_GET, [](AsyncWebServerRequest* request) { handleCanview(request); });
   server.on("/api/logs/read", HTTP_GET, [](AsyncWebServerRequest* request) { handleLogsRead(request); });
   server.on("/api/logs", HTTP_GET, [](AsyncWebServerRequest* request) { handleLogsList(request); });
@@ -0,0 +1,216 @@
+#include "functions/bench/bench.h"
+
+#include <string.h>
+
+#include "functions/can/standalone_can.h"
+#include "functions/canview/canview.h"
+#include "functions/canview/dbc_table.h"
+#include "functions/canview/vw_mqb_chassis_dbc.h"
+#include "functions/canview/vw_pq_chassis_dbc.h"
+#include "functions/config/config.h"
+#include "functions/core/calcs.h"
+#include "functions/core/state.h"
+
+// Release firmware leaves the suite out (see OH_BENCH_API); the host bench build always has it.
+#if OH_HOST || OH_BENCH_API
+
+struct bench_case_t {
+  const char* name;
+  uint32_t iterations; // at scale 1; sized for roughly 10-50 ms per case on the ESP32-S3
+  uint32_t (*run)(uint32_t iterations);
+};
+
+// Fixed pseudo-random payloads, so extraction and CRC work on varied bits but identical ones per run.
+#define BENCH_FRAME_COUNT 16
+static uint8_t bench_frames[BENCH_FRAME_COUNT][8];
+
+static void bench_fill_frames() {
+  uint32_t lcg = 0x12345678;
+  for (uint8_t f = 0; f < BENCH_FRAME_COUNT; f++) {
+    for (uint8_t i = 0; i < 8; i++) {
+      lcg = lcg * 1664525U + 1013904223U;
+      bench_frames[f][i] = (uint8_t)(lcg >> 24);
+    }
+  }
+}
+
+static uint32_t bench_fold(uint32_t acc, uint32_t value) {
+  return (acc ^ value) * 16777619UL;
+}
+
+static uint32_t bench_float_bits(float value) {
+  uint32_t bits = 0;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+// The calculation behind get_lock_target_adjustment, without its release smoother: that one keeps
+// state the CAN task owns, and every extra call steps the live ramp.
+static uint32_t bench_lock_target_raw(uint32_t iterations) {
+  uint32_t acc = 2166136261UL;
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc = bench_fold(acc, bench_float_bits(get_lock_target_raw()));
+  }
+  return acc;
+}
+
+static uint32_t bench_lock_target_adjusted_value(uint32_t iterations) {
+  uint32_t acc = 2166136261UL;
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc = bench_fold(acc, get_lock_target_adjusted_value((uint8_t)i, (i & 0x100) != 0));
+  }
+  return acc;
+}
+
+static uint32_t bench_dbc_extract_raw(uint32_t iterations) {
+  static const dbc_signal_t* const tables[] = {k_vw_mqb_chassis_signals, k_vw_pq_chassis_signals};
+  const uint16_t counts[] = {k_vw_mqb_chassis_signal_count, k_vw_pq_chassis_signal_count};
+  uint32_t acc = 2166136261UL;
+  uint8_t table = 0;
+  uint16_t signal = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    const dbc_signal_t& sig = tables[table][signal];
+    const uint64_t raw =
+      dbc_extract_raw(bench_frames[i % BENCH_FRAME_COUNT], sig.start_bit, sig.length, sig.is_little_endian);
+    acc = bench_fold(acc, (uint32_t)raw ^ (uint32_t)(raw >> 32));
+    if (++signal >= counts[table]) {
+      signal = 0;
+      table ^= 1;
+    }
+  }
+  return acc;
+}
+
+// What the decode paths run: the active table's precomputed plans, without re-planning per call.
+static uint32_t bench_dbc_extract_planned(uint32_t iterations) {
+  const dbc_table_t* table = dbcActiveChassisTable();
+  if (!table || !table->plans || table->signal_count == 0) {
+    return 0;
+  }
+  uint32_t acc = 2166136261UL;
+  uint16_t signal = 0;
+  for (uint32_t i = 0; i < iterations; i++) {
+    const uint64_t raw = dbc_extract_planned(bench_frames[i % BENCH_FRAME_COUNT], table->plans[signal]);
+    acc = bench_fold(acc, (uint32_t)raw ^ (uint32_t)(raw >> 32));
+    if (++signal >= table->signal_count) {
+      signal = 0;
+    }
+  }
+  return acc;
+}
+
+static uint32_t bench_calc_checksum(uint32_t iterations) {
+  static const uint8_t* const seqs[] = {ID_SEQ_0A8, ID_SEQ_0AD, ID_SEQ_0A7, ID_SEQ_08A, ID_SEQ_086,
+                                        ID_SEQ_121, ID_SEQ_116, ID_SEQ_106, ID_SEQ_5BE, ID_SEQ_3BE,
+                                        ID_SEQ_392, ID_SEQ_641, ID_SEQ_65D};
+  const uint8_t seq_count = sizeof(seqs) / sizeof(seqs[0]);
+  uint32_t acc = 2166136261UL;
+  for (uint32_t i = 0; i < iterations; i++) {
+    acc = bench_fold(acc, calcChecksum(bench_frames[i % BENCH_FRAME_COUNT], seqs[i % seq_count]));
+  }
+  return acc;
+}
+
+static uint32_t bench_canview_update_cache(uint32_t iterations) {
+  // 64 IDs, as many as a busy chassis bus carries; the scratch cache holds them all, so this is the
+  // steady state of the RX path: a linear scan ending in a hit.
+  twai_message_t msg = {};
+  msg.data_length_code = 8;
+  uint32_t acc = 2166136261UL;
+  for (uint32_t i = 0; i < iterations; i++) {
+    msg.identifier = 0x080 + (i % 64) * 0x13;
+    memcpy(msg.data, bench_frames[i % BENCH_FRAME_COUNT], sizeof(msg.data));
+    acc = bench_fold(acc, canviewBenchUpdateCache(msg));
+  }
+  return acc;
+}
+
+static uint32_t bench_canview_build_json(uint32_t iterations) {
+  uint32_t acc = 2166136261UL;
+  for (uint32_t i = 0; i < iterations; i++) {
+    const String json = canviewBuildJson(200, 20, "all");
+    acc = bench_fold(acc, (uint32_t)json.length());
+  }
+  return acc;
+}
+
+static const bench_case_t k_bench_cases[] = {
+  {"get_lock_target_raw", 20000, bench_lock_target_raw},
+  {"get_lock_target_adjusted_value", 100000, bench_lock_target_adjusted_value},
+  {"dbc_extract_raw", 200000, bench_dbc_extract_raw},
+  {"dbc_extract_planned", 200000, bench_dbc_extract_planned},
+  {"calc_checksum", 100000, bench_calc_checksum},
+  {"canview_update_cache", 20000, bench_canview_update_cache},
+  {"canview_build_json", 20, bench_canview_build_json},
+};
+
+static const uint8_t k_bench_case_count = sizeof(k_bench_cases) / sizeof(k_bench_cases[0]);
+
+uint32_t benchSelectCases(const char* filter) {
+  uint32_t cases = 0;
+  for (uint8_t i = 0; i < k_bench_case_count; i++) {
+    if (!filter || !filter[0] || strstr(k_bench_cases[i].name, filter)) {
+      cases |= 1UL << i;
+    }
+  }
+  return cases;
+}
+
+uint8_t benchRunSuite(uint32_t cases, uint32_t scale, uint8_t repeat, bench_report_fn_t report, void* ctx) {
+  bench_fill_frames();
+  const uint32_t mhz = ESP.getCpuFreqMHz();
+  uint8_t ran = 0;
+  for (uint8_t i = 0; i < k_bench_case_count; i++) {
+    if (!(cases & (1UL << i))) {
+      continue;
+    }
+    const bench_case_t& c = k_bench_cases[i];
+    const uint32_t iterations = c.iterations * (scale ? scale : 1);
+    (void)c.run(iterations / 10 + 1); // warm caches and branch predictors
+
+    bench_result_t result = {c.name, iterations, 0.0f, -1.0f, 0};
+    uint32_t best_cycles = UINT32_MAX;
+    for (uint8_t r = 0; r < (repeat ? repeat : 1); r++) {
+      const uint32_t started = ESP.getCycleCount();
+      result.check = c.run(iterations);
+      const uint32_t cycles = ESP.getCycleCount() - started;
+      if (cycles < best_cycles) {
+        best_cycles = cycles;
+      }
+    }
+    // The host stand-in counts nanoseconds at a nominal 1000 MHz; only the device has real cycles.
+    result.nsPerOp = (float)best_cycles * 1000.0f / (float)mhz / (float)iterations;
+#if !OH_HOST
+    result.cyclesPerOp = (float)best_cycles / (float)iterations;
+#endif
+    report(result, ctx);
+    ran++;
+  }
+  return ran;
+}
+
+String benchEnvLine() {
+  char mhz[12] = "-";
+#if !OH_HOST
+  snprintf(mhz, sizeof(mhz), "%lu", (unsigned long)ESP.getCpuFreqMHz());
+#endif
+  char line[128];
+  snprintf(line, sizeof(line), "bench_env target=%s cpu_mhz=%s mode=%s generation=%u", OH_HOST ? "host" : "esp32s3",
+           mhz, get_openhaldex_mode_string(openhaldexEffectiveMode()), haldexGeneration);
+  return String(line);
+}
+
+String benchResultLine(const bench_result_t& result) {
+  char cycles[24];
+  if (result.cyclesPerOp < 0.0f) {
+    strcpy(cycles, "-");
+  } else {
+    snprintf(cycles, sizeof(cycles), "%.2f", result.cyclesPerOp);
+  }
+  char line[160];
+  snprintf(line, sizeof(line), "bench name=%s iters=%lu ns_per_op=%.2f cycles_per_op=%s check=%08lx", result.name,
+           (unsigned long)result.iterations, result.nsPerOp, cycles, (unsigned long)result.check);
+  return String(line);
+}
+
+#endif
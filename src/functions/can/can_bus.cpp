@@ -1,4 +1,5 @@
 #include "functions/can/can.h"
+#include "functions/can/can_hal.h"
 
 #include "functions/config/pins.h"
 #include "functions/config/config.h"
@@ -7,15 +8,6 @@
 #include "functions/can/can_state.h"
 #include "functions/canview/canview.h"
 
-#if OH_CAN_HALDEX_MCP2515
-#include <SPI.h>
-#include <mcp2515.h>
-#include <mutex>
-
-static std::mutex can_mcp_mutex;
-static MCP2515 can_mcp(MCP2515_CS, 10000000, &SPI);
-#endif
-
 static uint32_t last_can_chs_tx_error_log_ms = 0;
 static uint32_t last_can_hdx_tx_error_log_ms = 0;
 
@@ -28,56 +20,25 @@ static bool can_rate_limited(uint32_t& last_log_ms, uint32_t interval_ms = 1000)
   return false;
 }
 
-static bool can_init_bus(int bus_id, int tx_pin, int rx_pin, twai_handle_t* out_handle, twai_mode_t mode) {
-  if (tx_pin < 0 || rx_pin < 0) {
-    LOG_ERROR("can", "bus init failed: invalid pins bus=%d tx=%d rx=%d", bus_id, tx_pin, rx_pin);
-    return false;
-  }
-
-  twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(gpio_num_t(tx_pin), gpio_num_t(rx_pin), mode);
-  twai_timing_config_t t_config = TWAI_TIMING_CONFIG_500KBITS();
-  twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
-
-  g_config.tx_queue_len = 1024;
-  g_config.rx_queue_len = 2048;
-  g_config.controller_id = bus_id;
-  g_config.tx_io = gpio_num_t(tx_pin);
-  g_config.rx_io = gpio_num_t(rx_pin);
-
-  esp_err_t err = twai_driver_install_v2(&g_config, &t_config, &f_config, out_handle);
-  if (err != ESP_OK) {
-    LOG_ERROR("can", "bus init failed: install bus=%d err=%s", bus_id, esp_err_to_name(err));
+static bool can_send(uint8_t bus, const twai_message_t& msg, TickType_t timeout_ticks, uint32_t& last_log_ms,
+                     const char* label) {
+  if (!canHalReady(bus)) {
+    if (!can_rate_limited(last_log_ms)) {
+      LOG_WARN("can", "%s TX skipped: bus %u unavailable id=0x%lX", label, bus, (unsigned long)msg.identifier);
+    }
     return false;
   }
-  err = twai_start_v2(*out_handle);
-  if (err != ESP_OK) {
-    LOG_ERROR("can", "bus init failed: start bus=%d err=%s", bus_id, esp_err_to_name(err));
-    return false;
+  const can_hal_backend_t* backend = canHalBackend(bus);
+  const int err = backend->send(bus, msg, timeout_ticks);
+  if (err != 0 && !can_rate_limited(last_log_ms)) {
+    LOG_WARN("can", "%s TX failed (%s) id=0x%lX err=%s", label, backend->name, (unsigned long)msg.identifier,
+             backend->errorName(err));
   }
-  return true;
-}
-
-static void can_deinit_twai_bus(twai_handle_t& handle) {
-  if (!handle) {
-    return;
-  }
-  (void)twai_stop_v2(handle);
-  (void)twai_driver_uninstall_v2(handle);
-  handle = nullptr;
+  return err == 0;
 }
 
 bool chassis_can_send(const twai_message_t& msg, TickType_t timeout_ticks) {
-  if (!can_bus_0()) {
-    if (!can_rate_limited(last_can_chs_tx_error_log_ms)) {
-      LOG_WARN("can", "CHS TX skipped: bus 0 unavailable id=0x%lX", (unsigned long)msg.identifier);
-    }
-    return false;
-  }
-  esp_err_t err = twai_transmit_v2(can_bus_0(), &msg, timeout_ticks);
-  bool ok = (err == ESP_OK);
-  if (!ok && !can_rate_limited(last_can_chs_tx_error_log_ms)) {
-    LOG_WARN("can", "CHS TX failed id=0x%lX err=%s", (unsigned long)msg.identifier, esp_err_to_name(err));
-  }
+  const bool ok = can_send(0, msg, timeout_ticks, last_can_chs_tx_error_log_ms, "CHS");
   if (ok) {
     canviewCacheFrameTx(msg, 0);
   }
@@ -85,151 +46,48 @@ bool chassis_can_send(const twai_message_t& msg, TickType_t timeout_ticks) {
 }
 
 bool haldex_can_send(const twai_message_t& msg, TickType_t timeout_ticks, bool generated) {
-#if OH_CAN_HALDEX_MCP2515
-  (void)timeout_ticks;
-  struct can_frame frame = {};
-  frame.can_id = msg.identifier & 0x1FFFFFFF;
-  if (msg.extd)
-    frame.can_id |= CAN_EFF_FLAG;
-  if (msg.rtr)
-    frame.can_id |= CAN_RTR_FLAG;
-  frame.can_dlc = msg.data_length_code;
-  for (uint8_t i = 0; i < frame.can_dlc && i < 8; i++) {
-    frame.data[i] = msg.data[i];
-  }
-  MCP2515::ERROR err;
-  {
-    std::lock_guard<std::mutex> lock(can_mcp_mutex);
-    err = can_mcp.sendMessage(&frame);
-  }
-  bool ok = (err == MCP2515::ERROR_OK);
-  if (!ok && !can_rate_limited(last_can_hdx_tx_error_log_ms)) {
-    LOG_WARN("can", "HDX TX failed (MCP2515) id=0x%lX err=%d", (unsigned long)msg.identifier, (int)err);
-  }
+  const bool ok = can_send(1, msg, timeout_ticks, last_can_hdx_tx_error_log_ms, "HDX");
   if (ok) {
     canviewCacheFrameTx(msg, 1, generated);
   }
   return ok;
-#else
-  if (!can_bus_1()) {
-    if (!can_rate_limited(last_can_hdx_tx_error_log_ms)) {
-      LOG_WARN("can", "HDX TX skipped: bus 1 unavailable id=0x%lX", (unsigned long)msg.identifier);
-    }
-    return false;
-  }
-  esp_err_t err = twai_transmit_v2(can_bus_1(), &msg, timeout_ticks);
-  bool ok = (err == ESP_OK);
-  if (!ok && !can_rate_limited(last_can_hdx_tx_error_log_ms)) {
-    LOG_WARN("can", "HDX TX failed id=0x%lX err=%s", (unsigned long)msg.identifier, esp_err_to_name(err));
-  }
-  if (ok) {
-    canviewCacheFrameTx(msg, 1, generated);
-  }
-  return ok;
-#endif
 }
 
 bool chassis_can_receive(twai_message_t& msg) {
-  if (!can_bus_0())
+  if (!canHalReady(0))
     return false;
-  return twai_receive_v2(can_bus_0(), &msg, 0) == ESP_OK;
+  return canHalBackend(0)->receive(0, msg);
 }
 
 bool haldex_can_receive(twai_message_t& msg) {
-#if OH_CAN_HALDEX_MCP2515
-  struct can_frame frame = {};
-  {
-    std::lock_guard<std::mutex> lock(can_mcp_mutex);
-    if (can_mcp.readMessage(&frame) != MCP2515::ERROR_OK) {
-      return false;
-    }
-  }
-  msg.identifier = frame.can_id & CAN_EFF_MASK;
-  msg.extd = (frame.can_id & CAN_EFF_FLAG) ? 1 : 0;
-  msg.rtr = (frame.can_id & CAN_RTR_FLAG) ? 1 : 0;
-  msg.data_length_code = frame.can_dlc;
-  for (uint8_t i = 0; i < frame.can_dlc && i < 8; i++) {
-    msg.data[i] = frame.data[i];
-  }
-  return true;
-#else
-  if (!can_bus_1())
+  if (!canHalReady(1))
     return false;
-  return twai_receive_v2(can_bus_1(), &msg, 0) == ESP_OK;
-#endif
+  return canHalBackend(1)->receive(1, msg);
 }
 
 bool canInitChassisOnly(twai_mode_t mode) {
-  can_deinit_twai_bus(can_bus_0());
+  canHalEnd(0);
   can0_ready = false;
   can_ready = false;
-  can0_ready = can_init_bus(0, CAN1_TX, CAN1_RX, &can_bus_0(), mode);
+  can0_ready = canHalBegin(0, mode);
   return can0_ready;
 }
 
-static bool can_init_haldex_bus() {
-#if OH_CAN_HALDEX_MCP2515
-  std::lock_guard<std::mutex> lock(can_mcp_mutex);
-  // Haldex bus (logical bus 1) on MCP2515.
-  pinMode(MCP2515_RST, OUTPUT);
-  digitalWrite(MCP2515_RST, HIGH);
-  delay(10);
-  digitalWrite(MCP2515_RST, LOW);
-  delay(10);
-  digitalWrite(MCP2515_RST, HIGH);
-  delay(10);
-
-  SPI.begin(MCP2515_SCLK, MCP2515_MISO, MCP2515_MOSI, MCP2515_CS);
-
-  if (can_mcp.reset() != MCP2515::ERROR_OK) {
-    DEBUG("CAN haldex (MCP2515) reset failed");
-    return false;
-  }
-  if (can_mcp.setBitrate(CAN_500KBPS) != MCP2515::ERROR_OK) {
-    DEBUG("CAN haldex (MCP2515) bitrate set failed");
-    return false;
-  }
-  if (can_mcp.setNormalMode() != MCP2515::ERROR_OK) {
-    DEBUG("CAN haldex (MCP2515) normal mode failed");
-    return false;
-  }
-  DEBUG("CAN haldex (MCP2515) started");
-  return true;
-#else
-  // Optional dual-TWAI fallback (non T-2CAN targets).
-  return can_init_bus(1, CAN0_TX, CAN0_RX, &can_bus_1(), TWAI_MODE_NO_ACK);
-#endif
-}
-
 void haldexCanSleep() {
-#if OH_CAN_HALDEX_MCP2515
-  if (can1_ready) {
-    (void)can_mcp.setSleepMode();
-  }
-  can1_ready = false;
-#else
-  can_deinit_twai_bus(can_bus_1());
+  canHalSleep(1);
   can1_ready = false;
-#endif
 }
 
 void canDeinit() {
-  const bool had_haldex_bus = can1_ready;
   can_ready = false;
-  can_deinit_twai_bus(can_bus_0());
+  canHalEnd(0);
   can0_ready = false;
-#if OH_CAN_HALDEX_MCP2515
-  if (had_haldex_bus) {
-    (void)can_mcp.setSleepMode();
-  }
-#else
-  can_deinit_twai_bus(can_bus_1());
-#endif
+  canHalEnd(1);
   can1_ready = false;
 }
 
 void canInit() {
-  // Bus mapping for T-2CAN:
+  // Bus mapping for T-2CAN (see can_hal.h for other builds):
   // - chassis (logical bus 0): internal ESP32-S3 TWAI on CAN1 pins
   // - haldex  (logical bus 1): MCP2515 SPI controller
   canDeinit();
@@ -237,28 +95,29 @@ void canInit() {
   can0_ready = false;
   can1_ready = false;
 
-  // Chassis bus (logical bus 0) on internal TWAI.
+  // Chassis bus (logical bus 0).
   can0_ready = canInitChassisOnly(TWAI_MODE_NO_ACK);
   if (!can0_ready) {
-    DEBUG("CAN chassis (TWAI) init failed");
+    DEBUG("CAN chassis (%s) init failed", canHalBackend(0)->name);
     return;
   }
 
-  can1_ready = can_init_haldex_bus();
+  // Haldex bus (logical bus 1).
+  can1_ready = canHalBegin(1, TWAI_MODE_NO_ACK);
   if (!can1_ready) {
-    DEBUG("CAN haldex (TWAI bus 1) init failed");
+    DEBUG("CAN haldex (%s) init failed", canHalBackend(1)->name);
     return;
   }
 
   can_ready = can0_ready && can1_ready;
 
-  if (!can0_ready || !can_bus_0()) {
-    DEBUG("CAN - Not ready; skipping alert configuration");
+  const can_hal_backend_t* chassis = canHalBackend(0);
+  if (!chassis->enableAlerts) {
     return;
   }
   uint32_t alerts_to_enable =
     TWAI_ALERT_RX_DATA | TWAI_ALERT_ERR_PASS | TWAI_ALERT_BUS_ERROR | TWAI_ALERT_RX_QUEUE_FULL;
-  if (twai_reconfigure_alerts(alerts_to_enable, NULL) == ESP_OK) {
+  if (chassis->enableAlerts(0, alerts_to_enable)) {
     DEBUG("Reconfiguration of CAN alerts");
   } else {
     DEBUG("Failed to reconfigure CAN alerts!");
@@ -268,14 +127,12 @@ void canInit() {
 
 void canRecoverIfBusFailure() {
   if (can_ready && isBusFailure) {
-    if (can_bus_0()) {
-      twai_initiate_recovery_v2(can_bus_0());
-    }
-#if !OH_CAN_HALDEX_MCP2515
-    if (can_bus_1()) {
-      twai_initiate_recovery_v2(can_bus_1());
+    for (uint8_t bus = 0; bus < CAN_HAL_BUS_COUNT; bus++) {
+      const can_hal_backend_t* backend = canHalBackend(bus);
+      if (backend->recover && canHalReady(bus)) {
+        backend->recover(bus);
+      }
     }
-#endif
   }
 }
 
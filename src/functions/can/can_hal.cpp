@@ -0,0 +1,72 @@
+#include "functions/can/can_hal.h"
+
+static const can_hal_backend_t* can_hal_bound[CAN_HAL_BUS_COUNT] = {};
+static bool can_hal_ready[CAN_HAL_BUS_COUNT] = {};
+
+static const can_hal_backend_t* can_hal_default_backend(uint8_t bus) {
+#if OH_CAN_LOADGEN
+  (void)bus;
+  return &can_hal_loadgen;
+#elif OH_HOST
+  (void)bus;
+  return &can_hal_host;
+#elif OH_CAN_HALDEX_MCP2515
+  return (bus == 0) ? &can_hal_twai : &can_hal_mcp2515;
+#else
+  (void)bus;
+  return &can_hal_twai;
+#endif
+}
+
+const can_hal_backend_t* canHalBackend(uint8_t bus) {
+  if (bus >= CAN_HAL_BUS_COUNT) {
+    return nullptr;
+  }
+  if (!can_hal_bound[bus]) {
+    can_hal_bound[bus] = can_hal_default_backend(bus);
+  }
+  return can_hal_bound[bus];
+}
+
+void canHalSetBackend(uint8_t bus, const can_hal_backend_t* backend) {
+  if (bus >= CAN_HAL_BUS_COUNT) {
+    return;
+  }
+  canHalEnd(bus);
+  can_hal_bound[bus] = backend;
+}
+
+bool canHalBegin(uint8_t bus, twai_mode_t mode) {
+  const can_hal_backend_t* backend = canHalBackend(bus);
+  if (!backend) {
+    return false;
+  }
+  can_hal_ready[bus] = backend->begin(bus, mode);
+  return can_hal_ready[bus];
+}
+
+void canHalEnd(uint8_t bus) {
+  const can_hal_backend_t* backend = canHalBackend(bus);
+  if (!backend) {
+    return;
+  }
+  can_hal_ready[bus] = false;
+  backend->end(bus);
+}
+
+void canHalSleep(uint8_t bus) {
+  const can_hal_backend_t* backend = canHalBackend(bus);
+  if (!backend) {
+    return;
+  }
+  can_hal_ready[bus] = false;
+  if (backend->sleep) {
+    backend->sleep(bus);
+  } else {
+    backend->end(bus);
+  }
+}
+
+bool canHalReady(uint8_t bus) {
+  return bus < CAN_HAL_BUS_COUNT && can_hal_ready[bus];
+}
@@ -0,0 +1,119 @@
+#include "functions/can/can_hal.h"
+
+#if !OH_HOST && OH_CAN_HALDEX_MCP2515
+
+#include <SPI.h>
+#include <mcp2515.h>
+#include <mutex>
+
+#include "functions/config/pins.h"
+#include "functions/config/config.h"
+
+// One MCP2515 on SPI; it serves whichever logical bus it is bound to (the Haldex bus on T-2CAN).
+static std::mutex can_mcp_mutex;
+static MCP2515 can_mcp(MCP2515_CS, 10000000, &SPI);
+static bool can_mcp_started = false;
+
+static bool mcp_begin(uint8_t bus, twai_mode_t mode) {
+  (void)bus;
+  std::lock_guard<std::mutex> lock(can_mcp_mutex);
+  can_mcp_started = false;
+  pinMode(MCP2515_RST, OUTPUT);
+  digitalWrite(MCP2515_RST, HIGH);
+  delay(10);
+  digitalWrite(MCP2515_RST, LOW);
+  delay(10);
+  digitalWrite(MCP2515_RST, HIGH);
+  delay(10);
+
+  SPI.begin(MCP2515_SCLK, MCP2515_MISO, MCP2515_MOSI, MCP2515_CS);
+
+  if (can_mcp.reset() != MCP2515::ERROR_OK) {
+    DEBUG("CAN haldex (MCP2515) reset failed");
+    return false;
+  }
+  if (can_mcp.setBitrate(CAN_500KBPS) != MCP2515::ERROR_OK) {
+    DEBUG("CAN haldex (MCP2515) bitrate set failed");
+    return false;
+  }
+  const MCP2515::ERROR err =
+    (mode == TWAI_MODE_LISTEN_ONLY) ? can_mcp.setListenOnlyMode() : can_mcp.setNormalMode();
+  if (err != MCP2515::ERROR_OK) {
+    DEBUG("CAN haldex (MCP2515) %s mode failed", (mode == TWAI_MODE_LISTEN_ONLY) ? "listen-only" : "normal");
+    return false;
+  }
+  DEBUG("CAN haldex (MCP2515) started");
+  can_mcp_started = true;
+  return true;
+}
+
+static void mcp_sleep(uint8_t bus) {
+  (void)bus;
+  std::lock_guard<std::mutex> lock(can_mcp_mutex);
+  if (can_mcp_started) {
+    (void)can_mcp.setSleepMode();
+  }
+  can_mcp_started = false;
+}
+
+static int mcp_send(uint8_t bus, const twai_message_t& msg, TickType_t timeout_ticks) {
+  (void)bus;
+  (void)timeout_ticks;
+  struct can_frame frame = {};
+  frame.can_id = msg.identifier & 0x1FFFFFFF;
+  if (msg.extd)
+    frame.can_id |= CAN_EFF_FLAG;
+  if (msg.rtr)
+    frame.can_id |= CAN_RTR_FLAG;
+  frame.can_dlc = msg.data_length_code;
+  for (uint8_t i = 0; i < frame.can_dlc && i < 8; i++) {
+    frame.data[i] = msg.data[i];
+  }
+  std::lock_guard<std::mutex> lock(can_mcp_mutex);
+  return (int)can_mcp.sendMessage(&frame);
+}
+
+static bool mcp_receive(uint8_t bus, twai_message_t& msg) {
+  (void)bus;
+  struct can_frame frame = {};
+  {
+    std::lock_guard<std::mutex> lock(can_mcp_mutex);
+    if (can_mcp.readMessage(&frame) != MCP2515::ERROR_OK) {
+      return false;
+    }
+  }
+  msg.identifier = frame.can_id & CAN_EFF_MASK;
+  msg.extd = (frame.can_id & CAN_EFF_FLAG) ? 1 : 0;
+  msg.rtr = (frame.can_id & CAN_RTR_FLAG) ? 1 : 0;
+  msg.data_length_code = frame.can_dlc;
+  for (uint8_t i = 0; i < frame.can_dlc && i < 8; i++) {
+    msg.data[i] = frame.data[i];
+  }
+  return true;
+}
+
+static const char* mcp_error_name(int err) {
+  switch (err) {
+  case MCP2515::ERROR_OK:
+    return "OK";
+  case MCP2515::ERROR_FAIL:
+    return "FAIL";
+  case MCP2515::ERROR_ALLTXBUSY:
+    return "ALLTXBUSY";
+  case MCP2515::ERROR_FAILINIT:
+    return "FAILINIT";
+  case MCP2515::ERROR_FAILTX:
+    return "FAILTX";
+  case MCP2515::ERROR_NOMSG:
+    return "NOMSG";
+  default:
+    return "UNKNOWN";
+  }
+}
+
+// end() parks the controller in sleep mode, as the MCP2515 has no driver to uninstall.
+const can_hal_backend_t can_hal_mcp2515 = {
+  "mcp2515", mcp_begin, mcp_sleep, mcp_send, mcp_receive, mcp_sleep, nullptr, nullptr, mcp_error_name,
+};
+
+#endif
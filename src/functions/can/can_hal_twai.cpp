@@ -0,0 +1,95 @@
+#include "functions/can/can_hal.h"
+
+#if !OH_HOST
+
+#include "functions/config/pins.h"
+#include "functions/config/config.h"
+
+static twai_handle_t twai_handles[CAN_HAL_BUS_COUNT] = {};
+
+static bool twai_bus_pins(uint8_t bus, int& tx_pin, int& rx_pin) {
+  // Logical bus 0 (chassis) is wired to the CAN1 pins; the optional second controller to CAN0.
+  tx_pin = (bus == 0) ? CAN1_TX : CAN0_TX;
+  rx_pin = (bus == 0) ? CAN1_RX : CAN0_RX;
+  return tx_pin >= 0 && rx_pin >= 0;
+}
+
+static void twai_end(uint8_t bus) {
+  twai_handle_t& handle = twai_handles[bus];
+  if (!handle) {
+    return;
+  }
+  (void)twai_stop_v2(handle);
+  (void)twai_driver_uninstall_v2(handle);
+  handle = nullptr;
+}
+
+static bool twai_begin(uint8_t bus, twai_mode_t mode) {
+  twai_end(bus);
+
+  int tx_pin = -1;
+  int rx_pin = -1;
+  if (!twai_bus_pins(bus, tx_pin, rx_pin)) {
+    LOG_ERROR("can", "bus init failed: invalid pins bus=%d tx=%d rx=%d", bus, tx_pin, rx_pin);
+    return false;
+  }
+
+  twai_general_config_t g_config = TWAI_GENERAL_CONFIG_DEFAULT(gpio_num_t(tx_pin), gpio_num_t(rx_pin), mode);
+  twai_timing_config_t t_config = TWAI_TIMING_CONFIG_500KBITS();
+  twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+
+  g_config.tx_queue_len = 1024;
+  g_config.rx_queue_len = 2048;
+  g_config.controller_id = bus;
+  g_config.tx_io = gpio_num_t(tx_pin);
+  g_config.rx_io = gpio_num_t(rx_pin);
+
+  esp_err_t err = twai_driver_install_v2(&g_config, &t_config, &f_config, &twai_handles[bus]);
+  if (err != ESP_OK) {
+    LOG_ERROR("can", "bus init failed: install bus=%d err=%s", bus, esp_err_to_name(err));
+    return false;
+  }
+  err = twai_start_v2(twai_handles[bus]);
+  if (err != ESP_OK) {
+    LOG_ERROR("can", "bus init failed: start bus=%d err=%s", bus, esp_err_to_name(err));
+    return false;
+  }
+  return true;
+}
+
+static int twai_send(uint8_t bus, const twai_message_t& msg, TickType_t timeout_ticks) {
+  if (!twai_handles[bus]) {
+    return ESP_ERR_INVALID_STATE;
+  }
+  return twai_transmit_v2(twai_handles[bus], &msg, timeout_ticks);
+}
+
+static bool twai_receive(uint8_t bus, twai_message_t& msg) {
+  if (!twai_handles[bus]) {
+    return false;
+  }
+  return twai_receive_v2(twai_handles[bus], &msg, 0) == ESP_OK;
+}
+
+static void twai_recover(uint8_t bus) {
+  if (twai_handles[bus]) {
+    twai_initiate_recovery_v2(twai_handles[bus]);
+  }
+}
+
+static bool twai_enable_alerts(uint8_t bus, uint32_t alerts) {
+  if (!twai_handles[bus]) {
+    return false;
+  }
+  return twai_reconfigure_alerts_v2(twai_handles[bus], alerts, NULL) == ESP_OK;
+}
+
+static const char* twai_error_name(int err) {
+  return esp_err_to_name((esp_err_t)err);
+}
+
+const can_hal_backend_t can_hal_twai = {
+  "twai", twai_begin, twai_end, twai_send, twai_receive, nullptr, twai_recover, twai_enable_alerts, twai_error_name,
+};
+
+#endif
@@ -0,0 +1,503 @@
+#include "functions/can/can_loadgen.h"
+
+#include <mutex>
+#include <string.h>
+
+#include "functions/can/can_id.h"
+#include "functions/can/standalone_can.h"
+#include "functions/core/state.h"
+
+enum can_loadgen_check_t : uint8_t {
+  LOADGEN_CHECK_NONE,
+  LOADGEN_CHECK_E2E, // data[0] = calcChecksum(data, idSeq), counter in the low nibble of data[1]
+  LOADGEN_CHECK_XOR, // data[7] = XOR of data[0..6] (PQ Bremse_4)
+};
+
+struct can_loadgen_frame_t {
+  uint16_t id;
+  uint8_t dlc;
+  uint16_t periodMs;
+  uint8_t counterByte; // LOADGEN_NO_COUNTER when the frame has none
+  uint8_t counterMask; // bits of counterByte the counter owns
+  uint8_t counterMin;
+  uint8_t counterMax;
+  uint8_t counterStep;
+  can_loadgen_check_t check;
+  const uint8_t* idSeq;
+  uint8_t data[8];
+};
+
+#define LOADGEN_NO_COUNTER 0xFF
+#define LOADGEN_PLAIN LOADGEN_NO_COUNTER, 0, 0, 0, 0, LOADGEN_CHECK_NONE, nullptr
+
+// PQ35/46 chassis mix shared by Gen1/2/4: the standalone frames (io/frames.cpp) at their task periods,
+// plus the engine, gearbox and steering traffic a car carries. ~60 km/h, 2000 rpm, 20 % pedal.
+static const can_loadgen_frame_t k_loadgen_pq[] = {
+  {mLW_1, 8, 10, 5, 0xF0, 0x00, 0xF0, 0x10, LOADGEN_CHECK_NONE, nullptr, {0x20, 0, 0, 0, 0x80, 0, 0, 0}},
+  {BRAKES1_ID, 8, 10, 7, 0x0F, 0x00, 0x0F, 1, LOADGEN_CHECK_NONE, nullptr, {0x20, 0x40, 0xE0, 0x2E, 0xFE, 0xFE, 0, 0}},
+  {BRAKES4_ID, 8, 10, 6, 0xF0, 0x00, 0xF0, 0x10, LOADGEN_CHECK_XOR, nullptr, {0xFE, 0, 0, 0x64, 0, 0, 0, 0}},
+  {MOTOR1_ID, 8, 10, LOADGEN_PLAIN, {0x00, 0xFE, 0x40, 0x1F, 0xFE, 0x32, 0x16, 0xFE}},
+  {MOTOR3_ID, 8, 10, LOADGEN_PLAIN, {0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01}},
+  {mLenkhilfe_1, 6, 10, LOADGEN_PLAIN, {0}},
+  {mGetriebe_1, 8, 10, LOADGEN_PLAIN, {0}},
+  {BRAKES3_ID, 8, 10, LOADGEN_PLAIN, {0xB6, 0x07, 0xCC, 0x07, 0xD2, 0x07, 0xD2, 0x07}},
+  {MOTOR2_ID, 8, 20, LOADGEN_PLAIN, {0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x00}},
+  {GRA_ID, 4, 20, LOADGEN_PLAIN, {0}},
+  {BRAKES10_ID, 8, 20, 1, 0x0F, 0x00, 0x0F, 1, LOADGEN_CHECK_NONE, nullptr, {0}},
+  {MOTOR5_ID, 8, 20, LOADGEN_PLAIN, {0}},
+  {MOTOR6_ID, 8, 20, LOADGEN_PLAIN, {0}},
+  {BRAKES5_ID, 8, 20, 6, 0xF0, 0x00, 0xF0, 0x10, LOADGEN_CHECK_NONE, nullptr, {0}},
+  {mGetriebe_2, 8, 20, LOADGEN_PLAIN, {0}},
+  {BRAKES2_ID, 8, 20, 3, 0xF0, 0x00, 0xF0, 0x10, LOADGEN_CHECK_NONE, nullptr, {0, 0, 0, 0, 0x7F, 0, 0, 0}},
+  {mKombi_1, 8, 25, LOADGEN_PLAIN, {0}},
+  {mGate_Komf_1, 8, 100, LOADGEN_PLAIN, {0}},
+  {mBSG_Last, 5, 100, LOADGEN_PLAIN, {0}},
+  {BRAKES11_ID, 8, 100, LOADGEN_PLAIN, {0}},
+  {mSysteminfo_1, 8, 100, LOADGEN_PLAIN, {0}},
+  {mSoll_Verbauliste_neu, 8, 100, LOADGEN_PLAIN, {0}},
+  {mKombi_2, 8, 200, LOADGEN_PLAIN, {0}},
+  {mKombi_3, 8, 200, LOADGEN_PLAIN, {0}},
+  {NMH_Gateway, 7, 200, LOADGEN_PLAIN, {0}},
+  {mDiagnose_1, 8, 1000, 7, 0xFF, 0x00, 0x1F, 1, LOADGEN_CHECK_NONE, nullptr, {0}},
+};
+
+// MQB chassis mix for Gen5, same sources; counter ranges as the standalone frames use them.
+static const can_loadgen_frame_t k_loadgen_mqb[] = {
+  {LWI_01, 8, 10, 1, 0xFF, 0x10, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_086, {0}},
+  {ESP_14, 8, 10, 1, 0xFF, 0x10, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_08A, {0, 0, 0, 0, 0, 0, 0, 0xFE}},
+  {MOTOR_11, 8, 10, 1, 0xFF, 0x40, 0x4F, 1, LOADGEN_CHECK_E2E, ID_SEQ_0A7, {0, 0, 0xFA, 0xFA, 0, 0xFA, 0xFA, 0xFA}},
+  {MOTOR_12, 8, 10, 1, 0xFF, 0x70, 0x7F, 1, LOADGEN_CHECK_E2E, ID_SEQ_0A8, {0, 0, 0, 0, 0, 0x64, 0x0F, 0}},
+  {GETRIEBE_11, 8, 10, 1, 0xFF, 0x00, 0x0F, 1, LOADGEN_CHECK_E2E, ID_SEQ_0AD, {0}},
+  {ESP_19, 8, 10, LOADGEN_PLAIN, {0x40, 0x1F, 0x40, 0x1F, 0x40, 0x1F, 0x40, 0x1F}},
+  {ESP_18, 8, 10, LOADGEN_PLAIN, {0}},
+  {ESP_21, 8, 20, 1, 0x0F, 0x00, 0x0F, 1, LOADGEN_CHECK_NONE, nullptr, {0, 0, 0, 0, 0x70, 0x17, 0, 0}},
+  {ESP_05, 8, 20, 1, 0xFF, 0x80, 0x8F, 1, LOADGEN_CHECK_E2E, ID_SEQ_106, {0, 0, 0x64, 0xC0, 0, 0, 0xFD, 0}},
+  {MOTOR_04, 8, 20, LOADGEN_PLAIN, {0, 0, 0, 0, 0, 0x3C, 0, 0}},
+  {ESP_10, 8, 20, 1, 0x0F, 0x00, 0x0F, 1, LOADGEN_CHECK_E2E, ID_SEQ_116, {0, 0, 0x01, 0x04, 0, 0x40, 0, 0}},
+  {MOTOR_20, 8, 20, 1, 0x0F, 0x00, 0x0F, 1, LOADGEN_CHECK_E2E, ID_SEQ_121, {0, 0x20, 0x03, 0, 0, 0, 0, 0}},
+  {ESP_29, 8, 100, LOADGEN_PLAIN, {0, 0x20, 0x59, 0, 0, 0, 0, 0}},
+  {KOMBI_01, 8, 25, LOADGEN_PLAIN, {0x10, 0x20, 0x02, 0x00, 0x0C, 0x00, 0x00, 0x24}},
+  {CHARISMA_01, 8, 1000, LOADGEN_PLAIN, {0, 0, 0x22, 0x02, 0x02, 0x20, 0, 0}},
+  {ESP_07, 8, 100, 1, 0xFF, 0x00, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_392, {0}},
+  {MOTOR_14, 8, 100, 1, 0xFF, 0x10, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_3BE, {0, 0, 0xE6, 0x01, 0xC8, 0x80, 0, 0x80}},
+  {GETRIEBE_14, 8, 100, LOADGEN_PLAIN, {0x00, 0x00, 0x54, 0x24, 0x00, 0x60, 0x01, 0x51}},
+  {GATEWAY_72, 8, 100, LOADGEN_PLAIN, {0x50, 0x80, 0x00, 0x00, 0x05, 0x10, 0x01, 0x78}},
+  {Parkhilfe_04, 8, 100, LOADGEN_PLAIN, {0, 0, 0, 0, 0, 0, 0, 0x24}},
+  {SYSTEMINFO_01, 8, 1000, LOADGEN_PLAIN, {0}},
+  {ESP_23, 8, 100, 1, 0xFF, 0x00, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_5BE, {0, 0, 0xBF, 0x7F, 0, 0, 0x7C, 0x78}},
+  {MOTOR_07, 8, 1000, LOADGEN_PLAIN, {0xA0, 0x5A, 0x56, 0xA3, 0x80, 0xA0, 0x59, 0x01}},
+  {MOTOR_CODE_01, 8, 1000, 1, 0xFF, 0x10, 0x1F, 1, LOADGEN_CHECK_E2E, ID_SEQ_641, {0}},
+  {ESP_20, 8, 1000, 1, 0xFF, 0x30, 0x3F, 1, LOADGEN_CHECK_E2E, ID_SEQ_65D, {0}},
+  {DIAGNOSE_01, 8, 1000, LOADGEN_PLAIN, {0}},
+  {KOMBI_02, 8, 1000, LOADGEN_PLAIN, {0}},
+};
+
+#define LOADGEN_TABLE_LEN(t) (uint8_t)(sizeof(t) / sizeof((t)[0]))
+#define LOADGEN_MAX_FRAMES 32
+
+static bool loadgen_table(uint8_t generation, const can_loadgen_frame_t*& table, uint8_t& count) {
+  switch (generation) {
+  case 1:
+  case 2:
+  case 4:
+    table = k_loadgen_pq;
+    count = LOADGEN_TABLE_LEN(k_loadgen_pq);
+    return true;
+  case 5:
+    table = k_loadgen_mqb;
+    count = LOADGEN_TABLE_LEN(k_loadgen_mqb);
+    return true;
+  default:
+    return false;
+  }
+}
+
+static void loadgen_build(const can_loadgen_frame_t& entry, uint8_t counter, twai_message_t& frame) {
+  frame = {};
+  frame.identifier = entry.id;
+  frame.data_length_code = entry.dlc;
+  memcpy(frame.data, entry.data, sizeof(frame.data));
+  if (entry.counterByte != LOADGEN_NO_COUNTER) {
+    uint8_t& b = frame.data[entry.counterByte];
+    b = (uint8_t)((b & ~entry.counterMask) | (counter & entry.counterMask));
+  }
+  if (entry.check == LOADGEN_CHECK_E2E) {
+    frame.data[0] = calcChecksum(frame.data, entry.idSeq);
+  } else if (entry.check == LOADGEN_CHECK_XOR) {
+    uint8_t x = 0;
+    for (uint8_t i = 0; i < 7; i++) {
+      x ^= frame.data[i];
+    }
+    frame.data[7] = x;
+  }
+}
+
+static uint8_t loadgen_next_counter(const can_loadgen_frame_t& entry, uint8_t counter) {
+  const uint16_t next = (uint16_t)counter + entry.counterStep;
+  return (next > entry.counterMax) ? entry.counterMin : (uint8_t)next;
+}
+
+uint16_t canFrameWireBits(const twai_message_t& frame) {
+  // SOF through CRC is bit-stuffed, so walk it: header, data, then the CRC-15 of everything before.
+  uint8_t bits[128];
+  uint8_t n = 0;
+  const uint8_t dlc = frame.data_length_code > 8 ? 8 : frame.data_length_code;
+  auto put = [&](uint32_t value, uint8_t width) {
+    while (width--) {
+      bits[n++] = (uint8_t)((value >> width) & 1U);
+    }
+  };
+  put(0, 1);
+  if (frame.extd) {
+    put(frame.identifier >> 18, 11);
+    put(3, 2); // SRR, IDE
+    put(frame.identifier & 0x3FFFF, 18);
+    put(frame.rtr ? 1 : 0, 1);
+    put(0, 2);
+  } else {
+    put(frame.identifier & 0x7FF, 11);
+    put(frame.rtr ? 1 : 0, 1);
+    put(0, 2); // IDE, r0
+  }
+  put(frame.data_length_code & 0x0F, 4);
+  if (!frame.rtr) {
+    for (uint8_t i = 0; i < dlc; i++) {
+      put(frame.data[i], 8);
+    }
+  }
+  uint16_t crc = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    const bool invert = bits[i] ^ ((crc >> 14) & 1U);
+    crc = (uint16_t)((crc << 1) & 0x7FFF);
+    if (invert) {
+      crc ^= 0x4599;
+    }
+  }
+  put(crc, 15);
+
+  uint8_t stuffed = 0;
+  uint8_t run = 1;
+  uint8_t level = bits[0];
+  for (uint8_t i = 1; i < n; i++) {
+    if (bits[i] == level) {
+      run++;
+    } else {
+      level = bits[i];
+      run = 1;
+    }
+    if (run == 5) {
+      stuffed++;
+      level ^= 1U;
+      run = 1;
+    }
+  }
+  // CRC delimiter, ACK slot and delimiter, EOF, intermission.
+  return (uint16_t)(n + stuffed + 1 + 2 + 7 + 3);
+}
+
+static uint32_t loadgen_wire_us(const twai_message_t& frame) {
+  return (uint32_t)canFrameWireBits(frame) * (1000000UL / CAN_LOADGEN_BITRATE);
+}
+
+float canLoadgenNativeLoad(uint8_t generation) {
+  const can_loadgen_frame_t* table = nullptr;
+  uint8_t count = 0;
+  if (!loadgen_table(generation, table, count)) {
+    return 0.0f;
+  }
+  float busy_us_per_s = 0.0f;
+  for (uint8_t i = 0; i < count; i++) {
+    twai_message_t frame;
+    loadgen_build(table[i], table[i].counterMin, frame);
+    busy_us_per_s += (float)loadgen_wire_us(frame) * (1000.0f / table[i].periodMs);
+  }
+  return busy_us_per_s / 10000.0f;
+}
+
+static uint8_t loadgen_latency_bucket(uint32_t us) {
+  if (us < 4) {
+    return (uint8_t)us;
+  }
+  const uint8_t msb = (uint8_t)(31 - __builtin_clz(us));
+  return (uint8_t)(msb * 4 + ((us >> (msb - 2)) & 3U));
+}
+
+uint32_t canLoadgenLatencyPercentileUs(const can_loadgen_stats_t& stats, uint8_t percentile) {
+  uint64_t total = 0;
+  for (uint16_t i = 0; i < CAN_LOADGEN_LATENCY_BUCKETS; i++) {
+    total += stats.latency[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  const uint64_t wanted = (total * percentile + 99) / 100;
+  uint64_t seen = 0;
+  for (uint16_t i = 0; i < CAN_LOADGEN_LATENCY_BUCKETS; i++) {
+    seen += stats.latency[i];
+    if (seen >= wanted && stats.latency[i]) {
+      if (i < 4) {
+        return i;
+      }
+      const uint8_t msb = (uint8_t)(i / 4);
+      const uint32_t upper = ((uint32_t)(4 + (i % 4) + 1) << (msb - 2)) - 1;
+      return (upper < stats.latencyMaxUs) ? upper : stats.latencyMaxUs;
+    }
+  }
+  return stats.latencyMaxUs;
+}
+
+#if OH_HOST || OH_CAN_LOADGEN
+
+struct loadgen_rx_slot_t {
+  twai_message_t frame;
+  uint64_t arrivalUs;
+};
+
+static std::mutex loadgen_mutex;
+static uint8_t loadgen_config_generation = 0;
+static uint8_t loadgen_config_load = OH_CAN_LOADGEN ? OH_CAN_LOADGEN_LOAD : 0;
+static bool loadgen_running = false;
+static const can_loadgen_frame_t* loadgen_frames = nullptr;
+static uint8_t loadgen_frame_count = 0;
+static uint32_t loadgen_period_us[LOADGEN_MAX_FRAMES];
+static uint64_t loadgen_due_us[LOADGEN_MAX_FRAMES];
+static uint8_t loadgen_counter[LOADGEN_MAX_FRAMES];
+static uint64_t loadgen_started_us = 0;
+static uint64_t loadgen_bus_free_us = 0; // end of the frame last on the simulated chassis wire
+static uint32_t loadgen_clock_last = 0;
+static uint64_t loadgen_clock_high = 0;
+
+static loadgen_rx_slot_t loadgen_rx[CAN_LOADGEN_RX_QUEUE_LEN];
+static uint16_t loadgen_rx_head = 0;
+static uint16_t loadgen_rx_count = 0;
+
+// The chassis frame the bridge holds right now, timed when it reaches the Haldex bus.
+static bool loadgen_pending = false;
+static uint32_t loadgen_pending_id = 0;
+static uint64_t loadgen_pending_arrival_us = 0;
+
+static can_loadgen_stats_t loadgen_stats = {};
+
+// micros() widened to 64 bits; called at least every few ms while the bridge runs.
+static uint64_t loadgen_now_us() {
+  const uint32_t now = micros();
+  if (now < loadgen_clock_last) {
+    loadgen_clock_high += 0x100000000ULL;
+  }
+  loadgen_clock_last = now;
+  return loadgen_clock_high | now;
+}
+
+// Puts every frame that finished on the simulated bus by now_us into the RX queue. Pending frames
+// contend as on a real bus: the lowest ID wins each slot, so at full load the high IDs run late.
+static void loadgen_run(uint64_t now_us) {
+  while (loadgen_frame_count) {
+    uint64_t start = loadgen_bus_free_us;
+    uint64_t earliest = UINT64_MAX;
+    for (uint8_t i = 0; i < loadgen_frame_count; i++) {
+      if (loadgen_due_us[i] < earliest) {
+        earliest = loadgen_due_us[i];
+      }
+    }
+    if (earliest > start) {
+      start = earliest;
+    }
+    uint8_t pick = 0;
+    bool found = false;
+    for (uint8_t i = 0; i < loadgen_frame_count; i++) {
+      if (loadgen_due_us[i] <= start && (!found || loadgen_frames[i].id < loadgen_frames[pick].id)) {
+        pick = i;
+        found = true;
+      }
+    }
+
+    twai_message_t frame;
+    const can_loadgen_frame_t& entry = loadgen_frames[pick];
+    loadgen_build(entry, loadgen_counter[pick], frame);
+    const uint32_t wire_us = loadgen_wire_us(frame);
+    const uint64_t end = start + wire_us;
+    if (end > now_us) {
+      break;
+    }
+
+    loadgen_counter[pick] = loadgen_next_counter(entry, loadgen_counter[pick]);
+    const uint32_t period = loadgen_period_us[pick];
+    while (loadgen_due_us[pick] + period <= start) {
+      loadgen_due_us[pick] += period;
+      loadgen_stats.overwritten++;
+    }
+    loadgen_due_us[pick] += period;
+    loadgen_bus_free_us = end;
+    loadgen_stats.generated++;
+    loadgen_stats.busyUs += wire_us;
+
+    if (loadgen_rx_count >= CAN_LOADGEN_RX_QUEUE_LEN) {
+      loadgen_stats.rxDropped++;
+      continue;
+    }
+    loadgen_rx_slot_t& slot = loadgen_rx[(loadgen_rx_head + loadgen_rx_count) % CAN_LOADGEN_RX_QUEUE_LEN];
+    slot.frame = frame;
+    slot.arrivalUs = end;
+    loadgen_rx_count++;
+    if (loadgen_rx_count > loadgen_stats.rxHighWater) {
+      loadgen_stats.rxHighWater = loadgen_rx_count;
+    }
+  }
+}
+
+static void loadgen_reset_stats_locked(uint64_t now_us) {
+  const uint8_t generation = loadgen_stats.generation;
+  const uint8_t load = loadgen_stats.loadPercent;
+  loadgen_stats = {};
+  loadgen_stats.generation = generation;
+  loadgen_stats.loadPercent = load;
+  loadgen_started_us = now_us;
+}
+
+bool canLoadgenConfigure(uint8_t generation, uint8_t load_percent) {
+  const can_loadgen_frame_t* table = nullptr;
+  uint8_t count = 0;
+  if ((generation != 0 && !loadgen_table(generation, table, count)) || load_percent > 150) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  loadgen_config_generation = generation;
+  loadgen_config_load = load_percent;
+  return true;
+}
+
+static bool loadgen_start_locked(uint8_t generation) {
+  const can_loadgen_frame_t* table = nullptr;
+  uint8_t count = 0;
+  if (!loadgen_table(generation, table, count) || count > LOADGEN_MAX_FRAMES) {
+    LOG_ERROR("can", "loadgen: no frame mix for generation %u", generation);
+    return false;
+  }
+  const float native = canLoadgenNativeLoad(generation);
+  const float scale = (loadgen_config_load && native > 0.0f) ? native / loadgen_config_load : 1.0f;
+
+  const uint64_t now_us = loadgen_now_us();
+  loadgen_frames = table;
+  loadgen_frame_count = count;
+  for (uint8_t i = 0; i < count; i++) {
+    const float period_us = table[i].periodMs * 1000.0f * scale;
+    loadgen_period_us[i] = period_us < 1.0f ? 1 : (uint32_t)period_us;
+    // Spread the first instances over their period, as independently started ECUs would be.
+    loadgen_due_us[i] = now_us + (uint64_t)loadgen_period_us[i] * i / count;
+    loadgen_counter[i] = table[i].counterMin;
+  }
+  loadgen_bus_free_us = now_us;
+  loadgen_rx_head = 0;
+  loadgen_rx_count = 0;
+  loadgen_pending = false;
+  loadgen_stats.generation = generation;
+  loadgen_stats.loadPercent = loadgen_config_load ? loadgen_config_load : (uint8_t)(native + 0.5f);
+  loadgen_reset_stats_locked(now_us);
+  loadgen_running = true;
+  LOG_INFO("can", "loadgen: generation %u, %u frames, %u%% load (native %.1f%%)", generation, count,
+           loadgen_stats.loadPercent, native);
+  return true;
+}
+
+static bool loadgen_begin(uint8_t bus, twai_mode_t mode) {
+  (void)mode;
+  if (bus != 0) {
+    return true;
+  }
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  return loadgen_start_locked(loadgen_config_generation ? loadgen_config_generation : haldexGeneration);
+}
+
+static void loadgen_end(uint8_t bus) {
+  if (bus != 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  loadgen_running = false;
+  loadgen_rx_count = 0;
+  loadgen_pending = false;
+}
+
+static int loadgen_send(uint8_t bus, const twai_message_t& msg, TickType_t timeout_ticks) {
+  (void)timeout_ticks;
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  const uint64_t now_us = loadgen_now_us();
+  if (bus == 0) {
+    // Chassis TX (OpenHaldex broadcast, standalone frames) takes its slot on the simulated wire.
+    loadgen_run(now_us);
+    loadgen_bus_free_us = ((loadgen_bus_free_us > now_us) ? loadgen_bus_free_us : now_us) + loadgen_wire_us(msg);
+    return 0;
+  }
+  loadgen_stats.haldexTx++;
+  if (loadgen_pending && msg.identifier == loadgen_pending_id) {
+    const uint64_t latency = now_us - loadgen_pending_arrival_us;
+    const uint32_t us = latency > UINT32_MAX ? UINT32_MAX : (uint32_t)latency;
+    loadgen_pending = false;
+    loadgen_stats.forwarded++;
+    loadgen_stats.latencySumUs += us;
+    if (us > loadgen_stats.latencyMaxUs) {
+      loadgen_stats.latencyMaxUs = us;
+    }
+    const uint8_t bucket = loadgen_latency_bucket(us);
+    loadgen_stats.latency[bucket < CAN_LOADGEN_LATENCY_BUCKETS ? bucket : CAN_LOADGEN_LATENCY_BUCKETS - 1]++;
+  }
+  return 0;
+}
+
+static bool loadgen_receive(uint8_t bus, twai_message_t& msg) {
+  if (bus != 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  if (!loadgen_running) {
+    return false;
+  }
+  // Following haldexGeneration: settings load after canInit, and the UI can switch generations.
+  if (!loadgen_config_generation && haldexGeneration != loadgen_stats.generation &&
+      !loadgen_start_locked(haldexGeneration)) {
+    loadgen_running = false;
+    return false;
+  }
+  loadgen_run(loadgen_now_us());
+  if (loadgen_rx_count == 0) {
+    return false;
+  }
+  const loadgen_rx_slot_t& slot = loadgen_rx[loadgen_rx_head];
+  msg = slot.frame;
+  loadgen_pending = true;
+  loadgen_pending_id = slot.frame.identifier;
+  loadgen_pending_arrival_us = slot.arrivalUs;
+  loadgen_rx_head = (uint16_t)((loadgen_rx_head + 1) % CAN_LOADGEN_RX_QUEUE_LEN);
+  loadgen_rx_count--;
+  loadgen_stats.received++;
+  return true;
+}
+
+static const char* loadgen_error_name(int err) {
+  return err == 0 ? "OK" : "FAIL";
+}
+
+const can_hal_backend_t can_hal_loadgen = {
+  "loadgen", loadgen_begin, loadgen_end, loadgen_send, loadgen_receive, nullptr, nullptr, nullptr, loadgen_error_name,
+};
+
+void canLoadgenGetStats(can_loadgen_stats_t& out) {
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  if (loadgen_running) {
+    loadgen_run(loadgen_now_us());
+  }
+  out = loadgen_stats;
+  out.elapsedUs = loadgen_now_us() - loadgen_started_us;
+}
+
+void canLoadgenResetStats() {
+  std::lock_guard<std::mutex> lock(loadgen_mutex);
+  const uint64_t now_us = loadgen_now_us();
+  if (loadgen_running) {
+    loadgen_run(now_us);
+  }
+  loadgen_reset_stats_locked(now_us);
+  loadgen_stats.rxHighWater = loadgen_rx_count;
+}
+
+#endif
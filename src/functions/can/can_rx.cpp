@@ -1,3 +1,4 @@
+#include <atomic>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -7,10 +8,10 @@
 #include "functions/config/config.h"
 #include "functions/core/state.h"
 #include "functions/core/calcs.h"
+#include "functions/core/telemetry.h"
 #include "functions/can/can_id.h"
 #include "functions/canview/canview.h"
-#include "functions/canview/vw_mqb_chassis_dbc.h"
-#include "functions/canview/vw_pq_chassis_dbc.h"
+#include "functions/canview/dbc_table.h"
 #include "functions/can/can_state.h"
 #include "functions/power/power.h"
 #include "functions/diag/uds.h"
@@ -35,145 +36,109 @@ static bool can_messages_equal(const twai_message_t& a, const twai_message_t& b)
   return true;
 }
 
-enum mapped_bus_t { MAPPED_BUS_UNKNOWN = 0, MAPPED_BUS_ANY, MAPPED_BUS_CHASSIS, MAPPED_BUS_HALDEX };
-
 struct mapped_signal_binding_t {
-  String source_key;
+  bool configured = false;
+  bool ready = false;
   mapped_bus_t bus = MAPPED_BUS_UNKNOWN;
   uint32_t frame_id = 0;
   const dbc_signal_t* signal = nullptr;
-  uint8_t generation = 0;
-  bool ready = false;
+  dbc_extract_plan_t plan = {};
+  dbc_extract_plan_t mux_plan = {};
+  dbc_value_plan_t value_plan = {};
+};
+
+// Per-task mapped-input bindings. Rebuilt only when the mapping config, Haldex generation or
+// active DBC table changes, so the RX loop itself does no String work or allocation.
+struct mapped_inputs_t {
+  mapped_signal_binding_t speed;
+  mapped_signal_binding_t throttle;
+  mapped_signal_binding_t rpm;
+  uint32_t config_epoch = 0;
+  uint8_t haldex_generation = 0;
+  const dbc_table_t* table = nullptr;
 };
 
 static volatile uint32_t mapped_speed_tick_ms = 0;
 static volatile uint32_t mapped_throttle_tick_ms = 0;
 static volatile uint32_t mapped_rpm_tick_ms = 0;
 static const uint32_t k_mapped_input_timeout_ms = 1000;
-static mapped_signal_binding_t mode_trigger_binding = {};
-static mode_trigger_config_t mode_trigger_config = {};
-static bool mode_trigger_prev_seen = false;
-static float mode_trigger_prev_value = 0.0f;
-static bool mode_trigger_change_latched = false;
-
-static String normalize_mapping_token(const String& input) {
-  String out = input;
-  out.trim();
-  out.toLowerCase();
-  return out;
-}
-
-static String normalize_signal_name(const char* name) {
-  String out = String(name ? name : "");
-  out.replace("_", " ");
-  out.trim();
-  out.toLowerCase();
-  return out;
-}
-
-static String normalize_signal_unit(const char* unit) {
-  String out = String(unit ? unit : "");
-  out.trim();
-  out.toLowerCase();
-  return out;
-}
-
-static bool split_mapping_key(const String& key, String& bus, String& frame, String& signal, String& unit) {
-  int p1 = key.indexOf('|');
-  int p2 = (p1 >= 0) ? key.indexOf('|', p1 + 1) : -1;
-  int p3 = (p2 >= 0) ? key.indexOf('|', p2 + 1) : -1;
-  if (p1 < 0 || p2 < 0 || p3 < 0) {
-    return false;
-  }
-  bus = key.substring(0, p1);
-  frame = key.substring(p1 + 1, p2);
-  signal = key.substring(p2 + 1, p3);
-  unit = key.substring(p3 + 1);
-  bus = normalize_mapping_token(bus);
-  frame = normalize_mapping_token(frame);
-  signal = normalize_mapping_token(signal);
-  unit = normalize_mapping_token(unit);
-  return true;
-}
-
-static mapped_bus_t parse_mapping_bus(const String& bus) {
-  if (bus == "all" || bus.length() == 0) {
-    return MAPPED_BUS_ANY;
-  }
-  if (bus == "chassis" || bus == "chs") {
-    return MAPPED_BUS_CHASSIS;
-  }
-  if (bus == "haldex" || bus == "hdx") {
-    return MAPPED_BUS_HALDEX;
-  }
-  return MAPPED_BUS_UNKNOWN;
-}
-
-static bool parse_mapping_frame_id(const String& frame, uint32_t& out_id) {
-  if (frame.length() == 0) {
-    return false;
-  }
-  char* endptr = nullptr;
-  const unsigned long parsed = strtoul(frame.c_str(), &endptr, 0);
-  if (endptr == frame.c_str() || *endptr != '\0') {
-    return false;
-  }
-  out_id = (uint32_t)parsed;
-  return true;
-}
+static const uint32_t k_mode_trigger_term_timeout_ms = 1500;
+
+// Trigger value expressed in the bound signal's integer grid (value * den), so INT/FIXED signals
+// compare without float math.
+struct mode_trigger_threshold_t {
+  float value = 0.0f;
+  uint32_t den = 1;
+  int64_t floor_mant = 0;
+  bool exact = false;
+  int64_t nearest_mant = 0;
+  bool near = false; // nearest grid point lies within the EQ tolerance
+};
 
-static const dbc_signal_t* active_chassis_signals() {
-  return (haldexGeneration == 5) ? k_vw_mqb_chassis_signals : k_vw_pq_chassis_signals;
-}
+struct mode_trigger_term_program_t {
+  mapped_signal_binding_t binding;
+  mode_trigger_operator_t op = MODE_TRIGGER_GTE;
+  mode_trigger_threshold_t threshold;
+  mode_trigger_threshold_t release; // replaces threshold while the term is true (hysteresis)
+  bool has_release = false;
+  uint8_t rule = 0;
+};
 
-static uint16_t active_chassis_signal_count() {
-  return (haldexGeneration == 5) ? k_vw_mqb_chassis_signal_count : k_vw_pq_chassis_signal_count;
-}
+// Per-bus term state: only the RX task of that bus writes its row. state and seen_ms are also read
+// by the chassis task when it evaluates rules; prev_* stay with the owning task.
+struct mode_trigger_term_state_t {
+  std::atomic<bool> state;
+  std::atomic<uint32_t> seen_ms; // 0 = never
+  bool prev_seen;
+  dbc_value_t prev_value;
+};
 
-static const dbc_signal_t* find_dbc_signal(uint32_t id, const String& signal_name, const String& signal_unit) {
-  const dbc_signal_t* name_match = nullptr;
-  const dbc_signal_t* active_signals = active_chassis_signals();
-  const uint16_t signal_count = active_chassis_signal_count();
-  for (uint16_t i = 0; i < signal_count; i++) {
-    const dbc_signal_t* sig = &active_signals[i];
-    if (sig->id != id) {
-      continue;
-    }
-    if (normalize_signal_name(sig->name) != signal_name) {
-      continue;
-    }
-    if (normalize_signal_unit(sig->unit) == signal_unit) {
-      return sig;
-    }
-    if (!name_match) {
-      name_match = sig;
-    }
-  }
-  return name_match;
-}
+struct mode_trigger_rule_program_t {
+  mode_trigger_combine_t combine = MODE_TRIGGER_ALL;
+  uint8_t first_term = 0;
+  uint8_t term_count = 0;
+  uint16_t debounce_ms = 0;
+  bool raw = false;
+  bool output = false;
+  uint32_t raw_changed_ms = 0;
+};
 
-static const dbc_signal_t* find_mux_signal(uint32_t id) {
-  const dbc_signal_t* active_signals = active_chassis_signals();
-  const uint16_t signal_count = active_chassis_signal_count();
-  for (uint16_t i = 0; i < signal_count; i++) {
-    const dbc_signal_t* sig = &active_signals[i];
-    if (sig->id == id && sig->mux == -2) {
-      return sig;
-    }
-  }
-  return nullptr;
-}
+// The primary trigger (rule 0) plus the extra rules, compiled into flat arrays whenever their config
+// or the DBC binding changes. by_frame keeps term indices sorted by frame ID, so a frame only
+// evaluates the terms bound to it. Rules are evaluated by the chassis task only.
+#define MODE_TRIGGER_PROGRAM_RULES (1 + MODE_TRIGGER_RULE_MAX)
+#define MODE_TRIGGER_PROGRAM_TERMS (1 + MODE_TRIGGER_RULE_MAX * MODE_TRIGGER_TERM_MAX)
+struct mode_trigger_program_t {
+  mode_trigger_term_program_t terms[MODE_TRIGGER_PROGRAM_TERMS];
+  mode_trigger_term_state_t term_states[2][MODE_TRIGGER_PROGRAM_TERMS];
+  uint8_t term_count = 0;
+  uint8_t by_frame[MODE_TRIGGER_PROGRAM_TERMS] = {};
+  mode_trigger_rule_program_t rules[MODE_TRIGGER_PROGRAM_RULES];
+  uint8_t rule_count = 0;
+};
 
-static bool frame_mux_matches(const dbc_signal_t* signal, const twai_message_t& frame) {
-  if (!signal || signal->mux < 0) {
+// Both RX tasks evaluate the program without a lock: a rebuild compiles into the idle buffer once no
+// task is inside the program and publishes it with one pointer store, like the lock tables.
+// mode_trigger_id_filter holds a bit per hashed frame ID of any term, so the common case, a frame no
+// term is bound to, costs one relaxed load.
+static mode_trigger_program_t mode_trigger_programs[2];
+static std::atomic<mode_trigger_program_t*> mode_trigger_program(nullptr);
+static std::atomic<uint32_t> mode_trigger_readers(0);
+static std::atomic<uint32_t> mode_trigger_id_filter[8];
+static std::atomic<bool> mode_trigger_rebuilding(false);
+static mode_trigger_config_t mode_trigger_config = {};
+static mode_trigger_rules_t mode_trigger_rules = {};
+static mode_trigger_rules_t mode_trigger_next_rules = {};
+static mode_trigger_rule_keys_t mode_trigger_rule_keys = {};
+static uint32_t mode_trigger_config_epoch = 0;
+static uint8_t mode_trigger_haldex_generation = 0;
+static const dbc_table_t* mode_trigger_table = nullptr;
+
+static bool frame_mux_matches(const mapped_signal_binding_t& binding, const twai_message_t& frame) {
+  if (binding.signal->mux < 0) {
     return true;
   }
-  const dbc_signal_t* mux_sig = find_mux_signal(signal->id);
-  if (!mux_sig) {
-    return false;
-  }
-  const uint64_t raw = dbc_extract_raw(frame.data, mux_sig->start_bit, mux_sig->length, mux_sig->is_little_endian);
-  return ((int)raw) == signal->mux;
+  return ((int)dbc_extract_planned(frame.data, binding.mux_plan)) == binding.signal->mux;
 }
 
 static bool mapping_bus_matches(mapped_bus_t bus, uint8_t bus_index) {
@@ -189,46 +154,55 @@ static bool mapping_bus_matches(mapped_bus_t bus, uint8_t bus_index) {
   return false;
 }
 
-static void refresh_binding(mapped_signal_binding_t& binding, const String& source_key_raw) {
-  const String source_key = normalize_mapping_token(source_key_raw);
-  if (binding.source_key == source_key && binding.generation == haldexGeneration) {
+static void bind_signal(mapped_signal_binding_t& binding, const mapped_signal_key_t& key, const dbc_table_t* table) {
+  binding = {};
+  binding.configured = key.configured;
+  if (!key.valid) {
     return;
   }
 
-  binding.source_key = source_key;
-  binding.bus = MAPPED_BUS_UNKNOWN;
-  binding.frame_id = 0;
-  binding.signal = nullptr;
-  binding.generation = haldexGeneration;
-  binding.ready = false;
-
-  if (source_key.length() == 0) {
+  binding.bus = key.bus;
+  binding.frame_id = key.frameId;
+  binding.signal = dbcFindSignal(table, key.frameId, key.signal, key.unit);
+  if (!binding.signal) {
     return;
   }
-
-  String bus;
-  String frame;
-  String signal;
-  String unit;
-  if (!split_mapping_key(source_key, bus, frame, signal, unit)) {
-    return;
+  binding.plan = dbcSignalPlan(table, binding.signal);
+  binding.value_plan = dbc_plan_value(binding.signal);
+  binding.ready = true;
+  if (binding.signal->mux >= 0) {
+    const dbc_signal_t* mux_sig = dbcFindMuxSignal(table, binding.frame_id);
+    binding.ready = mux_sig != nullptr;
+    if (mux_sig) {
+      binding.mux_plan = dbcSignalPlan(table, mux_sig);
+    }
   }
+}
 
-  binding.bus = parse_mapping_bus(bus);
-  if (binding.bus == MAPPED_BUS_UNKNOWN) {
+static void refresh_mapped_inputs(mapped_inputs_t& inputs) {
+  const uint32_t config_epoch = configEpoch();
+  const dbc_table_t* table = dbcActiveChassisTable();
+  if (inputs.config_epoch == config_epoch && inputs.haldex_generation == haldexGeneration &&
+      inputs.table == table) {
     return;
   }
 
-  if (!parse_mapping_frame_id(frame, binding.frame_id)) {
-    return;
+  mapped_signal_key_t speed = {};
+  mapped_signal_key_t throttle = {};
+  mapped_signal_key_t rpm = {};
+  if (!mappedInputKeysGet(speed, throttle, rpm, 0)) {
+    return; // config busy; retry next loop
   }
-
-  binding.signal = find_dbc_signal(binding.frame_id, signal, unit);
-  binding.ready = binding.signal != nullptr;
+  bind_signal(inputs.speed, speed, table);
+  bind_signal(inputs.throttle, throttle, table);
+  bind_signal(inputs.rpm, rpm, table);
+  inputs.config_epoch = config_epoch;
+  inputs.haldex_generation = haldexGeneration;
+  inputs.table = table;
 }
 
 static bool apply_binding_from_frame(const mapped_signal_binding_t& binding, const twai_message_t& frame,
-                                     uint8_t bus_index, float& out_value) {
+                                     uint8_t bus_index, dbc_value_t& out_value) {
   if (!binding.ready || !binding.signal) {
     return false;
   }
@@ -238,11 +212,11 @@ static bool apply_binding_from_frame(const mapped_signal_binding_t& binding, con
   if ((frame.identifier & 0x1FFFFFFF) != (binding.frame_id & 0x1FFFFFFF)) {
     return false;
   }
-  if (!frame_mux_matches(binding.signal, frame)) {
+  if (!frame_mux_matches(binding, frame)) {
     return false;
   }
-  const float value = dbc_decode_signal(binding.signal, frame.data);
-  if (!std::isfinite(value)) {
+  const dbc_value_t value = dbc_decode_value(binding.signal, binding.value_plan, binding.plan, frame.data);
+  if (!dbc_value_valid(value)) {
     return false;
   }
   out_value = value;
@@ -267,369 +241,632 @@ static bool mode_trigger_configs_equal(const mode_trigger_config_t& left, const
          left.broadcastOpenHaldexOverCAN == right.broadcastOpenHaldexOverCAN;
 }
 
-static bool evaluate_mode_trigger_condition(float value) {
-  switch (mode_trigger_config.op) {
+static bool mode_trigger_rules_equal(const mode_trigger_rules_t& left, const mode_trigger_rules_t& right) {
+  if (left.count != right.count) {
+    return false;
+  }
+  for (uint8_t r = 0; r < left.count; r++) {
+    const mode_trigger_rule_t& a = left.rules[r];
+    const mode_trigger_rule_t& b = right.rules[r];
+    if (a.enabled != b.enabled || a.combine != b.combine || a.debounceMs != b.debounceMs || a.mode != b.mode ||
+        a.broadcastOpenHaldexOverCAN != b.broadcastOpenHaldexOverCAN || a.termCount != b.termCount) {
+      return false;
+    }
+    for (uint8_t t = 0; t < a.termCount; t++) {
+      if (a.terms[t].signal != b.terms[t].signal || a.terms[t].op != b.terms[t].op ||
+          !trigger_values_equal(a.terms[t].value, b.terms[t].value) ||
+          !trigger_values_equal(a.terms[t].hysteresis, b.terms[t].hysteresis)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static mode_trigger_threshold_t prepare_trigger_threshold(float value, const dbc_value_plan_t& plan) {
+  mode_trigger_threshold_t t = {};
+  t.value = value;
+  t.den = (plan.den > 0) ? plan.den : 1;
+  const double scaled = (double)value * (double)t.den;
+  t.nearest_mant = (int64_t)floor(scaled + 0.5);
+  const double error = fabs(scaled - (double)t.nearest_mant);
+  // The configured value is a float; treat float noise around a grid point as exact.
+  t.exact = error <= 1e-6 * (fabs(scaled) > 1.0 ? fabs(scaled) : 1.0);
+  t.floor_mant = t.exact ? t.nearest_mant : (int64_t)floor(scaled);
+  t.near = error <= 0.001 * (double)t.den;
+  return t;
+}
+
+static bool trigger_value_matches(const dbc_value_t& value, const mode_trigger_threshold_t& t) {
+  if (value.kind == DBC_VALUE_FLOAT || value.den != t.den) {
+    return trigger_values_equal(dbc_value_to_float(value), t.value);
+  }
+  if (!t.near) {
+    return false;
+  }
+  const int64_t diff = value.mant - t.nearest_mant;
+  const uint64_t distance = (uint64_t)((diff < 0) ? -diff : diff);
+  return distance * 1000U <= value.den;
+}
+
+static bool trigger_compare(mode_trigger_operator_t op, const dbc_value_t& value, const mode_trigger_threshold_t& t) {
+  const bool integral = value.kind != DBC_VALUE_FLOAT && value.den == t.den;
+  const float fvalue = integral ? 0.0f : dbc_value_to_float(value);
+  const int64_t mant = value.mant;
+
+  switch (op) {
   case MODE_TRIGGER_GT:
-    return value > mode_trigger_config.value;
+    return integral ? (mant > t.floor_mant) : (fvalue > t.value);
   case MODE_TRIGGER_GTE:
-    return value >= mode_trigger_config.value;
+    return integral ? (t.exact ? mant >= t.floor_mant : mant > t.floor_mant) : (fvalue >= t.value);
   case MODE_TRIGGER_LT:
-    return value < mode_trigger_config.value;
+    return integral ? (t.exact ? mant < t.floor_mant : mant <= t.floor_mant) : (fvalue < t.value);
   case MODE_TRIGGER_LTE:
-    return value <= mode_trigger_config.value;
+    return integral ? (mant <= t.floor_mant) : (fvalue <= t.value);
   case MODE_TRIGGER_EQ:
-    return trigger_values_equal(value, mode_trigger_config.value);
+    return trigger_value_matches(value, t);
   case MODE_TRIGGER_NEQ:
-    return !trigger_values_equal(value, mode_trigger_config.value);
-  case MODE_TRIGGER_CHANGE: {
-    const bool target_now = trigger_values_equal(value, mode_trigger_config.value);
-    const bool target_before =
-      mode_trigger_prev_seen && trigger_values_equal(mode_trigger_prev_value, mode_trigger_config.value);
-    if (target_now && !target_before) {
-      mode_trigger_change_latched = true;
-    } else if (!target_now) {
-      mode_trigger_change_latched = false;
-    }
-    return mode_trigger_change_latched;
-  }
+    return !trigger_value_matches(value, t);
   default:
     break;
   }
   return false;
 }
 
-static void refresh_mode_trigger_binding() {
+static bool evaluate_trigger_term(const mode_trigger_term_program_t& term, const mode_trigger_term_state_t& ts,
+                                  const dbc_value_t& value) {
+  const bool state = ts.state.load(std::memory_order_relaxed);
+  if (term.op == MODE_TRIGGER_CHANGE) {
+    // Latches on the edge into the target value and holds while the signal stays there.
+    if (!trigger_value_matches(value, term.threshold)) {
+      return false;
+    }
+    return state || !(ts.prev_seen && trigger_value_matches(ts.prev_value, term.threshold));
+  }
+  const mode_trigger_threshold_t& t = (state && term.has_release) ? term.release : term.threshold;
+  return trigger_compare(term.op, value, t);
+}
+
+static uint8_t mode_trigger_id_bit(uint32_t id) {
+  return (uint8_t)((id ^ (id >> 8) ^ (id >> 16)) & 0xFF);
+}
+
+static bool mode_trigger_id_filter_hit(uint32_t id) {
+  const uint8_t bit = mode_trigger_id_bit(id);
+  return (mode_trigger_id_filter[bit >> 5].load(std::memory_order_relaxed) & (1UL << (bit & 31))) != 0;
+}
+
+static void compile_trigger_term(mode_trigger_program_t& program, uint8_t rule, const mapped_signal_key_t& key,
+                                 mode_trigger_operator_t op, float value, float hysteresis,
+                                 const dbc_table_t* table) {
+  mode_trigger_term_program_t& term = program.terms[program.term_count++];
+  term = {};
+  term.rule = rule;
+  term.op = op;
+  bind_signal(term.binding, key, table);
+  term.binding.frame_id &= 0x1FFFFFFF;
+  term.threshold = prepare_trigger_threshold(value, term.binding.value_plan);
+  if (hysteresis > 0.0f && (op == MODE_TRIGGER_GT || op == MODE_TRIGGER_GTE)) {
+    term.release = prepare_trigger_threshold(value - hysteresis, term.binding.value_plan);
+    term.has_release = true;
+  } else if (hysteresis > 0.0f && (op == MODE_TRIGGER_LT || op == MODE_TRIGGER_LTE)) {
+    term.release = prepare_trigger_threshold(value + hysteresis, term.binding.value_plan);
+    term.has_release = true;
+  }
+}
+
+static void compile_mode_trigger_program(mode_trigger_program_t& program, const mode_trigger_config_t& primary,
+                                         const mapped_signal_key_t& primary_key, const mode_trigger_rules_t& rules,
+                                         const mode_trigger_rule_keys_t& keys, const dbc_table_t* table) {
+  program.term_count = 0;
+  program.rule_count = 0;
+  for (uint8_t b = 0; b < 2; b++) {
+    for (uint8_t i = 0; i < MODE_TRIGGER_PROGRAM_TERMS; i++) {
+      mode_trigger_term_state_t& ts = program.term_states[b][i];
+      ts.state.store(false, std::memory_order_relaxed);
+      ts.seen_ms.store(0, std::memory_order_relaxed);
+      ts.prev_seen = false;
+      ts.prev_value = {};
+    }
+  }
+
+  // Rule 0 is the primary trigger; rule r + 1 is modeTriggerRulesGet() entry r.
+  mode_trigger_rule_program_t& first = program.rules[program.rule_count++];
+  first = {};
+  if (primary.enabled) {
+    compile_trigger_term(program, 0, primary_key, primary.op, primary.value, 0.0f, table);
+    first.term_count = 1;
+  }
+
+  for (uint8_t r = 0; r < rules.count && r < MODE_TRIGGER_RULE_MAX; r++) {
+    const mode_trigger_rule_t& config = rules.rules[r];
+    mode_trigger_rule_program_t& rule = program.rules[program.rule_count++];
+    rule = {};
+    rule.combine = config.combine;
+    rule.debounce_ms = config.debounceMs;
+    rule.first_term = program.term_count;
+    if (!config.enabled) {
+      continue;
+    }
+    for (uint8_t t = 0; t < config.termCount && t < MODE_TRIGGER_TERM_MAX; t++) {
+      const mode_trigger_term_t& term = config.terms[t];
+      compile_trigger_term(program, (uint8_t)(r + 1), keys[r][t], term.op, term.value, term.hysteresis, table);
+      rule.term_count++;
+    }
+  }
+
+  for (uint8_t i = 0; i < program.term_count; i++) {
+    uint8_t j = i;
+    while (j > 0 && program.terms[program.by_frame[j - 1]].binding.frame_id > program.terms[i].binding.frame_id) {
+      program.by_frame[j] = program.by_frame[j - 1];
+      j--;
+    }
+    program.by_frame[j] = i;
+  }
+}
+
+// A term bound to both buses takes whichever bus saw its frame last.
+static bool trigger_term_live_state(const mode_trigger_program_t& program, uint8_t index, uint32_t now_ms) {
+  bool found = false;
+  bool state = false;
+  uint32_t newest_age = 0;
+  for (uint8_t b = 0; b < 2; b++) {
+    const mode_trigger_term_state_t& ts = program.term_states[b][index];
+    const uint32_t seen_ms = ts.seen_ms.load(std::memory_order_acquire);
+    const uint32_t age = now_ms - seen_ms;
+    if (seen_ms == 0 || age > k_mode_trigger_term_timeout_ms || (found && age >= newest_age)) {
+      continue;
+    }
+    found = true;
+    newest_age = age;
+    state = ts.state.load(std::memory_order_relaxed);
+  }
+  return found && state;
+}
+
+static void update_trigger_rule(const mode_trigger_program_t& program, mode_trigger_rule_program_t& rule,
+                                uint32_t now_ms) {
+  bool raw = (rule.combine == MODE_TRIGGER_ALL) && rule.term_count > 0;
+  for (uint8_t i = 0; i < rule.term_count; i++) {
+    const bool live_state = trigger_term_live_state(program, (uint8_t)(rule.first_term + i), now_ms);
+    if (rule.combine == MODE_TRIGGER_ALL) {
+      raw = raw && live_state;
+    } else {
+      raw = raw || live_state;
+    }
+  }
+  if (raw != rule.raw) {
+    rule.raw = raw;
+    rule.raw_changed_ms = now_ms;
+  }
+  if (rule.output != rule.raw && (now_ms - rule.raw_changed_ms) >= rule.debounce_ms) {
+    rule.output = rule.raw;
+  }
+}
+
+// Re-runs liveness and debounce for every extra rule, not just those whose frames arrived: a rule
+// whose frames stop has to time out even while other rules keep seeing traffic.
+static void update_trigger_rules(mode_trigger_program_t& program, uint32_t now_ms) {
+  int8_t active_rule = -1;
+  for (uint8_t r = 1; r < program.rule_count; r++) {
+    mode_trigger_rule_program_t& rule = program.rules[r];
+    update_trigger_rule(program, rule, now_ms);
+    if (rule.output && active_rule < 0) {
+      active_rule = (int8_t)(r - 1);
+    }
+  }
+  modeTriggerRuleRuntimeUpdate(active_rule, now_ms);
+}
+
+static void run_mode_trigger_program(mode_trigger_program_t& program, const twai_message_t& frame, uint8_t bus_index,
+                                     uint32_t now_ms) {
+  const uint32_t id = frame.identifier & 0x1FFFFFFF;
+  uint8_t lo = 0;
+  uint8_t hi = program.term_count;
+  while (lo < hi) {
+    const uint8_t mid = (uint8_t)((lo + hi) / 2);
+    if (program.terms[program.by_frame[mid]].binding.frame_id < id) {
+      lo = (uint8_t)(mid + 1);
+    } else {
+      hi = mid;
+    }
+  }
+
+  uint32_t touched_rules = 0;
+  for (uint8_t i = lo; i < program.term_count; i++) {
+    const uint8_t index = program.by_frame[i];
+    const mode_trigger_term_program_t& term = program.terms[index];
+    if (term.binding.frame_id != id) {
+      break;
+    }
+    dbc_value_t value = {};
+    if (!apply_binding_from_frame(term.binding, frame, bus_index, value)) {
+      continue;
+    }
+    mode_trigger_term_state_t& ts = program.term_states[bus_index ? 1 : 0][index];
+    const bool state = evaluate_trigger_term(term, ts, value);
+    ts.prev_value = value;
+    ts.prev_seen = true;
+    ts.state.store(state, std::memory_order_relaxed);
+    ts.seen_ms.store(now_ms ? now_ms : 1, std::memory_order_release);
+    touched_rules |= 1U << term.rule;
+    if (term.rule == 0) {
+      modeTriggerRuntimeUpdate(state, value, now_ms);
+    }
+  }
+  // Haldex-bus terms reach their rules on the next chassis pass.
+  if (bus_index == 0 && (touched_rules & ~1U) != 0) {
+    update_trigger_rules(program, now_ms);
+  }
+}
+
+static bool mode_trigger_wait_for_readers(TickType_t deadline) {
+  while (mode_trigger_readers.load() != 0) {
+    if ((int32_t)(xTaskGetTickCount() - deadline) >= 0) {
+      return false;
+    }
+    vTaskDelay(1);
+  }
+  return true;
+}
+
+static void refresh_mode_trigger_program() {
+  const uint32_t config_epoch = configEpoch();
+  const dbc_table_t* table = dbcActiveChassisTable();
+  if (mode_trigger_config_epoch == config_epoch && mode_trigger_haldex_generation == haldexGeneration &&
+      mode_trigger_table == table) {
+    return;
+  }
+  bool idle = false;
+  if (!mode_trigger_rebuilding.compare_exchange_strong(idle, true)) {
+    return; // the other RX task is already rebuilding
+  }
+
   mode_trigger_config_t next_config = {};
-  if (!modeTriggerConfigGet(next_config, 0)) {
+  mapped_signal_key_t key = {};
+  if (!modeTriggerConfigGet(next_config, 0) || !modeTriggerKeyGet(key, 0) ||
+      !modeTriggerRulesGet(mode_trigger_next_rules, 0) || !modeTriggerRuleKeysGet(mode_trigger_rule_keys, 0)) {
+    mode_trigger_rebuilding.store(false);
+    return;
+  }
+
+  const bool config_changed = !mode_trigger_configs_equal(mode_trigger_config, next_config) ||
+                              !mode_trigger_rules_equal(mode_trigger_rules, mode_trigger_next_rules);
+  // Other settings move the epoch too; keep the running program (and its latches) unless it is stale.
+  mode_trigger_program_t* current = mode_trigger_program.load();
+  if (current && !config_changed && mode_trigger_haldex_generation == haldexGeneration &&
+      mode_trigger_table == table) {
+    mode_trigger_config_epoch = config_epoch;
+    mode_trigger_rebuilding.store(false);
+    return;
+  }
+
+  // Grace period for the buffer retired by the previous swap; retried next pass if a reader lingers.
+  if (current && !mode_trigger_wait_for_readers(xTaskGetTickCount() + pdMS_TO_TICKS(5))) {
+    mode_trigger_rebuilding.store(false);
     return;
   }
+  mode_trigger_program_t* next =
+    (current == &mode_trigger_programs[0]) ? &mode_trigger_programs[1] : &mode_trigger_programs[0];
+  compile_mode_trigger_program(*next, next_config, key, mode_trigger_next_rules, mode_trigger_rule_keys, table);
 
-  if (!mode_trigger_configs_equal(mode_trigger_config, next_config)) {
-    mode_trigger_prev_seen = false;
-    mode_trigger_prev_value = 0.0f;
-    mode_trigger_change_latched = false;
-    modeTriggerRuntimeReset();
+  // The filter covers both programs across the swap, then only the new one.
+  uint32_t next_filter[8] = {};
+  for (uint8_t i = 0; i < next->term_count; i++) {
+    const uint8_t bit = mode_trigger_id_bit(next->terms[i].binding.frame_id);
+    next_filter[bit >> 5] |= 1UL << (bit & 31);
+  }
+  for (uint8_t w = 0; w < 8; w++) {
+    mode_trigger_id_filter[w].fetch_or(next_filter[w]);
+  }
+  mode_trigger_program.store(next);
+  for (uint8_t w = 0; w < 8; w++) {
+    mode_trigger_id_filter[w].store(next_filter[w]);
   }
 
   mode_trigger_config = next_config;
-  refresh_binding(mode_trigger_binding, mode_trigger_config.signal);
+  mode_trigger_rules = mode_trigger_next_rules;
+  mode_trigger_config_epoch = config_epoch;
+  mode_trigger_haldex_generation = haldexGeneration;
+  mode_trigger_table = table;
+  modeTriggerRuntimeReset();
+  mode_trigger_rebuilding.store(false);
+}
 
-  if (!mode_trigger_config.enabled || mode_trigger_config.signal.length() == 0 || !mode_trigger_binding.ready) {
-    modeTriggerRuntimeReset();
+// Once per chassis pass, so timeouts and debounce expire without any trigger frame arriving.
+static void service_mode_trigger_rules(uint32_t now_ms) {
+  mode_trigger_readers.fetch_add(1);
+  mode_trigger_program_t* program = mode_trigger_program.load();
+  if (program && program->rule_count > 1) {
+    update_trigger_rules(*program, now_ms);
   }
+  mode_trigger_readers.fetch_sub(1);
 }
 
 static void apply_mode_trigger_from_frame(const twai_message_t& frame, uint8_t bus_index, uint32_t now_ms) {
-  if (!mode_trigger_config.enabled || !mode_trigger_binding.ready) {
+  if (!mode_trigger_id_filter_hit(frame.identifier & 0x1FFFFFFF)) {
     return;
   }
-
-  float trigger_value = 0.0f;
-  if (!apply_binding_from_frame(mode_trigger_binding, frame, bus_index, trigger_value)) {
-    return;
+  mode_trigger_readers.fetch_add(1);
+  mode_trigger_program_t* program = mode_trigger_program.load();
+  if (program && program->term_count > 0) {
+    run_mode_trigger_program(*program, frame, bus_index, now_ms);
   }
-
-  const bool trigger_active = evaluate_mode_trigger_condition(trigger_value);
-  modeTriggerRuntimeUpdate(trigger_active, trigger_value, now_ms);
-  mode_trigger_prev_value = trigger_value;
-  mode_trigger_prev_seen = true;
+  mode_trigger_readers.fetch_sub(1);
 }
 
-// Chassis-side receive loop:
+// Chassis-side receive pass, drains everything queued (parseCAN_chs runs it every tick):
 // - caches incoming chassis traffic for CAN View
 // - updates core telemetry (throttle/rpm/speed)
 // - mutates pass-through frames when controller is enabled
 // - forwards toward Haldex bus
-void parseCAN_chs(void* arg) {
+void canBridgeChassisPass() {
   static uint32_t last_abs_speed_ms = 0;
   static bool abs_speed_valid = false;
   static const uint32_t k_abs_speed_timeout_ms = 500;
   static const uint16_t k_rx_burst_yield_frames = 64;
-  static mapped_signal_binding_t mapped_speed_binding = {};
-  static mapped_signal_binding_t mapped_throttle_binding = {};
-  static mapped_signal_binding_t mapped_rpm_binding = {};
-  static String mapped_speed_source = "";
-  static String mapped_throttle_source = "";
-  static String mapped_rpm_source = "";
+  static mapped_inputs_t mapped = {};
+
+  refresh_mapped_inputs(mapped);
+  refresh_mode_trigger_program();
+  service_mode_trigger_rules(millis());
+  (void)telemetryPublishIfDue(millis());
+
+  uint16_t burst_frames = 0;
+  while (chassis_can_receive(rx_msg_chs())) {
+    lastCANChassisTick = millis();
+    const uint32_t now_ms = millis();
+    powerTrackChassisFrame(rx_msg_chs(), now_ms);
+    canviewCacheFrame(rx_msg_chs(), 0);
+    apply_mode_trigger_from_frame(rx_msg_chs(), 0, now_ms);
+
+    dbc_value_t mapped_value = {};
+    if (apply_binding_from_frame(mapped.throttle, rx_msg_chs(), 0, mapped_value)) {
+      received_pedal_value = dbc_value_negative(mapped_value) ? 0.0f : dbc_value_to_float(mapped_value);
+      vehicle_state.throttle = received_pedal_value;
+      mapped_throttle_tick_ms = now_ms;
+    }
+    if (apply_binding_from_frame(mapped.rpm, rx_msg_chs(), 0, mapped_value)) {
+      received_vehicle_rpm = dbc_value_negative(mapped_value) ? 0 : (uint16_t)dbc_value_round(mapped_value);
+      mapped_rpm_tick_ms = now_ms;
+    }
+    if (apply_binding_from_frame(mapped.speed, rx_msg_chs(), 0, mapped_value)) {
+      received_vehicle_speed = dbc_value_negative(mapped_value) ? 0 : (uint16_t)dbc_value_round(mapped_value);
+      vehicle_state.speed = received_vehicle_speed;
+      mapped_speed_tick_ms = now_ms;
+    }
 
-  while (1) {
-#if detailedDebugStack
-    stackCHS = uxTaskGetStackHighWaterMark(NULL);
-#endif
-    (void)mappedInputSignalsGet(mapped_speed_source, mapped_throttle_source, mapped_rpm_source, 0);
-    refresh_binding(mapped_speed_binding, mapped_speed_source);
-    refresh_binding(mapped_throttle_binding, mapped_throttle_source);
-    refresh_binding(mapped_rpm_binding, mapped_rpm_source);
-    refresh_mode_trigger_binding();
-
-    uint16_t burst_frames = 0;
-    while (chassis_can_receive(rx_msg_chs())) {
-      lastCANChassisTick = millis();
-      const uint32_t now_ms = millis();
-      powerTrackChassisFrame(rx_msg_chs(), now_ms);
-      canviewCacheFrame(rx_msg_chs(), 0);
-      apply_mode_trigger_from_frame(rx_msg_chs(), 0, now_ms);
-
-      float mapped_value = 0.0f;
-      if (apply_binding_from_frame(mapped_throttle_binding, rx_msg_chs(), 0, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
-        }
-        received_pedal_value = mapped_value;
-        vehicle_state.throttle = received_pedal_value;
-        mapped_throttle_tick_ms = now_ms;
+    const bool speed_mapped_recent =
+      mapped.speed.configured && ((now_ms - (uint32_t)mapped_speed_tick_ms) <= k_mapped_input_timeout_ms);
+    const bool throttle_mapped_recent = mapped.throttle.configured &&
+                                        ((now_ms - (uint32_t)mapped_throttle_tick_ms) <= k_mapped_input_timeout_ms);
+    const bool rpm_mapped_recent =
+      mapped.rpm.configured && ((now_ms - (uint32_t)mapped_rpm_tick_ms) <= k_mapped_input_timeout_ms);
+
+    tx_msg_hdx().identifier = rx_msg_chs().identifier;
+
+    if (isStandalone) {
+      switch (rx_msg_chs().identifier) {
+      case diagnostics_1_ID:
+      case diagnostics_2_ID:
+      case diagnostics_3_ID:
+      case diagnostics_4_ID:
+      case diagnostics_5_ID:
+        // Standalone mode keeps diagnostic gateway traffic alive across buses.
+        tx_msg_hdx() = rx_msg_chs();
+        tx_msg_hdx().extd = rx_msg_chs().extd;
+        tx_msg_hdx().rtr = rx_msg_chs().rtr;
+        tx_msg_hdx().data_length_code = rx_msg_chs().data_length_code;
+        haldex_can_send(tx_msg_hdx(), (10 / portTICK_PERIOD_MS), false);
+        break;
       }
-      if (apply_binding_from_frame(mapped_rpm_binding, rx_msg_chs(), 0, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
+    }
+
+    if (!isStandalone) {
+      switch (rx_msg_chs().identifier) {
+      case MOTOR1_ID:
+        if (!throttle_mapped_recent) {
+          received_pedal_value = rx_msg_chs().data[5] * 0.4f;
+          vehicle_state.throttle = received_pedal_value;
         }
-        received_vehicle_rpm = (uint16_t)lroundf(mapped_value);
-        mapped_rpm_tick_ms = now_ms;
-      }
-      if (apply_binding_from_frame(mapped_speed_binding, rx_msg_chs(), 0, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
+        if (!rpm_mapped_recent) {
+          received_vehicle_rpm = ((rx_msg_chs().data[3] << 8) | rx_msg_chs().data[2]) * 0.25f;
         }
-        received_vehicle_speed = (uint16_t)lroundf(mapped_value);
-        vehicle_state.speed = received_vehicle_speed;
-        mapped_speed_tick_ms = now_ms;
-      }
-
-      const bool speed_mapped_recent =
-        (mapped_speed_source.length() > 0) && ((now_ms - (uint32_t)mapped_speed_tick_ms) <= k_mapped_input_timeout_ms);
-      const bool throttle_mapped_recent = (mapped_throttle_source.length() > 0) &&
-                                          ((now_ms - (uint32_t)mapped_throttle_tick_ms) <= k_mapped_input_timeout_ms);
-      const bool rpm_mapped_recent =
-        (mapped_rpm_source.length() > 0) && ((now_ms - (uint32_t)mapped_rpm_tick_ms) <= k_mapped_input_timeout_ms);
-
-      tx_msg_hdx().identifier = rx_msg_chs().identifier;
-
-      if (isStandalone) {
-        switch (rx_msg_chs().identifier) {
-        case diagnostics_1_ID:
-        case diagnostics_2_ID:
-        case diagnostics_3_ID:
-        case diagnostics_4_ID:
-        case diagnostics_5_ID:
-          // Standalone mode keeps diagnostic gateway traffic alive across buses.
-          tx_msg_hdx() = rx_msg_chs();
-          tx_msg_hdx().extd = rx_msg_chs().extd;
-          tx_msg_hdx().rtr = rx_msg_chs().rtr;
-          tx_msg_hdx().data_length_code = rx_msg_chs().data_length_code;
-          haldex_can_send(tx_msg_hdx(), (10 / portTICK_PERIOD_MS), false);
-          break;
+        break;
+
+      case BRAKES1_ID: {
+        // ABS aggregate vehicle speed (BR1_Wheel_Speed_kmh, 0.01 km/h units).
+        if (!speed_mapped_recent) {
+          uint64_t raw = dbc_extract_raw(rx_msg_chs().data, 17, 15, 1);
+          received_vehicle_speed = (uint16_t)((raw + 50) / 100);
+          vehicle_state.speed = received_vehicle_speed;
+          last_abs_speed_ms = millis();
+          abs_speed_valid = true;
         }
+        break;
       }
 
-      if (!isStandalone) {
-        switch (rx_msg_chs().identifier) {
-        case MOTOR1_ID:
-          if (!throttle_mapped_recent) {
-            received_pedal_value = rx_msg_chs().data[5] * 0.4f;
-            vehicle_state.throttle = received_pedal_value;
-          }
-          if (!rpm_mapped_recent) {
-            received_vehicle_rpm = ((rx_msg_chs().data[3] << 8) | rx_msg_chs().data[2]) * 0.25f;
-          }
-          break;
-
-        case BRAKES1_ID: {
-          // ABS aggregate vehicle speed (BR1_Wheel_Speed_kmh, 0.01 km/h units).
-          if (!speed_mapped_recent) {
-            uint64_t raw = dbc_extract_raw(rx_msg_chs().data, 17, 15, 1);
-            received_vehicle_speed = (uint16_t)((raw + 50) / 100);
-            vehicle_state.speed = received_vehicle_speed;
-            last_abs_speed_ms = millis();
-            abs_speed_valid = true;
-          }
-          break;
+      case MOTOR2_ID:
+        // Fallback only when ABS speed is missing/stale.
+        if (!speed_mapped_recent && (!abs_speed_valid || (millis() - last_abs_speed_ms) > k_abs_speed_timeout_ms)) {
+          received_vehicle_speed = rx_msg_chs().data[3] * 128 / 100;
+          vehicle_state.speed = received_vehicle_speed;
         }
-
-        case MOTOR2_ID:
-          // Fallback only when ABS speed is missing/stale.
-          if (!speed_mapped_recent && (!abs_speed_valid || (millis() - last_abs_speed_ms) > k_abs_speed_timeout_ms)) {
-            received_vehicle_speed = rx_msg_chs().data[3] * 128 / 100;
-            vehicle_state.speed = received_vehicle_speed;
-          }
-          break;
-
-        case MOTOR_04:
-          if (haldexGeneration == 5) {
-            const uint16_t mo_ladedruck_raw =
-              (uint16_t)(((uint16_t)rx_msg_chs().data[5] << 1) | (rx_msg_chs().data[4] >> 7)) & 0x01FF;
-            const int32_t boost_mbar = (int32_t)(mo_ladedruck_raw * 10.0f + 0.5f) - 1000;
-            received_vehicle_boost = (boost_mbar > 0) ? (uint16_t)boost_mbar : 0;
-          }
-          break;
-
-        case MOTOR_20:
-          if (haldexGeneration == 5 && !throttle_mapped_recent) {
-            received_pedal_value = ((rx_msg_chs().data[1] >> 4) | ((rx_msg_chs().data[2] & 0x0F) << 4)) * 0.4f;
-            vehicle_state.throttle = received_pedal_value;
-          }
-          break;
-
-        case ESP_19:
-          if (haldexGeneration == 5 && !speed_mapped_recent) {
-            const uint16_t wheel_speed_hl_raw = (uint16_t)((rx_msg_chs().data[1] << 8) | rx_msg_chs().data[0]);
-            const uint16_t wheel_speed_hr_raw = (uint16_t)((rx_msg_chs().data[3] << 8) | rx_msg_chs().data[2]);
-            const uint16_t wheel_speed_vl_raw = (uint16_t)((rx_msg_chs().data[5] << 8) | rx_msg_chs().data[4]);
-            const uint16_t wheel_speed_vr_raw = (uint16_t)((rx_msg_chs().data[7] << 8) | rx_msg_chs().data[6]);
-            const float average_wheel_speed =
-              (wheel_speed_hl_raw + wheel_speed_hr_raw + wheel_speed_vl_raw + wheel_speed_vr_raw) * (0.0075f / 4.0f);
-
-            received_vehicle_speed = (uint16_t)(average_wheel_speed + 0.5f);
-            vehicle_state.speed = received_vehicle_speed;
-            last_abs_speed_ms = millis();
-            abs_speed_valid = true;
-          }
-          break;
-
-        case ESP_21:
-          if (haldexGeneration == 5 && !speed_mapped_recent &&
-              (!abs_speed_valid || (millis() - last_abs_speed_ms) > k_abs_speed_timeout_ms)) {
-            received_vehicle_speed = (uint16_t)((((rx_msg_chs().data[5] << 8) | rx_msg_chs().data[4]) * 0.01f) + 0.5f);
-            vehicle_state.speed = received_vehicle_speed;
-            last_abs_speed_ms = millis();
-            abs_speed_valid = true;
-          }
-          break;
-
-        case OPENHALDEX_EXTERNAL_CONTROL_ID:
-          // External mode messages are intentionally ignored for mode selection.
-          // Main UI/API configuration is authoritative.
-          break;
+        break;
+
+      case MOTOR_04:
+        if (haldexGeneration == 5) {
+          const uint16_t mo_ladedruck_raw =
+            (uint16_t)(((uint16_t)rx_msg_chs().data[5] << 1) | (rx_msg_chs().data[4] >> 7)) & 0x01FF;
+          const int32_t boost_mbar = (int32_t)(mo_ladedruck_raw * 10.0f + 0.5f) - 1000;
+          received_vehicle_boost = (boost_mbar > 0) ? (uint16_t)boost_mbar : 0;
         }
+        break;
 
-        bool generatedFrame = false;
-        twai_message_t original = rx_msg_chs();
-
-        // STOCK: bridge unchanged. MAP: mutate known control frames for selected generation.
-        if (openhaldexEffectiveMode() != MODE_STOCK) {
-          if (haldexGeneration == 1 || haldexGeneration == 2 || haldexGeneration == 4 || haldexGeneration == 5) {
-            getLockData(rx_msg_chs());
-            generatedFrame = !can_messages_equal(original, rx_msg_chs());
-          }
-        } else {
-          lock_target = 0;
+      case MOTOR_20:
+        if (haldexGeneration == 5 && !throttle_mapped_recent) {
+          received_pedal_value = ((rx_msg_chs().data[1] >> 4) | ((rx_msg_chs().data[2] & 0x0F) << 4)) * 0.4f;
+          vehicle_state.throttle = received_pedal_value;
+        }
+        break;
+
+      case ESP_19:
+        if (haldexGeneration == 5 && !speed_mapped_recent) {
+          const uint16_t wheel_speed_hl_raw = (uint16_t)((rx_msg_chs().data[1] << 8) | rx_msg_chs().data[0]);
+          const uint16_t wheel_speed_hr_raw = (uint16_t)((rx_msg_chs().data[3] << 8) | rx_msg_chs().data[2]);
+          const uint16_t wheel_speed_vl_raw = (uint16_t)((rx_msg_chs().data[5] << 8) | rx_msg_chs().data[4]);
+          const uint16_t wheel_speed_vr_raw = (uint16_t)((rx_msg_chs().data[7] << 8) | rx_msg_chs().data[6]);
+          const float average_wheel_speed =
+            (wheel_speed_hl_raw + wheel_speed_hr_raw + wheel_speed_vl_raw + wheel_speed_vr_raw) * (0.0075f / 4.0f);
+
+          received_vehicle_speed = (uint16_t)(average_wheel_speed + 0.5f);
+          vehicle_state.speed = received_vehicle_speed;
+          last_abs_speed_ms = millis();
+          abs_speed_valid = true;
+        }
+        break;
+
+      case ESP_21:
+        if (haldexGeneration == 5 && !speed_mapped_recent &&
+            (!abs_speed_valid || (millis() - last_abs_speed_ms) > k_abs_speed_timeout_ms)) {
+          received_vehicle_speed = (uint16_t)((((rx_msg_chs().data[5] << 8) | rx_msg_chs().data[4]) * 0.01f) + 0.5f);
+          vehicle_state.speed = received_vehicle_speed;
+          last_abs_speed_ms = millis();
+          abs_speed_valid = true;
         }
+        break;
 
-        tx_msg_hdx() = rx_msg_chs();
-        tx_msg_hdx().extd = rx_msg_chs().extd;
-        tx_msg_hdx().rtr = rx_msg_chs().rtr;
-        tx_msg_hdx().data_length_code = rx_msg_chs().data_length_code;
-        haldex_can_send(tx_msg_hdx(), (10 / portTICK_PERIOD_MS), generatedFrame);
+      case OPENHALDEX_EXTERNAL_CONTROL_ID:
+        // External mode messages are intentionally ignored for mode selection.
+        // Main UI/API configuration is authoritative.
+        break;
+      }
+
+      bool generatedFrame = false;
+      twai_message_t original = rx_msg_chs();
+
+      // STOCK: bridge unchanged. MAP: mutate known control frames for selected generation.
+      if (openhaldexEffectiveMode() != MODE_STOCK) {
+        if (haldexGeneration == 1 || haldexGeneration == 2 || haldexGeneration == 4 || haldexGeneration == 5) {
+          getLockData(rx_msg_chs());
+          generatedFrame = !can_messages_equal(original, rx_msg_chs());
+        }
+      } else {
+        lock_target = 0;
       }
 
-      if (++burst_frames >= k_rx_burst_yield_frames) {
-        burst_frames = 0;
-        taskYIELD();
+      tx_msg_hdx() = rx_msg_chs();
+      tx_msg_hdx().extd = rx_msg_chs().extd;
+      tx_msg_hdx().rtr = rx_msg_chs().rtr;
+      tx_msg_hdx().data_length_code = rx_msg_chs().data_length_code;
+      haldex_can_send(tx_msg_hdx(), (10 / portTICK_PERIOD_MS), generatedFrame);
+      if (generatedFrame && bootFirstControlFrameMs == 0) {
+        bootFirstControlFrameMs = millis();
       }
     }
 
+    if (++burst_frames >= k_rx_burst_yield_frames) {
+      burst_frames = 0;
+      taskYIELD();
+    }
+  }
+}
+
+void parseCAN_chs(void* arg) {
+  while (1) {
+#if detailedDebugStack
+    stackCHS = uxTaskGetStackHighWaterMark(NULL);
+#endif
+    canBridgeChassisPass();
     vTaskDelay(1);
   }
 }
 
-// Haldex-side receive loop:
+// Haldex-side receive pass, drains everything queued (parseCAN_hdx runs it every tick):
 // - caches incoming Haldex traffic for CAN View
 // - derives telemetry/status flags used by diagnostics UI
 // - optionally rebroadcasts Haldex frames onto chassis bus
-void parseCAN_hdx(void* arg) {
+void canBridgeHaldexPass() {
   static const uint16_t k_rx_burst_yield_frames = 64;
-  static mapped_signal_binding_t mapped_speed_binding = {};
-  static mapped_signal_binding_t mapped_throttle_binding = {};
-  static mapped_signal_binding_t mapped_rpm_binding = {};
-  static String mapped_speed_source = "";
-  static String mapped_throttle_source = "";
-  static String mapped_rpm_source = "";
+  static mapped_inputs_t mapped = {};
+
+  refresh_mapped_inputs(mapped);
+  refresh_mode_trigger_program();
+
+  uint16_t burst_frames = 0;
+  while (haldex_can_receive(rx_msg_hdx())) {
+    lastCANHaldexTick = millis();
+    const bool suppress_internal_diag = diagUdsObserveHaldexFrame(rx_msg_hdx());
+    canviewCacheFrame(rx_msg_hdx(), 1);
+    const uint32_t now_ms = millis();
+    apply_mode_trigger_from_frame(rx_msg_hdx(), 1, now_ms);
+
+    dbc_value_t mapped_value = {};
+    if (apply_binding_from_frame(mapped.throttle, rx_msg_hdx(), 1, mapped_value)) {
+      received_pedal_value = dbc_value_negative(mapped_value) ? 0.0f : dbc_value_to_float(mapped_value);
+      vehicle_state.throttle = received_pedal_value;
+      mapped_throttle_tick_ms = now_ms;
+    }
+    if (apply_binding_from_frame(mapped.rpm, rx_msg_hdx(), 1, mapped_value)) {
+      received_vehicle_rpm = dbc_value_negative(mapped_value) ? 0 : (uint16_t)dbc_value_round(mapped_value);
+      mapped_rpm_tick_ms = now_ms;
+    }
+    if (apply_binding_from_frame(mapped.speed, rx_msg_hdx(), 1, mapped_value)) {
+      received_vehicle_speed = dbc_value_negative(mapped_value) ? 0 : (uint16_t)dbc_value_round(mapped_value);
+      vehicle_state.speed = received_vehicle_speed;
+      mapped_speed_tick_ms = now_ms;
+    }
 
-  while (1) {
-#if detailedDebugStack
-    stackHDX = uxTaskGetStackHighWaterMark(NULL);
-#endif
-    (void)mappedInputSignalsGet(mapped_speed_source, mapped_throttle_source, mapped_rpm_source, 0);
-    refresh_binding(mapped_speed_binding, mapped_speed_source);
-    refresh_binding(mapped_throttle_binding, mapped_throttle_source);
-    refresh_binding(mapped_rpm_binding, mapped_rpm_source);
-    refresh_mode_trigger_binding();
-
-    uint16_t burst_frames = 0;
-    while (haldex_can_receive(rx_msg_hdx())) {
-      lastCANHaldexTick = millis();
-      const bool suppress_internal_diag = diagUdsObserveHaldexFrame(rx_msg_hdx());
-      canviewCacheFrame(rx_msg_hdx(), 1);
-      const uint32_t now_ms = millis();
-      apply_mode_trigger_from_frame(rx_msg_hdx(), 1, now_ms);
-
-      float mapped_value = 0.0f;
-      if (apply_binding_from_frame(mapped_throttle_binding, rx_msg_hdx(), 1, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
-        }
-        received_pedal_value = mapped_value;
-        vehicle_state.throttle = received_pedal_value;
-        mapped_throttle_tick_ms = now_ms;
-      }
-      if (apply_binding_from_frame(mapped_rpm_binding, rx_msg_hdx(), 1, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
-        }
-        received_vehicle_rpm = (uint16_t)lroundf(mapped_value);
-        mapped_rpm_tick_ms = now_ms;
+    // Engagement extraction is generation-specific and follows legacy OpenHaldex behavior.
+    if (haldexGeneration == 5) {
+      if (rx_msg_hdx().identifier == HALDEX_ID_GEN5) {
+        received_haldex_engagement_raw = rx_msg_hdx().data[2];
+        received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 0, 250);
+        received_haldex_state = rx_msg_hdx().data[3];
       }
-      if (apply_binding_from_frame(mapped_speed_binding, rx_msg_hdx(), 1, mapped_value)) {
-        if (mapped_value < 0.0f) {
-          mapped_value = 0.0f;
-        }
-        received_vehicle_speed = (uint16_t)lroundf(mapped_value);
-        vehicle_state.speed = received_vehicle_speed;
-        mapped_speed_tick_ms = now_ms;
+    } else {
+      if (haldexGeneration == 1) {
+        received_haldex_engagement_raw = rx_msg_hdx().data[1];
+        received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 198);
       }
 
-      // Engagement extraction is generation-specific and follows legacy OpenHaldex behavior.
-      if (haldexGeneration == 5) {
-        if (rx_msg_hdx().identifier == HALDEX_ID_GEN5) {
-          received_haldex_engagement_raw = rx_msg_hdx().data[2];
-          received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 0, 250);
-          received_haldex_state = rx_msg_hdx().data[3];
-        }
-      } else {
-        if (haldexGeneration == 1) {
-          received_haldex_engagement_raw = rx_msg_hdx().data[1];
-          received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 198);
-        }
-
-        if (haldexGeneration == 2) {
-          received_haldex_engagement_raw = rx_msg_hdx().data[1] + rx_msg_hdx().data[4];
-          received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 255);
-        }
+      if (haldexGeneration == 2) {
+        received_haldex_engagement_raw = rx_msg_hdx().data[1] + rx_msg_hdx().data[4];
+        received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 255);
+      }
 
-        if (haldexGeneration == 4) {
-          received_haldex_engagement_raw = rx_msg_hdx().data[1];
-          received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 255);
-        }
-        received_haldex_state = rx_msg_hdx().data[0];
+      if (haldexGeneration == 4) {
+        received_haldex_engagement_raw = rx_msg_hdx().data[1];
+        received_haldex_engagement = map_haldex_engagement_percent(received_haldex_engagement_raw, 128, 255);
       }
-      awd_state.actual = received_haldex_engagement;
+      received_haldex_state = rx_msg_hdx().data[0];
+    }
+    awd_state.actual = received_haldex_engagement;
 
-      received_report_clutch1 = (received_haldex_state & (1 << 0));
-      received_temp_protection = (received_haldex_state & (1 << 1));
-      received_report_clutch2 = (received_haldex_state & (1 << 2));
-      received_coupling_open = (received_haldex_state & (1 << 3));
-      received_speed_limit = (received_haldex_state & (1 << 6));
+    received_report_clutch1 = (received_haldex_state & (1 << 0));
+    received_temp_protection = (received_haldex_state & (1 << 1));
+    received_report_clutch2 = (received_haldex_state & (1 << 2));
+    received_coupling_open = (received_haldex_state & (1 << 3));
+    received_speed_limit = (received_haldex_state & (1 << 6));
 
-      // Forward Haldex traffic onto chassis CAN (bridge behavior).
-      if (openhaldexEffectiveBroadcastOpenHaldexOverCAN() && !suppress_internal_diag) {
-        chassis_can_send(rx_msg_hdx(), (10 / portTICK_PERIOD_MS));
-      }
+    // Forward Haldex traffic onto chassis CAN (bridge behavior).
+    if (openhaldexEffectiveBroadcastOpenHaldexOverCAN() && !suppress_internal_diag) {
+      chassis_can_send(rx_msg_hdx(), (10 / portTICK_PERIOD_MS));
+    }
 
-      if (++burst_frames >= k_rx_burst_yield_frames) {
-        burst_frames = 0;
-        taskYIELD();
-      }
+    if (++burst_frames >= k_rx_burst_yield_frames) {
+      burst_frames = 0;
+      taskYIELD();
     }
+  }
+}
 
+void parseCAN_hdx(void* arg) {
+  while (1) {
+#if detailedDebugStack
+    stackHDX = uxTaskGetStackHighWaterMark(NULL);
+#endif
+    canBridgeHaldexPass();
     vTaskDelay(1);
   }
 }
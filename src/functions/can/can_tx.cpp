@@ -3,6 +3,7 @@
 #include "functions/config/config.h"
 
 #include "functions/core/state.h"
+#include "functions/core/telemetry.h"
 #include "functions/can/can_id.h"
 #include "functions/can/can_state.h"
 
@@ -14,6 +15,8 @@ void broadcastOpenHaldex(void* arg) {
 #if detailedDebugStack
     stackbroadcastOpenHaldex = uxTaskGetStackHighWaterMark(NULL);
 #endif
+    telemetry_snapshot_t telemetry = {};
+    telemetryRead(telemetry);
     twai_message_t broadcast_frame = {};
     broadcast_frame.identifier = OPENHALDEX_BROADCAST_ID;
     broadcast_frame.extd = 0;
@@ -21,12 +24,12 @@ void broadcastOpenHaldex(void* arg) {
     broadcast_frame.data_length_code = 8;
     broadcast_frame.data[0] = 0;
     broadcast_frame.data[1] = isStandalone ? 1 : 0;
-    broadcast_frame.data[2] = (uint8_t)received_haldex_engagement_raw;
-    broadcast_frame.data[3] = (uint8_t)lock_target;
-    broadcast_frame.data[4] = received_vehicle_speed;
-    broadcast_frame.data[5] = state.mode_override;
+    broadcast_frame.data[2] = telemetry.haldexEngagementRaw;
+    broadcast_frame.data[3] = (uint8_t)telemetry.lockTarget;
+    broadcast_frame.data[4] = telemetry.speed;
+    broadcast_frame.data[5] = telemetry.modeOverride;
     broadcast_frame.data[6] = (uint8_t)openhaldexEffectiveMode();
-    broadcast_frame.data[7] = (uint8_t)received_pedal_value;
+    broadcast_frame.data[7] = (uint8_t)telemetry.throttle;
 
     if (openhaldexEffectiveBroadcastOpenHaldexOverCAN()) {
       chassis_can_send(broadcast_frame, (10 / portTICK_PERIOD_MS));
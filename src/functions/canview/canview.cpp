@@ -1,7 +1,6 @@
 #include "functions/canview/canview.h"
 #include "functions/can/can_id.h"
-#include "functions/canview/vw_mqb_chassis_dbc.h"
-#include "functions/canview/vw_pq_chassis_dbc.h"
+#include "functions/canview/dbc_table.h"
 #include "functions/core/state.h"
 #include "functions/storage/filelog.h"
 #include <math.h>
@@ -86,15 +85,15 @@ static void canview_copy_frame(canview_frame_t& dst, const twai_message_t& msg,
   }
 }
 
-static void canview_update_cache(canview_frame_t* cache, uint8_t cache_size, const twai_message_t& msg,
-                                 bool generated) {
+static uint8_t canview_update_cache(canview_frame_t* cache, uint8_t cache_size, const twai_message_t& msg,
+                                    bool generated) {
   uint32_t key = canview_make_key(msg);
   int oldest_index = 0;
   uint32_t oldest_ts = cache[0].ts;
   for (uint8_t i = 0; i < cache_size; i++) {
     if (cache[i].key == key) {
       canview_copy_frame(cache[i], msg, generated);
-      return;
+      return i;
     }
     if (i == 0 || cache[i].ts < oldest_ts) {
       oldest_ts = cache[i].ts;
@@ -102,6 +101,7 @@ static void canview_update_cache(canview_frame_t* cache, uint8_t cache_size, con
     }
   }
   canview_copy_frame(cache[oldest_index], msg, generated);
+  return (uint8_t)oldest_index;
 }
 
 static void canview_push_raw(canview_frame_t* raw, uint8_t& idx, const twai_message_t& msg, bool generated) {
@@ -160,6 +160,12 @@ void canviewCacheFrameTx(const twai_message_t& msg, uint8_t bus, bool generated)
   }
 }
 
+uint8_t canviewBenchUpdateCache(const twai_message_t& msg) {
+  // A scratch cache the size of the chassis one, so benchmarks leave the live view untouched.
+  static canview_frame_t bench_cache[CANVIEW_CHASSIS_CACHE_SIZE];
+  return canview_update_cache(bench_cache, CANVIEW_CHASSIS_CACHE_SIZE, msg, false);
+}
+
 static bool canview_find_frame(uint32_t id, const canview_frame_t* cache, uint8_t cache_size, canview_frame_t& out) {
   uint32_t key = id & 0x1FFFFFFF;
   for (uint8_t i = 0; i < cache_size; i++) {
@@ -171,14 +177,6 @@ static bool canview_find_frame(uint32_t id, const canview_frame_t* cache, uint8_
   return false;
 }
 
-static const dbc_signal_t* canview_active_chassis_signals() {
-  return (haldexGeneration == 5) ? k_vw_mqb_chassis_signals : k_vw_pq_chassis_signals;
-}
-
-static uint16_t canview_active_chassis_signal_count() {
-  return (haldexGeneration == 5) ? k_vw_mqb_chassis_signal_count : k_vw_pq_chassis_signal_count;
-}
-
 bool canviewGetLastTxFrame(uint8_t bus, uint32_t id, canview_last_tx_t& out) {
   out.found = false;
   out.generated = false;
@@ -206,18 +204,6 @@ bool canviewGetLastTxFrame(uint8_t bus, uint32_t id, canview_last_tx_t& out) {
   }
   return true;
 }
-static const dbc_signal_t* canview_find_mux_signal(uint32_t id) {
-  const dbc_signal_t* active_signals = canview_active_chassis_signals();
-  const uint16_t active_signal_count = canview_active_chassis_signal_count();
-  for (uint16_t i = 0; i < active_signal_count; i++) {
-    const dbc_signal_t* sig = &active_signals[i];
-    if (sig->id == id && sig->mux == -2) {
-      return sig;
-    }
-  }
-  return nullptr;
-}
-
 static String canview_haldex_state_label(uint8_t v) {
   String out = String(v);
   String labels;
@@ -240,113 +226,6 @@ static String canview_haldex_state_label(uint8_t v) {
   return out;
 }
 
-static int canview_get_mux_value(uint32_t id, const canview_frame_t& frame, bool& ok) {
-  ok = false;
-  const dbc_signal_t* mux_sig = canview_find_mux_signal(id);
-  if (!mux_sig) {
-    return 0;
-  }
-  uint64_t raw = dbc_extract_raw(frame.data, mux_sig->start_bit, mux_sig->length, mux_sig->is_little_endian);
-  ok = true;
-  return (int)raw;
-}
-
-static String canview_normalize_signal_token(const char* value) {
-  String token = String(value ? value : "");
-  token.replace("_", " ");
-  token.trim();
-  token.toLowerCase();
-  return token;
-}
-
-static String canview_normalize_unit_token(const char* value) {
-  String token = String(value ? value : "");
-  token.trim();
-  token.toLowerCase();
-  return token;
-}
-
-static bool canview_split_mapping_key(const String& raw, String& bus, String& frame, String& signal, String& unit) {
-  int first = raw.indexOf('|');
-  if (first < 0) {
-    return false;
-  }
-  int second = raw.indexOf('|', first + 1);
-  if (second < 0) {
-    return false;
-  }
-  int third = raw.indexOf('|', second + 1);
-  if (third < 0) {
-    return false;
-  }
-
-  bus = raw.substring(0, first);
-  frame = raw.substring(first + 1, second);
-  signal = raw.substring(second + 1, third);
-  unit = raw.substring(third + 1);
-  bus.trim();
-  bus.toLowerCase();
-  frame.trim();
-  frame.toLowerCase();
-  signal.trim();
-  signal.toLowerCase();
-  unit.trim();
-  unit.toLowerCase();
-  return bus.length() > 0 && frame.length() > 0 && signal.length() > 0;
-}
-
-static bool canview_parse_frame_id(const String& token, uint32_t& out_id) {
-  String value = token;
-  value.trim();
-  if (!value.length()) {
-    return false;
-  }
-
-  char* end = nullptr;
-  unsigned long parsed = strtoul(value.c_str(), &end, 0);
-  if (!end || *end != '\0') {
-    return false;
-  }
-  out_id = (uint32_t)parsed;
-  return true;
-}
-
-static const dbc_signal_t* canview_find_signal_definition(uint32_t id, const String& signal_name,
-                                                          const String& signal_unit) {
-  const dbc_signal_t* name_match = nullptr;
-  const dbc_signal_t* active_signals = canview_active_chassis_signals();
-  const uint16_t active_signal_count = canview_active_chassis_signal_count();
-  for (uint16_t i = 0; i < active_signal_count; i++) {
-    const dbc_signal_t* sig = &active_signals[i];
-    if (sig->id != id) {
-      continue;
-    }
-    if (canview_normalize_signal_token(sig->name) != signal_name) {
-      continue;
-    }
-    if (canview_normalize_unit_token(sig->unit) == signal_unit) {
-      return sig;
-    }
-    if (!name_match) {
-      name_match = sig;
-    }
-  }
-  return name_match;
-}
-
-static bool canview_frame_matches_signal(const dbc_signal_t* signal, const canview_frame_t& frame) {
-  if (!signal) {
-    return false;
-  }
-  if (signal->mux < 0) {
-    return true;
-  }
-
-  bool mux_ok = false;
-  const int mux_val = canview_get_mux_value(signal->id, frame, mux_ok);
-  return mux_ok && mux_val == signal->mux;
-}
-
 static bool canview_find_latest_frame_for_id(const canview_frame_t* cache, uint8_t cache_size, uint32_t id,
                                              uint32_t now, canview_frame_t& out) {
   bool found = false;
@@ -368,17 +247,17 @@ static bool canview_find_latest_frame_for_id(const canview_frame_t* cache, uint8
   return found;
 }
 
-static bool canview_select_latest_frame(const String& bus, uint32_t id, canview_frame_t& out, String& out_dir) {
+static bool canview_select_latest_frame(mapped_bus_t bus, uint32_t id, canview_frame_t& out, const char*& out_dir) {
   const uint32_t now = millis();
   canview_frame_t rx_frame = {};
   canview_frame_t tx_frame = {};
   bool has_rx = false;
   bool has_tx = false;
 
-  if (bus == "chassis") {
+  if (bus == MAPPED_BUS_CHASSIS) {
     has_rx = canview_find_latest_frame_for_id(canview_chassis_cache, CANVIEW_CHASSIS_CACHE_SIZE, id, now, rx_frame);
     has_tx = canview_find_latest_frame_for_id(canview_chassis_cache_tx, CANVIEW_CHASSIS_CACHE_SIZE, id, now, tx_frame);
-  } else if (bus == "haldex") {
+  } else if (bus == MAPPED_BUS_HALDEX) {
     has_rx = canview_find_latest_frame_for_id(canview_haldex_cache, CANVIEW_HALDEX_CACHE_SIZE, id, now, rx_frame);
     has_tx = canview_find_latest_frame_for_id(canview_haldex_cache_tx, CANVIEW_HALDEX_CACHE_SIZE, id, now, tx_frame);
   } else {
@@ -400,7 +279,88 @@ static bool canview_select_latest_frame(const String& bus, uint32_t id, canview_
   return true;
 }
 
-bool canviewResolveMappedSignal(const String& key, canview_resolved_signal_t& out) {
+// Dashboard slots bound to their signal once per config epoch: key parsed, DBC signal found and its
+// extraction plans built, so a status poll only picks the newest frame and decodes it. Built and read
+// on the web task only.
+enum {
+  CANVIEW_SLOT_UNBOUND = 0,
+  CANVIEW_SLOT_DBC,
+  CANVIEW_SLOT_HALDEX_STATE,
+  CANVIEW_SLOT_ENGAGEMENT,
+};
+
+struct canview_slot_plan_t {
+  uint8_t kind;
+  bool mapped;
+  mapped_bus_t bus;
+  uint32_t frame_id;
+  const dbc_signal_t* signal;
+  dbc_extract_plan_t plan;
+  dbc_value_plan_t value_plan;
+  bool has_mux;
+  dbc_extract_plan_t mux_plan;
+};
+
+static canview_slot_plan_t canview_slot_plans[DASHBOARD_SIGNAL_SLOT_COUNT];
+static uint32_t canview_slot_epoch = 0;
+static uint8_t canview_slot_generation = 0;
+static const dbc_table_t* canview_slot_table = nullptr;
+
+static void canview_bind_slot(const mapped_signal_key_t& key, const dbc_table_t* table, canview_slot_plan_t& out) {
+  out = {};
+  out.mapped = key.configured;
+  if (!key.valid || (key.bus != MAPPED_BUS_CHASSIS && key.bus != MAPPED_BUS_HALDEX)) {
+    return;
+  }
+  out.bus = key.bus;
+  out.frame_id = key.frameId;
+  if (strcmp(key.signal, "haldex state") == 0) {
+    out.kind = CANVIEW_SLOT_HALDEX_STATE;
+    return;
+  }
+  if (strcmp(key.signal, "engagement") == 0) {
+    out.kind = CANVIEW_SLOT_ENGAGEMENT;
+    return;
+  }
+
+  const dbc_signal_t* sig = dbcFindSignal(table, key.frameId, key.signal, key.unit);
+  if (!sig) {
+    return;
+  }
+  if (sig->mux >= 0) {
+    const dbc_signal_t* mux_sig = dbcFindMuxSignal(table, sig->id);
+    if (!mux_sig) {
+      return;
+    }
+    out.has_mux = true;
+    out.mux_plan = dbcSignalPlan(table, mux_sig);
+  }
+  out.kind = CANVIEW_SLOT_DBC;
+  out.signal = sig;
+  out.plan = dbcSignalPlan(table, sig);
+  out.value_plan = dbc_plan_value(sig);
+}
+
+static void canview_refresh_slot_plans() {
+  const uint32_t epoch = configEpoch();
+  const dbc_table_t* table = dbcActiveChassisTable();
+  if (canview_slot_epoch == epoch && canview_slot_generation == haldexGeneration && canview_slot_table == table) {
+    return;
+  }
+
+  static mapped_signal_key_t keys[DASHBOARD_SIGNAL_SLOT_COUNT];
+  if (!dashboardSignalKeysGet(keys, DASHBOARD_SIGNAL_SLOT_COUNT, 10)) {
+    return; // config busy; keep the old plans and retry on the next call
+  }
+  for (uint8_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    canview_bind_slot(keys[i], table, canview_slot_plans[i]);
+  }
+  canview_slot_epoch = epoch;
+  canview_slot_generation = haldexGeneration;
+  canview_slot_table = table;
+}
+
+bool canviewResolveDashboardSlot(uint8_t slot, canview_resolved_signal_t& out) {
   out.found = false;
   out.mapped = false;
   out.numeric = false;
@@ -412,42 +372,33 @@ bool canviewResolveMappedSignal(const String& key, canview_resolved_signal_t& ou
   out.name = "";
   out.unit = "";
   out.numericValue = 0.0f;
+  out.integral = false;
+  out.integerValue = 0;
   out.textValue = "";
-
-  String normalized = key;
-  normalized.trim();
-  normalized.toLowerCase();
-  out.mapped = normalized.length() > 0;
-  if (!out.mapped) {
+  if (slot >= DASHBOARD_SIGNAL_SLOT_COUNT) {
     return false;
   }
 
-  String bus;
-  String frame_token;
-  String signal_name;
-  String signal_unit;
-  if (!canview_split_mapping_key(normalized, bus, frame_token, signal_name, signal_unit)) {
-    return false;
-  }
-
-  uint32_t frame_id = 0;
-  if (!canview_parse_frame_id(frame_token, frame_id)) {
+  canview_refresh_slot_plans();
+  const canview_slot_plan_t& plan = canview_slot_plans[slot];
+  out.mapped = plan.mapped;
+  if (plan.kind == CANVIEW_SLOT_UNBOUND) {
     return false;
   }
 
   canview_frame_t frame = {};
-  String dir;
-  if (!canview_select_latest_frame(bus, frame_id, frame, dir)) {
+  const char* dir = "";
+  if (!canview_select_latest_frame(plan.bus, plan.frame_id, frame, dir)) {
     return false;
   }
 
-  out.bus = bus;
+  out.bus = (plan.bus == MAPPED_BUS_HALDEX) ? "haldex" : "chassis";
   out.dir = dir;
   out.generated = frame.generated;
   out.id = frame.id;
   out.ageMs = millis() - frame.ts;
 
-  if (signal_name == "haldex state") {
+  if (plan.kind == CANVIEW_SLOT_HALDEX_STATE) {
     uint8_t state = (haldexGeneration == 5) ? frame.data[3] : frame.data[0];
     out.found = true;
     out.name = "Haldex state";
@@ -455,7 +406,7 @@ bool canviewResolveMappedSignal(const String& key, canview_resolved_signal_t& ou
     return true;
   }
 
-  if (signal_name == "engagement") {
+  if (plan.kind == CANVIEW_SLOT_ENGAGEMENT) {
     uint16_t raw = (haldexGeneration == 5) ? frame.data[2] : frame.data[1];
     if (haldexGeneration == 2) {
       raw = (uint16_t)(frame.data[1] + frame.data[4]);
@@ -464,27 +415,48 @@ bool canviewResolveMappedSignal(const String& key, canview_resolved_signal_t& ou
     out.numeric = true;
     out.name = "Engagement";
     out.numericValue = raw;
+    out.integral = true;
+    out.integerValue = raw;
     return true;
   }
 
-  const dbc_signal_t* sig = canview_find_signal_definition(frame_id, signal_name, signal_unit);
-  if (!sig || !canview_frame_matches_signal(sig, frame)) {
+  const dbc_signal_t* sig = plan.signal;
+  if (plan.has_mux && (int)dbc_extract_planned(frame.data, plan.mux_plan) != sig->mux) {
     return false;
   }
-
-  float value = dbc_decode_signal(sig, frame.data);
-  if (!isfinite(value)) {
+  const dbc_value_t value = dbc_decode_value(sig, plan.value_plan, plan.plan, frame.data);
+  if (!dbc_value_valid(value)) {
     return false;
   }
 
   out.found = true;
   out.numeric = true;
-  out.name = String(sig->name ? sig->name : "");
-  out.unit = String(sig->unit ? sig->unit : "");
-  out.numericValue = value;
+  out.name = sig->name ? sig->name : "";
+  out.unit = sig->unit ? sig->unit : "";
+  out.numericValue = dbc_value_to_float(value);
+  out.integral = value.kind == DBC_VALUE_INT && value.mant >= INT32_MIN && value.mant <= INT32_MAX;
+  out.integerValue = out.integral ? (int32_t)value.mant : 0;
   return true;
 }
 
+const char* canviewDashboardSlotName(uint8_t slot) {
+  if (slot >= DASHBOARD_SIGNAL_SLOT_COUNT) {
+    return nullptr;
+  }
+  canview_refresh_slot_plans();
+  const canview_slot_plan_t& plan = canview_slot_plans[slot];
+  switch (plan.kind) {
+  case CANVIEW_SLOT_DBC:
+    return plan.signal->name;
+  case CANVIEW_SLOT_HALDEX_STATE:
+    return "Haldex state";
+  case CANVIEW_SLOT_ENGAGEMENT:
+    return "Engagement";
+  default:
+    return nullptr;
+  }
+}
+
 String canviewBuildJson(uint16_t decoded_limit, uint8_t raw_limit, const String& bus_filter) {
   String json;
   json.reserve(12000);
@@ -498,48 +470,57 @@ String canviewBuildJson(uint16_t decoded_limit, uint8_t raw_limit, const String&
   busFilter.toLowerCase();
   bool want_chassis = (busFilter.length() == 0 || busFilter == "all" || busFilter == "chassis");
   bool want_haldex = (busFilter.length() == 0 || busFilter == "all" || busFilter == "haldex");
-  const dbc_signal_t* active_signals = canview_active_chassis_signals();
-  const uint16_t active_signal_count = canview_active_chassis_signal_count();
+  const dbc_table_t* table = dbcActiveChassisTable();
 
+  // Walk the table one frame ID at a time so each cached frame is looked up and demuxed once.
   auto append_chassis = [&](const canview_frame_t* cache, uint8_t cache_size, const char* bus, const char* dir) {
-    for (uint16_t i = 0; i < active_signal_count && decoded_count < decoded_limit; i++) {
-      const dbc_signal_t* sig = &active_signals[i];
+    if (!table) {
+      return;
+    }
+    for (uint16_t f = 0; f < table->frame_count && decoded_count < decoded_limit; f++) {
+      const dbc_frame_index_t& index = table->frames[f];
       canview_frame_t frame;
-      if (!canview_find_frame(sig->id, cache, cache_size, frame)) {
+      if (!canview_find_frame(index.id, cache, cache_size, frame)) {
         continue;
       }
       if ((now - frame.ts) > CANVIEW_STALE_MS) {
         continue;
       }
-      if (sig->mux >= 0) {
-        bool mux_ok = false;
-        int mux_val = canview_get_mux_value(sig->id, frame, mux_ok);
-        if (!mux_ok || mux_val != sig->mux) {
+      bool mux_ok = false;
+      int mux_val = 0;
+      if (index.mux >= 0) {
+        const dbc_signal_t* mux_sig = &table->signals[index.first + index.mux];
+        mux_val = (int)dbc_extract_planned(frame.data, dbcSignalPlan(table, mux_sig));
+        mux_ok = true;
+      }
+      for (uint16_t i = 0; i < index.count && decoded_count < decoded_limit; i++) {
+        const dbc_signal_t* sig = &table->signals[index.first + i];
+        if (sig->mux >= 0 && (!mux_ok || mux_val != sig->mux)) {
           continue;
         }
-      }
 
-      float value = dbc_decode_signal(sig, frame.data);
-      if (!isfinite(value))
-        value = 0.0f;
-      if (decoded_count > 0) {
-        json += ",";
+        float value = dbc_decode_planned(sig, dbcSignalPlan(table, sig), frame.data);
+        if (!isfinite(value))
+          value = 0.0f;
+        if (decoded_count > 0) {
+          json += ",";
+        }
+        String busStr = canview_escape_json(String(bus));
+        String dirStr = canview_escape_json(String(dir));
+        String nameStr = canview_escape_json(String(sig->name));
+        String unitStr = canview_escape_json(String(sig->unit));
+        json += "{";
+        json += "\"bus\":\"" + busStr + "\"";
+        json += ",\"dir\":\"" + dirStr + "\"";
+        json += ",\"id\":" + String(sig->id);
+        json += ",\"name\":\"" + nameStr + "\"";
+        json += ",\"value\":" + String(value, 3);
+        json += ",\"unit\":\"" + unitStr + "\"";
+        json += ",\"ts\":" + String(frame.ts);
+        json += ",\"generated\":" + String(frame.generated ? "true" : "false");
+        json += "}";
+        decoded_count++;
       }
-      String busStr = canview_escape_json(String(bus));
-      String dirStr = canview_escape_json(String(dir));
-      String nameStr = canview_escape_json(String(sig->name));
-      String unitStr = canview_escape_json(String(sig->unit));
-      json += "{";
-      json += "\"bus\":\"" + busStr + "\"";
-      json += ",\"dir\":\"" + dirStr + "\"";
-      json += ",\"id\":" + String(sig->id);
-      json += ",\"name\":\"" + nameStr + "\"";
-      json += ",\"value\":" + String(value, 3);
-      json += ",\"unit\":\"" + unitStr + "\"";
-      json += ",\"ts\":" + String(frame.ts);
-      json += ",\"generated\":" + String(frame.generated ? "true" : "false");
-      json += "}";
-      decoded_count++;
     }
   };
 
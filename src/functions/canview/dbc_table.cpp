@@ -0,0 +1,612 @@
+#include "functions/canview/dbc_table.h"
+
+#include <LittleFS.h>
+#include <esp_heap_caps.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "functions/canview/vw_mqb_chassis_dbc.h"
+#include "functions/canview/vw_pq_chassis_dbc.h"
+#include "functions/config/config.h"
+#include "functions/core/state.h"
+#include "functions/storage/storage.h"
+
+// Dropping a DBC at one of these paths replaces the compiled table for that platform on next boot.
+static const char* DBC_MQB_PATH = "/dbc/mqb.dbc";
+static const char* DBC_PQ_PATH = "/dbc/pq.dbc";
+static const size_t DBC_LINE_MAX = 256;
+// DBC pseudo-frame that holds unassigned signals.
+static const uint32_t DBC_INDEPENDENT_SIG_ID = 0xC0000000UL;
+
+static dbc_table_t dbc_mqb = {};
+static dbc_table_t dbc_pq = {};
+static volatile bool dbc_ready = false;
+
+struct dbc_reader_t {
+  File file;
+  uint8_t block[512];
+  size_t len;
+  size_t pos;
+};
+
+// Parsed signal before the name pool is final; name/unit are offsets into the scratch pool.
+struct dbc_parsed_signal_t {
+  dbc_signal_t sig;
+  uint32_t name_offset;
+  uint32_t unit_offset;
+  uint32_t order;
+};
+
+struct dbc_intern_t {
+  char* pool;
+  uint32_t pool_len;
+  uint32_t pool_cap;
+  uint32_t* slots; // pool offset + 1, 0 = empty
+  uint32_t slot_count;
+};
+
+static void* dbc_alloc(size_t bytes) {
+  // Tables are read-mostly; prefer PSRAM and keep internal RAM for the CAN/web stacks.
+  void* ptr = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!ptr) {
+    ptr = malloc(bytes);
+  }
+  return ptr;
+}
+
+static int dbc_compare_parsed(const void* a, const void* b) {
+  const dbc_parsed_signal_t* left = (const dbc_parsed_signal_t*)a;
+  const dbc_parsed_signal_t* right = (const dbc_parsed_signal_t*)b;
+  if (left->sig.id != right->sig.id) {
+    return (left->sig.id < right->sig.id) ? -1 : 1;
+  }
+  // Keep DBC order inside a frame, like the generated tables.
+  if (left->order == right->order) {
+    return 0;
+  }
+  return (left->order < right->order) ? -1 : 1;
+}
+
+// Frame ranges over an already ID-sorted signal array.
+static bool dbc_build_frames(dbc_table_t& table, const dbc_signal_t* signals, uint16_t count) {
+  uint16_t frame_count = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (i == 0 || signals[i].id != signals[i - 1].id) {
+      frame_count++;
+    }
+  }
+  dbc_frame_index_t* frames = (dbc_frame_index_t*)dbc_alloc(sizeof(*frames) * frame_count);
+  if (!frames) {
+    return false;
+  }
+
+  uint16_t f = 0;
+  for (uint16_t i = 0; i < count; i++) {
+    if (i == 0 || signals[i].id != signals[i - 1].id) {
+      frames[f].id = signals[i].id;
+      frames[f].first = i;
+      frames[f].count = 0;
+      frames[f].mux = -1;
+      f++;
+    }
+    dbc_frame_index_t& frame = frames[f - 1];
+    if (signals[i].mux == -2 && frame.mux < 0) {
+      frame.mux = (int16_t)frame.count;
+    }
+    frame.count++;
+  }
+
+  table.signals = signals;
+  table.signal_count = count;
+  table.frames = frames;
+  table.frame_count = frame_count;
+  table.ram_bytes += (uint32_t)(sizeof(*frames) * frame_count);
+  return true;
+}
+
+static bool dbc_next_line(dbc_reader_t& reader, char* line, size_t cap) {
+  size_t out = 0;
+  bool any = false;
+  while (true) {
+    if (reader.pos >= reader.len) {
+      reader.len = reader.file.read(reader.block, sizeof(reader.block));
+      reader.pos = 0;
+      if (reader.len == 0) {
+        break;
+      }
+    }
+    const char c = (char)reader.block[reader.pos++];
+    any = true;
+    if (c == '\n') {
+      break;
+    }
+    // Overlong lines are truncated; everything a signal needs sits before the receiver list.
+    if (c != '\r' && out + 1 < cap) {
+      line[out++] = c;
+    }
+  }
+  line[out] = '\0';
+  return any;
+}
+
+static char* dbc_skip_spaces(char* p) {
+  while (*p == ' ' || *p == '\t') {
+    p++;
+  }
+  return p;
+}
+
+static bool dbc_expect(char*& p, char c) {
+  p = dbc_skip_spaces(p);
+  if (*p != c) {
+    return false;
+  }
+  p++;
+  return true;
+}
+
+static uint32_t dbc_hash(const char* s) {
+  uint32_t h = 2166136261UL;
+  while (*s) {
+    h ^= (uint8_t)*s++;
+    h *= 16777619UL;
+  }
+  return h;
+}
+
+// Returns the pool offset of `s`, adding it once; repeated names/units ("CHECKSUM", "") share storage.
+static uint32_t dbc_intern(dbc_intern_t& intern, const char* s) {
+  uint32_t slot = dbc_hash(s) & (intern.slot_count - 1);
+  while (intern.slots[slot] != 0) {
+    const uint32_t offset = intern.slots[slot] - 1;
+    if (strcmp(intern.pool + offset, s) == 0) {
+      return offset;
+    }
+    slot = (slot + 1) & (intern.slot_count - 1);
+  }
+  const uint32_t len = (uint32_t)strlen(s) + 1;
+  if (intern.pool_len + len > intern.pool_cap) {
+    return 0; // pool[0] is always the empty string
+  }
+  const uint32_t offset = intern.pool_len;
+  memcpy(intern.pool + offset, s, len);
+  intern.pool_len += len;
+  intern.slots[slot] = offset + 1;
+  return offset;
+}
+
+// SG_ <name> [M|m<n>] : <start>|<len>@<order><sign> (<factor>,<offset>) [<min>|<max>] "<unit>" ...
+static bool dbc_parse_signal_line(char* p, uint32_t frame_id, dbc_signal_t& sig, char*& name, char*& unit) {
+  p = dbc_skip_spaces(p + 3);
+  name = p;
+  while (*p && *p != ' ' && *p != '\t' && *p != ':') {
+    p++;
+  }
+  if (p == name) {
+    return false;
+  }
+  const bool name_ended_on_colon = (*p == ':');
+  *p = '\0';
+  if (!name_ended_on_colon) {
+    p = dbc_skip_spaces(p + 1);
+  }
+
+  sig.mux = -1;
+  if (!name_ended_on_colon && *p == 'M') {
+    sig.mux = -2;
+    p++;
+  } else if (!name_ended_on_colon && *p == 'm') {
+    char* end = nullptr;
+    const long mux_value = strtol(p + 1, &end, 10);
+    if (end == p + 1 || mux_value < 0 || mux_value > 32767) {
+      return false;
+    }
+    sig.mux = (int16_t)mux_value;
+    p = end;
+    if (*p == 'M') {
+      p++; // extended multiplexing: treat as a plain multiplexed signal
+    }
+  }
+  if (!name_ended_on_colon && !dbc_expect(p, ':')) {
+    return false;
+  }
+  if (name_ended_on_colon) {
+    p++;
+  }
+
+  char* end = nullptr;
+  const unsigned long start_bit = strtoul(dbc_skip_spaces(p), &end, 10);
+  p = end;
+  if (!dbc_expect(p, '|')) {
+    return false;
+  }
+  const unsigned long length = strtoul(p, &end, 10);
+  p = end;
+  if (!dbc_expect(p, '@') || (p[0] != '0' && p[0] != '1') || (p[1] != '+' && p[1] != '-')) {
+    return false;
+  }
+  sig.is_little_endian = (p[0] == '1') ? 1 : 0;
+  sig.is_signed = (p[1] == '-') ? 1 : 0;
+  p += 2;
+
+  if (!dbc_expect(p, '(')) {
+    return false;
+  }
+  sig.factor = strtof(p, &end);
+  p = end;
+  if (!dbc_expect(p, ',')) {
+    return false;
+  }
+  sig.offset = strtof(p, &end);
+  p = end;
+  if (!dbc_expect(p, ')') || !dbc_expect(p, '[')) {
+    return false;
+  }
+  sig.min = strtof(p, &end);
+  p = end;
+  if (!dbc_expect(p, '|')) {
+    return false;
+  }
+  sig.max = strtof(p, &end);
+  p = end;
+  if (!dbc_expect(p, ']') || !dbc_expect(p, '"')) {
+    return false;
+  }
+  unit = p;
+  while (*p && *p != '"') {
+    p++;
+  }
+  *p = '\0';
+
+  if (length == 0 || length > 64 || start_bit > 63) {
+    return false;
+  }
+  if (sig.is_little_endian && (start_bit + length) > 64) {
+    return false;
+  }
+  sig.id = frame_id;
+  sig.start_bit = (uint16_t)start_bit;
+  sig.length = (uint8_t)length;
+  return true;
+}
+
+static bool dbc_parse_frame_line(char* p, uint32_t& frame_id) {
+  char* end = nullptr;
+  const unsigned long raw_id = strtoul(dbc_skip_spaces(p + 3), &end, 10);
+  if (end == p + 3) {
+    return false;
+  }
+  if (raw_id == DBC_INDEPENDENT_SIG_ID) {
+    return false;
+  }
+  // Bit 31 marks extended IDs in DBC files; frames are matched on the 29-bit identifier.
+  frame_id = (uint32_t)(raw_id & 0x1FFFFFFFUL);
+  return true;
+}
+
+static bool dbc_is_keyword(const char* p, const char* keyword) {
+  const size_t len = strlen(keyword);
+  return strncmp(p, keyword, len) == 0 && (p[len] == ' ' || p[len] == '\t');
+}
+
+static bool dbc_open(dbc_reader_t& reader, const char* path) {
+  reader.file = LittleFS.open(path, "r");
+  reader.len = 0;
+  reader.pos = 0;
+  return (bool)reader.file;
+}
+
+static bool dbc_load_file(dbc_table_t& table, const char* path) {
+  const uint32_t started_us = micros();
+  dbc_reader_t* reader = new dbc_reader_t();
+  char* line = (char*)malloc(DBC_LINE_MAX);
+  if (!reader || !line) {
+    delete reader;
+    free(line);
+    return false;
+  }
+
+  // Pass 1: size the signal array and an upper bound for the string pool.
+  uint32_t signal_count = 0;
+  uint32_t string_bytes = 1;
+  if (!dbc_open(*reader, path)) {
+    delete reader;
+    free(line);
+    return false;
+  }
+  while (dbc_next_line(*reader, line, DBC_LINE_MAX)) {
+    const char* p = dbc_skip_spaces(line);
+    if (dbc_is_keyword(p, "SG_")) {
+      signal_count++;
+      string_bytes += (uint32_t)strlen(p) + 2;
+    }
+  }
+  reader->file.close();
+  if (signal_count == 0 || signal_count > 0xFFFF) {
+    LOG_WARN("dbc", "Ignoring %s: signals=%lu", path, (unsigned long)signal_count);
+    delete reader;
+    free(line);
+    return false;
+  }
+
+  dbc_parsed_signal_t* parsed = (dbc_parsed_signal_t*)dbc_alloc(sizeof(*parsed) * signal_count);
+  dbc_intern_t intern = {};
+  intern.pool_cap = string_bytes;
+  intern.pool = (char*)dbc_alloc(intern.pool_cap);
+  intern.slot_count = 64;
+  while (intern.slot_count < signal_count * 4) {
+    intern.slot_count <<= 1;
+  }
+  intern.slots = (uint32_t*)calloc(intern.slot_count, sizeof(uint32_t));
+  bool ok = parsed && intern.pool && intern.slots && dbc_open(*reader, path);
+
+  // Pass 2: parse BO_/SG_ records in file order.
+  uint32_t parsed_count = 0;
+  uint32_t skipped = 0;
+  if (ok) {
+    intern.pool[0] = '\0';
+    intern.pool_len = 1;
+    uint32_t frame_id = 0;
+    bool frame_valid = false;
+    while (dbc_next_line(*reader, line, DBC_LINE_MAX)) {
+      char* p = dbc_skip_spaces(line);
+      if (dbc_is_keyword(p, "BO_")) {
+        frame_valid = dbc_parse_frame_line(p, frame_id);
+        continue;
+      }
+      if (!dbc_is_keyword(p, "SG_")) {
+        continue;
+      }
+      char* name = nullptr;
+      char* unit = nullptr;
+      dbc_parsed_signal_t& out = parsed[parsed_count];
+      if (!frame_valid || parsed_count >= signal_count ||
+          !dbc_parse_signal_line(p, frame_id, out.sig, name, unit)) {
+        skipped++;
+        continue;
+      }
+      out.name_offset = dbc_intern(intern, name);
+      out.unit_offset = dbc_intern(intern, unit);
+      out.order = parsed_count;
+      parsed_count++;
+    }
+    reader->file.close();
+    ok = parsed_count > 0;
+  }
+
+  // Compact: exact-size pool and signal array, then point names/units into the pool.
+  char* pool = nullptr;
+  dbc_signal_t* signals = nullptr;
+  if (ok) {
+    pool = (char*)dbc_alloc(intern.pool_len);
+    signals = (dbc_signal_t*)dbc_alloc(sizeof(*signals) * parsed_count);
+    ok = pool && signals;
+  }
+  if (ok) {
+    memcpy(pool, intern.pool, intern.pool_len);
+    qsort(parsed, parsed_count, sizeof(*parsed), dbc_compare_parsed);
+    for (uint32_t i = 0; i < parsed_count; i++) {
+      signals[i] = parsed[i].sig;
+      signals[i].name = pool + parsed[i].name_offset;
+      signals[i].unit = pool + parsed[i].unit_offset;
+    }
+    dbc_table_t loaded = {};
+    loaded.name = table.name;
+    loaded.source = path;
+    loaded.pool_bytes = intern.pool_len;
+    loaded.ram_bytes = (uint32_t)(intern.pool_len + sizeof(*signals) * parsed_count);
+    ok = dbc_build_frames(loaded, signals, (uint16_t)parsed_count);
+    if (ok) {
+      loaded.load_us = micros() - started_us;
+      table = loaded;
+    }
+  }
+
+  free(parsed);
+  free(intern.pool);
+  free(intern.slots);
+  free(line);
+  delete reader;
+  if (!ok) {
+    free(pool);
+    free(signals);
+    LOG_WARN("dbc", "Failed to load %s; keeping compiled %s table", path, table.name);
+    return false;
+  }
+
+  LOG_INFO("dbc", "Loaded %s signals=%u frames=%u skipped=%lu ramBytes=%lu loadUs=%lu", path,
+           (unsigned)table.signal_count, (unsigned)table.frame_count, (unsigned long)skipped,
+           (unsigned long)table.ram_bytes, (unsigned long)table.load_us);
+  return true;
+}
+
+static void dbc_init_builtin(dbc_table_t& table, const char* name, const dbc_signal_t* signals,
+                             uint16_t signal_count, const dbc_frame_index_t* frames, uint16_t frame_count,
+                             const dbc_name_hash_t* name_hash) {
+  // Generated tables are already sorted and indexed in flash; nothing to build.
+  table = {};
+  table.name = name;
+  table.source = "builtin";
+  table.signals = signals;
+  table.signal_count = signal_count;
+  table.frames = frames;
+  table.frame_count = frame_count;
+  table.name_hash = name_hash;
+}
+
+static void dbc_build_plans(dbc_table_t& table) {
+  if (!table.signals || table.signal_count == 0) {
+    return;
+  }
+  dbc_extract_plan_t* plans = (dbc_extract_plan_t*)dbc_alloc(sizeof(*plans) * table.signal_count);
+  if (!plans) {
+    LOG_WARN("dbc", "No memory for %s extraction plans; decoding per call", table.name);
+    return;
+  }
+  for (uint16_t i = 0; i < table.signal_count; i++) {
+    const dbc_signal_t& sig = table.signals[i];
+    plans[i] = dbc_plan_extract(sig.start_bit, sig.length, sig.is_little_endian);
+  }
+  table.plans = plans;
+  table.ram_bytes += (uint32_t)(sizeof(*plans) * table.signal_count);
+}
+
+void dbcTablesInit() {
+  dbc_init_builtin(dbc_mqb, "mqb", k_vw_mqb_chassis_signals, k_vw_mqb_chassis_signal_count, k_vw_mqb_chassis_frames,
+                   k_vw_mqb_chassis_frame_count, &k_vw_mqb_chassis_name_hash);
+  dbc_init_builtin(dbc_pq, "pq", k_vw_pq_chassis_signals, k_vw_pq_chassis_signal_count, k_vw_pq_chassis_frames,
+                   k_vw_pq_chassis_frame_count, &k_vw_pq_chassis_name_hash);
+
+  if (storageFsReady()) {
+    if (LittleFS.exists(DBC_MQB_PATH)) {
+      dbc_load_file(dbc_mqb, DBC_MQB_PATH);
+    }
+    if (LittleFS.exists(DBC_PQ_PATH)) {
+      dbc_load_file(dbc_pq, DBC_PQ_PATH);
+    }
+  }
+  dbc_build_plans(dbc_mqb);
+  dbc_build_plans(dbc_pq);
+
+  dbc_ready = true;
+}
+
+const dbc_table_t* dbcActiveChassisTable() {
+  if (!dbc_ready) {
+    return nullptr;
+  }
+  const dbc_table_t* table = (haldexGeneration == 5) ? &dbc_mqb : &dbc_pq;
+  return table->signals ? table : nullptr;
+}
+
+const dbc_frame_index_t* dbcFindFrame(const dbc_table_t* table, uint32_t id) {
+  if (!table || table->frame_count == 0) {
+    return nullptr;
+  }
+  uint16_t lo = 0;
+  uint16_t hi = table->frame_count;
+  while (lo < hi) {
+    const uint16_t mid = (uint16_t)((lo + hi) / 2);
+    const uint32_t mid_id = table->frames[mid].id;
+    if (mid_id == id) {
+      return &table->frames[mid];
+    }
+    if (mid_id < id) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return nullptr;
+}
+
+const dbc_signal_t* dbcFindMuxSignal(const dbc_table_t* table, uint32_t id) {
+  const dbc_frame_index_t* frame = dbcFindFrame(table, id);
+  if (!frame || frame->mux < 0) {
+    return nullptr;
+  }
+  return &table->signals[frame->first + frame->mux];
+}
+
+dbc_extract_plan_t dbcSignalPlan(const dbc_table_t* table, const dbc_signal_t* sig) {
+  if (table && table->plans && sig >= table->signals && sig < table->signals + table->signal_count) {
+    return table->plans[sig - table->signals];
+  }
+  return dbc_plan_extract(sig->start_bit, sig->length, sig->is_little_endian);
+}
+
+// Compares a DBC name against a mapping token without building a String.
+static bool dbc_name_matches(const char* dbc_name, const char* token) {
+  const char* p = dbc_name ? dbc_name : "";
+  while (*p == '_' || isspace((unsigned char)*p)) {
+    p++;
+  }
+  const char* end = p + strlen(p);
+  while (end > p && (end[-1] == '_' || isspace((unsigned char)end[-1]))) {
+    end--;
+  }
+  for (; p < end; p++, token++) {
+    const char c = (*p == '_') ? ' ' : (char)tolower((unsigned char)*p);
+    if (c != *token) {
+      return false;
+    }
+  }
+  return *token == '\0';
+}
+
+static bool dbc_unit_matches(const char* dbc_unit, const char* token) {
+  const char* p = dbc_unit ? dbc_unit : "";
+  while (isspace((unsigned char)*p)) {
+    p++;
+  }
+  const char* end = p + strlen(p);
+  while (end > p && isspace((unsigned char)end[-1])) {
+    end--;
+  }
+  for (; p < end; p++, token++) {
+    if ((char)tolower((unsigned char)*p) != *token) {
+      return false;
+    }
+  }
+  return *token == '\0';
+}
+
+const dbc_signal_t* dbcFindSignal(const dbc_table_t* table, uint32_t id, const char* name, const char* unit) {
+  if (!table || !name || !unit) {
+    return nullptr;
+  }
+
+  const dbc_name_hash_t* hash = table->name_hash;
+  if (hash && hash->bucket_count > 0 && hash->slot_count > 0) {
+    const uint32_t bucket = dbc_name_hash(id, name, 0) % hash->bucket_count;
+    const uint32_t slot = dbc_name_hash(id, name, hash->seeds[bucket]) % hash->slot_count;
+    const uint16_t index = hash->slots[slot];
+    if (index >= table->signal_count) {
+      return nullptr;
+    }
+    const dbc_signal_t* sig = &table->signals[index];
+    if (sig->id != id || !dbc_name_matches(sig->name, name)) {
+      return nullptr;
+    }
+    if (dbc_unit_matches(sig->unit, unit)) {
+      return sig;
+    }
+    // Unit differs: fall through so a same-named signal with the right unit still wins.
+  }
+
+  const dbc_frame_index_t* frame = dbcFindFrame(table, id);
+  if (!frame) {
+    return nullptr;
+  }
+  const dbc_signal_t* name_match = nullptr;
+  for (uint16_t i = 0; i < frame->count; i++) {
+    const dbc_signal_t* sig = &table->signals[frame->first + i];
+    if (!dbc_name_matches(sig->name, name)) {
+      continue;
+    }
+    if (dbc_unit_matches(sig->unit, unit)) {
+      return sig;
+    }
+    if (!name_match) {
+      name_match = sig;
+    }
+  }
+  return name_match;
+}
+
+static void dbc_write_table_json(JsonObject out, const dbc_table_t& table) {
+  out["source"] = table.source ? table.source : "";
+  out["signals"] = table.signal_count;
+  out["frames"] = table.frame_count;
+  out["poolBytes"] = table.pool_bytes;
+  out["ramBytes"] = table.ram_bytes;
+  out["loadUs"] = table.load_us;
+}
+
+void dbcWriteStatusJson(JsonObject out) {
+  out["ready"] = (bool)dbc_ready;
+  out["active"] = (haldexGeneration == 5) ? "mqb" : "pq";
+  dbc_write_table_json(out["mqb"].to<JsonObject>(), dbc_mqb);
+  dbc_write_table_json(out["pq"].to<JsonObject>(), dbc_pq);
+}
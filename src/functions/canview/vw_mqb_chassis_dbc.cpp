@@ -1,78 +1,7 @@
+// Generated by scripts/dbc_codegen.py from vw_mqb.dbc; do not edit by hand.
 #include "functions/canview/vw_mqb_chassis_dbc.h"
 
-const dbc_signal_t k_vw_mqb_chassis_signals[] = {
-  {290, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {290, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {290, "ACC_limitierte_Anfahrdyn", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_nachtr_Stopp_Anf", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_DynErhoehung", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_Freilaufstrategie_TSK", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_zul_Regelabw_unten", 16, 6, 1, 0, 0.024f, 0.0f, 0.0f, 1.512f, "Unit_MeterPerSeconSquar", -1},
-  {290, "ACC_StartStopp_Info", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {290, "ACC_Sollbeschleunigung_02", 24, 11, 1, 0, 0.005f, -7.22f, -7.22f, 3.005f, "Unit_MeterPerSeconSquar", -1},
-  {290, "ACC_zul_Regelabw_oben", 35, 5, 1, 0, 0.0625f, 0.0f, 0.0f, 1.9375f, "Unit_MeterPerSeconSquar", -1},
-  {290, "ACC_neg_Sollbeschl_Grad_02", 40, 8, 1, 0, 0.05f, 0.0f, 0.0f, 12.75f, "Unit_MeterPerCubicSecon", -1},
-  {290, "ACC_pos_Sollbeschl_Grad_02", 48, 8, 1, 0, 0.05f, 0.0f, 0.0f, 12.75f, "Unit_MeterPerCubicSecon", -1},
-  {290, "ACC_Anfahren", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_Anhalten", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {290, "ACC_Typ", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {290, "ACC_Status_ACC", 60, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {290, "ACC_Minimale_Bremsung", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {279, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {279, "AWV_AWA_Status_EPS", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {279, "AWV1_Anf_Prefill", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_CM_Info", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV2_Freigabe", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV1_HBA_Param", 19, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {279, "AWV2_Ruckprofil", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {279, "AWV2_Priowarnung", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_CM_Anforderung", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_Info_Teilbremsung", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_Notfallblinken", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_Teilbremsung_Freigabe", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "ANB_Zielbrems_Teilbrems_Verz_Anf", 29, 10, 1, 0, 0.024f, -20.016f, -20.016f, 4.536f, "Unit_MeterPerSeconSquar",
-   -1},
-  {279, "ANB_Zielbremsung_Freigabe", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV_Vorstufe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV_Halten", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV_CityANB_Auspraegung", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "PCF_Freigabe", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV1_ECD_Anlauf", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV_AWA_VZ_Anf_Lenkmomoffset", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {279, "AWV_AWA_Anf_Lenkmomoffset", 47, 9, 1, 0, 0.01f, 0.0f, 0.0f, 5.11f, "Unit_NewtoMeter", -1},
-  {279, "PCF_Time_to_collision", 56, 8, 1, 0, 0.01f, 0.0f, 0.0f, 2.5f, "Unit_Secon", -1},
-  {304, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {304, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {304, "PLA_Status_PLA_ESP", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {304, "PLA_LW_Soll", 16, 13, 1, 0, 0.1f, 0.0f, 0.0f, 819.1f, "Unit_DegreOfArc", -1},
-  {304, "PLA_VZ_LW_Soll", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {304, "PLA_Status_PLA_EPS", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {304, "PLA_Bremsmoment", 36, 13, 1, 0, 4.0f, 0.0f, 0.0f, 32760.0f, "Unit_NewtoMeter", -1},
-  {304, "PLA_Bremsverzoegerung", 36, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.0f, "Unit_MeterPerSeconSquar", -1},
-  {304, "PLA_Anf_Bremsverzoegerung", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {304, "PLA_BremsMom_Verzoeg", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {304, "PLA_Anhalten", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {304, "PLA_Anhalteweg", 52, 11, 1, 0, 0.01f, 0.0f, 0.01f, 20.45f, "Unit_Meter", -1},
-  {304, "PLA_01_Signal_red_cyclic", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {679, "ACC_Regelgeschw", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
-  {679, "ACC_Einheit_maxSetzgeschw", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {679, "ACC_maxSetzgeschw", 23, 9, 1, 0, 1.0f, 0.0f, 0.0f, 510.0f, "", -1},
-  {679, "ACC_minRegelgeschw", 32, 8, 1, 0, 0.32f, 0.0f, 0.0f, 81.28f, "Unit_KiloMeterPerHour", -1},
-  {679, "ACC_maxRegelgeschw", 40, 8, 1, 0, 0.32f, 0.0f, 0.0f, 81.28f, "Unit_KiloMeterPerHour", -1},
-  {679, "ACC_Tempolimitassistent", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {679, "ACC_Kurvenassistent", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {679, "ACC_RUV", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {679, "ACC_Tachokranz", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {679, "ACC_Typ_Tachokranz_unten", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {679, "ACC_ENG_Texte", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {679, "ACC_ADAPTIVE", 63, 2, 0, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {681, "AWV_Warnung", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {681, "AWV_Texte", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {681, "AWV_Status_Anzeige", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {681, "AWV_Einstellung_System_FSG", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {681, "AWV_Einstellung_Warnung_FSG", 36, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {681, "AWV_Warnlevel", 58, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+constexpr dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {64, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {64, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {64, "AB_RGS_Anst", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
@@ -103,260 +32,115 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {64, "AB_Gurtwarn_HBFS", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {64, "SC_Masterzeit_Offset", 53, 2, 1, 0, 5.08f, 0.0f, 0.0f, 15.24f, "Unit_Secon", -1},
   {64, "SC_Masterzeit", 57, 7, 1, 0, 0.04f, 0.0f, 0.0f, 5.04f, "Unit_Secon", -1},
-  {1312, "AB_Belegung_VB", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_FA", 40, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_BF", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe2_FA", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe2_MI", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe2_BF", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe3_FA", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe3_MI", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Gurtschloss_Reihe3_BF", 54, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Sitzpos_Sens_FA", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1312, "AB_Sitzpos_Sens_BF", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {65, "Airbag_03_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {65, "Airbag_03_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {65, "AB_MKB_Safing", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_BZ", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1633, "AAG_Bremsl_durch_ECD", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Anhaenger_abgesteckt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_NSL_aktiv", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Anhaenger_erkannt", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Blinker_H_aktiv", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Blinker_HL_def", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Blinker_HR_def", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Bremslicht_H_def", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Schlusslicht_HL_def", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_Schlusslicht_HR_def", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_AVS_Fehler_02", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1633, "AAG_AVS_Stati", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1626, "BCM_Bremsbelag_Sensor", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Bremsfluessigkeit_Sensor", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Licht_Warn", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Waschwasser_Sensor", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Kuehlmittel_Sensor", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Kl_15_HW_erkannt", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Eis_Offroad_Taste", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "ZZH_Endlage_oben", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "ZZH_Endlage_unten", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "ZZH_Endlage_unplausibel", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM2_EZS_gedrueckt", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM2_SST_gedrueckt", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Hybrid_StartStopp_Taste", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Warnblink_Taster", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Valet_Parking_Taster", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Remotestart_Betrieb", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_HSK_Taster", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Heckrollo_Taster", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Rueckfahrlicht_Schalter", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_MH_Schalter", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_MH_WIV_Schalter", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Eco_Charisma_Taste", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Thermomanagement", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1626, "BCM_Thermomanagement_Fehler", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM_Thermomanagement_gueltig", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1626, "BCM1_Lichtwarn_Texte", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {869, "BEM_P_Generator", 16, 8, 1, 0, 50.0f, 0.0f, 0.0f, 12700.0f, "Unit_Watt", -1},
-  {869, "BEM_n_LLA", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {869, "BEM_01_Abschaltstufen", 26, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {869, "BEM_Anf_KL", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {869, "BEM_StartStopp_Info", 30, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {869, "BEM_DFM", 32, 5, 1, 0, 3.225f, 0.025f, 0.025f, 100.0f, "", -1},
-  {869, "BEM_EMLIN_ungueltig", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {869, "BEM_Batt_Ab", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {869, "BEM_Segel_Info", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {869, "BEM_HYB_DC_uSollLV", 50, 6, 1, 0, 0.1f, 10.6f, 10.6f, 16.0f, "Unit_Volt", -1},
-  {869, "BEM_HYB_DC_uMinLV", 56, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.3f, "Unit_Volt", -1},
-  {1628, "BMS_HYB_ASV_hinten_Status", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1628, "BMS_HYB_ASV_vorne_Status", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1628, "BMS_HYB_KD_Fehler", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1628, "BMS_HYB_BattFanSpd", 16, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1628, "BMS_HYB_VentilationReq", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1628, "BMS_HYB_Spuelbetrieb_Status", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1628, "BMS_HYB_Kuehlung_Anf", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1628, "BMS_HYB_Temp_vor_Verd", 24, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
-  {1628, "BMS_HYB_Temp_nach_Verd", 32, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
-  {1628, "BMS_Temperatur", 40, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
-  {1628, "BMS_Temperatur_Ansaugluft", 48, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
-  {1628, "BMS_IstSpannung_HV", 56, 8, 1, 0, 1.0f, 100.0f, 100.0f, 350.0f, "Unit_Volt", -1},
-  {901, "CHA_Ziel_FahrPr_ALR", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_ESP", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_FL", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Fahrer_Umschaltung", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_MO", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_GE", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_ST", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_SCU", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_DR", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_QS", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_AFS", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_RGS", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_EPS", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_ACC", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_SAK", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {901, "CHA_Ziel_FahrPr_MStSt", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {945, "DC_HYB_iAktLV", 12, 10, 1, 0, 1.0f, -511.0f, -511.0f, 510.0f, "Unit_Amper", -1},
-  {945, "DC_HYB_iAktReserveLV", 22, 10, 1, 0, 1.0f, -511.0f, -511.0f, 510.0f, "Unit_Amper", -1},
-  {945, "DC_HYB_uAktLV", 32, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.3f, "Unit_Volt", -1},
-  {945, "DC_HYB_LangsRegelung", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {945, "DC_HYB_Abregelung_Temperatur", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {945, "DC_HYB_Fehler_RedLeistung", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {945, "DC_HYB_Fehler_intern", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {945, "DC_HYB_Fehler_Spannung", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {945, "DC_HYB_Auslastungsgrad", 56, 8, 1, 0, 0.4f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1714, "DGN_Verlernzaehler", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
-  {1714, "KBI_Kilometerstand", 8, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1.04857e+06f, "Unit_KiloMeter", -1},
-  {1714, "UH_Jahr", 28, 7, 1, 0, 1.0f, 2000.0f, 2000.0f, 2127.0f, "Unit_Year", -1},
-  {1714, "UH_Monat", 35, 4, 1, 0, 1.0f, 0.0f, 1.0f, 12.0f, "Unit_Month", -1},
-  {1714, "UH_Tag", 39, 5, 1, 0, 1.0f, 0.0f, 1.0f, 31.0f, "Unit_Day", -1},
-  {1714, "UH_Stunde", 44, 5, 1, 0, 1.0f, 0.0f, 0.0f, 23.0f, "Unit_Hours", -1},
-  {1714, "UH_Minute", 49, 6, 1, 0, 1.0f, 0.0f, 0.0f, 59.0f, "Unit_Minut", -1},
-  {1714, "UH_Sekunde", 55, 6, 1, 0, 1.0f, 0.0f, 0.0f, 59.0f, "Unit_Secon", -1},
-  {1714, "Kombi_02_alt", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1714, "Uhrzeit_01_alt", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1520, "DI_KL_58xd", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 253.0f, "", -1},
-  {1520, "DI_KL_58xs", 8, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1520, "DI_Display_Nachtdesign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1520, "DI_KL_58xt", 16, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1520, "DI_Fotosensor", 24, 16, 1, 0, 1.0f, 0.0f, 0.0f, 65535.0f, "", -1},
-  {1603, "KBI_Einheit_Datum", 0, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1603, "KBI_Einheit_Druck", 2, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1603, "KBI_Einheit_Streckenanz", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1603, "KBI_MFA_v_Einheit_02", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1603, "KBI_Einheit_Temp", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1603, "KBI_Einheit_Uhrzeit", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1603, "KBI_Einheit_Verbrauch", 8, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1603, "KBI_Einheit_Volumen", 10, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1603, "KBI_Einheit_Sprache", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {260, "EPB_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {260, "EPB_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {260, "EPB_QBit_Laengsbeschleunigung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_QBit_Pedalweg_Kuppl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_BCM2_Motor_Wakeup", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_Freig_Verzoeg_Anf", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_Verzoeg_Anf", 16, 8, 1, 0, 0.048f, -7.968f, -7.968f, 4.224f, "Unit_MeterPerSeconSquar", -1},
-  {260, "EPB_Laengsbeschleunigung", 24, 8, 1, 0, 1.0f, -128.0f, -128.0f, 126.0f, "Unit_PerCentOfForceOfGravi", -1},
-  {260, "EPB_Pedalweg_Kuppl", 32, 8, 1, 0, 0.4f, 0.0f, 8.0f, 92.0f, "Unit_PerCent", -1},
-  {260, "EPB_Anfahrwunsch_erkannt", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_DAA_Randbed_erf", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_Fehlerstatus", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {260, "EPB_Schalterposition", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {260, "EPB_QBit_Schalterpos", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_Konsistenz_ACC", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {260, "EPB_Spannkraft", 56, 5, 1, 0, 1.0f, 0.0f, 0.0f, 29.0f, "Unit_KiloNewto", -1},
-  {260, "EPB_Status", 61, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {257, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {257, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {257, "ESP_QBit_Gierrate", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_QBit_Laengsbeschl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_QBit_Querb", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_Stillstandsflag", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_Querbeschleunigung", 16, 8, 1, 0, 0.01f, -1.27f, -1.27f, 1.27f, "Unit_ForceOfGravi", -1},
-  {257, "ESP_Laengsbeschl", 24, 10, 1, 0, 0.03125f, -16.0f, -16.0f, 15.9063f, "Unit_MeterPerSeconSquar", -1},
-  {257, "ESP_Verteil_Wankmom", 34, 5, 1, 0, 0.1f, -1.0f, -1.0f, 1.0f, "", -1},
-  {257, "ESP_QBit_Anf_Vert_Wank", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_Gierrate", 40, 14, 1, 0, 0.01f, 0.0f, 0.0f, 163.82f, "Unit_DegreOfArcPerSecon", -1},
-  {257, "ESP_VZ_Gierrate", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_Notbremsanzeige", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_SpannungsAnf", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {257, "ESP_PLA_Abbruch", 57, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {257, "ESP_Status_ESP_PLA", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {262, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {262, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {262, "ESP_QBit_Bremsdruck", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_QBit_Fahrer_bremst", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Schwelle_Unterdruck", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {262, "ESP_Bremsdruck", 16, 10, 1, 0, 0.3f, -30.0f, -30.0f, 276.6f, "Unit_Bar", -1},
-  {262, "ESP_Fahrer_bremst", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Verz_TSK_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Lenkeingriff_ADS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Konsistenz_TSK", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Bremsruck_AWV2", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Konsistenz_AWV2", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ECD_Fehler", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ECD_nicht_verfuegbar", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Status_Bremsentemp", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Autohold_Standby", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_HDC_Standby", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_HBA_aktiv", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Prefill_ausgeloest", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Rueckwaertsfahrt_erkannt", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Status_Anfahrhilfe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_HDC_aktiv", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_StartStopp_Info", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {262, "ESP_Eingr_HL", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Eingr_HR", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Eingr_VL", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Eingr_VR", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_BKV_Unterdruck", 48, 8, 1, 0, 4.0f, 0.0f, 0.0f, 1012.0f, "Unit_MilliBar", -1},
-  {262, "ESP_Autohold_aktiv", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_FStatus_Anfahrhilfe", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Verz_EPB_aktiv", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ECD_Bremslicht", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Verzoeg_EPB_verf", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Status_Bremsdruck", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {262, "ESP_Anforderung_EPB", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {914, "ESP_07_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {914, "ESP_07_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "ESP_ACC_LDE", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_Quattro_Antrieb", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_Codierung_ADS", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {914, "ESP_RTA_HL", 16, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
-  {914, "ESP_RTA_HR", 24, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
-  {914, "ESP_RTA_VR", 32, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
-  {914, "OBD_Fehler_Radsensor_HL", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "OBD_Fehler_Radsensor_HR", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "OBD_Fehler_Radsensor_VL", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "OBD_Fehler_Radsensor_VR", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "ESP_Qualifizierung_Antriebsart", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_Offroad_Modus", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_MKB_ausloesbar", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_MKB_Status", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_CM_Variante", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "ESP_OBD_Status", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {278, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {278, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {278, "ESP_QBit_Wegimpuls_VL", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {278, "ESP_QBit_Wegimpuls_VR", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {278, "ESP_QBit_Wegimpuls_HL", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {278, "ESP_QBit_Wegimpuls_HR", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {278, "ESP_Wegimpuls_VL", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {278, "ESP_Wegimpuls_VR", 26, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {278, "ESP_Wegimpuls_HL", 36, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {278, "ESP_Wegimpuls_HR", 46, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {278, "ESP_VL_Fahrtrichtung", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {278, "ESP_VR_Fahrtrichtung", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {278, "ESP_HL_Fahrtrichtung", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {278, "ESP_HR_Fahrtrichtung", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {134, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {134, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {134, "LWI_Sensorstatus", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {134, "LWI_QBit_Sub_Daten", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {134, "LWI_QBit_Lenkradwinkel", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {134, "LWI_Lenkradwinkel", 16, 13, 1, 0, 0.1f, 0.0f, 0.0f, 800.0f, "Unit_DegreOfArc", -1},
+  {134, "LWI_VZ_Lenkradwinkel", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {134, "LWI_VZ_Lenkradw_Geschw", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {134, "LWI_Lenkradw_Geschw", 31, 9, 1, 0, 5.0f, 0.0f, 0.0f, 2500.0f, "Unit_DegreOfArcPerSecon", -1},
+  {134, "LWI_Sub_Daten", 40, 16, 1, 0, 1.0f, 0.0f, 0.0f, 65535.0f, "", -1},
+  {157, "Motor_Hybrid_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {157, "Motor_Hybrid_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {157, "MO_HYB_IstStatusK0", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {157, "MO_HYB_max_ind_VM_Mom", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1021.0f, "Unit_NewtoMeter", -1},
+  {157, "MO_HYB_Zielzustand", 26, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {157, "MO_HYB_Startmodus", 29, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {157, "MO_HYB_Startmodus_PQ3x", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {157, "MO_HYB_Stoppmodus", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {157, "MO_HYB_VM_Mom_oE", 40, 10, 1, 0, 1.0f, -100.0f, -100.0f, 922.0f, "Unit_NewtoMeter", -1},
+  {157, "MO_HYB_VM_aktiv", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {157, "MO_HYB_Schaltverhinderung", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "Getriebe_Hybrid_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {158, "Getriebe_Hybrid_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {158, "GE_HYB_Fehlerstatus", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {158, "GE_HYB_Freigabe_K0", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Freigabe_LL_Reg", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Freig_sSchl_K0", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Freig_VM_EM_Stop", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Wiederstart", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Filt_MomAufbau", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {158, "GE_HYB_nK0", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_MinutInver", -1},
+  {158, "GE_HYB_MomEingriff_EM", 32, 6, 1, 0, 0.5f, 0.0f, 0.0f, 31.5f, "Unit_NewtoMeter", -1},
+  {158, "GE_HYB_VZ_MomEingriff_EM", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_Sportfaktor", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {158, "GE_HYB_VM_akt_halten", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_StartAnf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {158, "GE_HYB_VM_Startkontr", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {159, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {159, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {159, "EPS_DSR_Status", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {159, "EPS_Berechneter_LW", 16, 12, 1, 0, 0.15f, 0.0f, 0.0f, 613.95f, "Unit_DegreOfArc", -1},
+  {159, "EPS_BLW_QBit", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {159, "EPS_VZ_BLW", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {159, "EPS_HCA_Status", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {159, "EPS_AWA_Status", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 14.0f, "", -1},
+  {159, "EPS_Lenkmoment", 40, 10, 1, 0, 1.0f, 0.0f, 0.0f, 8.0f, "Unit_centiNewtoMeter", -1},
+  {159, "EPS_Lenkmoment_QBit", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {159, "EPS_VZ_Lenkmoment", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {159, "EPS_Lenkungstyp", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {167, "Motor_11_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {167, "Motor_11_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {167, "MO_Mom_Soll_Roh", 12, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {167, "MO_Mom_Ist_Summe", 22, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {167, "MO_Mom_Traegheit_Summe", 32, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {167, "MO_Mom_Soll_gefiltert", 42, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {167, "MO_Mom_Schub", 52, 9, 1, 0, 1.0f, -509.0f, -509.0f, 0.0f, "Unit_NewtoMeter", -1},
+  {167, "MO_Status_Normalbetrieb_01", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {167, "MO_erste_Ungenauschwelle", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {167, "MO_QBit_Motormomente", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {168, "Motor_12_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {168, "Motor_12_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {168, "MO_Mom_neg_verfuegbar", 12, 9, 1, 0, 1.0f, -509.0f, -509.0f, 0.0f, "Unit_NewtoMeter", -1},
+  {168, "MO_Mom_Begr_stat", 21, 9, 1, 0, 1.0f, 0.0f, 0.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {168, "MO_Mom_Begr_dyn", 30, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {168, "MO_Momentenintegral_02", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {168, "MO_QBit_Drehzahl_01", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {168, "MO_Drehzahl_01", 48, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16383.0f, "Unit_MinutInver", -1},
+  {173, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {173, "COUNTER_DISABLED", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {173, "GE_MMom_Soll_02", 12, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "", -1},
+  {173, "GE_MMom_Vorhalt_02", 22, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "", -1},
+  {173, "GE_Uefkt", 32, 10, 1, 0, 0.1f, 0.0f, 0.0f, 102.2f, "", -1},
+  {173, "GE_Fahrstufe", 42, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {173, "GE_reserv_Fahrstufe", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {173, "GE_Schaltablauf", 47, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {173, "GE_Uefkt_unplausibel", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {173, "GE_MMom_Status_02", 50, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {173, "GE_Status_Kraftschluss", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {173, "GE_MMom_Status", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {173, "GE_Freig_MMom_Vorhalt", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {173, "GE_Verbot_Ausblendung", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {173, "GE_Zielgang", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {174, "Getriebe_12_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {174, "Getriebe_12_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {174, "GE_Drehzahlmesser_Daempfung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {174, "GE_Schubabschalt_Unt", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {174, "GE_Freigabe_Synchro", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {174, "GE_Synchro_Wunschdrehz", 15, 9, 1, 0, 25.0f, 0.0f, 0.0f, 12750.0f, "Unit_MinutInver", -1},
+  {174, "GE_Synchro_Zeit", 24, 8, 1, 0, 20.0f, 0.0f, 0.0f, 5080.0f, "Unit_MilliSecon", -1},
+  {174, "GE_Mom_Begr_Gradient", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_NewtoMeterPerSecon", -1},
+  {174, "GE_Anheb_Solldrehz_Leerlauf", 40, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_MinutInver", -1},
+  {174, "GE_Aufnahmemoment", 48, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {174, "GE_Anf_Zylabsch", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {174, "GE_HYB_DZ_Eingriff", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {175, "WH_Status_Sperre", 0, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {175, "WH_Initialisierung", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {175, "WH_SensorPos_roh", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {175, "WH_03_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {175, "WH_SensorPos_roh_inv", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {175, "WH_Testergebnis", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {175, "WH_Test_Aktiv", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {175, "WH_Status", 25, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "", -1},
   {178, "ESP_HL_Radgeschw_02", 0, 16, 1, 0, 0.0075f, 0.0f, 0.0f, 491.49f, "Unit_KiloMeterPerHour", -1},
   {178, "ESP_HR_Radgeschw_02", 16, 16, 1, 0, 0.0075f, 0.0f, 0.0f, 491.49f, "Unit_KiloMeterPerHour", -1},
   {178, "ESP_VL_Radgeschw_02", 32, 16, 1, 0, 0.0075f, 0.0f, 0.0f, 491.49f, "Unit_KiloMeterPerHour", -1},
   {178, "ESP_VR_Radgeschw_02", 48, 16, 1, 0, 0.0075f, 0.0f, 0.0f, 491.49f, "Unit_KiloMeterPerHour", -1},
-  {1629, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1629, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1629, "BR_Systemart", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1629, "ESP_SpannungsAnf_02", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1629, "ESP_Zaehnezahl", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1629, "ESP_Charisma_FahrPr", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1629, "ESP_Charisma_Status", 28, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1629, "ESP_Wiederstart_Anz_01", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Wiederstart_Anz_02", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Wiederstart_Anz_03", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Wiederstart_Anz_04", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_01", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_02", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_03", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_04", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_05", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_06", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_07", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_Std", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "ESP_Dachrelingsensor", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1629, "ESP_Stoppverbot_Anz_08", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "HDC_Charisma_FahrPr", 45, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1629, "HDC_Charisma_Status", 49, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1629, "BR_QBit_Reifenumfang", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1629, "BR_Reifenumfang", 52, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "Unit_MilliMeter", -1},
   {253, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {253, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {253, "BR_Eingriffsmoment", 12, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "", -1},
@@ -384,123 +168,199 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {253, "ESP_Eingriff", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {253, "ESP_ASP", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {253, "ESP_Anhaltevorgang_ACC_aktiv", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BCM_01_alt", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "SMLS_01_alt", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_02_alt", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Wischer_01_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Anhaenger_01_alt", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Klima_Sensor_02_alt", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "VSG_01_alt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Klima_01_alt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "WFS_01_alt", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Licht_Anf_01_alt", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_HFS_offen", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_HBFS_offen", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "VS_VD_offen_ver", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "VS_VD_zu_ver", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_BT_offen", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BCM1_Rueckfahrlicht_Schalter", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_FT_offen", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Wischer_vorne_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "AAG_Anhaenger_erkannt", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BCM1_MH_Schalter", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "ZV_HD_offen", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "Waschen_vorne_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "KL_Thermomanagement", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {987, "WFS_Schluessel_Fahrberecht", 34, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {987, "BCM1_RFahrlicht_Fzg_Anf", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BCM1_RFahrlicht_Ahg_Anf", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BH_Fernlicht", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BH_Blinker_li", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BH_Blinker_re", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {987, "BCM1_OBD_FStatus_ATemp", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {987, "BCM1_Aussen_Temp_ungef", 56, 8, 1, 0, 0.5f, -50.0f, -50.0f, 76.0f, "Unit_DegreCelsi", -1},
-  {989, "LH_EPS_01_alt", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "Kessy_04_alt", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "LIN_2_alt", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "MFG_01_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "GW_74_va_14", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "Klima_02_alt", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "Parkhilfe_01_alt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "ELV_01_alt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "KY_StartStopp_Info", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {989, "PH_StartStopp_Info", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {989, "EPS_Lenkerposition", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {989, "ELV_Anf_Klemme_50", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "MF_StartStopp_Info", 25, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {989, "KL_Geblaesespannung_Soll", 40, 8, 1, 0, 0.05f, 0.5f, 2.0f, 13.0f, "Unit_Volt", -1},
-  {989, "KL_Umluftklappe_Status", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {989, "MFL_Tip_Down", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "MFL_Tip_Up", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {989, "LS_Tiptronic_Fehler", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {296, "GE_WH_Sperre", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {296, "GE_Ausleuchtungsmode", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {296, "GE_Test_Freigabe", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {296, "GE_Ist_Fahrstufe", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {296, "GE_Testparameter_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {296, "GE_Testparameter_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {173, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {173, "COUNTER_DISABLED", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {173, "GE_MMom_Soll_02", 12, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "", -1},
-  {173, "GE_MMom_Vorhalt_02", 22, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "", -1},
-  {173, "GE_Uefkt", 32, 10, 1, 0, 0.1f, 0.0f, 0.0f, 102.2f, "", -1},
-  {173, "GE_Fahrstufe", 42, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {173, "GE_reserv_Fahrstufe", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {173, "GE_Schaltablauf", 47, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {173, "GE_Uefkt_unplausibel", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {173, "GE_MMom_Status_02", 50, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {173, "GE_Status_Kraftschluss", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {173, "GE_MMom_Status", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {173, "GE_Freig_MMom_Vorhalt", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {173, "GE_Verbot_Ausblendung", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {173, "GE_Zielgang", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {174, "Getriebe_12_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {174, "Getriebe_12_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {174, "GE_Drehzahlmesser_Daempfung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {174, "GE_Schubabschalt_Unt", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {174, "GE_Freigabe_Synchro", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {174, "GE_Synchro_Wunschdrehz", 15, 9, 1, 0, 25.0f, 0.0f, 0.0f, 12750.0f, "Unit_MinutInver", -1},
-  {174, "GE_Synchro_Zeit", 24, 8, 1, 0, 20.0f, 0.0f, 0.0f, 5080.0f, "Unit_MilliSecon", -1},
-  {174, "GE_Mom_Begr_Gradient", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_NewtoMeterPerSecon", -1},
-  {174, "GE_Anheb_Solldrehz_Leerlauf", 40, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_MinutInver", -1},
-  {174, "GE_Aufnahmemoment", 48, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {174, "GE_Anf_Zylabsch", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {174, "GE_HYB_DZ_Eingriff", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {301, "Getriebe_13_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {301, "Getriebe_13_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {301, "GE_StartStopp_Info", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {301, "GE_Langfr_Schutzmom_02", 14, 9, 1, 0, 1.0f, 0.0f, 0.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {301, "GE_Eingangsdrehz", 48, 14, 1, 0, 1.0f, 0.0f, 0.0f, 16381.0f, "Unit_MinutInver", -1},
-  {301, "GE_Notlauf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {301, "GE_Freig_Langfr_Schutzmom", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_OBD_AbsperrVent", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {968, "GE_amax_moeglich", 16, 9, 1, 0, 0.024f, -2.016f, -2.016f, 10.224f, "Unit_MeterPerSeconSquar", -1},
-  {968, "GE_Charisma_FahrPr", 25, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {968, "GE_Charisma_Status", 29, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {968, "GE_Verlustmoment", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
-  {968, "GE_Freigabe_Verfallsinfo_WFS", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_Codierung_MSG", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_LaunchControl", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_Heizwunsch", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {968, "GE_OBD_Status", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_LFR_Adaption", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {968, "GE_Sumpftemperatur", 56, 8, 1, 0, 1.0f, -58.0f, -58.0f, 196.0f, "Unit_DegreCelsi", -1},
-  {158, "Getriebe_Hybrid_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {158, "Getriebe_Hybrid_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {158, "GE_HYB_Fehlerstatus", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {158, "GE_HYB_Freigabe_K0", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Freigabe_LL_Reg", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Freig_sSchl_K0", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Freig_VM_EM_Stop", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Wiederstart", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Filt_MomAufbau", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {158, "GE_HYB_nK0", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_MinutInver", -1},
-  {158, "GE_HYB_MomEingriff_EM", 32, 6, 1, 0, 0.5f, 0.0f, 0.0f, 31.5f, "Unit_NewtoMeter", -1},
-  {158, "GE_HYB_VZ_MomEingriff_EM", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_Sportfaktor", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {158, "GE_HYB_VM_akt_halten", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_StartAnf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {158, "GE_HYB_VM_Startkontr", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {257, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {257, "ESP_QBit_Gierrate", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_QBit_Laengsbeschl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_QBit_Querb", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_Stillstandsflag", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_Querbeschleunigung", 16, 8, 1, 0, 0.01f, -1.27f, -1.27f, 1.27f, "Unit_ForceOfGravi", -1},
+  {257, "ESP_Laengsbeschl", 24, 10, 1, 0, 0.03125f, -16.0f, -16.0f, 15.9063f, "Unit_MeterPerSeconSquar", -1},
+  {257, "ESP_Verteil_Wankmom", 34, 5, 1, 0, 0.1f, -1.0f, -1.0f, 1.0f, "", -1},
+  {257, "ESP_QBit_Anf_Vert_Wank", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_Gierrate", 40, 14, 1, 0, 0.01f, 0.0f, 0.0f, 163.82f, "Unit_DegreOfArcPerSecon", -1},
+  {257, "ESP_VZ_Gierrate", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_Notbremsanzeige", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_SpannungsAnf", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {257, "ESP_PLA_Abbruch", 57, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {257, "ESP_Status_ESP_PLA", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {260, "EPB_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {260, "EPB_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {260, "EPB_QBit_Laengsbeschleunigung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_QBit_Pedalweg_Kuppl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_BCM2_Motor_Wakeup", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_Freig_Verzoeg_Anf", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_Verzoeg_Anf", 16, 8, 1, 0, 0.048f, -7.968f, -7.968f, 4.224f, "Unit_MeterPerSeconSquar", -1},
+  {260, "EPB_Laengsbeschleunigung", 24, 8, 1, 0, 1.0f, -128.0f, -128.0f, 126.0f, "Unit_PerCentOfForceOfGravi", -1},
+  {260, "EPB_Pedalweg_Kuppl", 32, 8, 1, 0, 0.4f, 0.0f, 8.0f, 92.0f, "Unit_PerCent", -1},
+  {260, "EPB_Anfahrwunsch_erkannt", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_DAA_Randbed_erf", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_Fehlerstatus", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {260, "EPB_Schalterposition", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {260, "EPB_QBit_Schalterpos", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_Konsistenz_ACC", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {260, "EPB_Spannkraft", 56, 5, 1, 0, 1.0f, 0.0f, 0.0f, 29.0f, "Unit_KiloNewto", -1},
+  {260, "EPB_Status", 61, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {262, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {262, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {262, "ESP_QBit_Bremsdruck", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_QBit_Fahrer_bremst", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Schwelle_Unterdruck", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {262, "ESP_Bremsdruck", 16, 10, 1, 0, 0.3f, -30.0f, -30.0f, 276.6f, "Unit_Bar", -1},
+  {262, "ESP_Fahrer_bremst", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Verz_TSK_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Lenkeingriff_ADS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Konsistenz_TSK", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Bremsruck_AWV2", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Konsistenz_AWV2", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ECD_Fehler", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ECD_nicht_verfuegbar", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Status_Bremsentemp", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Autohold_Standby", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_HDC_Standby", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_HBA_aktiv", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Prefill_ausgeloest", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Rueckwaertsfahrt_erkannt", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Status_Anfahrhilfe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_HDC_aktiv", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_StartStopp_Info", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {262, "ESP_Eingr_HL", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Eingr_HR", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Eingr_VL", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Eingr_VR", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_BKV_Unterdruck", 48, 8, 1, 0, 4.0f, 0.0f, 0.0f, 1012.0f, "Unit_MilliBar", -1},
+  {262, "ESP_Autohold_aktiv", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_FStatus_Anfahrhilfe", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Verz_EPB_aktiv", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ECD_Bremslicht", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Verzoeg_EPB_verf", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Status_Bremsdruck", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {262, "ESP_Anforderung_EPB", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {263, "MO_Istgang", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {263, "MO_Sollgang", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {263, "MO_Oeldruck", 16, 8, 1, 0, 0.04f, 0.0f, 0.0f, 10.0f, "Unit_Bar", -1},
+  {263, "MO_Anzeigedrehz", 24, 12, 1, 0, 3.0f, 0.0f, 0.0f, 12282.0f, "Unit_MinutInver", -1},
+  {263, "MO_Schaltempf_verfbar", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {263, "MO_Ladedruck", 39, 9, 1, 0, 0.01f, 0.0f, 0.0f, 5.1f, "Unit_Bar", -1},
+  {263, "MO_KVS", 48, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32767.0f, "Unit_MicroLiter", -1},
+  {263, "MO_KVS_Ueberlauf", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {264, "Fahrwerk_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {264, "Fahrwerk_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {278, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {278, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {278, "ESP_QBit_Wegimpuls_VL", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {278, "ESP_QBit_Wegimpuls_VR", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {278, "ESP_QBit_Wegimpuls_HL", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {278, "ESP_QBit_Wegimpuls_HR", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {278, "ESP_Wegimpuls_VL", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {278, "ESP_Wegimpuls_VR", 26, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {278, "ESP_Wegimpuls_HL", 36, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {278, "ESP_Wegimpuls_HR", 46, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {278, "ESP_VL_Fahrtrichtung", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {278, "ESP_VR_Fahrtrichtung", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {278, "ESP_HL_Fahrtrichtung", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {278, "ESP_HR_Fahrtrichtung", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {279, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {279, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {279, "AWV_AWA_Status_EPS", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {279, "AWV1_Anf_Prefill", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_CM_Info", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV2_Freigabe", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV1_HBA_Param", 19, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {279, "AWV2_Ruckprofil", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {279, "AWV2_Priowarnung", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_CM_Anforderung", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_Info_Teilbremsung", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_Notfallblinken", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_Teilbremsung_Freigabe", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "ANB_Zielbrems_Teilbrems_Verz_Anf", 29, 10, 1, 0, 0.024f, -20.016f, -20.016f, 4.536f, "Unit_MeterPerSeconSquar", -1},
+  {279, "ANB_Zielbremsung_Freigabe", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV_Vorstufe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV_Halten", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV_CityANB_Auspraegung", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "PCF_Freigabe", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV1_ECD_Anlauf", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV_AWA_VZ_Anf_Lenkmomoffset", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {279, "AWV_AWA_Anf_Lenkmomoffset", 47, 9, 1, 0, 0.01f, 0.0f, 0.0f, 5.11f, "Unit_NewtoMeter", -1},
+  {279, "PCF_Time_to_collision", 56, 8, 1, 0, 0.01f, 0.0f, 0.0f, 2.5f, "Unit_Secon", -1},
+  {286, "ESP_08_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {286, "ESP_08_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {286, "ESP_ANB_CM_Rueckk_Umsetz", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_Konsistenz_ACC_Botschaft", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_Stillstandsphase_erschoepft", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_ZT_Rueckk_Umsetz", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_Tuerkontakt_Fahrertuer", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_Abrutschen_Stillstand", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_Fahrer_tritt_ZBR_Schw", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_QBit_v_ref", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {286, "ESP_v_ref_Fahrtrichtung", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {286, "ESC_Bremsdruckgradient", 44, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2500.0f, "Unit_BarPerSecon", -1},
+  {286, "ESP_v_ref", 52, 12, 1, 0, 0.125f, 0.0f, 0.0f, 511.5f, "Unit_KiloMeterPerHour", -1},
+  {288, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {288, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {288, "TSK_Radbremsmom", 12, 12, 1, 0, 8.0f, 0.0f, 0.0f, 32760.0f, "Unit_NewtoMeter", -1},
+  {288, "TSK_Status", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {288, "TSK_v_Begrenzung_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_Standby_Anf_ESP", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_Freig_WU", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_Freig_Verzoeg_Anf", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_Limiter_ausgewaehlt", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_Wunsch_Uebersetz", 32, 10, 1, 0, 0.0245f, 0.0f, 0.0245f, 25.0635f, "", -1},
+  {288, "TSK_Hauptschalter_GRA_ACC", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {288, "TSK_SRBM_Anf_ASIL", 44, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {288, "TSK_ax_Getriebe_02", 48, 9, 1, 0, 0.024f, -2.016f, -2.016f, 10.224f, "Unit_MeterPerSeconSquar", -1},
+  {288, "TSK_Zwangszusch_ESP", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {288, "TSK_zul_Regelabw", 58, 6, 1, 0, 0.024f, 0.0f, 0.0f, 1.512f, "Unit_MeterPerSeconSquar", -1},
+  {289, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {289, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {289, "MO_Fahrpedalrohwert_01", 12, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "Unit_PerCent", -1},
+  {289, "MO_QBit_Fahrpedalwerte_01", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_Fahrpedalgradient", 21, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_PerCentPerSecon", -1},
+  {289, "MO_Sig_Fahrpedalgradient", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_rel_Saugrohrdruck", 30, 6, 1, 0, 18.0f, 0.0f, 0.0f, 1116.0f, "Unit_MilliBar", -1},
+  {289, "MO_rel_Saugrohrdruck_gem_err", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_Moment_im_Leerlauf", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_Schubabschaltung", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_StartStopp_StoppVorbereitung", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "MO_Solldrehz_Leerlauf", 40, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_MinutInver", -1},
+  {289, "MO_Entkopplung_Sollschlupf", 48, 7, 1, 0, 20.0f, 0.0f, 0.0f, 2480.0f, "Unit_MinutInver", -1},
+  {289, "MO_temporaere_Fahrerabwesenheit", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {289, "TSK_a_Soll_gradientenbegrenzt", 57, 7, 1, 0, 0.1f, -7.2f, -7.2f, 5.4f, "Unit_MeterPerSeconSquar", -1},
+  {290, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {290, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {290, "ACC_limitierte_Anfahrdyn", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_nachtr_Stopp_Anf", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_DynErhoehung", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_Freilaufstrategie_TSK", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_zul_Regelabw_unten", 16, 6, 1, 0, 0.024f, 0.0f, 0.0f, 1.512f, "Unit_MeterPerSeconSquar", -1},
+  {290, "ACC_StartStopp_Info", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {290, "ACC_Sollbeschleunigung_02", 24, 11, 1, 0, 0.005f, -7.22f, -7.22f, 3.005f, "Unit_MeterPerSeconSquar", -1},
+  {290, "ACC_zul_Regelabw_oben", 35, 5, 1, 0, 0.0625f, 0.0f, 0.0f, 1.9375f, "Unit_MeterPerSeconSquar", -1},
+  {290, "ACC_neg_Sollbeschl_Grad_02", 40, 8, 1, 0, 0.05f, 0.0f, 0.0f, 12.75f, "Unit_MeterPerCubicSecon", -1},
+  {290, "ACC_pos_Sollbeschl_Grad_02", 48, 8, 1, 0, 0.05f, 0.0f, 0.0f, 12.75f, "Unit_MeterPerCubicSecon", -1},
+  {290, "ACC_Anfahren", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_Anhalten", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {290, "ACC_Typ", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {290, "ACC_Status_ACC", 60, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {290, "ACC_Minimale_Bremsung", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {294, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {294, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {294, "HCA_01_Vib_Freq", 12, 4, 1, 0, 1.0f, 15.0f, 15.0f, 30.0f, "Unit_Hertz", -1},
+  {294, "HCA_01_LM_Offset", 16, 9, 1, 0, 1.0f, 0.0f, 0.0f, 511.0f, "Unit_centiNewtoMeter", -1},
+  {294, "EA_ACC_Sollstatus", 25, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {294, "EA_Ruckprofil", 27, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {294, "HCA_01_Sendestatus", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {294, "HCA_01_LM_OffSign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {294, "HCA_01_Status_HCA", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {294, "HCA_01_Vib_Amp", 36, 4, 1, 0, 0.2f, 0.0f, 0.0f, 3.0f, "Unit_NewtoMeter", -1},
+  {294, "EA_Ruckfreigabe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {294, "EA_ACC_Wunschgeschwindigkeit", 41, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
+  {296, "GE_WH_Sperre", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {296, "GE_Ausleuchtungsmode", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {296, "GE_Test_Freigabe", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {296, "GE_Ist_Fahrstufe", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {296, "GE_Testparameter_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {296, "GE_Testparameter_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {299, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {299, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {299, "GRA_Hauptschalter", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -517,57 +377,127 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {299, "GRA_Typ468", 25, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {299, "GRA_Tip_Stufe_2", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {299, "GRA_ButtonTypeInfo", 28, 2, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {960, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {960, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {960, "ZAS_Kl_S", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {960, "ZAS_Kl_15", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {960, "ZAS_Kl_X", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {960, "ZAS_Kl_50", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Drehz_Anh", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Vorwarn_Komp_ein", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_AC_Schalter", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Komp_Moment_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Zonen", 4, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {949, "KL_Vorwarn_Zuheizer_ein", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Zustand", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Comp_rev_rq", 8, 8, 1, 0, 50.0f, 0.0f, 0.0f, 8600.0f, "Unit_MinutInver", -1},
-  {949, "KL_Charisma_FahrPr", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {949, "KL_Charisma_Status", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {949, "KL_Comp_enable", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {949, "KL_Last_Kompr", 24, 8, 1, 0, 0.25f, 0.0f, 0.0f, 63.5f, "Unit_NewtoMeter", -1},
-  {949, "KL_Spannungs_Anf", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {949, "KL_Thermomanagement", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {949, "KL_StartStopp_Info", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {949, "KL_Anf_KL", 40, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "Unit_PerCent", -1},
-  {949, "KL_el_Zuheizer_Stufe", 48, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1625, "EKL_KD_Fehler", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1625, "EKL_Comp_SCI_com_stat", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1625, "EKL_Comp_output_stat", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1625, "EKL_Comp_main_stat", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1625, "EKL_Comp_ovld_stat", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1625, "EKL_Comp_Inv_stat", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1625, "EKL_Comp_photo_temp_stat", 30, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1625, "EKL_Comp_photo_temp", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "Unit_DegreCelsi", -1},
-  {1625, "EKL_Comp_current", 40, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.4f, "Unit_Amper", -1},
-  {1625, "EKL_Comp_rev_stat", 48, 8, 1, 0, 50.0f, 0.0f, 0.0f, 8600.0f, "Unit_MinutInver", -1},
-  {401604629, "Airbag_01_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604629, "Airbag_01_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604629, "AB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604732, "EMotor_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604732, "EMotor_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604732, "EM_HYB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604727, "Getriebe_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604727, "Getriebe_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604727, "GE_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604731, "Hybrid_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604731, "Hybrid_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604731, "BMS_HYB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604726, "Motor_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604726, "Motor_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604726, "MO_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604636, "SAK_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {401604636, "SAK_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {401604636, "SAK_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {301, "Getriebe_13_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {301, "Getriebe_13_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {301, "GE_StartStopp_Info", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {301, "GE_Langfr_Schutzmom_02", 14, 9, 1, 0, 1.0f, 0.0f, 0.0f, 509.0f, "Unit_NewtoMeter", -1},
+  {301, "GE_Eingangsdrehz", 48, 14, 1, 0, 1.0f, 0.0f, 0.0f, 16381.0f, "Unit_MinutInver", -1},
+  {301, "GE_Notlauf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {301, "GE_Freig_Langfr_Schutzmom", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {302, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {302, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {302, "ACC_Anhalteweg", 12, 11, 1, 0, 0.01f, 0.0f, 0.0f, 20.45f, "Unit_Meter", -1},
+  {302, "ACC_Anhalten", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {302, "ACC_Boost_Anf", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {302, "ACC_Freilauf_Anf", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {302, "ACC_Freilauf_Info", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {302, "ACC_Anforderung_HMS", 28, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {302, "ACC_Anfahren", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {302, "ACC_Folgebeschl", 32, 8, 1, 0, 0.03f, -4.6f, -4.6f, 2.99f, "Unit_MeterPerSeconSquar", -1},
+  {302, "ACC_Sollbeschleunigung_02", 53, 11, 1, 0, 0.005f, -7.22f, -7.22f, 3.005f, "Unit_MeterPerSeconSquar", -1},
+  {304, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {304, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {304, "PLA_Status_PLA_ESP", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {304, "PLA_LW_Soll", 16, 13, 1, 0, 0.1f, 0.0f, 0.0f, 819.1f, "Unit_DegreOfArc", -1},
+  {304, "PLA_VZ_LW_Soll", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {304, "PLA_Status_PLA_EPS", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {304, "PLA_Bremsmoment", 36, 13, 1, 0, 4.0f, 0.0f, 0.0f, 32760.0f, "Unit_NewtoMeter", -1},
+  {304, "PLA_Bremsverzoegerung", 36, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.0f, "Unit_MeterPerSeconSquar", -1},
+  {304, "PLA_Anf_Bremsverzoegerung", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {304, "PLA_BremsMom_Verzoeg", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {304, "PLA_Anhalten", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {304, "PLA_Anhalteweg", 52, 11, 1, 0, 0.01f, 0.0f, 0.01f, 20.45f, "Unit_Meter", -1},
+  {304, "PLA_01_Signal_red_cyclic", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {346, "TSK_08_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {346, "TSK_08_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {346, "MO_Anforderung_HMS", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {346, "TSK_Status_EA", 32, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {346, "TSK_vMax_Fahrerassistenz", 40, 9, 1, 0, 1.0f, 0.0f, 0.0f, 510.0f, "", -1},
+  {346, "TSK_Einheit_vMax_Fahrerassistenz", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {346, "TSK_Status_PLA", 50, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {346, "TSK_aktives_System", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {346, "TSK_erhoehter_Fahrwiderstand", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {346, "TSK_Anf_Antriebsmoment", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {346, "TSK_Status_ARA", 58, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {346, "TSK_Status_IPA", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {391, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {391, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {391, "EV_Rekuperationsstufe", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {391, "HV_Bordnetz_aktiv", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {391, "MO_Waehlpos", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {391, "MO_Fehler_NTKreis", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {391, "MO_Fehler_Notabschaltung_Klima", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {391, "MO_KLE_FStatus", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {391, "MO_WH_Texte", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {391, "MO_Drehzahl_VM", 32, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16383.0f, "Unit_MinutInver", -1},
+  {391, "HV_Bordnetz_Fehler", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {391, "MO_Tankbereitschaft_Status", 49, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {391, "MO_Tankklappensteuerung", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {391, "MO_HVEM_Eskalation", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {391, "MO_HVEM_MaxLeistung", 55, 9, 1, 0, 50.0f, 0.0f, 0.0f, 25450.0f, "Unit_Watt", -1},
+  {418, "ESP_15_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {418, "ESP_15_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {427, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {427, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {427, "ESC_AHW_aktiv", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {427, "ESC_AHW_nicht_verfuegbar", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_ANB_CM_aktiv", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {427, "ESC_ANB_CM_nicht_verfuegbar", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Warnruck_aktiv", 19, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {427, "ESC_Warnruck_nicht_verfuegbar", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Prefill_aktiv", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Prefill_nicht_verfuegbar", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_HBA_aktiv", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_HBA_nicht_verfuegbar", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_TSK_SRBM_Anf", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_TSK_SRBM_nicht_verfuegbar", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Verz_Reg_aktiv", 30, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {427, "ESC_Verz_Reg_nicht_verfuegbar", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Verz_Reg_TB_nicht_verfuegbar", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Verz_Reg_ZB_nicht_verfuegbar", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Bremslicht_unplausibel", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_ACC", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_AWV", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_ARA", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_IPA", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_FCW", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_NV", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_RCTA", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_TSK", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_vFGS", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_STA", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Fahrer_Bremsdruck_bestimmend", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_EA", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_BFF", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_MKB", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Verz_ASIL_Verfuegbarkeit", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {427, "ESC_Pumpenanlauf_aktiv", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_AGW", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_KAS", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_PCF", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_FAS_VK", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Verz_Begrenzung", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {427, "ESC_Konsistenz_AWA", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {679, "ACC_Regelgeschw", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
+  {679, "ACC_Einheit_maxSetzgeschw", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {679, "ACC_maxSetzgeschw", 23, 9, 1, 0, 1.0f, 0.0f, 0.0f, 510.0f, "", -1},
+  {679, "ACC_minRegelgeschw", 32, 8, 1, 0, 0.32f, 0.0f, 0.0f, 81.28f, "Unit_KiloMeterPerHour", -1},
+  {679, "ACC_maxRegelgeschw", 40, 8, 1, 0, 0.32f, 0.0f, 0.0f, 81.28f, "Unit_KiloMeterPerHour", -1},
+  {679, "ACC_Tempolimitassistent", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {679, "ACC_Kurvenassistent", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {679, "ACC_RUV", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {679, "ACC_Tachokranz", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {679, "ACC_Typ_Tachokranz_unten", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {679, "ACC_ENG_Texte", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {679, "ACC_ADAPTIVE", 63, 2, 0, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {681, "AWV_Warnung", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {681, "AWV_Texte", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {681, "AWV_Status_Anzeige", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {681, "AWV_Einstellung_System_FSG", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {681, "AWV_Einstellung_Warnung_FSG", 36, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {681, "AWV_Warnlevel", 58, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {695, "RCTA_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {695, "RCTA_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {779, "KBI_ABS_Lampe", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {779, "KBI_ESP_Lampe", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {779, "KBI_BKL_Lampe", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -596,132 +526,238 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {779, "KBI_Konsistenz_ACC", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {779, "KBI_Fehler_Anzeige_ACC", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {779, "KBI_Anzeigefehler_SWA", 61, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1719, "KBI_Kilometerstand", 0, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1.04857e+06f, "Unit_KiloMeter", -1},
-  {1719, "KBI_Standzeit_02", 20, 17, 1, 0, 1.0f, 0.0f, 0.0f, 131068.0f, "Unit_Secon", -1},
-  {1719, "KBI_Inhalt_Tank", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 125.0f, "Unit_Liter", -1},
-  {1719, "KBI_FStatus_Tank", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1719, "KBI_QBit_Aussen_Temp_gef", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1719, "KBI_Aussen_Temp_gef", 56, 8, 1, 0, 0.5f, -50.0f, -50.0f, 75.0f, "Unit_DegreCelsi", -1},
-  {982, "Licht_hinten_01_BZ", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {982, "BCM2_Bremsl_durch_ECD", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Aussenlicht_def", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Standlicht_H_aktiv", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Parklicht_HL_aktiv", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Parklicht_HR_aktiv", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Bremslicht_H_aktiv", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Nebelschluss_aktiv", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Rueckfahrlicht_aktiv", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Blinker_HL_akt", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Blinker_HR_akt", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Blinker_li_def", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Bremsl_li_def", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schlusslicht_li_def", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Rueckf_li_def", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Nebel_li_def", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Brems_Nebel_li_def", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Brems_Nebel_re_def", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Brems_li_def", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Nebel_li_def", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_SL_BRL_BLK_li_def", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Brems_Blk_li_def", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Blinker_re_def", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Bremsl_re_def", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schlusslicht_re_def", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Rueckf_re_def", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Nebel_re_def", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Brems_re_def", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Schluss_Nebel_re_def", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_SL_BRL_BLK_re_def", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Brems_Blk_re_def", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Kennzl_def", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_3_Bremsl_def", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Nebel_mi_def", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Rueckf_mi_def", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Bremsl_li_ges_def", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {982, "LH_Bremsl_re_ges_def", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {134, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {134, "LWI_Sensorstatus", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "LWI_QBit_Sub_Daten", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "LWI_QBit_Lenkradwinkel", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "LWI_Lenkradwinkel", 16, 13, 1, 0, 0.1f, 0.0f, 0.0f, 800.0f, "Unit_DegreOfArc", -1},
-  {134, "LWI_VZ_Lenkradwinkel", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "LWI_VZ_Lenkradw_Geschw", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {134, "LWI_Lenkradw_Geschw", 31, 9, 1, 0, 5.0f, 0.0f, 0.0f, 2500.0f, "Unit_DegreOfArcPerSecon", -1},
-  {134, "LWI_Sub_Daten", 40, 16, 1, 0, 1.0f, 0.0f, 0.0f, 65535.0f, "", -1},
-  {263, "MO_Istgang", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {263, "MO_Sollgang", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {263, "MO_Oeldruck", 16, 8, 1, 0, 0.04f, 0.0f, 0.0f, 10.0f, "Unit_Bar", -1},
-  {263, "MO_Anzeigedrehz", 24, 12, 1, 0, 3.0f, 0.0f, 0.0f, 12282.0f, "Unit_MinutInver", -1},
-  {263, "MO_Schaltempf_verfbar", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {263, "MO_Ladedruck", 39, 9, 1, 0, 0.01f, 0.0f, 0.0f, 5.1f, "Unit_Bar", -1},
-  {263, "MO_KVS", 48, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32767.0f, "Unit_MicroLiter", -1},
-  {263, "MO_KVS_Ueberlauf", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_QBit_Ansaugluft_Temp", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_QBit_Oel_Temp", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_QBit_Kuehlmittel_Temp", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_Stellgliedtest_Soundaktuator", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_HYB_Fehler_HV_Netz", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_aktives_Getriebeheizen", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_Absperrventil_oeffnen", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1600, "MO_Ansaugluft_Temp", 8, 8, 1, 0, 0.75f, -48.0f, -48.0f, 141.75f, "Unit_DegreCelsi", -1},
-  {1600, "MO_Oel_Temp", 16, 8, 1, 0, 1.0f, -60.0f, -60.0f, 192.0f, "Unit_DegreCelsi", -1},
-  {1600, "MO_Kuehlmittel_Temp", 24, 8, 1, 0, 0.75f, -48.0f, -48.0f, 141.75f, "Unit_DegreCelsi", -1},
-  {1600, "MO_Hoeheninfo", 32, 8, 1, 0, 0.00781f, 0.0f, 0.0f, 1.98374f, "", -1},
-  {1600, "MO_Kennfeldk", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_Versionsinfo", 41, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {1600, "MO_Getriebe_kuehlen", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_Mom_Traegheit_02", 48, 5, 1, 0, 0.01f, 0.0f, 0.0f, 0.31f, "Unit_KiloGramMeterSquar", -1},
-  {1600, "MO_Heizungspumpenansteuerung", 53, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1600, "MO_SpannungsAnf", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1600, "MO_Nachlaufzeit_Heizungspumpe", 58, 6, 1, 0, 15.0f, 0.0f, 0.0f, 945.0f, "Unit_Secon", -1},
-  {1607, "MO_ITM_Kuehlmittel_Temp", 0, 8, 1, 0, 0.75f, -48.0f, -45.75f, 143.25f, "Unit_DegreCelsi", -1},
-  {1607, "MO_E85_Sensor", 8, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {1607, "SCR_Anz_Motorstarts", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 8.0f, "", -1},
-  {1607, "SCR_Reichweite", 16, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32766.0f, "", -1},
-  {1607, "SCR_Warnstufe_1", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1607, "SCR_Warnstufe_2", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1607, "SCR_Text", 34, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1607, "SCR_Akustik", 37, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1607, "MO_Kraftstofffilter_Wasser", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1607, "SCR_Systemfehler", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1607, "SCR_Inducement_Strategie", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1607, "MO_CO2_Faktor", 44, 12, 1, 0, 1.0f, 0.0f, 1.0f, 4094.0f, "Unit_GramPerLiter", -1},
-  {167, "Motor_11_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {167, "Motor_11_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {167, "MO_Mom_Soll_Roh", 12, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {167, "MO_Mom_Ist_Summe", 22, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {167, "MO_Mom_Traegheit_Summe", 32, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {167, "MO_Mom_Soll_gefiltert", 42, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {167, "MO_Mom_Schub", 52, 9, 1, 0, 1.0f, -509.0f, -509.0f, 0.0f, "Unit_NewtoMeter", -1},
-  {167, "MO_Status_Normalbetrieb_01", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {167, "MO_erste_Ungenauschwelle", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {167, "MO_QBit_Motormomente", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {168, "Motor_12_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {168, "Motor_12_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {168, "MO_Mom_neg_verfuegbar", 12, 9, 1, 0, 1.0f, -509.0f, -509.0f, 0.0f, "Unit_NewtoMeter", -1},
-  {168, "MO_Mom_Begr_stat", 21, 9, 1, 0, 1.0f, 0.0f, 0.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {168, "MO_Mom_Begr_dyn", 30, 10, 1, 0, 1.0f, -509.0f, -509.0f, 509.0f, "Unit_NewtoMeter", -1},
-  {168, "MO_Momentenintegral_02", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {168, "MO_QBit_Drehzahl_01", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {168, "MO_Drehzahl_01", 48, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16383.0f, "Unit_MinutInver", -1},
-  {958, "MO_StartStopp_Status", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {958, "MO_StartStopp_Wiederstart", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_StartStopp_Motorstopp", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Freig_Reku", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {958, "MO_Kl_75", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Kl_50", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Gangposition", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {958, "MO_StartStopp_Fahrerwunsch", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {958, "MO_HYB_Fahrbereitschaft", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Ext_E_Fahrt_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Fahrer_bremst", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_QBit_Fahrer_bremst", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_BLS", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Konsistenz_Bremsped", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Timeout_ESP", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {958, "MO_Klima_Eingr", 33, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {958, "MO_Aussp_Anlass", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {780, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {780, "ACC_Wunschgeschw_02", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
+  {780, "ACC_Status_Prim_Anz", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {780, "ACC_Abstandsindex", 24, 10, 1, 0, 1.0f, 0.0f, 1.0f, 1021.0f, "", -1},
+  {780, "ACC_Akustik_02", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {780, "ACC_Warnung_Verkehrszeichen_1", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Gesetzte_Zeitluecke", 37, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {780, "ACC_Optischer_Fahrerhinweis", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Typ_Tachokranz", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Anzeige_Zeitluecke", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Tachokranz", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Display_Prio", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {780, "ACC_Relevantes_Objekt", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {780, "ACC_Texte_Primaeranz", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "", -1},
+  {780, "ACC_Wunschgeschw_erreicht", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Typ_Tachokranz_unten", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {780, "ACC_Status_Anzeige", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {783, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {783, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {783, "SWA_Anzeigen", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {783, "SWA_Blindheit_erkannt", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_rel_Nichtverf", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_rel_Fehler", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Sta_aktiv", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Sta_passiv", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_FT_RueckLED", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "ASW_Status", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {783, "SWA_Standziele_li", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Kolonne_li", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Infostufe_SWA_li", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Warnung_SWA_li", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "ASW_Warnung_FS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "ASW_Warnung_BFS", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "ASW_Kombitexte", 30, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {783, "SWA_Kolonne_mi", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Standziele_re", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Kolonne_re", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Infostufe_SWA_re", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "SWA_Warnung_SWA_re", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {783, "HRE_Anzeigetexte", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {783, "SWA_Gischtzaehler", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {783, "Heckradar_Kombitexte", 56, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {783, "RCTA_Kombitexte", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {798, "TSK_07_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {798, "TSK_07_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {798, "TSK_Wunschgeschw", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 326.72f, "Unit_KiloMeterPerHour", -1},
+  {798, "TSK_Texte", 40, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {798, "TSK_Akustik", 45, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {798, "TSK_Texte_Primaeranz", 48, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {798, "TSK_Limiter_Fahrerinfo", 53, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {798, "TSK_Limiter_Anzeige", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {798, "TSK_Fahrzeugstatus_GRA", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {798, "TSK_Fahrzeugstatus_Limiter", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {798, "MO_Motorlaufwarnung", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {798, "TSK_Status_Anzeige", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {804, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {804, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {804, "ACC_Texte_Sekundaeranz", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {804, "ACC_Texte_Zusatzanz", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {804, "ACC_Status_Zusatzanz", 22, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {804, "ACC_Texte", 27, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {804, "ACC_Texte_braking_guard", 32, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {804, "ACC_Warnhinweis", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {804, "ACC_Zeitluecke_Abstandswarner", 36, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.0f, "Unit_Secon", -1},
+  {804, "ACC_Abstand_Abstandswarner", 42, 9, 1, 0, 1.0f, 0.0f, 0.0f, 508.0f, "", -1},
+  {804, "ACC_Tempolimit", 51, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {804, "ACC_Charisma_FahrPr", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {804, "ACC_Charisma_Status", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {804, "ACC_Texte_Abstandswarner", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {810, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {810, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {810, "EPS_SpannungsAnf", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {810, "EPS_Endanschlag", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {810, "EPS_Akustiksignal", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {810, "EPS_Fehlerlampe", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {810, "EPS_Warnungen", 19, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {810, "EPS_PLA_Abbruch", 22, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {810, "EPS_PLA_Fehler", 26, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {810, "EPS_PLA_Status", 30, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {810, "EPS_Charisma_FahrPr", 34, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {810, "EPS_Charisma_Status", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {810, "EPS_Lenkerposition", 41, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {810, "EPS_Anf_KL", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {810, "EPS_ARA_Status", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {811, "MO_HYB_E_Faktor", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {811, "MO_HYB_Drehzahl_VM", 16, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16256.0f, "Unit_MinutInver", -1},
+  {811, "MO_HYB_LowSpeedModus", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {812, "MO_Prio_MAX_Wunschdrehzahl", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {812, "MO_Prio_MIN_Wunschdrehzahl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {812, "MO_Luftpfad_aktiv", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {812, "MO_v_Begrenz_Aktivierbar", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {812, "MO_Drehzahlbeeinflussung", 16, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.45f, "Unit_PerCent", -1},
+  {812, "MO_MIN_Wunschdrehzahl", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_MinutInver", -1},
+  {812, "MO_MAX_Wunschdrehzahl", 32, 9, 1, 0, 25.0f, 0.0f, 0.0f, 12750.0f, "Unit_MinutInver", -1},
+  {812, "MO_Charisma_FahrPr", 41, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {812, "MO_Charisma_Status", 45, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {869, "BEM_P_Generator", 16, 8, 1, 0, 50.0f, 0.0f, 0.0f, 12700.0f, "Unit_Watt", -1},
+  {869, "BEM_n_LLA", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {869, "BEM_01_Abschaltstufen", 26, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {869, "BEM_Anf_KL", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {869, "BEM_StartStopp_Info", 30, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {869, "BEM_DFM", 32, 5, 1, 0, 3.225f, 0.025f, 0.025f, 100.0f, "", -1},
+  {869, "BEM_EMLIN_ungueltig", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {869, "BEM_Batt_Ab", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {869, "BEM_Segel_Info", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {869, "BEM_HYB_DC_uSollLV", 50, 6, 1, 0, 0.1f, 10.6f, 10.6f, 16.0f, "Unit_Volt", -1},
+  {869, "BEM_HYB_DC_uMinLV", 56, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.3f, "Unit_Volt", -1},
+  {870, "Hazard_Switch", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Comfort_Signal_Left", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Comfort_Signal_Right", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Left_Turn_Exterior_Bulb_1", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Right_Turn_Exterior_Bulb_1", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Left_Turn_Exterior_Bulb_2", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Right_Turn_Exterior_Bulb_2", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {870, "Fast_Send_Rate_Active", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_ALR", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_ESP", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_FL", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Fahrer_Umschaltung", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_MO", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_GE", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_ST", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_SCU", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_DR", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_QS", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_AFS", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_RGS", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_EPS", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_ACC", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_SAK", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {901, "CHA_Ziel_FahrPr_MStSt", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {913, "OBD_Calc_Load_Val", 0, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {913, "OBD_Eng_Cool_Temp", 8, 8, 1, 0, 1.0f, -40.0f, -40.0f, 215.0f, "Unit_DegreCelsi", -1},
+  {913, "OBD_Abs_Throttle_Pos", 16, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {913, "OBD_Abs_Load_Val", 24, 16, 1, 0, 0.392157f, 0.0f, 0.0f, 25700.0f, "Unit_PerCent", -1},
+  {913, "OBD_Abs_Pedal_Pos", 40, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {913, "OBD_Kaltstart_Denominator", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {913, "OBD_Minimum_Trip", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {913, "OBD_Driving_Cycle", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {913, "OBD_Warm_Up_Cycle", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {913, "OBD_Normed_Trip", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_07_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {914, "ESP_07_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "ESP_ACC_LDE", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_Quattro_Antrieb", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_Codierung_ADS", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {914, "ESP_RTA_HL", 16, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
+  {914, "ESP_RTA_HR", 24, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
+  {914, "ESP_RTA_VR", 32, 8, 1, 0, 0.0488281f, -6.20117f, -6.20117f, 6.15235f, "Unit_PerCent", -1},
+  {914, "OBD_Fehler_Radsensor_HL", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "OBD_Fehler_Radsensor_HR", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "OBD_Fehler_Radsensor_VL", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "OBD_Fehler_Radsensor_VR", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "ESP_Qualifizierung_Antriebsart", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_Offroad_Modus", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_MKB_ausloesbar", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_MKB_Status", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_CM_Variante", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "ESP_OBD_Status", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {916, "WBA_03_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {916, "WBA_03_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {916, "WBA_Fahrstufe_02", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {916, "WBA_ZielFahrstufe", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {916, "WBA_GE_Warnung_02", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {916, "WBA_eing_Gang_02", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {916, "WBA_GE_Texte", 28, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {916, "WBA_Segeln_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {916, "WBA_Schaltschema", 32, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {919, "LDW_Gong", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {919, "LDW_SW_Warnung_links", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_SW_Warnung_rechts", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Texte", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {919, "LDW_Seite_DLCTLC", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Lernmodus", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {919, "LDW_Anlaufsp_VLR", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {919, "LDW_Vib_Amp_VLR", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {919, "LDW_Anlaufzeit_VLR", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {919, "LDW_Lernmodus_rechts", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {919, "LDW_Lernmodus_links", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {919, "LDW_DLC", 40, 8, 1, 0, 0.01f, -1.25f, -1.25f, 1.25f, "Unit_Meter", -1},
+  {919, "LDW_TLC", 48, 5, 1, 0, 0.1f, 0.0f, 0.0f, 3.0f, "Unit_Secon", -1},
+  {919, "LDW_Warnung_links", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Warnung_rechts", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Codierinfo_fuer_VLR", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {919, "LDW_Frontscheibenheizung_aktiv", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Status_LED_gelb", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_Status_LED_gruen", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {919, "LDW_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_iAktLV", 12, 10, 1, 0, 1.0f, -511.0f, -511.0f, 510.0f, "Unit_Amper", -1},
+  {945, "DC_HYB_iAktReserveLV", 22, 10, 1, 0, 1.0f, -511.0f, -511.0f, 510.0f, "Unit_Amper", -1},
+  {945, "DC_HYB_uAktLV", 32, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.3f, "Unit_Volt", -1},
+  {945, "DC_HYB_LangsRegelung", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_Abregelung_Temperatur", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_Fehler_RedLeistung", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_Fehler_intern", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_Fehler_Spannung", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {945, "DC_HYB_Auslastungsgrad", 56, 8, 1, 0, 0.4f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {949, "KL_Drehz_Anh", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Vorwarn_Komp_ein", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_AC_Schalter", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Komp_Moment_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Zonen", 4, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {949, "KL_Vorwarn_Zuheizer_ein", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Zustand", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Comp_rev_rq", 8, 8, 1, 0, 50.0f, 0.0f, 0.0f, 8600.0f, "Unit_MinutInver", -1},
+  {949, "KL_Charisma_FahrPr", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {949, "KL_Charisma_Status", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {949, "KL_Comp_enable", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {949, "KL_Last_Kompr", 24, 8, 1, 0, 0.25f, 0.0f, 0.0f, 63.5f, "Unit_NewtoMeter", -1},
+  {949, "KL_Spannungs_Anf", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {949, "KL_Thermomanagement", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {949, "KL_StartStopp_Info", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {949, "KL_Anf_KL", 40, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "Unit_PerCent", -1},
+  {949, "KL_el_Zuheizer_Stufe", 48, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {958, "MO_StartStopp_Status", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {958, "MO_StartStopp_Wiederstart", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_StartStopp_Motorstopp", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Freig_Reku", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {958, "MO_Kl_75", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Kl_50", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Gangposition", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {958, "MO_StartStopp_Fahrerwunsch", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {958, "MO_HYB_Fahrbereitschaft", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Ext_E_Fahrt_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Fahrer_bremst", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_QBit_Fahrer_bremst", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_BLS", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Konsistenz_Bremsped", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Timeout_ESP", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {958, "MO_Klima_Eingr", 33, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {958, "MO_Aussp_Anlass", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {958, "MO_Freig_Anlass", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {958, "MO_Kuppl_schalter", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {958, "MO_Interlock", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -736,45 +772,12 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {958, "MO_QBit_Gangposition", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {958, "MO_Signalquelle_Gangposition", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {958, "MO_Remotestart_Betrieb", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1631, "TSK_QBit_Steigung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1631, "TSK_QBit_Fahrzeugmasse", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1631, "MO_SpannungsAnf_02", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1631, "MO_DPF_reg", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1631, "MO_Heizstrom_EKAT", 17, 7, 1, 0, 1.0f, 0.0f, 0.0f, 126.0f, "Unit_Amper", -1},
-  {1631, "MO_Heizstrom_SCR", 24, 6, 1, 0, 1.0f, 0.0f, 0.0f, 62.0f, "Unit_Amper", -1},
-  {1631, "TSK_Fahrzeugmasse_02", 48, 8, 1, 0, 32.0f, 0.0f, 0.0f, 8128.0f, "Unit_KiloGram", -1},
-  {1631, "TSK_Steigung", 56, 8, 1, 0, 0.8f, -101.6f, -101.6f, 101.6f, "Unit_PerCent", -1},
-  {812, "MO_Prio_MAX_Wunschdrehzahl", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {812, "MO_Prio_MIN_Wunschdrehzahl", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {812, "MO_Luftpfad_aktiv", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {812, "MO_v_Begrenz_Aktivierbar", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {812, "MO_Drehzahlbeeinflussung", 16, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.45f, "Unit_PerCent", -1},
-  {812, "MO_MIN_Wunschdrehzahl", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_MinutInver", -1},
-  {812, "MO_MAX_Wunschdrehzahl", 32, 9, 1, 0, 25.0f, 0.0f, 0.0f, 12750.0f, "Unit_MinutInver", -1},
-  {812, "MO_Charisma_FahrPr", 41, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {812, "MO_Charisma_Status", 45, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1648, "MO_Hybrid_StartStopp_LED", 43, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1648, "MO_Eis_Offroad_LED", 45, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1648, "MO_Anzahl_Abgesch_Zyl", 47, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1648, "MO_Zylabsch_Texte", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1648, "MO_E85_BS_Texte", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1648, "MO_Drehzahl_Warnung", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1648, "MO_obere_Drehzahlgrenze", 56, 8, 1, 0, 50.0f, 0.0f, 50.0f, 12750.0f, "Unit_MinutInver", -1},
-  {289, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {289, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {289, "MO_Fahrpedalrohwert_01", 12, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "Unit_PerCent", -1},
-  {289, "MO_QBit_Fahrpedalwerte_01", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_Fahrpedalgradient", 21, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "Unit_PerCentPerSecon", -1},
-  {289, "MO_Sig_Fahrpedalgradient", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_rel_Saugrohrdruck", 30, 6, 1, 0, 18.0f, 0.0f, 0.0f, 1116.0f, "Unit_MilliBar", -1},
-  {289, "MO_rel_Saugrohrdruck_gem_err", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_Moment_im_Leerlauf", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_Schubabschaltung", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_StartStopp_StoppVorbereitung", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "MO_Solldrehz_Leerlauf", 40, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Unit_MinutInver", -1},
-  {289, "MO_Entkopplung_Sollschlupf", 48, 7, 1, 0, 20.0f, 0.0f, 0.0f, 2480.0f, "Unit_MinutInver", -1},
-  {289, "MO_temporaere_Fahrerabwesenheit", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {289, "TSK_a_Soll_gradientenbegrenzt", 57, 7, 1, 0, 0.1f, -7.2f, -7.2f, 5.4f, "Unit_MeterPerSeconSquar", -1},
+  {960, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {960, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {960, "ZAS_Kl_S", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {960, "ZAS_Kl_15", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {960, "ZAS_Kl_X", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {960, "ZAS_Kl_50", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {967, "MO_HYB_Status_HV_Ladung", 8, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
   {967, "WIV_Anzeige_aktiv", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {967, "WIV_Oelmin_Warn", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -808,134 +811,82 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {967, "MO_Tankdeckel_Lampe", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {967, "MO_Text_Tankdeckelwarn", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {967, "WIV_Oeldr_Warn_Motor", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "Motor_Code_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1601, "Motor_Code_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1601, "MO_Faktor_Momente_02", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1601, "MO_Hybridfahrzeug", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1601, "MO_Code", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1601, "MO_Getriebe_Code", 24, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {1601, "MO_StartStopp_Codiert", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "MO_Anzahl_Zyl", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1601, "MO_Kraftstoffart", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1601, "MO_Hubraum", 40, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.7f, "Unit_Liter", -1},
-  {1601, "MO_Ansaugsystem", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "MO_Leistung", 48, 9, 1, 0, 1.0f, 0.0f, 0.0f, 511.0f, "Unit_KiloWatt", -1},
-  {1601, "MO_Abgastyp_EOBD", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "MO_Abgastyp_OBD", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "MO_DPF_verbaut", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1601, "TSK_Codierung", 60, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1601, "MO_Einspritzart", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {157, "Motor_Hybrid_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {157, "Motor_Hybrid_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {157, "MO_HYB_IstStatusK0", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {157, "MO_HYB_max_ind_VM_Mom", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1021.0f, "Unit_NewtoMeter", -1},
-  {157, "MO_HYB_Zielzustand", 26, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {157, "MO_HYB_Startmodus", 29, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {157, "MO_HYB_Startmodus_PQ3x", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {157, "MO_HYB_Stoppmodus", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {157, "MO_HYB_VM_Mom_oE", 40, 10, 1, 0, 1.0f, -100.0f, -100.0f, 922.0f, "Unit_NewtoMeter", -1},
-  {157, "MO_HYB_VM_aktiv", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {157, "MO_HYB_Schaltverhinderung", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {811, "MO_HYB_E_Faktor", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {811, "MO_HYB_Drehzahl_VM", 16, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16256.0f, "Unit_MinutInver", -1},
-  {811, "MO_HYB_LowSpeedModus", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984853, "NM_Airbag_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984853, "NM_Airbag_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984853, "NM_Airbag_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984853, "NM_Airbag_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984853, "NM_Airbag_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984853, "NM_Airbag_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984853, "NM_Airbag_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984853, "NM_Airbag_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984956, "NM_EMotor_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984956, "NM_EMotor_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984956, "NM_EMotor_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984956, "NM_EMotor_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984848, "NM_Gateway_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984848, "NM_Gateway_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984848, "NM_Gateway_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_ACAN_Aktivitaet", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_FCAN_Aktivitaet", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_KCAN_Aktivitaet", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_ICAN_Aktivitaet", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_DiagCAN_Aktivitaet", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_ECAN_Aktivitaet", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_Energie_LIN_Aktivi000", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_Bedien_LIN_Aktivitaet", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_EM_Aktivitaet", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NL_EM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NL_Shutdown", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NL_Spg_Messung", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_NL_Wakeup_Monitor", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984848, "NM_Gateway_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984951, "NM_Getriebe_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_v_gr_0", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_Pos_Erk", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NM_aktiv_Umg_Bed", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984951, "NM_Getriebe_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984955, "NM_Hybrid_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_NL_Luefter", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984955, "NM_Hybrid_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984950, "NM_MO_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {452984950, "NM_MO_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_HV_Abschaltung", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_EKP_Vorlauf", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NM_aktiv_STH_Betrieb", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NL_Kuehlerluefter", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NL_Diagnose", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NL_WFS", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NL_EEPROM", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_NL_Sonstige", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {452984950, "NM_MO_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {913, "OBD_Calc_Load_Val", 0, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {913, "OBD_Eng_Cool_Temp", 8, 8, 1, 0, 1.0f, -40.0f, -40.0f, 215.0f, "Unit_DegreCelsi", -1},
-  {913, "OBD_Abs_Throttle_Pos", 16, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {913, "OBD_Abs_Load_Val", 24, 16, 1, 0, 0.392157f, 0.0f, 0.0f, 25700.0f, "Unit_PerCent", -1},
-  {913, "OBD_Abs_Pedal_Pos", 40, 8, 1, 0, 0.392157f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {913, "OBD_Kaltstart_Denominator", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {913, "OBD_Minimum_Trip", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {913, "OBD_Driving_Cycle", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {913, "OBD_Warm_Up_Cycle", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {913, "OBD_Normed_Trip", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1630, "OBD_TG_F_Status_1", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1630, "OBD_TG_F_Status_2", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1630, "OBD_TG_F_Status_3", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1630, "OBD_TG_F_Status_4", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1630, "OBD_TG_Sens_Rohwert_1", 16, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
-  {1630, "OBD_TG_Sens_Rohwert_2", 28, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
-  {1630, "OBD_TG_Sens_Rohwert_3", 40, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
-  {1630, "OBD_TG_Sens_Rohwert_4", 52, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
-  {1437, "RSF_Tastencode_1", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1437, "RSF_Tastencode_2", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1437, "RSF_Tastencode_Maske", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {968, "GE_OBD_AbsperrVent", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {968, "GE_amax_moeglich", 16, 9, 1, 0, 0.024f, -2.016f, -2.016f, 10.224f, "Unit_MeterPerSeconSquar", -1},
+  {968, "GE_Charisma_FahrPr", 25, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {968, "GE_Charisma_Status", 29, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {968, "GE_Verlustmoment", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
+  {968, "GE_Freigabe_Verfallsinfo_WFS", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {968, "GE_Codierung_MSG", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {968, "GE_LaunchControl", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {968, "GE_Heizwunsch", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {968, "GE_OBD_Status", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {968, "GE_LFR_Adaption", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {968, "GE_Sumpftemperatur", 56, 8, 1, 0, 1.0f, -58.0f, -58.0f, 196.0f, "Unit_DegreCelsi", -1},
+  {981, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {981, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {981, "BCM1_Kurvenlicht_links_Anf", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Kurvenlicht_rechts_Anf", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Standlicht_Anf", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Abblendlicht_Anf", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Fernlicht_Anf", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Nebellicht_Anf", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Parklicht_li_Anf", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Parklicht_re_Anf", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Nebelschluss_Ahg_Anf", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Nebelschluss_Fzg_Anf", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Schlusslicht_Anf", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM_Rueckfahrlicht_Anf", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Signaturlicht_Anf", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Umfeldleuchten_Anf", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Tagfahrlicht_Anf", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Regenlicht_Anf", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Autobahnlicht_Anf", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Touristen_Licht_Anf", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_CH_aktiv", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_LH_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Gleitende_Leuchtw_Anf", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_GLW_Fernlicht_Anf", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Adaptive_Lichtvert_Anf", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_CH_LH_aktiv", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {981, "BCM1_Allwetterlicht_Anf", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "Licht_hinten_01_BZ", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {982, "BCM2_Bremsl_durch_ECD", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Aussenlicht_def", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Standlicht_H_aktiv", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Parklicht_HL_aktiv", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Parklicht_HR_aktiv", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Bremslicht_H_aktiv", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Nebelschluss_aktiv", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Rueckfahrlicht_aktiv", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Blinker_HL_akt", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Blinker_HR_akt", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Blinker_li_def", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Bremsl_li_def", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schlusslicht_li_def", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Rueckf_li_def", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Nebel_li_def", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Brems_Nebel_li_def", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Brems_Nebel_re_def", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Brems_li_def", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Nebel_li_def", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_SL_BRL_BLK_li_def", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Brems_Blk_li_def", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Blinker_re_def", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Bremsl_re_def", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schlusslicht_re_def", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Rueckf_re_def", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Nebel_re_def", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Brems_re_def", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Schluss_Nebel_re_def", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_SL_BRL_BLK_re_def", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Brems_Blk_re_def", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Kennzl_def", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_3_Bremsl_def", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Nebel_mi_def", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Rueckf_mi_def", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Bremsl_li_ges_def", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {982, "LH_Bremsl_re_ges_def", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {984, "RGS_VL_Texte", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {984, "RGS_VL_Charisma_FahrPr", 14, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {984, "RGS_VL_Charisma_Status", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
@@ -947,37 +898,73 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {984, "RGS_VL_Precrash_Basis", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {984, "RGS_VL_Precrash_Front", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {984, "RGS_VL_Precrash_Rear", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1528, "SAK_Charisma_FahrPr", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1528, "SAK_Charisma_Status", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1313, "STH_Funk_ein", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Funk_aus", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Zusatzheizung", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_LED", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Pumpe_ein", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Geblaese", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_EKP_Anst", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Start_folgt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Ventiloeffnungszeit", 8, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "Unit_Minut", -1},
-  {1313, "STH_Ventil_Status", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Waermeeintrag", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {1313, "STH_KVS", 24, 13, 1, 0, 1.0f, 0.0f, 0.0f, 8191.0f, "Unit_MilliLiter", -1},
-  {1313, "STH_Fehlerstatus", 37, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1313, "STH_Heizleistung", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1313, "STH_Wassertemp", 48, 8, 1, 0, 0.75f, -40.0f, -40.0f, 142.25f, "Unit_DegreCelsi", -1},
-  {1313, "STH_Motorvorwaermung", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_Servicemode", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_war_aktiv", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_KVS_Ueberlauf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1313, "STH_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1172, "STS_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1172, "STS_Car_not_under_theft", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_Car_under_theft", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_Anlassersperre", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_Typencodierung", 16, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {1172, "STS_LIN_aktiv", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_Standlicht", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1172, "STS_Fahrlicht", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BCM_01_alt", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "SMLS_01_alt", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_02_alt", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Wischer_01_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Anhaenger_01_alt", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Klima_Sensor_02_alt", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "VSG_01_alt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Klima_01_alt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "WFS_01_alt", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Licht_Anf_01_alt", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_HFS_offen", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_HBFS_offen", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "VS_VD_offen_ver", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "VS_VD_zu_ver", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_BT_offen", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BCM1_Rueckfahrlicht_Schalter", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_FT_offen", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Wischer_vorne_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "AAG_Anhaenger_erkannt", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BCM1_MH_Schalter", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "ZV_HD_offen", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "Waschen_vorne_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "KL_Thermomanagement", 32, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {987, "WFS_Schluessel_Fahrberecht", 34, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {987, "BCM1_RFahrlicht_Fzg_Anf", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BCM1_RFahrlicht_Ahg_Anf", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BH_Fernlicht", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BH_Blinker_li", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BH_Blinker_re", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {987, "BCM1_OBD_FStatus_ATemp", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {987, "BCM1_Aussen_Temp_ungef", 56, 8, 1, 0, 0.5f, -50.0f, -50.0f, 76.0f, "Unit_DegreCelsi", -1},
+  {988, "UNKNOWN_1", 15, 2, 0, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {988, "GE_Fahrstufe", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {988, "EPB_Status", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {988, "UNKNOWN_2", 58, 3, 0, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {989, "LH_EPS_01_alt", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "Kessy_04_alt", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "LIN_2_alt", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "MFG_01_alt", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "GW_74_va_14", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "Klima_02_alt", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "Parkhilfe_01_alt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "ELV_01_alt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "KY_StartStopp_Info", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {989, "PH_StartStopp_Info", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {989, "EPS_Lenkerposition", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {989, "ELV_Anf_Klemme_50", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "MF_StartStopp_Info", 25, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {989, "KL_Geblaesespannung_Soll", 40, 8, 1, 0, 0.05f, 0.5f, 2.0f, 13.0f, "Unit_Volt", -1},
+  {989, "KL_Umluftklappe_Status", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {989, "MFL_Tip_Down", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "MFL_Tip_Up", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {989, "LS_Tiptronic_Fehler", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {997, "TSG_FT_02_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {997, "TSG_FT_02_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1122, "PSD_Object_Index", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {1123, "PSD_Current_Route_Index", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {1123, "Route_Distance_Remaining", 8, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {1172, "STS_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1172, "STS_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1172, "STS_Car_not_under_theft", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1172, "STS_Car_under_theft", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1172, "STS_Anlassersperre", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1172, "STS_Typencodierung", 16, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {1172, "STS_LIN_aktiv", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1172, "STS_Standlicht", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1172, "STS_Fahrlicht", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1172, "STS_Alarm_still", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1172, "STS_Texte", 27, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {1172, "STS_Laderelais", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -986,6 +973,37 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {1172, "STS_Notstart", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1172, "STS_Signalhorn", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1172, "STS_Leerlaufschaltung", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1312, "AB_Belegung_VB", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_FA", 40, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_BF", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe2_FA", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe2_MI", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe2_BF", 48, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe3_FA", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe3_MI", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Gurtschloss_Reihe3_BF", 54, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Sitzpos_Sens_FA", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1312, "AB_Sitzpos_Sens_BF", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1313, "STH_Funk_ein", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Funk_aus", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Zusatzheizung", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_LED", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Pumpe_ein", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Geblaese", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_EKP_Anst", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Start_folgt", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Ventiloeffnungszeit", 8, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "Unit_Minut", -1},
+  {1313, "STH_Ventil_Status", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Waermeeintrag", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {1313, "STH_KVS", 24, 13, 1, 0, 1.0f, 0.0f, 0.0f, 8191.0f, "Unit_MilliLiter", -1},
+  {1313, "STH_Fehlerstatus", 37, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1313, "STH_Heizleistung", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1313, "STH_Wassertemp", 48, 8, 1, 0, 0.75f, -40.0f, -40.0f, 142.25f, "Unit_DegreCelsi", -1},
+  {1313, "STH_Motorvorwaermung", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_Servicemode", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_war_aktiv", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_KVS_Ueberlauf", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1313, "STH_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1413, "SI_Sammel_SG_Fehler", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 60.0f, "", -1},
   {1413, "SI_Rollenmode", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {1413, "SI_QRS_Mode", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -1009,322 +1027,225 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {1413, "SI_BUS_13", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1413, "SI_BUS_14", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1413, "SI_BUS_15", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {288, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {288, "TSK_Radbremsmom", 12, 12, 1, 0, 8.0f, 0.0f, 0.0f, 32760.0f, "Unit_NewtoMeter", -1},
-  {288, "TSK_Status", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {288, "TSK_v_Begrenzung_aktiv", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_Standby_Anf_ESP", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_Freig_WU", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_Freig_Verzoeg_Anf", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_Limiter_ausgewaehlt", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_Wunsch_Uebersetz", 32, 10, 1, 0, 0.0245f, 0.0f, 0.0245f, 25.0635f, "", -1},
-  {288, "TSK_Hauptschalter_GRA_ACC", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {288, "TSK_SRBM_Anf_ASIL", 44, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {288, "TSK_ax_Getriebe_02", 48, 9, 1, 0, 0.024f, -2.016f, -2.016f, 10.224f, "Unit_MeterPerSeconSquar", -1},
-  {288, "TSK_Zwangszusch_ESP", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {288, "TSK_zul_Regelabw", 58, 6, 1, 0, 0.024f, 0.0f, 0.0f, 1.512f, "Unit_MeterPerSeconSquar", -1},
-  {798, "TSK_07_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {798, "TSK_07_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {798, "TSK_Wunschgeschw", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 326.72f, "Unit_KiloMeterPerHour", -1},
-  {798, "TSK_Texte", 40, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {798, "TSK_Akustik", 45, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {798, "TSK_Texte_Primaeranz", 48, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {798, "TSK_Limiter_Fahrerinfo", 53, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {798, "TSK_Limiter_Anzeige", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {798, "TSK_Fahrzeugstatus_GRA", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {798, "TSK_Fahrzeugstatus_Limiter", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {798, "MO_Motorlaufwarnung", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {798, "TSK_Status_Anzeige", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_08_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {346, "TSK_08_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {346, "MO_Anforderung_HMS", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_Status_EA", 32, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_vMax_Fahrerassistenz", 40, 9, 1, 0, 1.0f, 0.0f, 0.0f, 510.0f, "", -1},
-  {346, "TSK_Einheit_vMax_Fahrerassistenz", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {346, "TSK_Status_PLA", 50, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_aktives_System", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_erhoehter_Fahrwiderstand", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {346, "TSK_Anf_Antriebsmoment", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {346, "TSK_Status_ARA", 58, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {346, "TSK_Status_IPA", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {1716, "VIN_01_MUX", 0, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -2},
-  {1716, "KS_Geheimnis_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_4", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_11", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "KS_Geheimnis_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_5", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_12", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "KS_Geheimnis_3", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_6", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_13", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "KS_Geheimnis_4", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_7", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_14", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "VIN_1", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_8", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_15", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "VIN_2", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_9", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_16", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {1716, "VIN_3", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
-  {1716, "VIN_10", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
-  {1716, "VIN_17", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
-  {175, "WH_Status_Sperre", 0, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {175, "WH_Initialisierung", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {175, "WH_SensorPos_roh", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {175, "WH_03_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {175, "WH_SensorPos_roh_inv", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {175, "WH_Testergebnis", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {175, "WH_Test_Aktiv", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {175, "WH_Status", 25, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "", -1},
-  {916, "WBA_03_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {916, "WBA_03_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {916, "WBA_Fahrstufe_02", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {916, "WBA_ZielFahrstufe", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {916, "WBA_GE_Warnung_02", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {916, "WBA_eing_Gang_02", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {916, "WBA_GE_Texte", 28, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {916, "WBA_Segeln_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {916, "WBA_Schaltschema", 32, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
+  {1437, "RSF_Tastencode_1", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1437, "RSF_Tastencode_2", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1437, "RSF_Tastencode_Maske", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1520, "DI_KL_58xd", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 253.0f, "", -1},
+  {1520, "DI_KL_58xs", 8, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {1520, "DI_Display_Nachtdesign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1520, "DI_KL_58xt", 16, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {1520, "DI_Fotosensor", 24, 16, 1, 0, 1.0f, 0.0f, 0.0f, 65535.0f, "", -1},
+  {1528, "SAK_Charisma_FahrPr", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1528, "SAK_Charisma_Status", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1600, "MO_QBit_Ansaugluft_Temp", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_QBit_Oel_Temp", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_QBit_Kuehlmittel_Temp", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_Stellgliedtest_Soundaktuator", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_HYB_Fehler_HV_Netz", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_aktives_Getriebeheizen", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_Absperrventil_oeffnen", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1600, "MO_Ansaugluft_Temp", 8, 8, 1, 0, 0.75f, -48.0f, -48.0f, 141.75f, "Unit_DegreCelsi", -1},
+  {1600, "MO_Oel_Temp", 16, 8, 1, 0, 1.0f, -60.0f, -60.0f, 192.0f, "Unit_DegreCelsi", -1},
+  {1600, "MO_Kuehlmittel_Temp", 24, 8, 1, 0, 0.75f, -48.0f, -48.0f, 141.75f, "Unit_DegreCelsi", -1},
+  {1600, "MO_Hoeheninfo", 32, 8, 1, 0, 0.00781f, 0.0f, 0.0f, 1.98374f, "", -1},
+  {1600, "MO_Kennfeldk", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_Versionsinfo", 41, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {1600, "MO_Getriebe_kuehlen", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_Mom_Traegheit_02", 48, 5, 1, 0, 0.01f, 0.0f, 0.0f, 0.31f, "Unit_KiloGramMeterSquar", -1},
+  {1600, "MO_Heizungspumpenansteuerung", 53, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {1600, "MO_SpannungsAnf", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1600, "MO_Nachlaufzeit_Heizungspumpe", 58, 6, 1, 0, 15.0f, 0.0f, 0.0f, 945.0f, "Unit_Secon", -1},
+  {1601, "Motor_Code_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1601, "Motor_Code_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1601, "MO_Faktor_Momente_02", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1601, "MO_Hybridfahrzeug", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1601, "MO_Code", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1601, "MO_Getriebe_Code", 24, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {1601, "MO_StartStopp_Codiert", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1601, "MO_Anzahl_Zyl", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1601, "MO_Kraftstoffart", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1601, "MO_Hubraum", 40, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.7f, "Unit_Liter", -1},
+  {1601, "MO_Ansaugsystem", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1601, "MO_Leistung", 48, 9, 1, 0, 1.0f, 0.0f, 0.0f, 511.0f, "Unit_KiloWatt", -1},
+  {1601, "MO_Abgastyp_EOBD", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1601, "MO_Abgastyp_OBD", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1601, "MO_DPF_verbaut", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1601, "TSK_Codierung", 60, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1601, "MO_Einspritzart", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1602, "WIV_Verschleissindex", 0, 16, 1, 0, 2e-08f, 0.0f, 0.0f, 0.00131068f, "", -1},
   {1602, "WIV_Russindex", 16, 16, 1, 0, 2e-08f, 0.0f, 0.0f, 0.00131068f, "", -1},
   {1602, "WIV_t_min", 32, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "Unit_Month", -1},
   {1602, "WIV_t_max", 40, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "Unit_Month", -1},
   {1602, "WIV_W_min", 48, 7, 1, 0, 1000.0f, 0.0f, 0.0f, 127000.0f, "Unit_KiloMeter", -1},
   {1602, "WIV_W_max", 56, 7, 1, 0, 1000.0f, 0.0f, 0.0f, 127000.0f, "Unit_KiloMeter", -1},
-  {294, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {294, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {294, "HCA_01_Vib_Freq", 12, 4, 1, 0, 1.0f, 15.0f, 15.0f, 30.0f, "Unit_Hertz", -1},
-  {294, "HCA_01_LM_Offset", 16, 9, 1, 0, 1.0f, 0.0f, 0.0f, 511.0f, "Unit_centiNewtoMeter", -1},
-  {294, "EA_ACC_Sollstatus", 25, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {294, "EA_Ruckprofil", 27, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {294, "HCA_01_Sendestatus", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {294, "HCA_01_LM_OffSign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {294, "HCA_01_Status_HCA", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {294, "HCA_01_Vib_Amp", 36, 4, 1, 0, 0.2f, 0.0f, 0.0f, 3.0f, "Unit_NewtoMeter", -1},
-  {294, "EA_Ruckfreigabe", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {294, "EA_ACC_Wunschgeschwindigkeit", 41, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
-  {810, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {810, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {810, "EPS_SpannungsAnf", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {810, "EPS_Endanschlag", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {810, "EPS_Akustiksignal", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {810, "EPS_Fehlerlampe", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {810, "EPS_Warnungen", 19, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {810, "EPS_PLA_Abbruch", 22, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {810, "EPS_PLA_Fehler", 26, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {810, "EPS_PLA_Status", 30, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {810, "EPS_Charisma_FahrPr", 34, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {810, "EPS_Charisma_Status", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {810, "EPS_Lenkerposition", 41, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {810, "EPS_Anf_KL", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {810, "EPS_ARA_Status", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {159, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {159, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {159, "EPS_DSR_Status", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {159, "EPS_Berechneter_LW", 16, 12, 1, 0, 0.15f, 0.0f, 0.0f, 613.95f, "Unit_DegreOfArc", -1},
-  {159, "EPS_BLW_QBit", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {159, "EPS_VZ_BLW", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {159, "EPS_HCA_Status", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {159, "EPS_AWA_Status", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 14.0f, "", -1},
-  {159, "EPS_Lenkmoment", 40, 10, 1, 0, 1.0f, 0.0f, 0.0f, 8.0f, "Unit_centiNewtoMeter", -1},
-  {159, "EPS_Lenkmoment_QBit", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {159, "EPS_VZ_Lenkmoment", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {159, "EPS_Lenkungstyp", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {286, "ESP_08_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {286, "ESP_08_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {286, "ESP_ANB_CM_Rueckk_Umsetz", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_Konsistenz_ACC_Botschaft", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_Stillstandsphase_erschoepft", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_ZT_Rueckk_Umsetz", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_Tuerkontakt_Fahrertuer", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_Abrutschen_Stillstand", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_Fahrer_tritt_ZBR_Schw", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_QBit_v_ref", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {286, "ESP_v_ref_Fahrtrichtung", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {286, "ESC_Bremsdruckgradient", 44, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2500.0f, "Unit_BarPerSecon", -1},
-  {286, "ESP_v_ref", 52, 12, 1, 0, 0.125f, 0.0f, 0.0f, 511.5f, "Unit_KiloMeterPerHour", -1},
-  {919, "LDW_Gong", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {919, "LDW_SW_Warnung_links", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_SW_Warnung_rechts", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Texte", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {919, "LDW_Seite_DLCTLC", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Lernmodus", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {919, "LDW_Anlaufsp_VLR", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {919, "LDW_Vib_Amp_VLR", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {919, "LDW_Anlaufzeit_VLR", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {919, "LDW_Lernmodus_rechts", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {919, "LDW_Lernmodus_links", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {919, "LDW_DLC", 40, 8, 1, 0, 0.01f, -1.25f, -1.25f, 1.25f, "Unit_Meter", -1},
-  {919, "LDW_TLC", 48, 5, 1, 0, 0.1f, 0.0f, 0.0f, 3.0f, "Unit_Secon", -1},
-  {919, "LDW_Warnung_links", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Warnung_rechts", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Codierinfo_fuer_VLR", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {919, "LDW_Frontscheibenheizung_aktiv", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Status_LED_gelb", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_Status_LED_gruen", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {919, "LDW_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {780, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {780, "ACC_Wunschgeschw_02", 12, 10, 1, 0, 0.32f, 0.0f, 0.0f, 327.04f, "Unit_KiloMeterPerHour", -1},
-  {780, "ACC_Status_Prim_Anz", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {780, "ACC_Abstandsindex", 24, 10, 1, 0, 1.0f, 0.0f, 1.0f, 1021.0f, "", -1},
-  {780, "ACC_Akustik_02", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {780, "ACC_Warnung_Verkehrszeichen_1", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Gesetzte_Zeitluecke", 37, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {780, "ACC_Optischer_Fahrerhinweis", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Typ_Tachokranz", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Anzeige_Zeitluecke", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Tachokranz", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Display_Prio", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {780, "ACC_Relevantes_Objekt", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {780, "ACC_Texte_Primaeranz", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "", -1},
-  {780, "ACC_Wunschgeschw_erreicht", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Typ_Tachokranz_unten", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {780, "ACC_Status_Anzeige", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {302, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {302, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {302, "ACC_Anhalteweg", 12, 11, 1, 0, 0.01f, 0.0f, 0.0f, 20.45f, "Unit_Meter", -1},
-  {302, "ACC_Anhalten", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {302, "ACC_Boost_Anf", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {302, "ACC_Freilauf_Anf", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {302, "ACC_Freilauf_Info", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {302, "ACC_Anforderung_HMS", 28, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {302, "ACC_Anfahren", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {302, "ACC_Folgebeschl", 32, 8, 1, 0, 0.03f, -4.6f, -4.6f, 2.99f, "Unit_MeterPerSeconSquar", -1},
-  {302, "ACC_Sollbeschleunigung_02", 53, 11, 1, 0, 0.005f, -7.22f, -7.22f, 3.005f, "Unit_MeterPerSeconSquar", -1},
-  {264, "Fahrwerk_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {264, "Fahrwerk_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {695, "RCTA_01_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {695, "RCTA_01_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {783, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {783, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {783, "SWA_Anzeigen", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {783, "SWA_Blindheit_erkannt", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_rel_Nichtverf", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_rel_Fehler", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Sta_aktiv", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Sta_passiv", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_FT_RueckLED", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "ASW_Status", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {783, "SWA_Standziele_li", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Kolonne_li", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Infostufe_SWA_li", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Warnung_SWA_li", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "ASW_Warnung_FS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "ASW_Warnung_BFS", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "ASW_Kombitexte", 30, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {783, "SWA_Kolonne_mi", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Standziele_re", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Kolonne_re", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Infostufe_SWA_re", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "SWA_Warnung_SWA_re", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {783, "HRE_Anzeigetexte", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {783, "SWA_Gischtzaehler", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
-  {783, "Heckradar_Kombitexte", 56, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {783, "RCTA_Kombitexte", 61, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {804, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {804, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {804, "ACC_Texte_Sekundaeranz", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {804, "ACC_Texte_Zusatzanz", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {804, "ACC_Status_Zusatzanz", 22, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {804, "ACC_Texte", 27, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {804, "ACC_Texte_braking_guard", 32, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {804, "ACC_Warnhinweis", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {804, "ACC_Zeitluecke_Abstandswarner", 36, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.0f, "Unit_Secon", -1},
-  {804, "ACC_Abstand_Abstandswarner", 42, 9, 1, 0, 1.0f, 0.0f, 0.0f, 508.0f, "", -1},
-  {804, "ACC_Tempolimit", 51, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {804, "ACC_Charisma_FahrPr", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {804, "ACC_Charisma_Status", 60, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {804, "ACC_Texte_Abstandswarner", 62, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {997, "TSG_FT_02_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {997, "TSG_FT_02_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {427, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {427, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {427, "ESC_AHW_aktiv", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {427, "ESC_AHW_nicht_verfuegbar", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_ANB_CM_aktiv", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {427, "ESC_ANB_CM_nicht_verfuegbar", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Warnruck_aktiv", 19, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {427, "ESC_Warnruck_nicht_verfuegbar", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Prefill_aktiv", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Prefill_nicht_verfuegbar", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_HBA_aktiv", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_HBA_nicht_verfuegbar", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_TSK_SRBM_Anf", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_TSK_SRBM_nicht_verfuegbar", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Verz_Reg_aktiv", 30, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {427, "ESC_Verz_Reg_nicht_verfuegbar", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Verz_Reg_TB_nicht_verfuegbar", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Verz_Reg_ZB_nicht_verfuegbar", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Bremslicht_unplausibel", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_ACC", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_AWV", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_ARA", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_IPA", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_FCW", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_NV", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_RCTA", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_TSK", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_vFGS", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_STA", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Fahrer_Bremsdruck_bestimmend", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_EA", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_BFF", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_MKB", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Verz_ASIL_Verfuegbarkeit", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {427, "ESC_Pumpenanlauf_aktiv", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_AGW", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_KAS", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_PCF", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_FAS_VK", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Verz_Begrenzung", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {427, "ESC_Konsistenz_AWA", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {418, "ESP_15_CRC", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {418, "ESP_15_BZ", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1122, "PSD_Object_Index", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {1123, "PSD_Current_Route_Index", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
-  {1123, "Route_Distance_Remaining", 8, 5, 1, 0, 1.0f, 0.0f, 0.0f, 31.0f, "", -1},
-  {988, "UNKNOWN_1", 15, 2, 0, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {988, "GE_Fahrstufe", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {988, "EPB_Status", 53, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {988, "UNKNOWN_2", 58, 3, 0, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {981, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {981, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {981, "BCM1_Kurvenlicht_links_Anf", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Kurvenlicht_rechts_Anf", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Standlicht_Anf", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Abblendlicht_Anf", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Fernlicht_Anf", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Nebellicht_Anf", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Parklicht_li_Anf", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Parklicht_re_Anf", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Nebelschluss_Ahg_Anf", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Nebelschluss_Fzg_Anf", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Schlusslicht_Anf", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM_Rueckfahrlicht_Anf", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Signaturlicht_Anf", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Umfeldleuchten_Anf", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Tagfahrlicht_Anf", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Regenlicht_Anf", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Autobahnlicht_Anf", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Touristen_Licht_Anf", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_CH_aktiv", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_LH_aktiv", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Gleitende_Leuchtw_Anf", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_GLW_Fernlicht_Anf", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Adaptive_Lichtvert_Anf", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_CH_LH_aktiv", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {981, "BCM1_Allwetterlicht_Anf", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Hazard_Switch", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Comfort_Signal_Left", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Comfort_Signal_Right", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Left_Turn_Exterior_Bulb_1", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Right_Turn_Exterior_Bulb_1", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Left_Turn_Exterior_Bulb_2", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Right_Turn_Exterior_Bulb_2", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {870, "Fast_Send_Rate_Active", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1603, "KBI_Einheit_Datum", 0, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1603, "KBI_Einheit_Druck", 2, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1603, "KBI_Einheit_Streckenanz", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1603, "KBI_MFA_v_Einheit_02", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1603, "KBI_Einheit_Temp", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1603, "KBI_Einheit_Uhrzeit", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1603, "KBI_Einheit_Verbrauch", 8, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1603, "KBI_Einheit_Volumen", 10, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1603, "KBI_Einheit_Sprache", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1607, "MO_ITM_Kuehlmittel_Temp", 0, 8, 1, 0, 0.75f, -48.0f, -45.75f, 143.25f, "Unit_DegreCelsi", -1},
+  {1607, "MO_E85_Sensor", 8, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {1607, "SCR_Anz_Motorstarts", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 8.0f, "", -1},
+  {1607, "SCR_Reichweite", 16, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32766.0f, "", -1},
+  {1607, "SCR_Warnstufe_1", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1607, "SCR_Warnstufe_2", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1607, "SCR_Text", 34, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1607, "SCR_Akustik", 37, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1607, "MO_Kraftstofffilter_Wasser", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1607, "SCR_Systemfehler", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1607, "SCR_Inducement_Strategie", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1607, "MO_CO2_Faktor", 44, 12, 1, 0, 1.0f, 0.0f, 1.0f, 4094.0f, "Unit_GramPerLiter", -1},
+  {1625, "EKL_KD_Fehler", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1625, "EKL_Comp_SCI_com_stat", 16, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1625, "EKL_Comp_output_stat", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1625, "EKL_Comp_main_stat", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1625, "EKL_Comp_ovld_stat", 21, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1625, "EKL_Comp_Inv_stat", 24, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1625, "EKL_Comp_photo_temp_stat", 30, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1625, "EKL_Comp_photo_temp", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "Unit_DegreCelsi", -1},
+  {1625, "EKL_Comp_current", 40, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.4f, "Unit_Amper", -1},
+  {1625, "EKL_Comp_rev_stat", 48, 8, 1, 0, 50.0f, 0.0f, 0.0f, 8600.0f, "Unit_MinutInver", -1},
+  {1626, "BCM_Bremsbelag_Sensor", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Bremsfluessigkeit_Sensor", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Licht_Warn", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Waschwasser_Sensor", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Kuehlmittel_Sensor", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Kl_15_HW_erkannt", 17, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Eis_Offroad_Taste", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "ZZH_Endlage_oben", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "ZZH_Endlage_unten", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "ZZH_Endlage_unplausibel", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM2_EZS_gedrueckt", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM2_SST_gedrueckt", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Hybrid_StartStopp_Taste", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Warnblink_Taster", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Valet_Parking_Taster", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Remotestart_Betrieb", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_HSK_Taster", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Heckrollo_Taster", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Rueckfahrlicht_Schalter", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_MH_Schalter", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_MH_WIV_Schalter", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Eco_Charisma_Taste", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Thermomanagement", 34, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1626, "BCM_Thermomanagement_Fehler", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM_Thermomanagement_gueltig", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1626, "BCM1_Lichtwarn_Texte", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1628, "BMS_HYB_ASV_hinten_Status", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1628, "BMS_HYB_ASV_vorne_Status", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1628, "BMS_HYB_KD_Fehler", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1628, "BMS_HYB_BattFanSpd", 16, 4, 1, 0, 10.0f, 0.0f, 0.0f, 100.0f, "Unit_PerCent", -1},
+  {1628, "BMS_HYB_VentilationReq", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1628, "BMS_HYB_Spuelbetrieb_Status", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1628, "BMS_HYB_Kuehlung_Anf", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1628, "BMS_HYB_Temp_vor_Verd", 24, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
+  {1628, "BMS_HYB_Temp_nach_Verd", 32, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
+  {1628, "BMS_Temperatur", 40, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
+  {1628, "BMS_Temperatur_Ansaugluft", 48, 8, 1, 0, 0.5f, -40.0f, -40.0f, 86.5f, "Unit_DegreCelsi", -1},
+  {1628, "BMS_IstSpannung_HV", 56, 8, 1, 0, 1.0f, 100.0f, 100.0f, 350.0f, "Unit_Volt", -1},
+  {1629, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1629, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1629, "BR_Systemart", 12, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1629, "ESP_SpannungsAnf_02", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1629, "ESP_Zaehnezahl", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1629, "ESP_Charisma_FahrPr", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1629, "ESP_Charisma_Status", 28, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1629, "ESP_Wiederstart_Anz_01", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Wiederstart_Anz_02", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Wiederstart_Anz_03", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Wiederstart_Anz_04", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_01", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_02", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_03", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_04", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_05", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_06", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_07", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_Std", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "ESP_Dachrelingsensor", 42, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1629, "ESP_Stoppverbot_Anz_08", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "HDC_Charisma_FahrPr", 45, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1629, "HDC_Charisma_Status", 49, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1629, "BR_QBit_Reifenumfang", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1629, "BR_Reifenumfang", 52, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "Unit_MilliMeter", -1},
+  {1630, "OBD_TG_F_Status_1", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1630, "OBD_TG_F_Status_2", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1630, "OBD_TG_F_Status_3", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1630, "OBD_TG_F_Status_4", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1630, "OBD_TG_Sens_Rohwert_1", 16, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
+  {1630, "OBD_TG_Sens_Rohwert_2", 28, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
+  {1630, "OBD_TG_Sens_Rohwert_3", 40, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
+  {1630, "OBD_TG_Sens_Rohwert_4", 52, 12, 1, 0, 0.5f, 0.0f, 0.0f, 2047.5f, "Unit_Ohm", -1},
+  {1631, "TSK_QBit_Steigung", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1631, "TSK_QBit_Fahrzeugmasse", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1631, "MO_SpannungsAnf_02", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1631, "MO_DPF_reg", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1631, "MO_Heizstrom_EKAT", 17, 7, 1, 0, 1.0f, 0.0f, 0.0f, 126.0f, "Unit_Amper", -1},
+  {1631, "MO_Heizstrom_SCR", 24, 6, 1, 0, 1.0f, 0.0f, 0.0f, 62.0f, "Unit_Amper", -1},
+  {1631, "TSK_Fahrzeugmasse_02", 48, 8, 1, 0, 32.0f, 0.0f, 0.0f, 8128.0f, "Unit_KiloGram", -1},
+  {1631, "TSK_Steigung", 56, 8, 1, 0, 0.8f, -101.6f, -101.6f, 101.6f, "Unit_PerCent", -1},
+  {1633, "AAG_BZ", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1633, "AAG_Bremsl_durch_ECD", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Anhaenger_abgesteckt", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_NSL_aktiv", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Anhaenger_erkannt", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Blinker_H_aktiv", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Blinker_HL_def", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Blinker_HR_def", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Bremslicht_H_def", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Schlusslicht_HL_def", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_Schlusslicht_HR_def", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_AVS_Fehler_02", 18, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1633, "AAG_AVS_Stati", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1648, "MO_Hybrid_StartStopp_LED", 43, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1648, "MO_Eis_Offroad_LED", 45, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1648, "MO_Anzahl_Abgesch_Zyl", 47, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1648, "MO_Zylabsch_Texte", 50, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1648, "MO_E85_BS_Texte", 52, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {1648, "MO_Drehzahl_Warnung", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1648, "MO_obere_Drehzahlgrenze", 56, 8, 1, 0, 50.0f, 0.0f, 50.0f, 12750.0f, "Unit_MinutInver", -1},
+  {1714, "DGN_Verlernzaehler", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
+  {1714, "KBI_Kilometerstand", 8, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1048570.0f, "Unit_KiloMeter", -1},
+  {1714, "UH_Jahr", 28, 7, 1, 0, 1.0f, 2000.0f, 2000.0f, 2127.0f, "Unit_Year", -1},
+  {1714, "UH_Monat", 35, 4, 1, 0, 1.0f, 0.0f, 1.0f, 12.0f, "Unit_Month", -1},
+  {1714, "UH_Tag", 39, 5, 1, 0, 1.0f, 0.0f, 1.0f, 31.0f, "Unit_Day", -1},
+  {1714, "UH_Stunde", 44, 5, 1, 0, 1.0f, 0.0f, 0.0f, 23.0f, "Unit_Hours", -1},
+  {1714, "UH_Minute", 49, 6, 1, 0, 1.0f, 0.0f, 0.0f, 59.0f, "Unit_Minut", -1},
+  {1714, "UH_Sekunde", 55, 6, 1, 0, 1.0f, 0.0f, 0.0f, 59.0f, "Unit_Secon", -1},
+  {1714, "Kombi_02_alt", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1714, "Uhrzeit_01_alt", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1716, "VIN_01_MUX", 0, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -2},
+  {1716, "KS_Geheimnis_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_4", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_11", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "KS_Geheimnis_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_5", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_12", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "KS_Geheimnis_3", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_6", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_13", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "KS_Geheimnis_4", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_7", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_14", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "VIN_1", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_8", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_15", 40, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "VIN_2", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_9", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_16", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1716, "VIN_3", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 0},
+  {1716, "VIN_10", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 1},
+  {1716, "VIN_17", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", 2},
+  {1719, "KBI_Kilometerstand", 0, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1048570.0f, "Unit_KiloMeter", -1},
+  {1719, "KBI_Standzeit_02", 20, 17, 1, 0, 1.0f, 0.0f, 0.0f, 131068.0f, "Unit_Secon", -1},
+  {1719, "KBI_Inhalt_Tank", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 125.0f, "Unit_Liter", -1},
+  {1719, "KBI_FStatus_Tank", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1719, "KBI_QBit_Aussen_Temp_gef", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1719, "KBI_Aussen_Temp_gef", 56, 8, 1, 0, 0.5f, -50.0f, -50.0f, 75.0f, "Unit_DegreCelsi", -1},
   {1720, "KBI_Reifenumfang", 0, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "Unit_MilliMeter", -1},
   {1720, "KBI_Variante_USA", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1720, "KBI_Variante", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -1335,22 +1256,323 @@ const dbc_signal_t k_vw_mqb_chassis_signals[] = {
   {1720, "KBI_Tankinhalt_hochaufl", 26, 14, 1, 0, 0.01f, 0.0f, 0.0f, 163.81f, "Unit_Liter", -1},
   {1720, "KBI_Max_Tankinhalt", 40, 8, 1, 0, 0.5f, 0.0f, 0.0f, 126.5f, "", -1},
   {1720, "KBI_Reifenumfang_Sekundaer", 48, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "Unit_MilliMeter", -1},
-  {391, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {391, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {391, "EV_Rekuperationsstufe", 12, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {391, "HV_Bordnetz_aktiv", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {391, "MO_Waehlpos", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {391, "MO_Fehler_NTKreis", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {391, "MO_Fehler_Notabschaltung_Klima", 20, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {391, "MO_KLE_FStatus", 22, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {391, "MO_WH_Texte", 24, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {391, "MO_Drehzahl_VM", 32, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16383.0f, "Unit_MinutInver", -1},
-  {391, "HV_Bordnetz_Fehler", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {391, "MO_Tankbereitschaft_Status", 49, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {391, "MO_Tankklappensteuerung", 52, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {391, "MO_HVEM_Eskalation", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {391, "MO_HVEM_MaxLeistung", 55, 9, 1, 0, 50.0f, 0.0f, 0.0f, 25450.0f, "Unit_Watt", -1},
+  {401604629, "Airbag_01_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604629, "Airbag_01_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604629, "AB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604636, "SAK_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604636, "SAK_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604636, "SAK_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604726, "Motor_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604726, "Motor_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604726, "MO_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604727, "Getriebe_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604727, "Getriebe_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604727, "GE_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604731, "Hybrid_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604731, "Hybrid_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604731, "BMS_HYB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604732, "EMotor_KompSchutz", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {401604732, "EMotor_Nachlauftyp", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {401604732, "EM_HYB_KD_Fehler", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984848, "NM_Gateway_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984848, "NM_Gateway_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984848, "NM_Gateway_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_ACAN_Aktivitaet", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_FCAN_Aktivitaet", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_KCAN_Aktivitaet", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_ICAN_Aktivitaet", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_DiagCAN_Aktivitaet", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_ECAN_Aktivitaet", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_Energie_LIN_Aktivi000", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_Bedien_LIN_Aktivitaet", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_EM_Aktivitaet", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NL_EM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NL_Shutdown", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NL_Spg_Messung", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_NL_Wakeup_Monitor", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984848, "NM_Gateway_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984853, "NM_Airbag_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984853, "NM_Airbag_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984853, "NM_Airbag_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984853, "NM_Airbag_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984853, "NM_Airbag_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984853, "NM_Airbag_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984853, "NM_Airbag_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984853, "NM_Airbag_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984950, "NM_MO_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984950, "NM_MO_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_HV_Abschaltung", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_EKP_Vorlauf", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NM_aktiv_STH_Betrieb", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NL_Kuehlerluefter", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NL_Diagnose", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NL_WFS", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NL_EEPROM", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_NL_Sonstige", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984950, "NM_MO_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984951, "NM_Getriebe_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_v_gr_0", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_Pos_Erk", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NM_aktiv_Umg_Bed", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984951, "NM_Getriebe_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984955, "NM_Hybrid_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_NL_Luefter", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984955, "NM_Hybrid_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_SNI", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984956, "NM_EMotor_01_NM_State", 16, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
+  {452984956, "NM_EMotor_01_Car_Wakeup", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_Wakeup", 24, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {452984956, "NM_EMotor_01_NM_aktiv_KL15", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_NM_aktiv_Diagnose", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_NM_aktiv_Tmin", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_NL_Daten_EEPROM", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {452984956, "NM_EMotor_01_UDS_CC", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+};
+
+const uint16_t k_vw_mqb_chassis_signal_count = (uint16_t)(sizeof(k_vw_mqb_chassis_signals) / sizeof(k_vw_mqb_chassis_signals[0]));
+
+constexpr dbc_frame_index_t k_vw_mqb_chassis_frames[] = {
+  {64, 0, 30, -1},
+  {65, 30, 3, -1},
+  {134, 33, 10, -1},
+  {157, 43, 11, -1},
+  {158, 54, 16, -1},
+  {159, 70, 12, -1},
+  {167, 82, 10, -1},
+  {168, 92, 8, -1},
+  {173, 100, 15, -1},
+  {174, 115, 12, -1},
+  {175, 127, 8, -1},
+  {178, 135, 4, -1},
+  {253, 139, 27, -1},
+  {257, 166, 16, -1},
+  {260, 182, 17, -1},
+  {262, 199, 35, -1},
+  {263, 234, 8, -1},
+  {264, 242, 2, -1},
+  {278, 244, 14, -1},
+  {279, 258, 23, -1},
+  {286, 281, 13, -1},
+  {288, 294, 15, -1},
+  {289, 309, 15, -1},
+  {290, 324, 17, -1},
+  {294, 341, 12, -1},
+  {296, 353, 6, -1},
+  {299, 359, 16, -1},
+  {301, 375, 7, -1},
+  {302, 382, 11, -1},
+  {304, 393, 13, -1},
+  {346, 406, 12, -1},
+  {391, 418, 15, -1},
+  {418, 433, 2, -1},
+  {427, 435, 41, -1},
+  {679, 476, 12, -1},
+  {681, 488, 6, -1},
+  {695, 494, 2, -1},
+  {779, 496, 28, -1},
+  {780, 524, 18, -1},
+  {783, 542, 26, -1},
+  {798, 568, 12, -1},
+  {804, 580, 14, -1},
+  {810, 594, 15, -1},
+  {811, 609, 3, -1},
+  {812, 612, 9, -1},
+  {869, 621, 11, -1},
+  {870, 632, 8, -1},
+  {901, 640, 16, -1},
+  {913, 656, 10, -1},
+  {914, 666, 18, -1},
+  {916, 684, 9, -1},
+  {919, 693, 20, -1},
+  {945, 713, 9, -1},
+  {949, 722, 17, -1},
+  {958, 739, 31, -1},
+  {960, 770, 6, -1},
+  {967, 776, 33, -1},
+  {968, 809, 12, -1},
+  {981, 821, 27, -1},
+  {982, 848, 37, -1},
+  {984, 885, 11, -1},
+  {987, 896, 31, -1},
+  {988, 927, 4, -1},
+  {989, 931, 18, -1},
+  {997, 949, 2, -1},
+  {1122, 951, 1, -1},
+  {1123, 952, 2, -1},
+  {1172, 954, 17, -1},
+  {1312, 971, 11, -1},
+  {1313, 982, 20, -1},
+  {1413, 1002, 23, -1},
+  {1437, 1025, 3, -1},
+  {1520, 1028, 5, -1},
+  {1528, 1033, 2, -1},
+  {1600, 1035, 18, -1},
+  {1601, 1053, 17, -1},
+  {1602, 1070, 6, -1},
+  {1603, 1076, 9, -1},
+  {1607, 1085, 12, -1},
+  {1625, 1097, 10, -1},
+  {1626, 1107, 26, -1},
+  {1628, 1133, 12, -1},
+  {1629, 1145, 25, -1},
+  {1630, 1170, 8, -1},
+  {1631, 1178, 8, -1},
+  {1633, 1186, 13, -1},
+  {1648, 1199, 7, -1},
+  {1714, 1206, 10, -1},
+  {1716, 1216, 22, 0},
+  {1719, 1238, 6, -1},
+  {1720, 1244, 10, -1},
+  {401604629, 1254, 3, -1},
+  {401604636, 1257, 3, -1},
+  {401604726, 1260, 3, -1},
+  {401604727, 1263, 3, -1},
+  {401604731, 1266, 3, -1},
+  {401604732, 1269, 3, -1},
+  {452984848, 1272, 21, -1},
+  {452984853, 1293, 8, -1},
+  {452984950, 1301, 16, -1},
+  {452984951, 1317, 12, -1},
+  {452984955, 1329, 10, -1},
+  {452984956, 1339, 9, -1},
+};
+
+const uint16_t k_vw_mqb_chassis_frame_count = (uint16_t)(sizeof(k_vw_mqb_chassis_frames) / sizeof(k_vw_mqb_chassis_frames[0]));
+
+static constexpr uint16_t k_name_hash_seeds[] = {
+  23, 73, 1, 4, 3, 22, 52, 8, 3, 1, 49, 23, 63, 60, 4, 81,
+  2, 66, 64, 3, 10, 2, 88, 4, 40, 102, 30, 1, 31, 11, 3, 6,
+  175, 130, 1, 110, 149, 75, 155, 92, 122, 85, 2, 3, 1, 45, 101, 17,
+  1, 2, 76, 103, 2, 3, 0, 61, 11, 185, 2, 0, 14, 12, 14, 31,
+  4, 415, 106, 13, 1, 27, 1, 90, 26, 0, 177, 742, 134, 6, 26, 58,
+  10, 55, 88, 2, 6, 20, 160, 14, 26, 5, 229, 26, 1, 57, 40, 71,
+  12, 27, 7, 52, 121, 1, 185, 123, 10, 64, 20, 55, 33, 7, 257, 147,
+  69, 13, 3, 148, 195, 2, 1, 7, 22, 131, 119, 2, 38, 83, 3, 82,
+  121, 4, 12, 12, 99, 30, 0, 126, 29, 39, 1, 172, 33, 12, 29, 9,
+  147, 149, 1, 149, 55, 38, 131, 15, 5, 6, 0, 17, 6, 99, 7, 39,
+  2, 74, 5, 1, 57, 3, 240, 27, 99, 39, 48, 40, 32, 160, 253, 8,
+  8, 30, 16, 0, 2, 5, 306, 186, 297, 75, 29, 7, 48, 65, 173, 1,
+  15, 19, 8, 70, 8, 296, 22, 155, 665, 249, 8, 1, 127, 52, 139, 155,
+  16, 20, 902, 7, 5, 15, 1, 42, 688, 281, 3, 285, 219, 244, 994, 3,
+  0, 207, 99, 158, 920, 0, 39, 9, 1017, 932, 404, 57, 90, 105, 1, 114,
+  148, 52, 477, 7, 99, 187, 140, 1, 496, 64, 20, 236, 640, 836, 0, 664,
+  600, 94, 35, 3, 1, 11, 183, 2, 33, 515, 43, 12, 24, 83, 2418, 1,
+  705, 217, 7, 10, 2, 108, 99, 1, 155, 120, 970, 273, 185, 21, 3, 245,
+  1566, 954, 374, 41, 0, 110, 134, 12, 431, 30, 764, 456, 617, 158, 53, 0,
+  275, 1, 0, 423, 456, 231, 376, 142, 1, 673, 2, 1892, 142, 989, 3, 6,
+  2, 3083, 2747, 77, 55, 1375, 78, 5376, 9, 17, 238, 1, 290, 36, 3370, 2530,
+  237,
+};
+
+static constexpr uint16_t k_name_hash_slots[] = {
+  511, 1050, 1327, 983, 1219, 1175, 240, 264, 448, 985, 8, 554, 676, 1344, 567, 701,
+  627, 690, 401, 1004, 568, 1109, 499, 524, 230, 427, 730, 303, 378, 561, 220, 1007,
+  2, 36, 1166, 1260, 459, 196, 585, 393, 680, 553, 740, 913, 575, 1240, 96, 921,
+  1173, 695, 238, 173, 86, 166, 334, 975, 1171, 279, 380, 1080, 735, 270, 1265, 66,
+  447, 831, 255, 347, 796, 732, 978, 286, 1042, 794, 386, 1111, 133, 600, 955, 1238,
+  984, 194, 904, 384, 907, 594, 500, 479, 490, 325, 777, 285, 890, 895, 510, 99,
+  707, 1118, 1292, 45, 369, 574, 1315, 487, 87, 1346, 475, 1048, 880, 212, 320, 1059,
+  1082, 685, 477, 968, 1043, 742, 1324, 1228, 306, 803, 307, 1231, 1159, 262, 1329, 981,
+  442, 98, 163, 100, 808, 1053, 659, 396, 953, 885, 371, 930, 596, 1306, 881, 1016,
+  523, 455, 140, 647, 1131, 1274, 1264, 532, 520, 754, 1046, 949, 1225, 1022, 1202, 793,
+  1137, 816, 1020, 833, 848, 864, 1146, 201, 290, 1079, 1226, 631, 1235, 1063, 120, 1014,
+  508, 1133, 674, 1149, 905, 925, 787, 1215, 124, 1101, 825, 879, 1237, 1126, 214, 108,
+  1194, 748, 613, 215, 1223, 362, 55, 1313, 115, 203, 18, 313, 959, 607, 23, 957,
+  1141, 630, 229, 167, 1031, 83, 30, 219, 963, 513, 372, 1338, 769, 761, 677, 991,
+  671, 982, 1201, 1114, 221, 24, 973, 711, 964, 143, 847, 1182, 859, 536, 1339, 1156,
+  1224, 297, 1083, 472, 1019, 638, 608, 207, 704, 1285, 1135, 1222, 589, 737, 800, 284,
+  105, 974, 277, 504, 276, 705, 423, 657, 407, 1074, 555, 355, 1148, 233, 429, 1220,
+  1163, 361, 1307, 868, 591, 438, 336, 559, 1336, 495, 132, 478, 961, 1178, 889, 636,
+  482, 515, 1015, 332, 54, 876, 376, 337, 435, 866, 137, 129, 533, 432, 1011, 125,
+  1217, 1326, 421, 210, 884, 902, 295, 663, 996, 1283, 1127, 786, 1188, 945, 606, 804,
+  888, 136, 445, 862, 694, 702, 354, 1192, 852, 94, 923, 1302, 237, 829, 364, 16,
+  529, 571, 234, 341, 224, 289, 461, 1269, 1186, 1174, 1157, 744, 995, 294, 150, 1051,
+  823, 195, 1181, 1200, 259, 404, 1321, 1218, 929, 773, 139, 1064, 79, 153, 795, 760,
+  298, 789, 549, 572, 809, 802, 665, 1251, 457, 542, 454, 517, 830, 399, 444, 1081,
+  112, 903, 188, 74, 954, 693, 451, 59, 69, 7, 565, 878, 577, 322, 13, 811,
+  375, 249, 333, 1196, 319, 826, 127, 1169, 950, 635, 1187, 47, 530, 484, 458, 729,
+  689, 892, 460, 162, 590, 977, 1089, 1066, 149, 966, 785, 1290, 368, 382, 1162, 241,
+  101, 807, 1208, 62, 181, 35, 39, 1155, 723, 468, 391, 431, 405, 941, 771, 104,
+  357, 331, 849, 512, 1122, 952, 937, 860, 41, 467, 476, 185, 755, 1266, 1193, 389,
+  558, 1154, 339, 1119, 675, 208, 655, 205, 1099, 910, 1267, 1239, 1065, 1009, 1341, 310,
+  68, 799, 649, 1277, 1280, 686, 1295, 473, 305, 874, 615, 441, 128, 433, 1029, 463,
+  871, 80, 113, 1199, 1289, 180, 1279, 430, 12, 299, 170, 887, 232, 1296, 772, 155,
+  90, 971, 1335, 1278, 626, 145, 1115, 292, 672, 1197, 1075, 465, 960, 497, 1242, 49,
+  1248, 851, 656, 527, 691, 593, 976, 296, 1232, 856, 891, 1337, 4, 507, 20, 917,
+  116, 344, 683, 282, 28, 622, 780, 564, 548, 770, 863, 3, 573, 44, 936, 1184,
+  159, 243, 850, 1128, 944, 827, 1177, 1256, 65, 1061, 40, 466, 70, 9, 588, 418,
+  187, 1255, 1183, 1287, 757, 893, 614, 156, 1096, 328, 1316, 1328, 1227, 387, 640, 1330,
+  1060, 502, 1317, 979, 563, 374, 664, 287, 872, 178, 471, 834, 398, 1325, 1164, 896,
+  920, 813, 1303, 1005, 1305, 972, 446, 845, 154, 749, 1281, 552, 1245, 126, 708, 516,
+  394, 78, 1116, 843, 1144, 652, 1214, 805, 1282, 308, 317, 1012, 1002, 899, 1165, 688,
+  836, 309, 595, 1234, 539, 158, 550, 758, 85, 783, 1275, 992, 641, 946, 89, 1332,
+  1129, 1003, 997, 818, 216, 1093, 644, 161, 412, 1095, 619, 358, 349, 650, 873, 169,
+  265, 182, 721, 906, 716, 1112, 1150, 483, 916, 293, 706, 603, 584, 714, 367, 697,
+  713, 763, 275, 211, 403, 765, 329, 1091, 269, 57, 1209, 933, 1270, 1045, 821, 107,
+  820, 109, 616, 330, 440, 544, 102, 416, 943, 867, 832, 521, 260, 92, 566, 812,
+  779, 22, 505, 666, 1334, 239, 1121, 390, 235, 58, 709, 1243, 717, 439, 67, 1203,
+  200, 37, 251, 1250, 625, 27, 926, 703, 736, 493, 278, 1088, 1170, 745, 909, 528,
+  1246, 1084, 618, 281, 130, 578, 1072, 1331, 360, 579, 15, 1304, 1035, 752, 498, 114,
+  366, 753, 951, 141, 599, 409, 750, 172, 969, 1058, 480, 699, 345, 397, 624, 1033,
+  633, 928, 1125, 875, 352, 727, 304, 14, 93, 1309, 1057, 1262, 1236, 449, 1001, 174,
+  901, 541, 6, 1100, 519, 464, 522, 934, 326, 639, 766, 110, 582, 359, 32, 38,
+  643, 363, 1069, 1030, 790, 547, 762, 176, 51, 679, 587, 824, 1284, 204, 25, 437,
+  134, 922, 1145, 1185, 377, 1310, 1273, 1288, 183, 1161, 828, 662, 1205, 1252, 1103, 335,
+  900, 634, 244, 611, 815, 395, 1190, 1216, 1229, 218, 506, 198, 202, 1244, 56, 669,
+  1113, 660, 1249, 1212, 1049, 147, 168, 414, 192, 453, 623, 1067, 886, 324, 628, 1340,
+  915, 877, 228, 76, 629, 1034, 965, 546, 1037, 106, 288, 609, 82, 543, 576, 252,
+  1018, 217, 1130, 410, 1276, 263, 556, 1076, 919, 142, 131, 71, 1041, 784, 776, 1271,
+  280, 1322, 1027, 1213, 422, 456, 782, 987, 226, 817, 53, 301, 531, 620, 388, 258,
+  857, 898, 291, 236, 733, 1047, 1025, 46, 710, 722, 509, 1301, 581, 254, 797, 323,
+  586, 1263, 165, 597, 157, 1210, 119, 191, 1008, 193, 1090, 400, 227, 1139, 605, 383,
+  1142, 1124, 1293, 734, 1298, 434, 267, 932, 1117, 486, 48, 385, 870, 1073, 1143, 604,
+  1333, 768, 1257, 1077, 209, 1104, 726, 419, 778, 1172, 602, 1108, 1013, 1056, 1040, 417,
+  152, 670, 1032, 164, 492, 470, 667, 489, 257, 718, 637, 406, 268, 1342, 1085, 272,
+  381, 146, 1198, 1167, 882, 300, 72, 1092, 184, 747, 31, 1140, 1299, 1254, 1345, 810,
+  5, 1180, 1086, 171, 956, 273, 225, 462, 1136, 538, 488, 481, 781, 551, 1207, 321,
+  1055, 1094, 610, 426, 645, 1023, 518, 17, 247, 73, 179, 75, 989, 724, 1160, 526,
+  980, 343, 562, 373, 858, 1017, 424, 469, 118, 452, 1021, 990, 743, 311, 612, 658,
+  1206, 88, 420, 632, 77, 814, 245, 148, 491, 450, 494, 673, 1258, 994, 1294, 746,
+  501, 854, 346, 496, 253, 1319, 1138, 1291, 869, 413, 26, 256, 351, 95, 1323, 617,
+  739, 189, 668, 924, 947, 993, 1211, 844, 764, 10, 534, 692, 242, 792, 738, 651,
+  751, 1272, 719, 1230, 1151, 1028, 197, 60, 274, 1024, 798, 353, 1097, 801, 138, 653,
+  841, 135, 206, 678, 1068, 111, 1176, 1132, 940, 1054, 144, 999, 340, 927, 514, 661,
+  1221, 1153, 1308, 1039, 231, 1253, 302, 648, 1123, 350, 931, 408, 1026, 151, 988, 998,
+  123, 1158, 21, 1311, 1098, 806, 43, 700, 621, 0, 681, 402, 213, 443, 696, 52,
+  759, 1038, 122, 436, 312, 967, 537, 1343, 19, 1189, 1036, 250, 545, 64, 11, 1195,
+  911, 819, 540, 1247, 1314, 731, 986, 855, 365, 84, 774, 788, 839, 728, 1107, 725,
+  1070, 835, 1000, 1300, 1062, 485, 1312, 684, 503, 970, 42, 175, 583, 935, 222, 91,
+  342, 81, 942, 840, 190, 525, 682, 1052, 177, 1044, 1297, 33, 962, 1102, 842, 1318,
+  838, 1006, 97, 853, 1106, 1268, 348, 767, 261, 1347, 117, 908, 370, 338, 223, 428,
+  199, 379, 34, 687, 1152, 601, 1147, 63, 1320, 1110, 61, 557, 318, 756, 1259, 592,
+  327, 938, 569, 160, 894, 1105, 715, 914, 720, 912, 654, 1, 646, 248, 560, 246,
+  50, 775, 865, 271, 425, 314, 1120, 411, 103, 1204, 791, 283, 958, 1010, 1071, 598,
+  837, 535, 897, 1087, 948, 1191, 580, 883, 846, 939, 570, 918, 316, 741, 1261, 822,
+  1134, 698, 121, 186, 1241, 712, 474, 1286, 1233, 1078, 29, 315, 266, 415, 392, 1168,
+  1179, 642, 861, 356,
 };
 
-const uint16_t k_vw_mqb_chassis_signal_count =
-  (uint16_t)(sizeof(k_vw_mqb_chassis_signals) / sizeof(k_vw_mqb_chassis_signals[0]));
+const dbc_name_hash_t k_vw_mqb_chassis_name_hash = {k_name_hash_seeds, 337, k_name_hash_slots, 1348};
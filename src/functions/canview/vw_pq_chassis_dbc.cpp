@@ -1,126 +1,105 @@
+// Generated by scripts/dbc_codegen.py from vw_pq.dbc; do not edit by hand.
 #include "functions/canview/vw_pq_chassis_dbc.h"
 
-const dbc_signal_t k_vw_pq_chassis_signals[] = {
-  {1488, "CAN_Stand_4_1_Drivetrain_Data_Main", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "CAN_Stand_4_1_Drivetrain_Data_Sub", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "CAN_Stand_4_1_Comfort_Data_Main", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "CAN_Stand_4_1_Comfort_Data_Sub", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "Reserved_SystemInfo_1_6", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Four_Door", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Right_Hand_Drive", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Vehicle_Index", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Vehicle_Generation", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "Vehicle_Derivative", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "Vehicle_Brand_2", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "Vehicle_Class", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1488, "InstallInfo_Valid", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "CAN_Infotainment_Installed", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "CAN_Infotainment_in_Diagnosis", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Sleep_CAN_Infotainment", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "CAN_Comfort_in_Diagnosis", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "Sleep_CAN_Comfort", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "CAN_Drivetrain_in_Diagnosis", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1488, "CAN_External_Enabled", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1408, "Intake_System", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
-  {1408, "Displacement", 56, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.7f, "l", 0},
-  {1408, "Slope_of_FillCurve", 56, 8, 1, 0, 0.001f, 0.0f, 0.0f, 0.255f, "l/mm", 1},
-  {1408, "Cylinder_Count", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "valves/cyl", 0},
-  {1408, "Evaluation_Factor_Soot_Index_Turbo", 50, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.3f, "", 1},
-  {1408, "Valve_Count", 49, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "valves/cyl", 0},
-  {1408, "Evaluation_Factor_Wear_Index", 44, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.3f, "", 1},
-  {1408, "Manufacturer_Code", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", 1},
-  {1408, "Engine_Power", 40, 9, 1, 0, 1.0f, 0.0f, 0.0f, 512.0f, "kW", 0},
-  {1408, "Max_Torque", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2550.0f, "Nm", 0},
-  {1408, "Normalized_Consumption", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2550.0f, "l/cyl", 1},
-  {1408, "Oil_Level_Threshold", 24, 8, 1, 0, 0.25f, 0.0f, 0.0f, 63.75f, "cm", 1},
-  {1408, "RPM_Max_Normalized", 24, 8, 1, 0, 100.0f, 0.0f, 0.0f, 25500.0f, "rpm", 0},
-  {1408, "Wear_Index", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
-  {1408, "Soot_Index", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
-  {1408, "Combustion_Type", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1408, "Reserved_Engine_Flexia_1", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1408, "Warm_Up_Cycle", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1408, "Driving_Cycle", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1408, "Counter_Engine_Flexia", 1, 3, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1408, "Multiplex_Switch_Engine_Flexia", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
-  {1416, "Oil_Temperature", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Reserved_Engine_7_3", 40, 16, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Boost_Pressure", 32, 8, 1, 0, 0.01f, 0.0f, 0.0f, 2.54f, "bar", -1},
-  {1416, "EngineRPM_Gradient_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "EngineRPM_Gradient", 24, 7, 1, 0, 1.0f, 0.0f, 0.0f, 126.0f, "rpm", -1},
-  {1416, "Altitude_Info_Engine_7", 16, 8, 1, 0, 0.00787f, 0.0f, 0.0f, 2.0f, "", -1},
-  {1416, "Terminal_DFM", 8, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
-  {1416, "PTC_Glow_Plugs_Disabled", 5, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Reserved_Engine_7_1", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Fault_Memory_Entry_Engine_7", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Status_Bit_Speed_Limiter", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Speed_Limiter_Activated", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1416, "Idle_Target_RPM_at_Max", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1160, "Counter_Engine_6", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1160, "Reserved_Engine_6_4", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1160, "OilTempProtection", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1160, "GRA_BrakeIntervention_Freigabe", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1160, "Reserved_Engine_6_3", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1160, "Feedback_Torque", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 100.0f, "", -1},
-  {1160, "GRA_TargetAcceleration", 32, 8, 1, 0, 0.024f, -3.984f, -3.984f, 2.112f, "m/s2", -1},
-  {1160, "AltitudeInfo__Engine_6_", 24, 8, 1, 0, 0.00787f, 0.0f, 0.0f, 2.0f, "", -1},
-  {1160, "ActualTorque_for_Transmission", 16, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {1160, "TargetTorque_for_Transmission", 8, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {1160, "Checksum_Engine_6", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1152, "MO5_Mp_Code", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -2},
-  {1152, "MO5_Max_Torque", 0, 6, 1, 0, 10.0f, 0.0f, 0.0f, 630.0f, "Nm", 0},
-  {1152, "MO5_RPM", 0, 6, 1, 0, 100.0f, 0.0f, 0.0f, 6300.0f, "rpm", 1},
-  {1152, "MO5_Engine_Type", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", 2},
-  {1152, "MO5_Exhaust_Type", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "MO5_Exhaust_Type_2", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "MO5_Exhaust_Type_3", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "OBD_Cold_Start_Denominator", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "OBD_Minimum_Trip", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "MO5_DPF_Regeneration", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
-  {1152, "MO5_Pre_Glow", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_E_Gas", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_OBD_2", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Hot_Idle", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_HVAC_Compressor", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Field_Cooling", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_AC_Clutch_Reduction", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Consumption", 16, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32767.0f, "????l", -1},
-  {1152, "MO5_Overrun_Consumption", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Fan", 32, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
-  {1152, "MO5_High_Beam_Light", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Particle_Lamp", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Status_BKU", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Start_Control_Type", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_TDE_Lamp", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_TDE_Text", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_RPM_Damping", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Interlock", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Start", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Starter", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Cruise_Control_Main_Switch", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Torque", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Engine_Text_1", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Engine_Text_2", 53, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Engine_Text_3", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "MO5_Engine_Text_4", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1152, "CHECKSUM", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {896, "MO3_Pre_Glow", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Priority_RPM", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO_Switch_Start_Stop", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Winter_Program", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Status_Pedal", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Status_FPG", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -2},
-  {896, "MO3_Signal_FPG", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 1},
-  {896, "MO3_Status_Temperature", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Offset_Temperature", 8, 8, 1, 0, 0.75f, -48.0f, -48.0f, 142.5f, "degC", -1},
-  {896, "MO3_Pedal_Value", 16, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
-  {896, "MO3_Wheel_Torque_Request", 24, 12, 1, 0, 0.39f, 0.0f, 0.0f, 1596.66f, "%", -1},
-  {896, "MO3_Preload_Wheel_Torque", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_Release_Coasting", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO_Start_Stop_Stop_Preparation", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {896, "MO3_RPM_Influence", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.45f, "%", -1},
-  {896, "MO3_Desired_RPM", 48, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
-  {896, "MO3_Throttle_Characteristic", 56, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", 0},
-  {896, "MO3_Fuel_Pedal_Gradient", 56, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "%/s", 1},
+constexpr dbc_signal_t k_vw_pq_chassis_signals[] = {
+  {194, "LW1_Steering_Angle", 0, 15, 1, 0, 0.04375f, 0.0f, 0.0f, 1433.55625f, "deg", -1},
+  {194, "LW1_Steering_Angle_Sign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {194, "LW1_Steering_Rate", 16, 15, 1, 0, 0.04375f, 0.0f, 0.0f, 1433.55625f, "deg/s", -1},
+  {194, "LW1_Rate_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {194, "LW1_ID", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {194, "LW1_Init_Source", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {194, "LW1_Status", 41, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {194, "LW1_Status_KL30", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {194, "LW1_Counter", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {194, "LW1_Coding", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {194, "LW1_CRC", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {208, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {208, "LH3_Mirror_Base_Switch", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {208, "COUNTER", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {208, "LH3_Steering_Torque", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1023.0f, "", -1},
+  {208, "LH3_Steering_Torque_Sign", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {208, "LH3_Steering_Torque_Valid", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {208, "LH3_Status_DSR", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {208, "LH3_Steering_Assist_Torque", 32, 12, 1, 0, 0.15f, 0.0f, 0.0f, 615.0f, "", -1},
+  {208, "LH3_Steering_Assist_Torque_Sign", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {208, "LH3_Steering_Assist_Torque_Valid", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {208, "LH3_Steering_Type", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {416, "BR1_ASR_Request", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_MSR_Request", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -2},
+  {416, "BR1_ABS_Brake", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_EDS_Active", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_ESP_Active", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_ASR_Active", 5, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {416, "BR1_EBV_Active", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Lamp_ABS", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Lamp_ASR", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Lamp_Brake", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Light_Switch", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Status_Pressure_Threshold", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_MAD", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Status_MAD", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Diagnosis", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Brake_Booster_Active", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Wheel_Speed_kmh", 17, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.39f, "km/h", -1},
+  {416, "BR1_ASR_Torque_Slip", 32, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
+  {416, "BR1_ASR_Torque_Drive", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", 0},
+  {416, "BR1_MSR_Torque_Inverted", 40, 8, 1, 0, -0.39f, 99.45f, 0.0f, 99.06f, "%", 1},
+  {416, "BR1_MSR_Torque", 48, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
+  {416, "BR1_Counter", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {416, "BR1_ASR_ESP", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_ESP_ASR_Passive", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Status_ESP", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {416, "BR1_Substitute_Speed", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {424, "Checksum_Brake_6", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {424, "Counter_Brake_6", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {424, "Status_Brake_Pressure_Brake_6_Dynamic", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {424, "Reserved_Brake_6_1", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {424, "Brake_Pressure_Brake_6", 0, 10, 1, 0, 0.3255f, -40.0f, -40.0f, 293.0f, "bar", -1},
+  {428, "BR8_Checksum", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {428, "BR8_Counter", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {428, "BR8_Status_ACC_Request", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Decel_EPB_Active", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Status_Brake_Temp", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Status_Brake_Pressure", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Tolerance_Comp_RearLeft", 16, 8, 1, 0, 0.048828f, -6.201172f, -6.201172f, 6.152344f, "%", -1},
+  {428, "BR8_Tolerance_Comp_RearRight", 24, 8, 1, 0, 0.048828f, -6.201172f, -6.201172f, 6.152344f, "%", -1},
+  {428, "BR8_Actual_Acceleration", 32, 9, 1, 0, 0.02f, -7.22f, -7.22f, 2.98f, "m/s2", -1},
+  {428, "BR8_Status_HW_BLS", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_QB_LateralAcceleration", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_ESC_Mode", 43, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {428, "BR8_Active_BrakeSystem", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Vehicle_Braking", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Status_BrakeSystem", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_LongitudinalAcceleration", 48, 10, 1, 0, 0.03125f, -16.0f, -15.96875f, 15.9375f, "m/s2", -1},
+  {428, "BR8_Status_ADR_BR", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Quattro", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Status_DecelControl", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Status_BLS", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Decel_EPB", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {428, "BR8_Check_EPB", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {640, "Driver_Requested_Torque", 56, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {640, "Mechanical_Engine_Loss_Torque", 48, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {640, "Pedal_Value_or_Throttle_Plate", 40, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
+  {640, "Internal_Engine_Torque_without_External", 32, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {640, "Engine_RPM", 16, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16256.0f, "rpm", -1},
+  {640, "Internal_Engine_Torque", 8, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {640, "Torque_Values_Inaccurate", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Error_Status_Transmission_Torque", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Error_Status_Brake_Torque", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Timeout_Brake_Message", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Clutch_Switch", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Kickdown_Switch", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {640, "Pedal_Value_Inaccurate_Engine_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
+  {640, "Idle_Information", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {644, "MOB_Standby", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {644, "MOB_Enable", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {644, "MOB_StopRequest", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {644, "MOB_CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {644, "MOB_COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {644, "TSK_SpeedLimitation_Active", 15, 1, 0, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {644, "TSK_ax_Transmission_01", 40, 8, 1, 0, 0.048f, 0.0f, 0.0f, 255.0f, "m/s2", -1},
+  {644, "MOB_BrakeControl", 16, 11, 1, 0, 0.048852f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {644, "MOB_BrakeTorque", 27, 13, 1, 0, 4.0f, 0.0f, 0.0f, 32760.0f, "Nm", -1},
   {648, "MO2_Mp_Code", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -2},
   {648, "MO2_Transmission_Code", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", 2},
   {648, "MO2_Max_Torque", 0, 6, 1, 0, 10.0f, 0.0f, 0.0f, 630.0f, "Nm", 3},
@@ -143,93 +122,27 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {648, "MO2_Idle_Target_RPM", 40, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "rpm", -1},
   {648, "MO2_Torque_Limitation", 48, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
   {648, "MO2_Torque_Reserve", 56, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
-  {640, "Driver_Requested_Torque", 56, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {640, "Mechanical_Engine_Loss_Torque", 48, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {640, "Pedal_Value_or_Throttle_Plate", 40, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
-  {640, "Internal_Engine_Torque_without_External", 32, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {640, "Engine_RPM", 16, 16, 1, 0, 0.25f, 0.0f, 0.0f, 16256.0f, "rpm", -1},
-  {640, "Internal_Engine_Torque", 8, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
-  {640, "Torque_Values_Inaccurate", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Error_Status_Transmission_Torque", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Error_Status_Brake_Torque", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Timeout_Brake_Message", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Clutch_Switch", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Kickdown_Switch", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {640, "Pedal_Value_Inaccurate_Engine_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
-  {640, "Idle_Information", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {194, "LW1_Steering_Angle", 0, 15, 1, 0, 0.04375f, 0.0f, 0.0f, 1433.55625f, "deg", -1},
-  {194, "LW1_Steering_Angle_Sign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {194, "LW1_Steering_Rate", 16, 15, 1, 0, 0.04375f, 0.0f, 0.0f, 1433.55625f, "deg/s", -1},
-  {194, "LW1_Rate_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {194, "LW1_ID", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {194, "LW1_Init_Source", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {194, "LW1_Status", 41, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {194, "LW1_Status_KL30", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {194, "LW1_Counter", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {194, "LW1_Coding", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {194, "LW1_CRC", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {976, "LH1_Load_Info", 0, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "A", -1},
-  {976, "LH1_Error_Load_Info", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Safety_Lamp", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Error_Lamp", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Text_Bits", 10, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {976, "LH1_Acoustic_Signal", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Sleep_Indicator", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Error_Entry", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_EPS_Diagnostic_Mode", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_ECU_Temp_Limit_Reached", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Cooling", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Hybrid_Mode", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Undervoltage", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Overvoltage", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Overtemperature", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Sensor", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_CAN_SS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_ECU", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Engine", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_NL_Power_Density", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {976, "LH1_Power", 32, 8, 1, 0, 0.5f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {976, "LH1_ECU_Temperature", 40, 8, 1, 0, 1.0f, -70.0f, -70.0f, 185.0f, "degC", -1},
-  {1312, "Reserved_Cluster_3_2", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1312, "Odometer", 40, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1000000.0f, "km", -1},
-  {1312, "ErrorStatus_StandTime", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1312, "StandTime", 24, 15, 1, 0, 4.0f, 0.0f, 0.0f, 131068.0f, "s", -1},
-  {1312, "Reserved_Cluster_3_1", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1312, "Key_Info", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1312, "Cluster_Multiplex_Code", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
-  {1312, "Cluster_InstallList_Level_Control", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_Multiplex_Brand", 11, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
-  {1312, "Cluster_InstallList_Power_Steering", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_Diesel_Pump", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_Steering_Angle", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_Multiplex_Model_Series", 8, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
-  {1312, "Cluster_Multiplex_Country_Variant", 8, 6, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
-  {1312, "Cluster_InstallList_AWD", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_Onboard_Power", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_ACC", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_Airbag", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_Multiplex_Generation", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
-  {1312, "Cluster_InstallList_HVAC", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_ABS", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_InstallList_Engine", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
-  {1312, "Cluster_Multiplex_Derivative", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
-  {1312, "Cluster_Multiplex_Language_Variant", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
-  {1312, "Cluster_Multiplex_Tire_Circumference", 0, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "mm", 2},
-  {1056, "Reserved_Cluster_2_2", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "ErrorStatus_Terminal_58s", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "Terminal_58s_Cluster_2", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {1056, "ErrorStatus_Terminal_58d", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "Terminal_58d_Cluster_2", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {1056, "Coolant_Middle_Temperature_4_1_Cluster_2", 32, 8, 1, 0, 0.75f, -48.0f, -48.0f, 142.5f, "C", -1},
-  {1056, "Oil_Temperature_4_1", 24, 8, 1, 0, 1.0f, -60.0f, -60.0f, 194.0f, "C", -1},
-  {1056, "Outside_Temperature_unfiltered_4_1", 16, 8, 1, 0, 0.5f, -50.0f, -50.0f, 77.0f, "C", -1},
-  {1056, "Ambient_Temperature_filtered", 8, 8, 1, 0, 0.5f, -50.0f, -50.0f, 77.0f, "C", -1},
-  {1056, "Fault_Memory_Entry_Cluster", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "Reserved_Cluster_2_1", 4, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "Trailer_Detected", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "ErrorStatus_Coolant_Middle_Temperature_4_1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "ErrorStatus_Oil_Temperature_4_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1056, "ErrorStatus_Outside_Temperature_4_1", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {672, "Reserved_Brake_4_1", 17, 7, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {672, "Unit_Clutch_Stiffness", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {672, "ABS_Setpoint_Rear_Clutch", 8, 8, 1, 0, 0.7874f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {672, "ABS_Setpoint_Center_Clutch", 0, 8, 1, 0, 3.0f, -381.0f, -381.0f, 378.0f, "Nm/min", -1},
+  {704, "Rear_Clutch_Stiffness_Actual", 32, 8, 1, 0, 0.7874f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {704, "Fault_Memory_Entry_AWD_1", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Reserved_AWD_1_1", 26, 5, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Shift_Pre_Warning", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Shift_Active_AWD_1", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Gear_Info_PNG", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "PNG_Display_Blinking", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "PNG_Status_4_1", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Center_Clutch_Stiffness_Actual", 8, 8, 1, 0, 3.0f, -381.0f, -381.0f, 378.0f, "Nm/min", -1},
+  {704, "Unit_of_Clutch_Stiffness", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Speed_Limiter", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "AWD_Warning_Lamp", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Emergency_Mode", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Clutch_Fully_Open", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Error_Status_Clutch_Stiffness", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "Overtemperature_Protection_AWD_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {704, "AWD_Clutch_Error", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {800, "Reserved_Cluster_1_3", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {800, "Indicated_Speed", 46, 10, 1, 0, 0.32f, 0.0f, 0.0f, 325.0f, "km/h", -1},
   {800, "Turn_Signal_Right_4_1", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
@@ -254,6 +167,24 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {800, "Oil_Pressure", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {800, "ErrorStatus_Fuel_Tank", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {800, "Driver_Door_4_1", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {896, "MO3_Pre_Glow", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Priority_RPM", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO_Switch_Start_Stop", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Winter_Program", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Status_Pedal", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Status_FPG", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -2},
+  {896, "MO3_Signal_FPG", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 1},
+  {896, "MO3_Status_Temperature", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Offset_Temperature", 8, 8, 1, 0, 0.75f, -48.0f, -48.0f, 142.5f, "degC", -1},
+  {896, "MO3_Pedal_Value", 16, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
+  {896, "MO3_Wheel_Torque_Request", 24, 12, 1, 0, 0.39f, 0.0f, 0.0f, 1596.66f, "%", -1},
+  {896, "MO3_Preload_Wheel_Torque", 36, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_Release_Coasting", 37, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO_Start_Stop_Stop_Preparation", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {896, "MO3_RPM_Influence", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.45f, "%", -1},
+  {896, "MO3_Desired_RPM", 48, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
+  {896, "MO3_Throttle_Characteristic", 56, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", 0},
+  {896, "MO3_Fuel_Pedal_Gradient", 56, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "%/s", 1},
   {906, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {906, "GRA_Main_Switch_Old", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {906, "GRA_Cancel", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -268,59 +199,12 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {906, "GRA_Transmitter", 18, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {906, "COUNTER", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {906, "GRA_Tip_Down", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {906, "GRA_Tip_Up", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {906, "GRA_Time_Gap", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {906, "GRA_Status_Limiter", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {906, "GRA_Type_Main_Switch_Old", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {906, "GRA_Sport_Switch", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {906, "GRA_Error_Tip", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1352, "Test_Parameter_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1352, "Test_Parameter_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {1352, "Shifter_Illumination", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1352, "Reserved_Transmission_4_1", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1352, "Test_Enable_Flag", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1352, "Parking_Brake_Reminder_Lamp", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1352, "Shift_Lock_Transmission_4", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Selected_Gear", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Gear_Display_Cluster_Transmission_Va", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1344, "Error_Lamp_for_Clutch_at_Front_Left", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Request_Creep_Adaptation", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "ECO_Display_4_1", 53, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Shift_Lock_Lamp", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Suppress_Warnings", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Gong", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Starter_Is_Actuated", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Upshift_Lamp", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Synchronization_Time", 40, 8, 1, 0, 20.0f, 0.0f, 0.0f, 5080.0f, "ms", -1},
-  {1344, "Inverted_Synchronization_Request", 32, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
-  {1344, "Synchronization_Desired_RPM", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
-  {1344, "Gradient_Limit", 16, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Nm/s", -1},
-  {1344, "Idle_Target_RPM_Transmission", 8, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "rpm", -1},
-  {1344, "Counter_Transmission_2", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1344, "Rev_Match_Flag", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Ecomatic_4_1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "Fuel_Cutoff_Assist", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1344, "LFR_Adaptation_Enable_Flag", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1088, "GE1_Shift", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Status_Protection", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_HVAC_Compressor", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_WK", 3, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1088, "GE1_Start_Stop_Info", 5, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1088, "GE1_EGS_Request", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Target_Gear", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1088, "GE1_Selector_Position", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1088, "GE1_Engine_Speed_Crank", 16, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.4f, "", -1},
-  {1088, "GE1_Target_Torque", 24, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
-  {1088, "GE1_Driving_Resistance", 32, 8, 1, 0, 0.249f, -31.623f, -31.623f, 31.623f, "", -1},
-  {1088, "GE1_Emergency_Mode", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1088, "GE1_Cooling", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1088, "GE1_Status_OBD", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Launch_Control", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Info_Bit", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Sleep_Indicator", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "COUNTER", 51, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1088, "GE1_Error_Entry", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1088, "GE1_Torque_Loss", 56, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
+  {906, "GRA_Tip_Up", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {906, "GRA_Time_Gap", 26, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {906, "GRA_Status_Limiter", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {906, "GRA_Type_Main_Switch_Old", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {906, "GRA_Sport_Switch", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {906, "GRA_Error_Tip", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {912, "GK1_Status_Tire_Pressure_Warning", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {912, "GK1_Status_Trailer", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {912, "GK1_Status_Light_1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -376,6 +260,261 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {912, "GK1_Trailer_Control_Lamp", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {912, "LDS_Position_AFL", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {912, "GK1_Seat_Heater_Additional_Function", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_LSM", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_LightSensor", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_Light1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_VSG", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_Key", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_Profile", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_Climate2", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_BSG4", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Status_Kessy_4", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "BS4_Sliding_LightValue_Request", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "BS4_SlidingLight_HighBeam_Request", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_TurnSignal_Left_Control", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_TurnSignal_Right_Control", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_LightSensor_CommError", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_LightSensor_Defective", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Brightness", 16, 3, 1, 0, 714.286f, 0.0f, 0.0f, 5000.002f, "lux", -1},
+  {914, "GK2_ConvertibleTop_Closing", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_ConvertibleTop_Unlocked", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_ConvertibleTop_Open_Locked", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_ConvertibleTop_Request", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_ConvertibleTop_Cover_Open", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Key", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "GK2_Hardtop", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_AFL_Switch", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_SubFunction_Lock", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_EM_LIN_Invalid", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {914, "GK2_Profile", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {914, "GK2_Terminal_StartStop_Info", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {914, "GK2_BSG_StartStop_Info", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {914, "GK2_BEM_Generator_Power", 40, 8, 1, 0, 50.0f, 0.0f, 0.0f, 12700.0f, "W", -1},
+  {914, "GK2_BEM_Shutdown_Levels", 48, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {914, "GK2_BEM_DFM", 51, 5, 1, 0, 3.225f, 0.025f, 0.025f, 100.0f, "%", -1},
+  {914, "GK2_Kessy_StartStop_Info", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {914, "GK2_BEM_StartStop_Info", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {928, "B10_Checksum", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {928, "B10_Counter", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {928, "B10_QB_DistancePulse_FrontLeft", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_DistancePulse_FrontRight", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_DistancePulse_RearLeft", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_DistancePulse_RearRight", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_DistancePulse_FrontLeft", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {928, "B10_DistancePulse_FrontRight", 26, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {928, "B10_DistancePulse_RearLeft", 36, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {928, "B10_DistancePulse_RearRight", 46, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
+  {928, "B10_QB_Direction_FrontLeft", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_Direction_FrontRight", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_Direction_RearLeft", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_QB_Direction_RearRight", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_Direction_FrontLeft", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_Direction_FrontRight", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_Direction_RearLeft", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {928, "B10_Direction_RearRight", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Load_Info", 0, 7, 1, 0, 1.0f, 0.0f, 0.0f, 127.0f, "A", -1},
+  {976, "LH1_Error_Load_Info", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Safety_Lamp", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Error_Lamp", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Text_Bits", 10, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {976, "LH1_Acoustic_Signal", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Sleep_Indicator", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Error_Entry", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_EPS_Diagnostic_Mode", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_ECU_Temp_Limit_Reached", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Cooling", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Hybrid_Mode", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Undervoltage", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Overvoltage", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Overtemperature", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Sensor", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_CAN_SS", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_ECU", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Engine", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_NL_Power_Density", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {976, "LH1_Power", 32, 8, 1, 0, 0.5f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {976, "LH1_ECU_Temperature", 40, 8, 1, 0, 1.0f, -70.0f, -70.0f, 185.0f, "degC", -1},
+  {978, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {978, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {978, "LH2_StraightAhead", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {978, "LH2_Status_Charisma", 13, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
+  {978, "LH2_Status_HCA", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {978, "LH2_Output_LW1", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {978, "LH2_Output_LW1_Valid", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {978, "LH2_Status_EPS_PLA", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {978, "LH2_ActiveSteeringIntervention", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {978, "LH2_PLA_Error", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {978, "LH2_PLA_Abort", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1056, "Reserved_Cluster_2_2", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "ErrorStatus_Terminal_58s", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "Terminal_58s_Cluster_2", 48, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {1056, "ErrorStatus_Terminal_58d", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "Terminal_58d_Cluster_2", 40, 7, 1, 0, 1.0f, 0.0f, 0.0f, 100.0f, "%", -1},
+  {1056, "Coolant_Middle_Temperature_4_1_Cluster_2", 32, 8, 1, 0, 0.75f, -48.0f, -48.0f, 142.5f, "C", -1},
+  {1056, "Oil_Temperature_4_1", 24, 8, 1, 0, 1.0f, -60.0f, -60.0f, 194.0f, "C", -1},
+  {1056, "Outside_Temperature_unfiltered_4_1", 16, 8, 1, 0, 0.5f, -50.0f, -50.0f, 77.0f, "C", -1},
+  {1056, "Ambient_Temperature_filtered", 8, 8, 1, 0, 0.5f, -50.0f, -50.0f, 77.0f, "C", -1},
+  {1056, "Fault_Memory_Entry_Cluster", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "Reserved_Cluster_2_1", 4, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "Trailer_Detected", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "ErrorStatus_Coolant_Middle_Temperature_4_1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "ErrorStatus_Oil_Temperature_4_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1056, "ErrorStatus_Outside_Temperature_4_1", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1088, "GE1_Shift", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Status_Protection", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_HVAC_Compressor", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_WK", 3, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1088, "GE1_Start_Stop_Info", 5, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1088, "GE1_EGS_Request", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Target_Gear", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1088, "GE1_Selector_Position", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1088, "GE1_Engine_Speed_Crank", 16, 8, 1, 0, 0.1f, 0.0f, 0.0f, 25.4f, "", -1},
+  {1088, "GE1_Target_Torque", 24, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
+  {1088, "GE1_Driving_Resistance", 32, 8, 1, 0, 0.249f, -31.623f, -31.623f, 31.623f, "", -1},
+  {1088, "GE1_Emergency_Mode", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1088, "GE1_Cooling", 44, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1088, "GE1_Status_OBD", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Launch_Control", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Info_Bit", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Sleep_Indicator", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "COUNTER", 51, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1088, "GE1_Error_Entry", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1088, "GE1_Torque_Loss", 56, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
+  {1152, "MO5_Mp_Code", 6, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -2},
+  {1152, "MO5_Max_Torque", 0, 6, 1, 0, 10.0f, 0.0f, 0.0f, 630.0f, "Nm", 0},
+  {1152, "MO5_RPM", 0, 6, 1, 0, 100.0f, 0.0f, 0.0f, 6300.0f, "rpm", 1},
+  {1152, "MO5_Engine_Type", 0, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", 2},
+  {1152, "MO5_Exhaust_Type", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "MO5_Exhaust_Type_2", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "MO5_Exhaust_Type_3", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "OBD_Cold_Start_Denominator", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "OBD_Minimum_Trip", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "MO5_DPF_Regeneration", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", 3},
+  {1152, "MO5_Pre_Glow", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_E_Gas", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_OBD_2", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Hot_Idle", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_HVAC_Compressor", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Field_Cooling", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_AC_Clutch_Reduction", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Consumption", 16, 15, 1, 0, 1.0f, 0.0f, 0.0f, 32767.0f, "????l", -1},
+  {1152, "MO5_Overrun_Consumption", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Fan", 32, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
+  {1152, "MO5_High_Beam_Light", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Particle_Lamp", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Status_BKU", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Start_Control_Type", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_TDE_Lamp", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_TDE_Text", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_RPM_Damping", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Interlock", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Start", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Starter", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Cruise_Control_Main_Switch", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Torque", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Engine_Text_1", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Engine_Text_2", 53, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Engine_Text_3", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "MO5_Engine_Text_4", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1152, "CHECKSUM", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1160, "Counter_Engine_6", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1160, "Reserved_Engine_6_4", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1160, "OilTempProtection", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1160, "GRA_BrakeIntervention_Freigabe", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1160, "Reserved_Engine_6_3", 48, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1160, "Feedback_Torque", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 100.0f, "", -1},
+  {1160, "GRA_TargetAcceleration", 32, 8, 1, 0, 0.024f, -3.984f, -3.984f, 2.112f, "m/s2", -1},
+  {1160, "AltitudeInfo__Engine_6_", 24, 8, 1, 0, 0.00787f, 0.0f, 0.0f, 2.0f, "", -1},
+  {1160, "ActualTorque_for_Transmission", 16, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {1160, "TargetTorque_for_Transmission", 8, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.0f, "MDI", -1},
+  {1160, "Checksum_Engine_6", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1184, "Wheel_Speed_Rear_Right_4_1", 49, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
+  {1184, "Reserved_Brake_3_4", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1184, "Wheel_Speed_Rear_Left_4_1", 33, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
+  {1184, "Reserved_Brake_3_3", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1184, "Wheel_Speed_Front_Right_4_1", 17, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
+  {1184, "Reserved_Brake_3_2", 16, 1, 1, 0, 0.01f, 0.0f, 0.0f, 325.0f, "km/h", -1},
+  {1184, "Wheel_Speed_Front_Left_4_1", 1, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
+  {1184, "Reserved_Brake_3_1", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1192, "CHECKSUM", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1192, "COUNTER", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1192, "BR5_ECD_Lamp", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1192, "BR5_Reverse_Torque_Conversion", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Trailer_Status", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "ESP_Rolling_Mode_Deactivate", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Pressure_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Status_Pressure", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Pressure_Valid", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Vehicle_Standstill", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Brake_Pressure", 16, 12, 1, 0, 0.1f, 0.0f, 0.0f, 250.0f, "bar", -1},
+  {1192, "BR5_Sign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Status_Yaw_Rate", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Yaw_Rate", 0, 14, 1, 0, 0.01f, 0.0f, 0.0f, 100.0f, "deg/s", -1},
+  {1192, "BR5_ANB_CM_Reverse_Torque_Conversion", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_HDC_Ready", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "ESP_Status_Fallback_eBKV", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "ESP_Request_EPB", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
+  {1192, "ESP_AutoHold_Active", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "ESP_AutoHold_Standby", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Trailer_Active", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Front_Monitor", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Brake_Light", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Emergency_Braking", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_Driver_Presses_ZBR_Threshold", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_AWV2_Brake_Jerk", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1192, "BR5_AWV2_Error", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1312, "Reserved_Cluster_3_2", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1312, "Odometer", 40, 20, 1, 0, 1.0f, 0.0f, 0.0f, 1000000.0f, "km", -1},
+  {1312, "ErrorStatus_StandTime", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1312, "StandTime", 24, 15, 1, 0, 4.0f, 0.0f, 0.0f, 131068.0f, "s", -1},
+  {1312, "Reserved_Cluster_3_1", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1312, "Key_Info", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1312, "Cluster_Multiplex_Code", 14, 2, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
+  {1312, "Cluster_InstallList_Level_Control", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_Multiplex_Brand", 11, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
+  {1312, "Cluster_InstallList_Power_Steering", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_Diesel_Pump", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_Steering_Angle", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_Multiplex_Model_Series", 8, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
+  {1312, "Cluster_Multiplex_Country_Variant", 8, 6, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
+  {1312, "Cluster_InstallList_AWD", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_Onboard_Power", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_ACC", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_Airbag", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_Multiplex_Generation", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
+  {1312, "Cluster_InstallList_HVAC", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_ABS", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_InstallList_Engine", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 3},
+  {1312, "Cluster_Multiplex_Derivative", 0, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 1},
+  {1312, "Cluster_Multiplex_Language_Variant", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
+  {1312, "Cluster_Multiplex_Tire_Circumference", 0, 12, 1, 0, 1.0f, 0.0f, 0.0f, 4095.0f, "mm", 2},
+  {1344, "Selected_Gear", 60, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Gear_Display_Cluster_Transmission_Va", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1344, "Error_Lamp_for_Clutch_at_Front_Left", 55, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Request_Creep_Adaptation", 54, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "ECO_Display_4_1", 53, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Shift_Lock_Lamp", 52, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Suppress_Warnings", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Gong", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Starter_Is_Actuated", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Upshift_Lamp", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Synchronization_Time", 40, 8, 1, 0, 20.0f, 0.0f, 0.0f, 5080.0f, "ms", -1},
+  {1344, "Inverted_Synchronization_Request", 32, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
+  {1344, "Synchronization_Desired_RPM", 24, 8, 1, 0, 25.0f, 0.0f, 0.0f, 6350.0f, "rpm", -1},
+  {1344, "Gradient_Limit", 16, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "Nm/s", -1},
+  {1344, "Idle_Target_RPM_Transmission", 8, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2540.0f, "rpm", -1},
+  {1344, "Counter_Transmission_2", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1344, "Rev_Match_Flag", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Ecomatic_4_1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "Fuel_Cutoff_Assist", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1344, "LFR_Adaptation_Enable_Flag", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1352, "Test_Parameter_2", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1352, "Test_Parameter_1", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
+  {1352, "Shifter_Illumination", 4, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1352, "Reserved_Transmission_4_1", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1352, "Test_Enable_Flag", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1352, "Parking_Brake_Reminder_Lamp", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1352, "Shift_Lock_Transmission_4", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1392, "HVAC_System_Disable", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1392, "Seat_Ventilation_Disable", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1392, "Washer_Heater_Disable", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
@@ -397,50 +536,40 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {1392, "Ignition_Switch_Terminal_X", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1392, "Ignition_Switch_Terminal_15", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1392, "Ignition_Switch_Terminal_S", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {424, "Checksum_Brake_6", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {424, "Counter_Brake_6", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {424, "Status_Brake_Pressure_Brake_6_Dynamic", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {424, "Reserved_Brake_6_1", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {424, "Brake_Pressure_Brake_6", 0, 10, 1, 0, 0.3255f, -40.0f, -40.0f, 293.0f, "bar", -1},
-  {1192, "CHECKSUM", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1192, "COUNTER", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {1192, "BR5_ECD_Lamp", 51, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1192, "BR5_Reverse_Torque_Conversion", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Trailer_Status", 40, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "ESP_Rolling_Mode_Deactivate", 34, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Pressure_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Status_Pressure", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Pressure_Valid", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Vehicle_Standstill", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Brake_Pressure", 16, 12, 1, 0, 0.1f, 0.0f, 0.0f, 250.0f, "bar", -1},
-  {1192, "BR5_Sign", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Status_Yaw_Rate", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Yaw_Rate", 0, 14, 1, 0, 0.01f, 0.0f, 0.0f, 100.0f, "deg/s", -1},
-  {1192, "BR5_ANB_CM_Reverse_Torque_Conversion", 49, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_HDC_Ready", 50, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "ESP_Status_Fallback_eBKV", 35, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "ESP_Request_EPB", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {1192, "ESP_AutoHold_Active", 38, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "ESP_AutoHold_Standby", 39, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Trailer_Active", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Front_Monitor", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Brake_Light", 43, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Emergency_Braking", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_Driver_Presses_ZBR_Threshold", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_AWV2_Brake_Jerk", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {1192, "BR5_AWV2_Error", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {672, "Reserved_Brake_4_1", 17, 7, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {672, "Unit_Clutch_Stiffness", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {672, "ABS_Setpoint_Rear_Clutch", 8, 8, 1, 0, 0.7874f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {672, "ABS_Setpoint_Center_Clutch", 0, 8, 1, 0, 3.0f, -381.0f, -381.0f, 378.0f, "Nm/min", -1},
-  {1184, "Wheel_Speed_Rear_Right_4_1", 49, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
-  {1184, "Reserved_Brake_3_4", 48, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1184, "Wheel_Speed_Rear_Left_4_1", 33, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
-  {1184, "Reserved_Brake_3_3", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {1184, "Wheel_Speed_Front_Right_4_1", 17, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
-  {1184, "Reserved_Brake_3_2", 16, 1, 1, 0, 0.01f, 0.0f, 0.0f, 325.0f, "km/h", -1},
-  {1184, "Wheel_Speed_Front_Left_4_1", 1, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.0f, "km/h", -1},
-  {1184, "Reserved_Brake_3_1", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1408, "Intake_System", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", 0},
+  {1408, "Displacement", 56, 7, 1, 0, 0.1f, 0.0f, 0.0f, 12.7f, "l", 0},
+  {1408, "Slope_of_FillCurve", 56, 8, 1, 0, 0.001f, 0.0f, 0.0f, 0.255f, "l/mm", 1},
+  {1408, "Cylinder_Count", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "valves/cyl", 0},
+  {1408, "Evaluation_Factor_Soot_Index_Turbo", 50, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.3f, "", 1},
+  {1408, "Valve_Count", 49, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "valves/cyl", 0},
+  {1408, "Evaluation_Factor_Wear_Index", 44, 6, 1, 0, 0.1f, 0.0f, 0.0f, 6.3f, "", 1},
+  {1408, "Manufacturer_Code", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", 1},
+  {1408, "Engine_Power", 40, 9, 1, 0, 1.0f, 0.0f, 0.0f, 512.0f, "kW", 0},
+  {1408, "Max_Torque", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2550.0f, "Nm", 0},
+  {1408, "Normalized_Consumption", 32, 8, 1, 0, 10.0f, 0.0f, 0.0f, 2550.0f, "l/cyl", 1},
+  {1408, "Oil_Level_Threshold", 24, 8, 1, 0, 0.25f, 0.0f, 0.0f, 63.75f, "cm", 1},
+  {1408, "RPM_Max_Normalized", 24, 8, 1, 0, 100.0f, 0.0f, 0.0f, 25500.0f, "rpm", 0},
+  {1408, "Wear_Index", 16, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
+  {1408, "Soot_Index", 8, 8, 1, 0, 1.0f, 0.0f, 0.0f, 254.0f, "", -1},
+  {1408, "Combustion_Type", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1408, "Reserved_Engine_Flexia_1", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1408, "Warm_Up_Cycle", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1408, "Driving_Cycle", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1408, "Counter_Engine_Flexia", 1, 3, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1408, "Multiplex_Switch_Engine_Flexia", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
+  {1416, "Oil_Temperature", 56, 8, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Reserved_Engine_7_3", 40, 16, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Boost_Pressure", 32, 8, 1, 0, 0.01f, 0.0f, 0.0f, 2.54f, "bar", -1},
+  {1416, "EngineRPM_Gradient_Sign", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "EngineRPM_Gradient", 24, 7, 1, 0, 1.0f, 0.0f, 0.0f, 126.0f, "rpm", -1},
+  {1416, "Altitude_Info_Engine_7", 16, 8, 1, 0, 0.00787f, 0.0f, 0.0f, 2.0f, "", -1},
+  {1416, "Terminal_DFM", 8, 8, 1, 0, 0.4f, 0.0f, 0.0f, 101.6f, "%", -1},
+  {1416, "PTC_Glow_Plugs_Disabled", 5, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Reserved_Engine_7_1", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Fault_Memory_Entry_Engine_7", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Status_Bit_Speed_Limiter", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Speed_Limiter_Activated", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1416, "Idle_Target_RPM_at_Max", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1440, "Measured_Lateral_Acceleration", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1440, "Reserved_Brake_2_2", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1440, "Pulse_Count", 56, 6, 1, 0, 1.0f, 0.0f, 0.0f, 63.0f, "", -1},
@@ -455,154 +584,6 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {1440, "Lateral_Acceleration_Timer_Tick", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -2},
   {1440, "Timer", 0, 8, 1, 0, 0.04f, 0.0f, 0.0f, 10.2f, "us", 1},
   {1440, "Lateral_Acceleration", 0, 8, 1, 0, 0.01f, -1.27f, -1.27f, 1.27f, "g", 0},
-  {416, "BR1_ASR_Request", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_MSR_Request", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -2},
-  {416, "BR1_ABS_Brake", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_EDS_Active", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_ESP_Active", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_ASR_Active", 5, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {416, "BR1_EBV_Active", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Lamp_ABS", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Lamp_ASR", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Lamp_Brake", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Light_Switch", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Status_Pressure_Threshold", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_MAD", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Status_MAD", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Diagnosis", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Brake_Booster_Active", 16, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Wheel_Speed_kmh", 17, 15, 1, 0, 0.01f, 0.0f, 0.0f, 326.39f, "km/h", -1},
-  {416, "BR1_ASR_Torque_Slip", 32, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
-  {416, "BR1_ASR_Torque_Drive", 40, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", 0},
-  {416, "BR1_MSR_Torque_Inverted", 40, 8, 1, 0, -0.39f, 99.45f, 0.0f, 99.06f, "%", 1},
-  {416, "BR1_MSR_Torque", 48, 8, 1, 0, 0.39f, 0.0f, 0.0f, 99.06f, "%", -1},
-  {416, "BR1_Counter", 56, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {416, "BR1_ASR_ESP", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_ESP_ASR_Passive", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Status_ESP", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {416, "BR1_Substitute_Speed", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {704, "Rear_Clutch_Stiffness_Actual", 32, 8, 1, 0, 0.7874f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {704, "Fault_Memory_Entry_AWD_1", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Reserved_AWD_1_1", 26, 5, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Shift_Pre_Warning", 25, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Shift_Active_AWD_1", 24, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Gear_Info_PNG", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "PNG_Display_Blinking", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "PNG_Status_4_1", 16, 3, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Center_Clutch_Stiffness_Actual", 8, 8, 1, 0, 3.0f, -381.0f, -381.0f, 378.0f, "Nm/min", -1},
-  {704, "Unit_of_Clutch_Stiffness", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Speed_Limiter", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "AWD_Warning_Lamp", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Emergency_Mode", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Clutch_Fully_Open", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Error_Status_Clutch_Stiffness", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "Overtemperature_Protection_AWD_1", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {704, "AWD_Clutch_Error", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
-  {208, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {208, "LH3_Mirror_Base_Switch", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {208, "COUNTER", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {208, "LH3_Steering_Torque", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1023.0f, "", -1},
-  {208, "LH3_Steering_Torque_Sign", 26, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {208, "LH3_Steering_Torque_Valid", 27, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {208, "LH3_Status_DSR", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {208, "LH3_Steering_Assist_Torque", 32, 12, 1, 0, 0.15f, 0.0f, 0.0f, 615.0f, "", -1},
-  {208, "LH3_Steering_Assist_Torque_Sign", 44, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {208, "LH3_Steering_Assist_Torque_Valid", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {208, "LH3_Steering_Type", 46, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {978, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {978, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {978, "LH2_StraightAhead", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {978, "LH2_Status_Charisma", 13, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {978, "LH2_Status_HCA", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {978, "LH2_Output_LW1", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {978, "LH2_Output_LW1_Valid", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {978, "LH2_Status_EPS_PLA", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {978, "LH2_ActiveSteeringIntervention", 32, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {978, "LH2_PLA_Error", 48, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {978, "LH2_PLA_Abort", 52, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {644, "MOB_Standby", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {644, "MOB_Enable", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {644, "MOB_StopRequest", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {644, "MOB_CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {644, "MOB_COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {644, "TSK_SpeedLimitation_Active", 15, 1, 0, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {644, "TSK_ax_Transmission_01", 40, 8, 1, 0, 0.048f, 0.0f, 0.0f, 255.0f, "m/s2", -1},
-  {644, "MOB_BrakeControl", 16, 11, 1, 0, 0.048852f, 0.0f, 0.0f, 100.0f, "%", -1},
-  {644, "MOB_BrakeTorque", 27, 13, 1, 0, 4.0f, 0.0f, 0.0f, 32760.0f, "Nm", -1},
-  {428, "BR8_Checksum", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {428, "BR8_Counter", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {428, "BR8_Status_ACC_Request", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Decel_EPB_Active", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Status_Brake_Temp", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Status_Brake_Pressure", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Tolerance_Comp_RearLeft", 16, 8, 1, 0, 0.048828f, -6.201172f, -6.201172f, 6.152344f, "%", -1},
-  {428, "BR8_Tolerance_Comp_RearRight", 24, 8, 1, 0, 0.048828f, -6.201172f, -6.201172f, 6.152344f, "%", -1},
-  {428, "BR8_Actual_Acceleration", 32, 9, 1, 0, 0.02f, -7.22f, -7.22f, 2.98f, "m/s2", -1},
-  {428, "BR8_Status_HW_BLS", 41, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_QB_LateralAcceleration", 42, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_ESC_Mode", 43, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {428, "BR8_Active_BrakeSystem", 45, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Vehicle_Braking", 46, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Status_BrakeSystem", 47, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_LongitudinalAcceleration", 48, 10, 1, 0, 0.03125f, -16.0f, -15.96875f, 15.9375f, "m/s2", -1},
-  {428, "BR8_Status_ADR_BR", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Quattro", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Status_DecelControl", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Status_BLS", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Decel_EPB", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {428, "BR8_Check_EPB", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_Checksum", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
-  {928, "B10_Counter", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {928, "B10_QB_DistancePulse_FrontLeft", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_DistancePulse_FrontRight", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_DistancePulse_RearLeft", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_DistancePulse_RearRight", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_DistancePulse_FrontLeft", 16, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {928, "B10_DistancePulse_FrontRight", 26, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {928, "B10_DistancePulse_RearLeft", 36, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {928, "B10_DistancePulse_RearRight", 46, 10, 1, 0, 1.0f, 0.0f, 0.0f, 1000.0f, "", -1},
-  {928, "B10_QB_Direction_FrontLeft", 56, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_Direction_FrontRight", 57, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_Direction_RearLeft", 58, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_QB_Direction_RearRight", 59, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_Direction_FrontLeft", 60, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_Direction_FrontRight", 61, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_Direction_RearLeft", 62, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {928, "B10_Direction_RearRight", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_LSM", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_LightSensor", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_Light1", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_VSG", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_Key", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_Profile", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_Climate2", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_BSG4", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Status_Kessy_4", 8, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "BS4_Sliding_LightValue_Request", 9, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "BS4_SlidingLight_HighBeam_Request", 10, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_TurnSignal_Left_Control", 11, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_TurnSignal_Right_Control", 12, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_LightSensor_CommError", 14, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_LightSensor_Defective", 15, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Brightness", 16, 3, 1, 0, 714.286f, 0.0f, 0.0f, 5000.002f, "lux", -1},
-  {914, "GK2_ConvertibleTop_Closing", 19, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_ConvertibleTop_Unlocked", 20, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_ConvertibleTop_Open_Locked", 21, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_ConvertibleTop_Request", 22, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_ConvertibleTop_Cover_Open", 23, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Key", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "GK2_Hardtop", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_AFL_Switch", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_SubFunction_Lock", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_EM_LIN_Invalid", 31, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
-  {914, "GK2_Profile", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
-  {914, "GK2_Terminal_StartStop_Info", 36, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {914, "GK2_BSG_StartStop_Info", 38, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {914, "GK2_BEM_Generator_Power", 40, 8, 1, 0, 50.0f, 0.0f, 0.0f, 12700.0f, "W", -1},
-  {914, "GK2_BEM_Shutdown_Levels", 48, 3, 1, 0, 1.0f, 0.0f, 0.0f, 7.0f, "", -1},
-  {914, "GK2_BEM_DFM", 51, 5, 1, 0, 3.225f, 0.025f, 0.025f, 100.0f, "%", -1},
-  {914, "GK2_Kessy_StartStop_Info", 56, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
-  {914, "GK2_BEM_StartStop_Info", 58, 2, 1, 0, 1.0f, 0.0f, 0.0f, 3.0f, "", -1},
   {1463, "CHECKSUM", 0, 8, 1, 0, 1.0f, 0.0f, 0.0f, 255.0f, "", -1},
   {1463, "COUNTER", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {1463, "B11_Hydraulic_Hold", 13, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -613,6 +594,26 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {1463, "B11_OBD_Nibble_RearRight", 28, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
   {1463, "B11_EPB_Actuator_active", 32, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1463, "B11_EPB_Actuator_valid", 33, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
+  {1488, "CAN_Stand_4_1_Drivetrain_Data_Main", 44, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "CAN_Stand_4_1_Drivetrain_Data_Sub", 40, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "CAN_Stand_4_1_Comfort_Data_Main", 36, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "CAN_Stand_4_1_Comfort_Data_Sub", 32, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "Reserved_SystemInfo_1_6", 30, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Four_Door", 29, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Right_Hand_Drive", 28, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Vehicle_Index", 24, 4, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Vehicle_Generation", 20, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "Vehicle_Derivative", 16, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "Vehicle_Brand_2", 12, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "Vehicle_Class", 8, 4, 1, 0, 1.0f, 0.0f, 0.0f, 15.0f, "", -1},
+  {1488, "InstallInfo_Valid", 7, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "CAN_Infotainment_Installed", 6, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "CAN_Infotainment_in_Diagnosis", 5, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Sleep_CAN_Infotainment", 4, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "CAN_Comfort_in_Diagnosis", 3, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "Sleep_CAN_Comfort", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "CAN_Drivetrain_in_Diagnosis", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
+  {1488, "CAN_External_Enabled", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 0.0f, "", -1},
   {1500, "VL1_Engine_ECU", 0, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1500, "VL1_Transmission_ECU", 1, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
   {1500, "VL1_ABS", 2, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
@@ -689,46 +690,106 @@ const dbc_signal_t k_vw_pq_chassis_signals[] = {
   {2000, "DI1_Time_old", 63, 1, 1, 0, 1.0f, 0.0f, 0.0f, 1.0f, "", -1},
 };
 
-const uint16_t k_vw_pq_chassis_signal_count =
-  (uint16_t)(sizeof(k_vw_pq_chassis_signals) / sizeof(k_vw_pq_chassis_signals[0]));
+const uint16_t k_vw_pq_chassis_signal_count = (uint16_t)(sizeof(k_vw_pq_chassis_signals) / sizeof(k_vw_pq_chassis_signals[0]));
+
+constexpr dbc_frame_index_t k_vw_pq_chassis_frames[] = {
+  {194, 0, 11, -1},
+  {208, 11, 11, -1},
+  {416, 22, 26, 1},
+  {424, 48, 5, -1},
+  {428, 53, 22, -1},
+  {640, 75, 14, 12},
+  {644, 89, 9, -1},
+  {648, 98, 22, 0},
+  {672, 120, 4, -1},
+  {704, 124, 17, -1},
+  {800, 141, 24, -1},
+  {896, 165, 18, 5},
+  {906, 183, 20, -1},
+  {912, 203, 55, 8},
+  {914, 258, 34, -1},
+  {928, 292, 18, -1},
+  {976, 310, 22, -1},
+  {978, 332, 11, -1},
+  {1056, 343, 15, -1},
+  {1088, 358, 20, -1},
+  {1152, 378, 37, 0},
+  {1160, 415, 11, -1},
+  {1184, 426, 8, -1},
+  {1192, 434, 27, -1},
+  {1312, 461, 25, 6},
+  {1344, 486, 20, -1},
+  {1352, 506, 7, -1},
+  {1392, 513, 21, -1},
+  {1408, 534, 21, 20},
+  {1416, 555, 13, -1},
+  {1440, 568, 14, 11},
+  {1463, 582, 10, -1},
+  {1488, 592, 20, -1},
+  {1500, 612, 64, -1},
+  {2000, 676, 10, -1},
+};
+
+const uint16_t k_vw_pq_chassis_frame_count = (uint16_t)(sizeof(k_vw_pq_chassis_frames) / sizeof(k_vw_pq_chassis_frames[0]));
 
-uint64_t vw_pq_dbc_extract_raw(const uint8_t* data, uint16_t start_bit, uint8_t length, uint8_t is_little_endian) {
-  if (length == 0 || length > 64) {
-    return 0;
-  }
-  if (is_little_endian) {
-    uint64_t raw = 0;
-    for (uint8_t i = 0; i < 8; i++) {
-      raw |= ((uint64_t)data[i]) << (8U * i);
-    }
-    raw >>= start_bit;
-    if (length == 64) {
-      return raw;
-    }
-    return raw & ((1ULL << length) - 1ULL);
-  }
+static constexpr uint16_t k_name_hash_seeds[] = {
+  26, 1, 1, 6, 230, 1, 82, 4, 47, 6, 11, 50, 51, 9, 121, 20,
+  70, 5, 3, 1, 43, 16, 2, 31, 48, 3, 16, 44, 207, 1, 6, 2,
+  1, 3, 63, 18, 14, 95, 2, 1, 3, 115, 14, 2, 128, 88, 2, 221,
+  131, 299, 3, 1, 9, 51, 207, 21, 40, 179, 19, 2, 41, 36, 153, 26,
+  16, 161, 1, 594, 615, 27, 7, 0, 32, 3, 14, 6, 3, 56, 29, 8,
+  14, 23, 4, 26, 20, 12, 18, 22, 272, 36, 73, 15, 315, 35, 5, 589,
+  210, 5, 351, 34, 243, 4, 34, 14, 23, 12, 2, 616, 33, 2, 80, 8,
+  146, 54, 10, 423, 26, 330, 324, 46, 906, 57, 1, 734, 529, 598, 478, 1,
+  4, 143, 165, 10, 59, 1, 51, 2586, 346, 94, 72, 15, 885, 583, 50, 1,
+  92, 153, 252, 1, 292, 210, 729, 41, 23, 253, 67, 15, 4236, 1, 1351, 137,
+  922, 208, 25, 291, 1, 225, 2, 156, 1313, 542, 1, 5,
+};
 
-  uint64_t raw = 0;
-  for (uint16_t i = 0; i < length; i++) {
-    int bit_index = (int)start_bit - (int)i;
-    int byte_index = bit_index / 8;
-    int bit_in_byte = 7 - (bit_index % 8);
-    uint8_t bit = (data[byte_index] >> bit_in_byte) & 0x1;
-    raw = (raw << 1) | bit;
-  }
-  return raw;
-}
+static constexpr uint16_t k_name_hash_slots[] = {
+  308, 585, 639, 33, 665, 51, 2, 194, 604, 305, 526, 671, 567, 291, 353, 493,
+  431, 411, 484, 525, 410, 577, 0, 136, 222, 284, 358, 59, 348, 323, 34, 583,
+  623, 402, 352, 278, 232, 41, 189, 67, 117, 90, 225, 669, 624, 614, 210, 214,
+  580, 582, 415, 423, 8, 234, 162, 364, 440, 546, 271, 593, 469, 19, 518, 457,
+  42, 553, 630, 253, 193, 123, 651, 141, 420, 554, 684, 532, 217, 504, 443, 533,
+  195, 543, 494, 301, 581, 156, 397, 500, 277, 226, 521, 517, 159, 315, 9, 215,
+  373, 87, 150, 427, 246, 336, 507, 578, 106, 229, 571, 498, 248, 512, 455, 557,
+  359, 25, 588, 562, 683, 531, 602, 203, 409, 307, 279, 535, 293, 565, 6, 311,
+  367, 463, 172, 12, 530, 168, 224, 419, 668, 462, 45, 383, 489, 480, 509, 626,
+  408, 130, 650, 584, 164, 49, 204, 452, 108, 326, 110, 37, 549, 406, 438, 140,
+  481, 297, 264, 401, 1, 396, 259, 634, 183, 243, 414, 663, 113, 380, 303, 503,
+  587, 596, 200, 432, 161, 71, 377, 479, 39, 381, 470, 299, 273, 357, 429, 153,
+  256, 17, 86, 597, 657, 317, 460, 425, 287, 180, 679, 48, 648, 260, 433, 300,
+  120, 149, 83, 310, 677, 21, 165, 453, 30, 324, 529, 191, 290, 389, 360, 492,
+  228, 483, 254, 179, 678, 474, 576, 23, 388, 38, 442, 436, 96, 107, 488, 598,
+  313, 139, 652, 173, 142, 555, 258, 245, 205, 608, 155, 231, 632, 40, 82, 198,
+  407, 22, 430, 539, 98, 3, 351, 615, 369, 399, 43, 606, 309, 361, 118, 384,
+  280, 478, 112, 523, 413, 534, 237, 476, 127, 645, 616, 218, 398, 609, 448, 125,
+  261, 625, 374, 520, 441, 468, 115, 490, 54, 181, 126, 459, 85, 199, 400, 482,
+  268, 318, 495, 143, 169, 378, 385, 641, 304, 60, 376, 426, 387, 46, 267, 347,
+  573, 501, 456, 325, 667, 206, 368, 306, 499, 202, 537, 50, 366, 62, 146, 558,
+  461, 569, 57, 514, 233, 341, 89, 505, 370, 131, 404, 450, 147, 151, 362, 269,
+  158, 65, 603, 672, 340, 95, 274, 589, 184, 178, 171, 163, 36, 227, 335, 572,
+  513, 209, 605, 111, 152, 282, 216, 129, 660, 64, 681, 312, 196, 207, 154, 275,
+  20, 262, 524, 236, 621, 81, 542, 24, 655, 601, 44, 568, 511, 338, 251, 485,
+  424, 545, 673, 331, 465, 617, 607, 466, 257, 242, 350, 635, 73, 590, 619, 252,
+  337, 643, 519, 208, 627, 94, 29, 319, 103, 412, 458, 88, 527, 560, 445, 170,
+  659, 449, 327, 662, 473, 405, 610, 47, 263, 676, 144, 11, 235, 182, 592, 28,
+  185, 467, 4, 434, 354, 422, 255, 77, 574, 391, 464, 656, 363, 13, 386, 187,
+  628, 58, 292, 32, 670, 240, 132, 510, 133, 76, 622, 644, 72, 230, 84, 124,
+  298, 515, 516, 192, 78, 394, 417, 594, 342, 330, 528, 355, 612, 119, 344, 92,
+  658, 289, 390, 446, 666, 244, 439, 314, 472, 508, 547, 435, 272, 35, 379, 548,
+  175, 160, 7, 664, 186, 100, 591, 93, 74, 31, 654, 395, 109, 122, 223, 177,
+  15, 642, 281, 247, 579, 114, 105, 213, 80, 522, 286, 322, 333, 502, 128, 685,
+  382, 428, 497, 418, 97, 444, 134, 26, 620, 550, 633, 53, 91, 680, 68, 61,
+  296, 637, 556, 75, 339, 544, 538, 506, 270, 52, 563, 10, 102, 221, 18, 190,
+  496, 249, 329, 294, 421, 116, 188, 640, 552, 201, 416, 451, 561, 646, 99, 285,
+  157, 611, 121, 356, 220, 486, 295, 320, 564, 559, 454, 375, 372, 288, 104, 145,
+  328, 27, 238, 674, 56, 276, 403, 392, 575, 166, 174, 437, 595, 393, 16, 346,
+  475, 219, 349, 649, 302, 477, 629, 540, 541, 55, 599, 197, 332, 647, 600, 586,
+  167, 471, 321, 212, 211, 63, 14, 566, 636, 682, 638, 487, 536, 675, 66, 250,
+  343, 148, 5, 447, 137, 661, 101, 570, 334, 265, 316, 631, 239, 283, 551, 365,
+  491, 345, 618, 241, 653, 79, 371, 266, 613, 138, 176, 70, 135, 69,
+};
 
-float vw_pq_dbc_decode_signal(const dbc_signal_t* sig, const uint8_t* data) {
-  uint64_t raw = vw_pq_dbc_extract_raw(data, sig->start_bit, sig->length, sig->is_little_endian);
-  if (!sig->is_signed) {
-    return ((float)raw * sig->factor) + sig->offset;
-  }
-  if (sig->length == 64) {
-    int64_t sraw = (int64_t)raw;
-    return ((float)sraw * sig->factor) + sig->offset;
-  }
-  uint64_t sign_mask = 1ULL << (sig->length - 1U);
-  int64_t sraw = (raw & sign_mask) ? (int64_t)(raw | (~((1ULL << sig->length) - 1ULL))) : (int64_t)raw;
-  return ((float)sraw * sig->factor) + sig->offset;
-}
+const dbc_name_hash_t k_vw_pq_chassis_name_hash = {k_name_hash_seeds, 172, k_name_hash_slots, 686};
@@ -69,14 +69,15 @@ static float interpolate_curve_u16(uint16_t x, const uint16_t* bins, const uint8
   return (float)values[count - 1];
 }
 
-static float get_speed_lock_target(openhaldex_mode_t mode) {
+static float get_speed_lock_target(openhaldex_mode_t mode, const lock_tables_t& tables) {
   if (!lock_enabled(mode)) {
     return 0.0f;
   }
   if (!dynamic_mode_speed_gate_allows_lock(mode)) {
     return 0.0f;
   }
-  float lock = interpolate_curve_u16(received_vehicle_speed, speed_curve_bins, speed_curve_lock, speed_curve_count);
+  float lock = interpolate_curve_u16(received_vehicle_speed, tables.speed_curve_bins, tables.speed_curve_lock,
+                                     tables.speed_curve_count);
   if (lock < 0.0f)
     lock = 0.0f;
   if (lock > 100.0f)
@@ -84,7 +85,7 @@ static float get_speed_lock_target(openhaldex_mode_t mode) {
   return lock;
 }
 
-static float get_throttle_lock_target(openhaldex_mode_t mode) {
+static float get_throttle_lock_target(openhaldex_mode_t mode, const lock_tables_t& tables) {
   if (!lock_enabled(mode)) {
     return 0.0f;
   }
@@ -98,11 +99,12 @@ static float get_throttle_lock_target(openhaldex_mode_t mode) {
     throttle = 100.0f;
 
   uint16_t throttle_bins_u16[CURVE_POINTS_MAX] = {};
-  for (uint8_t i = 0; i < throttle_curve_count && i < CURVE_POINTS_MAX; i++) {
-    throttle_bins_u16[i] = throttle_curve_bins[i];
+  for (uint8_t i = 0; i < tables.throttle_curve_count && i < CURVE_POINTS_MAX; i++) {
+    throttle_bins_u16[i] = tables.throttle_curve_bins[i];
   }
 
-  float lock = interpolate_curve_u16((uint16_t)throttle, throttle_bins_u16, throttle_curve_lock, throttle_curve_count);
+  float lock =
+    interpolate_curve_u16((uint16_t)throttle, throttle_bins_u16, tables.throttle_curve_lock, tables.throttle_curve_count);
   if (lock < 0.0f)
     lock = 0.0f;
   if (lock > 100.0f)
@@ -110,7 +112,7 @@ static float get_throttle_lock_target(openhaldex_mode_t mode) {
   return lock;
 }
 
-static float get_map_lock_target(openhaldex_mode_t mode) {
+static float get_map_lock_target(openhaldex_mode_t mode, const lock_tables_t& tables) {
   // 2D throttle/speed map with bilinear interpolation between bins.
   // Result is normalized to a lock percent in [0..100].
   if (!lock_enabled(mode)) {
@@ -137,16 +139,16 @@ static float get_map_lock_target(openhaldex_mode_t mode) {
   uint8_t t1 = 0;
   float t_ratio = 0;
 
-  if (throttle >= map_throttle_bins[MAP_THROTTLE_BINS - 1]) {
+  if (throttle >= tables.map_throttle_bins[MAP_THROTTLE_BINS - 1]) {
     t0 = MAP_THROTTLE_BINS - 1;
     t1 = t0;
   } else {
     for (uint8_t i = 0; i < MAP_THROTTLE_BINS - 1; i++) {
-      if (throttle <= map_throttle_bins[i + 1]) {
+      if (throttle <= tables.map_throttle_bins[i + 1]) {
         t0 = i;
         t1 = i + 1;
-        float denom = (float)map_throttle_bins[t1] - (float)map_throttle_bins[t0];
-        t_ratio = (denom > 0) ? ((throttle - map_throttle_bins[t0]) / denom) : 0;
+        float denom = (float)tables.map_throttle_bins[t1] - (float)tables.map_throttle_bins[t0];
+        t_ratio = (denom > 0) ? ((throttle - tables.map_throttle_bins[t0]) / denom) : 0;
         break;
       }
     }
@@ -156,25 +158,25 @@ static float get_map_lock_target(openhaldex_mode_t mode) {
   uint8_t s1 = 0;
   float s_ratio = 0;
 
-  if (speed >= map_speed_bins[MAP_SPEED_BINS - 1]) {
+  if (speed >= tables.map_speed_bins[MAP_SPEED_BINS - 1]) {
     s0 = MAP_SPEED_BINS - 1;
     s1 = s0;
   } else {
     for (uint8_t i = 0; i < MAP_SPEED_BINS - 1; i++) {
-      if (speed <= map_speed_bins[i + 1]) {
+      if (speed <= tables.map_speed_bins[i + 1]) {
         s0 = i;
         s1 = i + 1;
-        float denom = (float)map_speed_bins[s1] - (float)map_speed_bins[s0];
-        s_ratio = (denom > 0) ? ((speed - map_speed_bins[s0]) / denom) : 0;
+        float denom = (float)tables.map_speed_bins[s1] - (float)tables.map_speed_bins[s0];
+        s_ratio = (denom > 0) ? ((speed - tables.map_speed_bins[s0]) / denom) : 0;
         break;
       }
     }
   }
 
-  float v00 = map_lock_table[t0][s0];
-  float v01 = map_lock_table[t0][s1];
-  float v10 = map_lock_table[t1][s0];
-  float v11 = map_lock_table[t1][s1];
+  float v00 = tables.map_lock_table[t0][s0];
+  float v01 = tables.map_lock_table[t0][s1];
+  float v10 = tables.map_lock_table[t1][s0];
+  float v11 = tables.map_lock_table[t1][s1];
 
   float v0 = v00 + ((v01 - v00) * s_ratio);
   float v1 = v10 + ((v11 - v10) * s_ratio);
@@ -189,14 +191,14 @@ static float get_map_lock_target(openhaldex_mode_t mode) {
   return v;
 }
 
-static float get_rpm_lock_target(openhaldex_mode_t mode) {
+static float get_rpm_lock_target(openhaldex_mode_t mode, const lock_tables_t& tables) {
   if (!lock_enabled(mode)) {
     return 0.0f;
   }
   if (!dynamic_mode_speed_gate_allows_lock(mode)) {
     return 0.0f;
   }
-  float lock = interpolate_curve_u16(received_vehicle_rpm, rpm_curve_bins, rpm_curve_lock, rpm_curve_count);
+  float lock = interpolate_curve_u16(received_vehicle_rpm, tables.rpm_curve_bins, tables.rpm_curve_lock, tables.rpm_curve_count);
   if (lock < 0.0f)
     lock = 0.0f;
   if (lock > 100.0f)
@@ -261,11 +263,12 @@ static float smooth_lock_release(float raw_target) {
   return smoothed;
 }
 
-// Computes desired lock percent before generation-specific frame shaping.
-// This is the single source of "requested lock" used by CAN frame mutation.
-float get_lock_target_adjustment() {
+// Lock percent the mode and tables ask for right now, before release smoothing. Reads state only.
+float get_lock_target_raw() {
   float raw_target = 0.0f;
   const openhaldex_mode_t mode = openhaldexEffectiveMode();
+  // Table modes read one published snapshot for the whole calculation.
+  const lock_tables_t* tables = lockTablesReadBegin();
   switch (mode) {
   case MODE_FWD:
     raw_target = 0.0f;
@@ -292,27 +295,34 @@ float get_lock_target_adjustment() {
     break;
 
   case MODE_SPEED:
-    raw_target = get_speed_lock_target(mode);
+    raw_target = tables ? get_speed_lock_target(mode, *tables) : 0.0f;
     break;
 
   case MODE_THROTTLE:
-    raw_target = get_throttle_lock_target(mode);
+    raw_target = tables ? get_throttle_lock_target(mode, *tables) : 0.0f;
     break;
 
   case MODE_MAP:
-    raw_target = get_map_lock_target(mode);
+    raw_target = tables ? get_map_lock_target(mode, *tables) : 0.0f;
     break;
 
   case MODE_RPM:
-    raw_target = get_rpm_lock_target(mode);
+    raw_target = tables ? get_rpm_lock_target(mode, *tables) : 0.0f;
     break;
 
   default:
     raw_target = 0.0f;
     break;
   }
+  lockTablesReadEnd();
+
+  return raw_target;
+}
 
-  return smooth_lock_release(raw_target);
+// Computes desired lock percent before generation-specific frame shaping.
+// This is the single source of "requested lock" used by CAN frame mutation.
+float get_lock_target_adjustment() {
+  return smooth_lock_release(get_lock_target_raw());
 }
 // Converts a generation-specific control byte into a mode-adjusted byte.
 // `invert=true` is used by frames where lower encoded values mean higher lock.
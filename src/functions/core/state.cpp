@@ -1,10 +1,14 @@
 #include "functions/core/state.h"
 
 #include <algorithm>
+#include <atomic>
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
 
 // Global state variables - shared across all modules
 // Contains controller state, vehicle telemetry, and CAN bus status
@@ -18,6 +22,7 @@ uint8_t received_haldex_state = 0;
 uint8_t received_haldex_engagement_raw = 0;
 uint8_t received_haldex_engagement = 0;
 uint8_t appliedTorque = 0;
+volatile uint32_t bootFirstControlFrameMs = 0;
 
 uint8_t haldexLearnTable[101] = {};
 bool haldexLearnTableValid = false;
@@ -62,12 +67,18 @@ uint32_t lowPowerSleepDelayMs = 30000;
 uint32_t lowPowerWakeTimerSeconds = 300;
 uint32_t lowPowerProbeDurationMs = 1200;
 
+// Bumped by every config setter below; RX tasks compare it once per loop and only re-fetch on change.
+static std::atomic<uint32_t> config_epoch(1);
 static SemaphoreHandle_t mapped_input_mutex = nullptr;
 static String mapped_input_speed_signal = "";
 static String mapped_input_throttle_signal = "";
 static String mapped_input_rpm_signal = "";
+static mapped_signal_key_t mapped_input_speed_key = {};
+static mapped_signal_key_t mapped_input_throttle_key = {};
+static mapped_signal_key_t mapped_input_rpm_key = {};
 static SemaphoreHandle_t mode_trigger_mutex = nullptr;
 static String mode_trigger_signal = "";
+static mapped_signal_key_t mode_trigger_key = {};
 static bool mode_trigger_enabled = false;
 static mode_trigger_operator_t mode_trigger_op = MODE_TRIGGER_GTE;
 static float mode_trigger_value = 1.0f;
@@ -76,9 +87,19 @@ static bool mode_trigger_broadcast_open_haldex_over_can = true;
 static volatile bool mode_trigger_runtime_active = false;
 static volatile bool mode_trigger_runtime_seen = false;
 static volatile uint32_t mode_trigger_last_seen_ms = 0;
-static float mode_trigger_last_value = 0.0f;
+// Last primary-trigger value as decoded, kept tagged so the chassis task never converts it; readers
+// take it through a seqlock (odd while the writer is mid-copy) and convert on their side.
+static std::atomic<uint32_t> mode_trigger_last_value_seq(0);
+static dbc_value_t mode_trigger_last_value = {DBC_VALUE_INT, 1, 0, 0.0f};
+static mode_trigger_rules_t mode_trigger_rules = {};
+static mode_trigger_rule_keys_t mode_trigger_rule_keys = {};
+static openhaldex_mode_t mode_trigger_rule_modes[MODE_TRIGGER_RULE_MAX] = {};
+static bool mode_trigger_rule_broadcast[MODE_TRIGGER_RULE_MAX] = {};
+static volatile int8_t mode_trigger_rule_active = -1;
+static volatile uint32_t mode_trigger_rule_seen_ms = 0;
 static SemaphoreHandle_t dashboard_signal_mutex = nullptr;
 static String dashboard_signal_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+static mapped_signal_key_t dashboard_signal_keys[DASHBOARD_SIGNAL_SLOT_COUNT];
 
 long lastCANChassisTick = 0;
 long lastCANHaldexTick = 0;
@@ -127,6 +148,14 @@ uint8_t map_lock_table[MAP_THROTTLE_BINS][MAP_SPEED_BINS] = {
   {0, 5, 10, 15, 15, 10, 5, 0, 0},     {5, 10, 20, 25, 25, 20, 15, 10, 5}, {10, 20, 30, 40, 40, 30, 25, 20, 15},
   {20, 30, 45, 60, 60, 50, 40, 30, 20}};
 
+// Two snapshot buffers: one published, one being rebuilt. A buffer is only rewritten once every
+// reader that might still hold it has left (readers == 0 after the swap that retired it).
+static lock_tables_t lock_tables_buffers[2];
+static std::atomic<const lock_tables_t*> lock_tables_current(nullptr);
+static std::atomic<uint32_t> lock_tables_readers(0);
+static std::atomic<uint32_t> lock_tables_generation(0);
+static SemaphoreHandle_t lock_tables_mutex = nullptr;
+
 static SemaphoreHandle_t mappedInputMutexHandle() {
   if (!mapped_input_mutex) {
     mapped_input_mutex = xSemaphoreCreateMutex();
@@ -148,6 +177,75 @@ static SemaphoreHandle_t dashboardSignalMutexHandle() {
   return dashboard_signal_mutex;
 }
 
+static bool copy_mapping_token(const String& raw, char* out, size_t cap) {
+  String token = raw;
+  token.trim();
+  token.toLowerCase();
+  if (token.length() >= cap) {
+    out[0] = '\0';
+    return false;
+  }
+  memcpy(out, token.c_str(), token.length() + 1);
+  return true;
+}
+
+bool mappedSignalKeyParse(const String& raw, mapped_signal_key_t& out) {
+  out = {};
+  String key = raw;
+  key.trim();
+  out.configured = key.length() > 0;
+  if (!out.configured) {
+    return false;
+  }
+
+  const int p1 = key.indexOf('|');
+  const int p2 = (p1 >= 0) ? key.indexOf('|', p1 + 1) : -1;
+  const int p3 = (p2 >= 0) ? key.indexOf('|', p2 + 1) : -1;
+  if (p1 < 0 || p2 < 0 || p3 < 0) {
+    return false;
+  }
+
+  String bus = key.substring(0, p1);
+  bus.trim();
+  bus.toLowerCase();
+  if (bus == "all" || bus.length() == 0) {
+    out.bus = MAPPED_BUS_ANY;
+  } else if (bus == "chassis" || bus == "chs") {
+    out.bus = MAPPED_BUS_CHASSIS;
+  } else if (bus == "haldex" || bus == "hdx") {
+    out.bus = MAPPED_BUS_HALDEX;
+  } else {
+    return false;
+  }
+
+  String frame = key.substring(p1 + 1, p2);
+  frame.trim();
+  if (frame.length() == 0) {
+    return false;
+  }
+  char* endptr = nullptr;
+  const unsigned long parsed = strtoul(frame.c_str(), &endptr, 0);
+  if (endptr == frame.c_str() || *endptr != '\0') {
+    return false;
+  }
+  out.frameId = (uint32_t)parsed;
+
+  if (!copy_mapping_token(key.substring(p2 + 1, p3), out.signal, sizeof(out.signal)) ||
+      !copy_mapping_token(key.substring(p3 + 1), out.unit, sizeof(out.unit))) {
+    return false;
+  }
+  out.valid = true;
+  return true;
+}
+
+uint32_t configEpoch() {
+  return config_epoch.load(std::memory_order_acquire);
+}
+
+void configEpochBump() {
+  config_epoch.fetch_add(1, std::memory_order_release);
+}
+
 void mappedInputSignalsInit() {
   (void)mappedInputMutexHandle();
 }
@@ -184,18 +282,42 @@ bool mappedInputSignalsSet(const String& speed, const String& throttle, const St
   mapped_input_speed_signal = speed;
   mapped_input_throttle_signal = throttle;
   mapped_input_rpm_signal = rpm;
+  (void)mappedSignalKeyParse(speed, mapped_input_speed_key);
+  (void)mappedSignalKeyParse(throttle, mapped_input_throttle_key);
+  (void)mappedSignalKeyParse(rpm, mapped_input_rpm_key);
+  configEpochBump();
+  xSemaphoreGive(mutex);
+  return true;
+}
+
+bool mappedInputKeysGet(mapped_signal_key_t& speed, mapped_signal_key_t& throttle, mapped_signal_key_t& rpm,
+                        uint32_t timeout_ms) {
+  SemaphoreHandle_t mutex = mappedInputMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  speed = mapped_input_speed_key;
+  throttle = mapped_input_throttle_key;
+  rpm = mapped_input_rpm_key;
   xSemaphoreGive(mutex);
   return true;
 }
 
 bool mappedInputSignalsConfigured() {
-  String speed;
-  String throttle;
-  String rpm;
-  if (!mappedInputSignalsGet(speed, throttle, rpm, 1)) {
+  SemaphoreHandle_t mutex = mappedInputMutexHandle();
+  if (!mutex || xSemaphoreTake(mutex, pdMS_TO_TICKS(1)) != pdTRUE) {
     return false;
   }
-  return speed.length() > 0 && throttle.length() > 0 && rpm.length() > 0;
+  const bool configured =
+    mapped_input_speed_key.configured && mapped_input_throttle_key.configured && mapped_input_rpm_key.configured;
+  xSemaphoreGive(mutex);
+  return configured;
 }
 
 void modeTriggerInit() {
@@ -301,23 +423,172 @@ bool modeTriggerConfigSet(const mode_trigger_config_t& config, uint32_t timeout_
   mode_trigger_value = isfinite(config.value) ? config.value : 1.0f;
   mode_trigger_mode = (config.mode < openhaldex_mode_t_MAX) ? config.mode : MODE_MAP;
   mode_trigger_broadcast_open_haldex_over_can = config.broadcastOpenHaldexOverCAN;
+  (void)mappedSignalKeyParse(mode_trigger_signal, mode_trigger_key);
+  configEpochBump();
+  xSemaphoreGive(mutex);
+  return true;
+}
+
+bool modeTriggerKeyGet(mapped_signal_key_t& key, uint32_t timeout_ms) {
+  SemaphoreHandle_t mutex = modeTriggerMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  key = mode_trigger_key;
+  xSemaphoreGive(mutex);
+  return true;
+}
+
+const char* modeTriggerCombineName(mode_trigger_combine_t combine) {
+  return (combine == MODE_TRIGGER_ANY) ? "any" : "all";
+}
+
+bool modeTriggerCombineFromString(const String& raw, mode_trigger_combine_t& combine) {
+  String token = raw;
+  token.trim();
+  token.toLowerCase();
+  if (token == "all" || token == "and" || token == "&&") {
+    combine = MODE_TRIGGER_ALL;
+    return true;
+  }
+  if (token == "any" || token == "or" || token == "||") {
+    combine = MODE_TRIGGER_ANY;
+    return true;
+  }
+  return false;
+}
+
+bool modeTriggerRulesGet(mode_trigger_rules_t& rules, uint32_t timeout_ms) {
+  SemaphoreHandle_t mutex = modeTriggerMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  rules = mode_trigger_rules;
+  xSemaphoreGive(mutex);
+  return true;
+}
+
+bool modeTriggerRulesSet(const mode_trigger_rules_t& rules, uint32_t timeout_ms) {
+  SemaphoreHandle_t mutex = modeTriggerMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  mode_trigger_rules = {};
+  memset(mode_trigger_rule_keys, 0, sizeof(mode_trigger_rule_keys));
+  mode_trigger_rules.count = std::min<uint8_t>(rules.count, MODE_TRIGGER_RULE_MAX);
+  for (uint8_t r = 0; r < mode_trigger_rules.count; r++) {
+    const mode_trigger_rule_t& in = rules.rules[r];
+    mode_trigger_rule_t& rule = mode_trigger_rules.rules[r];
+    rule.enabled = in.enabled;
+    rule.combine = (in.combine < mode_trigger_combine_t_MAX) ? in.combine : MODE_TRIGGER_ALL;
+    rule.debounceMs = std::min<uint16_t>(in.debounceMs, 10000);
+    rule.mode = (in.mode < openhaldex_mode_t_MAX) ? in.mode : MODE_MAP;
+    rule.broadcastOpenHaldexOverCAN = in.broadcastOpenHaldexOverCAN;
+    rule.termCount = std::min<uint8_t>(in.termCount, MODE_TRIGGER_TERM_MAX);
+    for (uint8_t t = 0; t < rule.termCount; t++) {
+      mode_trigger_term_t& term = rule.terms[t];
+      term.signal = in.terms[t].signal;
+      term.signal.trim();
+      if (term.signal.length() > 160) {
+        term.signal = term.signal.substring(0, 160);
+      }
+      term.op = (in.terms[t].op < mode_trigger_operator_t_MAX) ? in.terms[t].op : MODE_TRIGGER_GTE;
+      term.value = isfinite(in.terms[t].value) ? in.terms[t].value : 1.0f;
+      const float hysteresis = in.terms[t].hysteresis;
+      term.hysteresis = (isfinite(hysteresis) && hysteresis > 0.0f) ? hysteresis : 0.0f;
+      (void)mappedSignalKeyParse(term.signal, mode_trigger_rule_keys[r][t]);
+    }
+    mode_trigger_rule_modes[r] = rule.mode;
+    mode_trigger_rule_broadcast[r] = rule.broadcastOpenHaldexOverCAN;
+  }
+  mode_trigger_rule_active = -1;
+  configEpochBump();
+  xSemaphoreGive(mutex);
+  return true;
+}
+
+bool modeTriggerRuleKeysGet(mode_trigger_rule_keys_t& keys, uint32_t timeout_ms) {
+  SemaphoreHandle_t mutex = modeTriggerMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  memcpy(keys, mode_trigger_rule_keys, sizeof(keys));
   xSemaphoreGive(mutex);
   return true;
 }
 
+void modeTriggerRuleRuntimeUpdate(int8_t active_rule, uint32_t seen_ms) {
+  mode_trigger_rule_active = (active_rule >= 0 && active_rule < MODE_TRIGGER_RULE_MAX) ? active_rule : -1;
+  mode_trigger_rule_seen_ms = seen_ms;
+}
+
+int8_t modeTriggerActiveRule() {
+  const int8_t rule = mode_trigger_rule_active;
+  if (modeTriggerSuppressed || loggingDebugCaptureActive() || rule < 0) {
+    return -1;
+  }
+  const uint32_t last_seen = (uint32_t)mode_trigger_rule_seen_ms;
+  if (last_seen == 0 || (millis() - last_seen) > 1500U) {
+    return -1;
+  }
+  return rule;
+}
+
 void modeTriggerRuntimeGet(mode_trigger_runtime_t& runtime) {
   const uint32_t last_seen = (uint32_t)mode_trigger_last_seen_ms;
   runtime.seen = mode_trigger_runtime_seen && last_seen > 0;
-  runtime.lastValue = mode_trigger_last_value;
+  dbc_value_t value;
+  while (true) {
+    const uint32_t before = mode_trigger_last_value_seq.load(std::memory_order_acquire);
+    if (before & 1U) {
+      taskYIELD();
+      continue;
+    }
+    memcpy(&value, &mode_trigger_last_value, sizeof(value));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (mode_trigger_last_value_seq.load(std::memory_order_relaxed) == before) {
+      break;
+    }
+  }
+  const float last_value = dbc_value_to_float(value);
+  runtime.lastValue = isfinite(last_value) ? last_value : 0.0f;
   runtime.lastSeenMs = last_seen;
   runtime.ageMs = runtime.seen ? (millis() - last_seen) : 0;
   runtime.active = modeTriggerOverrideActive();
 }
 
-void modeTriggerRuntimeUpdate(bool active, float value, uint32_t seen_ms) {
+void modeTriggerRuntimeUpdate(bool active, const dbc_value_t& value, uint32_t seen_ms) {
   mode_trigger_runtime_active = active;
   mode_trigger_runtime_seen = true;
-  mode_trigger_last_value = isfinite(value) ? value : 0.0f;
+  const uint32_t seq = mode_trigger_last_value_seq.load(std::memory_order_relaxed);
+  mode_trigger_last_value_seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(&mode_trigger_last_value, &value, sizeof(value));
+  mode_trigger_last_value_seq.store(seq + 2, std::memory_order_release);
   mode_trigger_last_seen_ms = seen_ms;
 }
 
@@ -325,6 +596,8 @@ void modeTriggerRuntimeReset() {
   mode_trigger_runtime_active = false;
   mode_trigger_runtime_seen = false;
   mode_trigger_last_seen_ms = 0;
+  mode_trigger_rule_active = -1;
+  mode_trigger_rule_seen_ms = 0;
 }
 
 bool modeTriggerOverrideActive() {
@@ -342,6 +615,10 @@ openhaldex_mode_t openhaldexEffectiveMode() {
   if (modeTriggerOverrideActive()) {
     return (mode_trigger_mode < openhaldex_mode_t_MAX) ? mode_trigger_mode : MODE_MAP;
   }
+  const int8_t rule = modeTriggerActiveRule();
+  if (rule >= 0) {
+    return mode_trigger_rule_modes[rule];
+  }
   return (state.mode < openhaldex_mode_t_MAX) ? state.mode : MODE_STOCK;
 }
 
@@ -349,6 +626,10 @@ bool openhaldexEffectiveBroadcastOpenHaldexOverCAN() {
   if (modeTriggerOverrideActive()) {
     return mode_trigger_broadcast_open_haldex_over_can;
   }
+  const int8_t rule = modeTriggerActiveRule();
+  if (rule >= 0) {
+    return mode_trigger_rule_broadcast[rule];
+  }
   return broadcastOpenHaldexOverCAN;
 }
 
@@ -379,6 +660,27 @@ bool dashboardSignalsGet(String* slots, size_t count, uint32_t timeout_ms) {
   return true;
 }
 
+bool dashboardSignalKeysGet(mapped_signal_key_t* keys, size_t count, uint32_t timeout_ms) {
+  if (!keys || count == 0) {
+    return false;
+  }
+
+  SemaphoreHandle_t mutex = dashboardSignalMutexHandle();
+  if (!mutex) {
+    return false;
+  }
+
+  TickType_t wait_ticks = (timeout_ms == 0) ? 0 : pdMS_TO_TICKS(timeout_ms);
+  if (xSemaphoreTake(mutex, wait_ticks) != pdTRUE) {
+    return false;
+  }
+
+  const size_t limit = std::min<size_t>(count, DASHBOARD_SIGNAL_SLOT_COUNT);
+  memcpy(keys, dashboard_signal_keys, sizeof(*keys) * limit);
+  xSemaphoreGive(mutex);
+  return true;
+}
+
 bool dashboardSignalsSet(const String* slots, size_t count, uint32_t timeout_ms) {
   if (!slots || count == 0) {
     return false;
@@ -401,10 +703,80 @@ bool dashboardSignalsSet(const String* slots, size_t count, uint32_t timeout_ms)
   for (size_t i = limit; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
     dashboard_signal_slots[i] = "";
   }
+  for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    (void)mappedSignalKeyParse(dashboard_signal_slots[i], dashboard_signal_keys[i]);
+  }
+  configEpochBump();
   xSemaphoreGive(mutex);
   return true;
 }
 
+static bool lock_tables_wait_for_readers(TickType_t deadline) {
+  while (lock_tables_readers.load() != 0) {
+    if ((int32_t)(xTaskGetTickCount() - deadline) >= 0) {
+      return false;
+    }
+    vTaskDelay(1);
+  }
+  return true;
+}
+
+// Created once at boot, before any task or handler can publish, so two first publishers cannot each
+// create their own mutex.
+void lockTablesInit() {
+  if (!lock_tables_mutex) {
+    lock_tables_mutex = xSemaphoreCreateMutex();
+  }
+}
+
+bool lockTablesPublish(uint32_t timeout_ms) {
+  if (!lock_tables_mutex || xSemaphoreTake(lock_tables_mutex, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+    return false;
+  }
+
+  const lock_tables_t* current = lock_tables_current.load();
+  lock_tables_t* next = (current == &lock_tables_buffers[0]) ? &lock_tables_buffers[1] : &lock_tables_buffers[0];
+
+  // Grace period for the buffer retired by the previous publish.
+  if (current && !lock_tables_wait_for_readers(xTaskGetTickCount() + pdMS_TO_TICKS(timeout_ms))) {
+    xSemaphoreGive(lock_tables_mutex);
+    return false;
+  }
+
+  next->speed_curve_count = speed_curve_count;
+  memcpy(next->speed_curve_bins, speed_curve_bins, sizeof(speed_curve_bins));
+  memcpy(next->speed_curve_lock, speed_curve_lock, sizeof(speed_curve_lock));
+  next->throttle_curve_count = throttle_curve_count;
+  memcpy(next->throttle_curve_bins, throttle_curve_bins, sizeof(throttle_curve_bins));
+  memcpy(next->throttle_curve_lock, throttle_curve_lock, sizeof(throttle_curve_lock));
+  next->rpm_curve_count = rpm_curve_count;
+  memcpy(next->rpm_curve_bins, rpm_curve_bins, sizeof(rpm_curve_bins));
+  memcpy(next->rpm_curve_lock, rpm_curve_lock, sizeof(rpm_curve_lock));
+  memcpy(next->map_speed_bins, map_speed_bins, sizeof(map_speed_bins));
+  memcpy(next->map_throttle_bins, map_throttle_bins, sizeof(map_throttle_bins));
+  memcpy(next->map_lock_table, map_lock_table, sizeof(map_lock_table));
+
+  lock_tables_current.store(next);
+  lock_tables_generation.fetch_add(1);
+  configEpochBump();
+  xSemaphoreGive(lock_tables_mutex);
+  return true;
+}
+
+// Returns nullptr until the first publish; callers treat that as "no table, no lock".
+const lock_tables_t* lockTablesReadBegin() {
+  lock_tables_readers.fetch_add(1);
+  return lock_tables_current.load();
+}
+
+void lockTablesReadEnd() {
+  lock_tables_readers.fetch_sub(1);
+}
+
+uint32_t lockTablesGeneration() {
+  return lock_tables_generation.load();
+}
+
 bool loggingDebugCaptureActive() {
   return logDebugFirmwareEnabled || logDebugNetworkEnabled || logDebugCanEnabled || logCanToFileEnabled;
 }
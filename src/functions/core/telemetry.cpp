@@ -0,0 +1,68 @@
+#include "functions/core/telemetry.h"
+
+#include <atomic>
+#include <string.h>
+
+#include "functions/core/state.h"
+#include "functions/core/state_model.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// Seqlock: odd while the writer is mid-copy. Readers copy, then re-check the sequence.
+static std::atomic<uint32_t> telemetry_seq(0);
+static telemetry_snapshot_t telemetry_data = {};
+static uint32_t telemetry_last_publish_ms = 0;
+static uint32_t telemetry_publish_count = 0;
+
+bool telemetryPublishIfDue(uint32_t now_ms) {
+  if (telemetry_publish_count != 0 && (now_ms - telemetry_last_publish_ms) < OH_TELEMETRY_PUBLISH_MS) {
+    return false;
+  }
+  telemetryPublish(now_ms);
+  return true;
+}
+
+void telemetryPublish(uint32_t now_ms) {
+  telemetry_snapshot_t next = {};
+  next.sequence = ++telemetry_publish_count;
+  next.publishedMs = now_ms;
+  next.speed = received_vehicle_speed;
+  next.rpm = received_vehicle_rpm;
+  next.boost = received_vehicle_boost;
+  next.throttle = received_pedal_value;
+  next.lockTarget = lock_target;
+  next.haldexState = received_haldex_state;
+  next.haldexEngagement = received_haldex_engagement;
+  next.haldexEngagementRaw = received_haldex_engagement_raw;
+  next.clutch1Report = received_report_clutch1;
+  next.clutch2Report = received_report_clutch2;
+  next.tempProtection = received_temp_protection;
+  next.couplingOpen = received_coupling_open;
+  next.speedLimit = received_speed_limit;
+  next.modeOverride = state.mode_override;
+  next.awdRequested = awd_state.requested;
+  next.awdActual = awd_state.actual;
+
+  const uint32_t seq = telemetry_seq.load(std::memory_order_relaxed);
+  telemetry_seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  memcpy(&telemetry_data, &next, sizeof(next));
+  telemetry_seq.store(seq + 2, std::memory_order_release);
+  telemetry_last_publish_ms = now_ms;
+}
+
+void telemetryRead(telemetry_snapshot_t& out) {
+  while (true) {
+    const uint32_t before = telemetry_seq.load(std::memory_order_acquire);
+    if (before & 1U) {
+      taskYIELD(); // writer mid-copy; it holds the slot for a few hundred ns at most
+      continue;
+    }
+    memcpy(&out, &telemetry_data, sizeof(out));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (telemetry_seq.load(std::memory_order_relaxed) == before) {
+      return;
+    }
+  }
+}
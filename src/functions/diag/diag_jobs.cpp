@@ -0,0 +1,440 @@
+#include "functions/diag/diag_jobs.h"
+
+#include <string.h>
+
+#include "functions/config/config.h"
+#include "functions/core/state.h"
+#include "functions/diag/uds.h"
+#include "functions/storage/filelog.h"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+struct diag_job_slot_t {
+  uint32_t id;
+  diag_job_state_t state;
+  const char* kind;
+  diag_job_fn_t fn;
+  diag_job_args_t args;
+  uint32_t submittedMs;
+  uint32_t startedMs;
+  uint32_t finishedMs;
+  String result;
+};
+
+static diag_job_slot_t g_slots[OH_DIAG_JOB_SLOTS];
+static SemaphoreHandle_t g_jobs_mutex = nullptr;
+static QueueHandle_t g_job_queue = nullptr; // slot indices, in submission order
+static TaskHandle_t g_worker = nullptr;
+static uint32_t g_next_id = 1;
+static uint32_t g_completed = 0;
+static uint32_t g_rejected = 0;
+
+struct diag_poll_entry_t {
+  uint16_t did;
+  bool ok; // last attempt succeeded
+  bool batched;
+  bool negative;
+  uint8_t nrc;
+  const char* status;
+  const char* message;
+  uint8_t dataLen;
+  uint8_t data[OH_DIAG_POLL_DATA_MAX];
+  uint32_t updatedMs; // last successful read, 0 = never
+  uint32_t attemptMs;
+};
+
+static diag_poll_config_t g_poll_config = {false, false, 1000, 0, {}, {}};
+static uint32_t g_poll_revision = 0; // bumped by every config change, so a stale cycle does not write
+static diag_poll_entry_t g_poll_cache[OH_DIAG_POLL_MAX];
+static uint32_t g_poll_last_ms = 0;
+static uint32_t g_poll_read_ms = 0; // last diagPollWriteJson or config change
+static uint32_t g_poll_cycle_ms = 0;
+static uint32_t g_poll_cycles = 0;
+static uint8_t g_poll_data[OH_DIAG_POLL_MAX * OH_DIAG_POLL_DATA_MAX];
+
+static void runJob(uint8_t index) {
+  diag_job_slot_t& slot = g_slots[index];
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  slot.state = DIAG_JOB_RUNNING;
+  slot.startedMs = millis();
+  const diag_job_fn_t fn = slot.fn;
+  const diag_job_args_t args = slot.args;
+  xSemaphoreGive(g_jobs_mutex);
+
+  // The transaction and the JSON build both happen here, outside the lock, so pollers only ever
+  // wait for a String copy.
+  JsonDocument doc;
+  fn(args, doc);
+  String out;
+  serializeJson(doc, out);
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  slot.result = out;
+  slot.finishedMs = millis();
+  slot.state = DIAG_JOB_DONE;
+  g_completed++;
+  xSemaphoreGive(g_jobs_mutex);
+}
+
+static void runPollCycle() {
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  const diag_poll_config_t config = g_poll_config;
+  const uint32_t revision = g_poll_revision;
+  xSemaphoreGive(g_jobs_mutex);
+
+  g_poll_last_ms = millis();
+  if (!config.enabled || config.count == 0 || haldexGeneration != 5) {
+    return;
+  }
+
+  diag_uds_did_read_t reads[OH_DIAG_POLL_MAX] = {};
+  for (uint8_t i = 0; i < config.count; i++) {
+    reads[i].did = config.dids[i];
+    reads[i].expectedLen = config.lengths[i];
+  }
+  diag_uds_result_t last = {};
+  (void)diagUdsReadDataByIdentifiers(reads, config.count, g_poll_data, sizeof(g_poll_data), last, 1500);
+  const uint32_t now = millis();
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  if (revision == g_poll_revision) {
+    for (uint8_t i = 0; i < config.count; i++) {
+      const diag_uds_did_read_t& read = reads[i];
+      diag_poll_entry_t& entry = g_poll_cache[i];
+      entry.ok = read.ok && read.dataLen <= OH_DIAG_POLL_DATA_MAX;
+      entry.batched = read.batched;
+      entry.negative = read.negative;
+      entry.nrc = read.nrc;
+      entry.status = read.ok && !entry.ok ? "payload_too_large" : read.status;
+      entry.message = read.message;
+      entry.attemptMs = now;
+      if (entry.ok) {
+        memcpy(entry.data, &g_poll_data[read.dataOffset], read.dataLen);
+        entry.dataLen = (uint8_t)read.dataLen;
+        entry.updatedMs = now;
+      }
+    }
+    g_poll_cycle_ms = now - g_poll_last_ms;
+    g_poll_cycles++;
+  }
+  xSemaphoreGive(g_jobs_mutex);
+
+  if (config.log) {
+    for (uint8_t i = 0; i < config.count; i++) {
+      if (reads[i].ok) {
+        filelogLogMeasuredValue(reads[i].did, &g_poll_data[reads[i].dataOffset], reads[i].dataLen);
+      }
+    }
+  }
+}
+
+// Caller holds g_jobs_mutex. A logging poller has a reader in the CAN log, so it keeps running.
+static bool pollIdle(uint32_t now) {
+  if (!g_poll_config.enabled || g_poll_config.log) {
+    return false;
+  }
+  uint32_t idle_ms = (uint32_t)g_poll_config.intervalMs * OH_DIAG_POLL_IDLE_INTERVALS;
+  if (idle_ms < OH_DIAG_POLL_IDLE_MIN_MS) {
+    idle_ms = OH_DIAG_POLL_IDLE_MIN_MS;
+  }
+  return (now - g_poll_read_ms) >= idle_ms;
+}
+
+static void diagJobWorker(void* arg) {
+  (void)arg;
+  for (;;) {
+    xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+    if (pollIdle(millis())) {
+      g_poll_config.enabled = false;
+      LOG_INFO("diag", "measured-value poller disabled: not read for %lu ms",
+               (unsigned long)(millis() - g_poll_read_ms));
+    }
+    const bool poll_enabled = g_poll_config.enabled && g_poll_config.count > 0;
+    const uint32_t interval_ms = g_poll_config.intervalMs;
+    xSemaphoreGive(g_jobs_mutex);
+
+    // Queued jobs first; the poll cycle runs when its interval is up and the queue is idle.
+    TickType_t wait = portMAX_DELAY;
+    if (poll_enabled) {
+      const uint32_t since = millis() - g_poll_last_ms;
+      wait = since >= interval_ms ? 0 : pdMS_TO_TICKS(interval_ms - since);
+    }
+    // An open KWP/TP2.0 channel needs channel tests in between, and a disconnect once idle.
+    const uint32_t tp20_ms = diagKwpTp20SessionService();
+    if (tp20_ms > 0 && pdMS_TO_TICKS(tp20_ms) < wait) {
+      wait = pdMS_TO_TICKS(tp20_ms);
+    }
+
+    uint8_t index = 0;
+    if (xQueueReceive(g_job_queue, &index, 0) == pdTRUE) {
+      runJob(index);
+      continue;
+    }
+    // Submits and poll-config changes both notify, so a new job or interval is picked up right away.
+    if (ulTaskNotifyTake(pdTRUE, wait) > 0) {
+      continue;
+    }
+    if (poll_enabled && (millis() - g_poll_last_ms) >= interval_ms) {
+      runPollCycle();
+    }
+  }
+}
+
+static bool ensureInit() {
+  if (!g_jobs_mutex) {
+    g_jobs_mutex = xSemaphoreCreateMutex();
+  }
+  if (!g_job_queue) {
+    g_job_queue = xQueueCreate(OH_DIAG_JOB_SLOTS, sizeof(uint8_t));
+  }
+  if (g_jobs_mutex && g_job_queue && !g_worker) {
+    if (xTaskCreatePinnedToCore(diagJobWorker, "diagJobs", 8192, nullptr, 1, &g_worker, OH_APP_TASK_CORE) != pdPASS) {
+      g_worker = nullptr;
+      LOG_ERROR("diag", "job worker start failed");
+    }
+  }
+  return g_jobs_mutex && g_job_queue && g_worker;
+}
+
+void diagJobsInit() {
+  (void)ensureInit();
+}
+
+uint32_t diagJobSubmit(const char* kind, diag_job_fn_t fn, const diag_job_args_t& args) {
+  if (!fn || !ensureInit()) {
+    return 0;
+  }
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  // Free slot first, otherwise recycle the oldest finished result.
+  int index = -1;
+  for (uint8_t i = 0; i < OH_DIAG_JOB_SLOTS; i++) {
+    if (g_slots[i].state == DIAG_JOB_UNKNOWN) {
+      index = i;
+      break;
+    }
+    if (g_slots[i].state == DIAG_JOB_DONE &&
+        (index < 0 || (int32_t)(g_slots[i].finishedMs - g_slots[index].finishedMs) < 0)) {
+      index = i;
+    }
+  }
+  if (index < 0) {
+    g_rejected++;
+    xSemaphoreGive(g_jobs_mutex);
+    return 0;
+  }
+
+  diag_job_slot_t& slot = g_slots[index];
+  slot.id = g_next_id++;
+  if (g_next_id == 0) {
+    g_next_id = 1;
+  }
+  slot.state = DIAG_JOB_QUEUED;
+  slot.kind = kind ? kind : "";
+  slot.fn = fn;
+  slot.args = args;
+  slot.submittedMs = millis();
+  slot.startedMs = 0;
+  slot.finishedMs = 0;
+  slot.result = "";
+  const uint32_t id = slot.id;
+  const uint8_t queued_index = (uint8_t)index;
+  // The queue holds one entry per slot, so this should never fail; if it does, free the slot rather
+  // than leave a job queued that the worker will never see.
+  if (xQueueSend(g_job_queue, &queued_index, 0) != pdTRUE) {
+    slot.state = DIAG_JOB_UNKNOWN;
+    g_rejected++;
+    xSemaphoreGive(g_jobs_mutex);
+    return 0;
+  }
+  xSemaphoreGive(g_jobs_mutex);
+  xTaskNotifyGive(g_worker);
+  return id;
+}
+
+bool diagJobGet(uint32_t id, diag_job_info_t& out) {
+  if (id == 0 || !ensureInit()) {
+    return false;
+  }
+
+  bool found = false;
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  for (uint8_t i = 0; i < OH_DIAG_JOB_SLOTS; i++) {
+    const diag_job_slot_t& slot = g_slots[i];
+    if (slot.state == DIAG_JOB_UNKNOWN || slot.id != id) {
+      continue;
+    }
+    const uint32_t now = millis();
+    out.id = slot.id;
+    out.state = slot.state;
+    out.kind = slot.kind;
+    out.ageMs = now - slot.submittedMs;
+    out.runMs = slot.startedMs == 0 ? 0 : ((slot.finishedMs != 0 ? slot.finishedMs : now) - slot.startedMs);
+    out.queuedAhead = 0;
+    for (uint8_t j = 0; j < OH_DIAG_JOB_SLOTS; j++) {
+      const diag_job_slot_t& other = g_slots[j];
+      if ((other.state == DIAG_JOB_QUEUED || other.state == DIAG_JOB_RUNNING) &&
+          (int32_t)(other.id - slot.id) < 0) {
+        out.queuedAhead++;
+      }
+    }
+    out.result = slot.state == DIAG_JOB_DONE ? slot.result : String();
+    found = true;
+    break;
+  }
+  xSemaphoreGive(g_jobs_mutex);
+  return found;
+}
+
+const char* diagJobStateName(diag_job_state_t state) {
+  switch (state) {
+  case DIAG_JOB_QUEUED:
+    return "queued";
+  case DIAG_JOB_RUNNING:
+    return "running";
+  case DIAG_JOB_DONE:
+    return "done";
+  default:
+    return "unknown";
+  }
+}
+
+void diagJobsWriteStatusJson(JsonObject out) {
+  out["slots"] = OH_DIAG_JOB_SLOTS;
+  if (!ensureInit()) {
+    out["ready"] = false;
+    return;
+  }
+  out["ready"] = true;
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  out["completed"] = g_completed;
+  out["rejected"] = g_rejected;
+  JsonArray jobs = out["jobs"].to<JsonArray>();
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < OH_DIAG_JOB_SLOTS; i++) {
+    const diag_job_slot_t& slot = g_slots[i];
+    if (slot.state == DIAG_JOB_UNKNOWN) {
+      continue;
+    }
+    JsonObject job = jobs.add<JsonObject>();
+    job["jobId"] = slot.id;
+    job["kind"] = slot.kind;
+    job["state"] = diagJobStateName(slot.state);
+    job["ageMs"] = now - slot.submittedMs;
+  }
+  xSemaphoreGive(g_jobs_mutex);
+}
+
+void diagPollConfigGet(diag_poll_config_t& out) {
+  if (!ensureInit()) {
+    out = g_poll_config;
+    return;
+  }
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  out = g_poll_config;
+  xSemaphoreGive(g_jobs_mutex);
+}
+
+bool diagPollConfigSet(const diag_poll_config_t& in) {
+  if (in.intervalMs < 200 || in.intervalMs > 60000 || in.count > OH_DIAG_POLL_MAX || !ensureInit()) {
+    return false;
+  }
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  const bool same_dids = in.count == g_poll_config.count &&
+                         memcmp(in.dids, g_poll_config.dids, sizeof(in.dids[0]) * in.count) == 0 &&
+                         memcmp(in.lengths, g_poll_config.lengths, sizeof(in.lengths[0]) * in.count) == 0;
+  g_poll_config = in;
+  g_poll_read_ms = millis(); // a client just configured it, so it starts with a full idle window
+  if (!same_dids) {
+    memset(g_poll_cache, 0, sizeof(g_poll_cache));
+    for (uint8_t i = 0; i < in.count; i++) {
+      g_poll_cache[i].did = in.dids[i];
+      g_poll_cache[i].status = "pending";
+      g_poll_cache[i].message = "";
+    }
+    g_poll_revision++;
+    g_poll_last_ms = millis() - in.intervalMs; // first cycle right away
+  }
+  xSemaphoreGive(g_jobs_mutex);
+
+  // Wake the worker so a new interval or DID set takes effect now rather than after the old wait.
+  xTaskNotifyGive(g_worker);
+  return true;
+}
+
+static void writeHexBytes(String& out, const uint8_t* data, uint8_t len) {
+  static const char k_hex[] = "0123456789ABCDEF";
+  out.reserve(len * 3);
+  for (uint8_t i = 0; i < len; i++) {
+    if (i > 0) {
+      out += ' ';
+    }
+    out += k_hex[data[i] >> 4];
+    out += k_hex[data[i] & 0x0F];
+  }
+}
+
+void diagPollWriteJson(JsonObject out) {
+  if (!ensureInit()) {
+    out["ready"] = false;
+    return;
+  }
+  out["ready"] = true;
+
+  xSemaphoreTake(g_jobs_mutex, portMAX_DELAY);
+  const diag_poll_config_t& config = g_poll_config;
+  const uint32_t now = millis();
+  g_poll_read_ms = now;
+  // Stale once three cycles have been missed.
+  const uint32_t stale_ms = (uint32_t)config.intervalMs * 3;
+  out["enabled"] = config.enabled;
+  out["log"] = config.log;
+  out["intervalMs"] = config.intervalMs;
+  out["active"] = config.enabled && config.count > 0 && haldexGeneration == 5;
+  out["cycles"] = g_poll_cycles;
+  out["lastCycleMs"] = g_poll_cycle_ms;
+  out["transport"] = "uds_can";
+  out["requestKind"] = "did";
+  out["itemCount"] = config.count;
+
+  uint8_t positive = 0;
+  JsonArray items = out["items"].to<JsonArray>();
+  for (uint8_t i = 0; i < config.count; i++) {
+    const diag_poll_entry_t& entry = g_poll_cache[i];
+    char did[7];
+    snprintf(did, sizeof(did), "0x%04X", entry.did);
+    JsonObject item = items.add<JsonObject>();
+    item["id"] = did;
+    item["did"] = did;
+    item["expectedLen"] = config.lengths[i];
+    item["ok"] = entry.updatedMs != 0;
+    item["lastOk"] = entry.ok;
+    item["batched"] = entry.batched;
+    item["status"] = entry.status ? entry.status : "";
+    item["message"] = entry.message ? entry.message : "";
+    if (entry.negative) {
+      char nrc[3];
+      snprintf(nrc, sizeof(nrc), "%02X", entry.nrc);
+      item["nrc"] = nrc;
+      item["nrcName"] = diagUdsNrcName(entry.nrc);
+    }
+    if (entry.updatedMs != 0) {
+      const uint32_t age = now - entry.updatedMs;
+      String hex;
+      writeHexBytes(hex, entry.data, entry.dataLen);
+      item["rawDataHex"] = hex;
+      item["ageMs"] = age;
+      item["stale"] = age > stale_ms;
+      positive++;
+    } else {
+      item["stale"] = true;
+    }
+  }
+  out["positiveResponseCount"] = positive;
+  xSemaphoreGive(g_jobs_mutex);
+}
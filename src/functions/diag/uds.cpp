@@ -17,10 +17,15 @@ static const uint8_t k_sid_read_dtc_information = 0x19;
 static const uint8_t k_sid_clear_diagnostic_information = 0x14;
 static const uint8_t k_sid_negative_response = 0x7F;
 static const uint8_t k_nrc_response_pending = 0x78;
+static const uint8_t k_nrc_incorrect_message_length = 0x13;
 static const uint8_t k_sid_kwp_start_diagnostic_session = 0x10;
 static const uint8_t k_sid_kwp_read_data_by_local_identifier = 0x21;
 static const uint8_t k_kwp_vag_diagnostic_session = 0x89;
 
+// ISO 15765-2 limits: 12-bit first-frame length, and how many FC.WAIT frames we accept per block.
+static const uint16_t k_isotp_max_message = 4095;
+static const uint8_t k_isotp_max_wait_frames = 10;
+
 static const uint8_t k_tp20_logical_haldex = 0x0A;
 static const uint32_t k_tp20_setup_request_id = 0x200;
 static const uint32_t k_tp20_setup_response_id = 0x200 + k_tp20_logical_haldex;
@@ -31,6 +36,12 @@ static const uint8_t k_tp20_setup_positive = 0xD0;
 static const uint8_t k_tp20_params_request = 0xA0;
 static const uint8_t k_tp20_params_response = 0xA1;
 static const uint8_t k_tp20_disconnect = 0xA8;
+static const uint8_t k_tp20_channel_test = 0xA3;
+// T1 we negotiate is 100 ms (0x8A); a module that has not ACKed well past that dropped the channel.
+static const uint32_t k_tp20_ack_timeout_ms = 500;
+// Channel kept open between KWP requests: channel test this often, disconnect after this long unused.
+static const uint32_t k_tp20_keepalive_ms = 1000;
+static const uint32_t k_tp20_idle_close_ms = 10000;
 
 static const diag_uds_route_t k_haldex_routes[] = {
   {"allwheel-70f", 0x70F, 0x779, false},
@@ -50,9 +61,39 @@ static volatile bool g_active_extended = false;
 static volatile bool g_tp20_active = false;
 static volatile uint32_t g_tp20_response_id = 0;
 static int g_selected_route_index = -1;
+static bool g_did_batch_rejected = false; // selected route cannot answer a multi-DID 0x22
+
+// What single reads taught about a DID on the selected route: its real record length (catalog lengths
+// are often short) and whether the module refuses it. Batches are built from this, so a wrong length or
+// a refused DID costs one fallback instead of one per poll cycle.
+struct did_learned_t {
+  uint16_t did;
+  uint16_t len; // 0 = not read yet
+  bool rejected;
+};
+static const uint8_t k_did_learn_max = 32;
+static did_learned_t g_did_learned[k_did_learn_max] = {};
+static uint8_t g_did_learned_count = 0;
+static uint8_t g_did_learned_next = 0; // eviction cursor once the table is full
 static diag_uds_result_t g_last_result = {};
+
+struct tp20_session_t {
+  bool open;
+  uint32_t testerTxId;
+  uint32_t ecuTxId;
+  uint8_t txSeq;
+  uint32_t openedMs;
+  uint32_t lastUseMs;     // last KWP request
+  uint32_t lastTrafficMs; // last request or channel test
+  uint32_t requests;
+  uint32_t opens;
+  uint32_t keepAlives;
+};
+static tp20_session_t g_tp20_session = {};
 static uint32_t g_last_result_ms = 0;
 static const char* g_last_transport = "uds_can";
+static diag_isotp_config_t g_isotp = {0, 0, 1000, 1000};
+static portMUX_TYPE g_isotp_mux = portMUX_INITIALIZER_UNLOCKED;
 
 static String byteHex(uint8_t value) {
   String out;
@@ -175,16 +216,21 @@ static void clearTp20RxQueue() {
   }
 }
 
+static void initRequestFrame(const diag_uds_route_t& route, twai_message_t& msg) {
+  msg = {};
+  msg.identifier = route.requestId;
+  msg.extd = route.extended ? 1 : 0;
+  msg.rtr = 0;
+  msg.data_length_code = 8;
+}
+
 static bool sendSingleFrame(const diag_uds_route_t& route, const uint8_t* payload, uint8_t len) {
   if (len == 0 || len > 7) {
     return false;
   }
 
-  twai_message_t msg = {};
-  msg.identifier = route.requestId;
-  msg.extd = route.extended ? 1 : 0;
-  msg.rtr = 0;
-  msg.data_length_code = 8;
+  twai_message_t msg;
+  initRequestFrame(route, msg);
   msg.data[0] = len & 0x0F;
   for (uint8_t i = 0; i < len; i++) {
     msg.data[i + 1] = payload[i];
@@ -192,18 +238,134 @@ static bool sendSingleFrame(const diag_uds_route_t& route, const uint8_t* payloa
   return haldex_can_send(msg, pdMS_TO_TICKS(20), true);
 }
 
-static bool sendFlowControl(const diag_uds_route_t& route) {
-  twai_message_t msg = {};
-  msg.identifier = route.requestId;
-  msg.extd = route.extended ? 1 : 0;
-  msg.rtr = 0;
-  msg.data_length_code = 8;
+static bool sendFlowControl(const diag_uds_route_t& route, const diag_isotp_config_t& isotp) {
+  twai_message_t msg;
+  initRequestFrame(route, msg);
   msg.data[0] = 0x30; // Continue To Send
-  msg.data[1] = 0x00; // Block size: unlimited
-  msg.data[2] = 0x00; // STmin: no extra separation requested
+  msg.data[1] = isotp.rxBlockSize;
+  msg.data[2] = isotp.rxStMin;
   return haldex_can_send(msg, pdMS_TO_TICKS(20), true);
 }
 
+static bool isValidStMin(uint8_t raw) {
+  return raw <= 0x7F || (raw >= 0xF1 && raw <= 0xF9);
+}
+
+static uint32_t decodeStMinUs(uint8_t raw) {
+  if (raw <= 0x7F) {
+    return (uint32_t)raw * 1000UL;
+  }
+  if (raw >= 0xF1 && raw <= 0xF9) {
+    return (uint32_t)(raw - 0xF0) * 100UL;
+  }
+  return 127000UL; // reserved values: ISO says use the longest defined separation
+}
+
+static void waitSeparation(uint32_t since_us, uint32_t gap_us) {
+  const uint32_t elapsed = micros() - since_us;
+  if (elapsed >= gap_us) {
+    return;
+  }
+  const uint32_t left_us = gap_us - elapsed;
+  if (left_us >= 2000) {
+    vTaskDelay(pdMS_TO_TICKS(left_us / 1000 - 1));
+  }
+  const uint32_t waited = micros() - since_us;
+  if (waited < gap_us) {
+    delayMicroseconds(gap_us - waited);
+  }
+}
+
+// Waits for the ECU's flow control after our first frame or a completed block (N_Bs).
+static bool waitFlowControl(const diag_isotp_config_t& isotp, uint8_t& block_size, uint32_t& st_min_us,
+                            diag_uds_result_t& result) {
+  uint8_t waits = 0;
+  uint32_t started_ms = millis();
+  for (;;) {
+    const uint32_t elapsed = millis() - started_ms;
+    if (elapsed >= isotp.nBsMs) {
+      result.timeout = true;
+      failResult(result, "fc_timeout", "No ISO-TP flow control from Haldex module");
+      return false;
+    }
+
+    twai_message_t frame = {};
+    if (xQueueReceive(g_rx_queue, &frame, pdMS_TO_TICKS(isotp.nBsMs - elapsed)) != pdTRUE) {
+      continue;
+    }
+    if ((frame.data[0] & 0xF0) != 0x30 || frame.data_length_code < 3) {
+      continue;
+    }
+
+    switch (frame.data[0] & 0x0F) {
+    case 0x0:
+      block_size = frame.data[1];
+      st_min_us = decodeStMinUs(frame.data[2]);
+      return true;
+    case 0x1:
+      if (++waits > k_isotp_max_wait_frames) {
+        failResult(result, "fc_wait_limit", "Haldex module kept ISO-TP flow control in WAIT");
+        return false;
+      }
+      started_ms = millis();
+      continue;
+    case 0x2:
+      failResult(result, "fc_overflow", "Haldex module rejected the ISO-TP request length");
+      return false;
+    default:
+      failResult(result, "bad_flow_control", "Invalid ISO-TP flow status");
+      return false;
+    }
+  }
+}
+
+// First frame, then consecutive frames in the blocks and at the pace the ECU's flow control asks for.
+static bool sendMultiFrame(const diag_uds_route_t& route, const diag_isotp_config_t& isotp, const uint8_t* payload,
+                           uint16_t len, diag_uds_result_t& result) {
+  twai_message_t msg;
+  initRequestFrame(route, msg);
+  msg.data[0] = (uint8_t)(0x10 | ((len >> 8) & 0x0F));
+  msg.data[1] = (uint8_t)(len & 0xFF);
+  for (uint8_t i = 0; i < 6; i++) {
+    msg.data[i + 2] = payload[i];
+  }
+  if (!haldex_can_send(msg, pdMS_TO_TICKS(20), true)) {
+    failResult(result, "send_failed", "Failed to send ISO-TP first frame");
+    return false;
+  }
+
+  uint16_t offset = 6;
+  uint8_t seq = 1;
+  while (offset < len) {
+    uint8_t block_size = 0;
+    uint32_t st_min_us = 0;
+    if (!waitFlowControl(isotp, block_size, st_min_us, result)) {
+      return false;
+    }
+
+    uint8_t sent_in_block = 0;
+    uint32_t last_us = 0;
+    while (offset < len && (block_size == 0 || sent_in_block < block_size)) {
+      if (sent_in_block > 0) {
+        waitSeparation(last_us, st_min_us);
+      }
+      initRequestFrame(route, msg);
+      msg.data[0] = (uint8_t)(0x20 | seq);
+      for (uint8_t i = 1; i < 8 && offset < len; i++) {
+        msg.data[i] = payload[offset++];
+      }
+      if (!haldex_can_send(msg, pdMS_TO_TICKS(20), true)) {
+        failResult(result, "send_failed", "Failed to send ISO-TP consecutive frame");
+        return false;
+      }
+      last_us = micros();
+      seq = (seq + 1) & 0x0F;
+      sent_in_block++;
+    }
+  }
+  return true;
+}
+
 static bool responseLooksRelevant(const uint8_t* payload, uint16_t len, uint8_t request_sid) {
   if (len == 0) {
     return false;
@@ -431,9 +593,13 @@ static bool sendKwpRequestTp20(uint32_t tester_tx_id, uint32_t ecu_tx_id, const
   tx_seq = expected_ack_seq;
   bool ack_seen = false;
   bool response_started = false;
-  while ((millis() - started_ms) < timeout_ms) {
+  const uint32_t sent_ms = millis();
+  const uint32_t elapsed_ms = sent_ms - started_ms;
+  const uint32_t left_ms = elapsed_ms < timeout_ms ? timeout_ms - elapsed_ms : 0;
+  const uint32_t ack_timeout_ms = left_ms < k_tp20_ack_timeout_ms ? left_ms : k_tp20_ack_timeout_ms;
+  while ((millis() - sent_ms) < ack_timeout_ms) {
     twai_message_t ack = {};
-    if (!receiveTp20Frame(ecu_tx_id, ack, started_ms, timeout_ms)) {
+    if (!receiveTp20Frame(ecu_tx_id, ack, sent_ms, ack_timeout_ms)) {
       break;
     }
     if (ack.data_length_code == 0) {
@@ -578,8 +744,9 @@ static bool readSingleFrame(const twai_message_t& frame, uint8_t request_sid, di
   return finishResponse(request_sid, result);
 }
 
-static bool readFirstFrame(const diag_uds_route_t& route, const twai_message_t& frame, uint8_t request_sid,
-                           diag_uds_result_t& result, uint32_t started_ms, uint32_t timeout_ms) {
+static bool readFirstFrame(const diag_uds_route_t& route, const diag_isotp_config_t& isotp,
+                           const twai_message_t& frame, uint8_t request_sid, diag_uds_result_t& result,
+                           uint32_t started_ms, uint32_t timeout_ms) {
   const uint16_t total_len = (uint16_t)(((frame.data[0] & 0x0F) << 8) | frame.data[1]);
   if (total_len == 0 || total_len > OH_UDS_MAX_PAYLOAD) {
     failResult(result, "payload_too_large", "UDS multi-frame response exceeded local buffer");
@@ -592,15 +759,27 @@ static bool readFirstFrame(const diag_uds_route_t& route, const twai_message_t&
   }
   result.payloadLen = offset;
 
-  if (!sendFlowControl(route)) {
+  if (!sendFlowControl(route, isotp)) {
     failResult(result, "flow_control_failed", "Failed to send ISO-TP flow control");
     return false;
   }
 
   uint8_t expected_seq = 1;
+  uint8_t block_count = 0;
+  uint32_t last_frame_ms = millis();
   while (result.payloadLen < total_len && (millis() - started_ms) < timeout_ms) {
+    // N_Cr: each consecutive frame must follow the previous one (or our flow control) in time.
+    const uint32_t gap = millis() - last_frame_ms;
+    if (gap >= isotp.nCrMs) {
+      result.timeout = true;
+      failResult(result, "cf_timeout", "Timed out waiting for ISO-TP consecutive frame");
+      return false;
+    }
     const uint32_t elapsed = millis() - started_ms;
-    const uint32_t remaining = elapsed < timeout_ms ? timeout_ms - elapsed : 0;
+    uint32_t remaining = elapsed < timeout_ms ? timeout_ms - elapsed : 0;
+    if (remaining > isotp.nCrMs - gap) {
+      remaining = isotp.nCrMs - gap;
+    }
     twai_message_t cf = {};
     if (xQueueReceive(g_rx_queue, &cf, pdMS_TO_TICKS(remaining > 0 ? remaining : 1)) != pdTRUE) {
       continue;
@@ -616,10 +795,19 @@ static bool readFirstFrame(const diag_uds_route_t& route, const twai_message_t&
       return false;
     }
     expected_seq = (expected_seq + 1) & 0x0F;
+    last_frame_ms = millis();
 
     for (uint8_t i = 1; i < cf.data_length_code && result.payloadLen < total_len; i++) {
       result.payload[result.payloadLen++] = cf.data[i];
     }
+
+    if (isotp.rxBlockSize != 0 && ++block_count >= isotp.rxBlockSize && result.payloadLen < total_len) {
+      block_count = 0;
+      if (!sendFlowControl(route, isotp)) {
+        failResult(result, "flow_control_failed", "Failed to send ISO-TP flow control");
+        return false;
+      }
+    }
   }
 
   if (result.payloadLen < total_len) {
@@ -631,8 +819,8 @@ static bool readFirstFrame(const diag_uds_route_t& route, const twai_message_t&
   return finishResponse(request_sid, result);
 }
 
-static bool receiveResponse(const diag_uds_route_t& route, uint8_t request_sid, diag_uds_result_t& result,
-                            uint32_t timeout_ms) {
+static bool receiveResponse(const diag_uds_route_t& route, const diag_isotp_config_t& isotp, uint8_t request_sid,
+                            diag_uds_result_t& result, uint32_t timeout_ms) {
   const uint32_t started_ms = millis();
   while ((millis() - started_ms) < timeout_ms) {
     const uint32_t elapsed = millis() - started_ms;
@@ -654,7 +842,7 @@ static bool receiveResponse(const diag_uds_route_t& route, uint8_t request_sid,
       return ok;
     }
     if (pci == 0x10) {
-      const bool ok = readFirstFrame(route, frame, request_sid, result, started_ms, timeout_ms);
+      const bool ok = readFirstFrame(route, isotp, frame, request_sid, result, started_ms, timeout_ms);
       result.elapsedMs = millis() - started_ms;
       return ok;
     }
@@ -666,7 +854,7 @@ static bool receiveResponse(const diag_uds_route_t& route, uint8_t request_sid,
   return false;
 }
 
-static bool sendRequestOnRoute(const diag_uds_route_t& route, const uint8_t* request, uint8_t request_len,
+static bool sendRequestOnRoute(const diag_uds_route_t& route, const uint8_t* request, uint16_t request_len,
                                diag_uds_result_t& result, uint32_t timeout_ms) {
   clearResult(result);
   result.route = &route;
@@ -682,8 +870,8 @@ static bool sendRequestOnRoute(const diag_uds_route_t& route, const uint8_t* req
     recordLastResult(result);
     return false;
   }
-  if (request_len == 0 || request_len > 7) {
-    failResult(result, "request_too_long", "Only single-frame UDS requests are enabled in this build");
+  if (request_len == 0 || request_len > OH_UDS_MAX_PAYLOAD || request_len > k_isotp_max_message) {
+    failResult(result, "request_too_long", "UDS request exceeds the local ISO-TP buffer");
     recordLastResult(result);
     return false;
   }
@@ -700,11 +888,21 @@ static bool sendRequestOnRoute(const diag_uds_route_t& route, const uint8_t* req
   g_active_extended = route.extended;
   g_active = true;
 
+  diag_isotp_config_t isotp;
+  diagUdsIsoTpConfigGet(isotp);
+
   bool ok = false;
-  if (!sendSingleFrame(route, request, request_len)) {
-    failResult(result, "send_failed", "Failed to send UDS request");
+  bool sent = false;
+  if (request_len <= 7) {
+    sent = sendSingleFrame(route, request, (uint8_t)request_len);
+    if (!sent) {
+      failResult(result, "send_failed", "Failed to send UDS request");
+    }
   } else {
-    ok = receiveResponse(route, request[0], result, timeout_ms);
+    sent = sendMultiFrame(route, isotp, request, request_len, result);
+  }
+  if (sent) {
+    ok = receiveResponse(route, isotp, request[0], result, timeout_ms);
   }
 
   g_active = false;
@@ -754,6 +952,8 @@ bool diagUdsProbeHaldex(diag_uds_result_t& out, uint32_t timeout_ms) {
     }
     if (readDidOnRoute(k_haldex_routes[i], 0xF19E, out, timeout_ms) && isPositiveDidResponse(out, 0xF19E)) {
       g_selected_route_index = i;
+      g_did_batch_rejected = false;
+      g_did_learned_count = 0;
       LOG_INFO("uds", "selected Haldex UDS route=%s req=%s resp=%s", k_haldex_routes[i].name,
                wordHex(k_haldex_routes[i].requestId, k_haldex_routes[i].extended).c_str(),
                wordHex(k_haldex_routes[i].responseId, k_haldex_routes[i].extended).c_str());
@@ -793,6 +993,221 @@ bool diagUdsReadDataByIdentifier(uint16_t did, diag_uds_result_t& out, uint32_t
   return ok;
 }
 
+static did_learned_t* findLearnedDid(uint16_t did) {
+  for (uint8_t i = 0; i < g_did_learned_count; i++) {
+    if (g_did_learned[i].did == did) {
+      return &g_did_learned[i];
+    }
+  }
+  return nullptr;
+}
+
+static void learnDid(uint16_t did, uint16_t len, bool rejected) {
+  did_learned_t* entry = findLearnedDid(did);
+  if (!entry) {
+    if (g_did_learned_count < k_did_learn_max) {
+      entry = &g_did_learned[g_did_learned_count++];
+    } else {
+      entry = &g_did_learned[g_did_learned_next];
+      g_did_learned_next = (uint8_t)((g_did_learned_next + 1) % k_did_learn_max);
+    }
+    *entry = {did, 0, false};
+  }
+  if (len != 0) {
+    entry->len = len;
+  }
+  entry->rejected = rejected;
+}
+
+// The length a single read measured wins over the caller's catalog length.
+static uint16_t didExpectedLen(const diag_uds_did_read_t& read) {
+  const did_learned_t* learned = findLearnedDid(read.did);
+  return (learned && learned->len != 0) ? learned->len : read.expectedLen;
+}
+
+static void setDidRead(diag_uds_did_read_t& read, const diag_uds_result_t& result) {
+  read.ok = false;
+  read.batched = false;
+  read.negative = result.negative;
+  read.nrc = result.nrc;
+  read.status = result.status;
+  read.message = result.message;
+  read.dataOffset = 0;
+  read.dataLen = 0;
+}
+
+// Splits a combined 0x62 response in request order. Nothing is committed unless every DID echo lines
+// up with the expected lengths and the payload is consumed exactly.
+static bool splitDidBatch(const diag_uds_result_t& result, diag_uds_did_read_t* reads, uint8_t count, uint8_t* data,
+                          uint16_t data_size, uint16_t& data_used) {
+  if (!result.ok || result.payloadLen < 1 || result.payload[0] != (k_sid_read_data_by_identifier + 0x40)) {
+    return false;
+  }
+
+  uint16_t offsets[OH_UDS_DID_BATCH_MAX] = {};
+  uint16_t lengths[OH_UDS_DID_BATCH_MAX] = {};
+  uint16_t pos = 1;
+  uint16_t needed = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    if (pos + 2 > result.payloadLen || result.payload[pos] != (uint8_t)(reads[i].did >> 8) ||
+        result.payload[pos + 1] != (uint8_t)(reads[i].did & 0xFF)) {
+      return false;
+    }
+    pos += 2;
+    const uint16_t expected = didExpectedLen(reads[i]);
+    const uint16_t len = expected != 0 ? expected : (uint16_t)(result.payloadLen - pos);
+    if (pos + len > result.payloadLen) {
+      return false;
+    }
+    offsets[i] = pos;
+    lengths[i] = len;
+    needed += len;
+    pos += len;
+  }
+  if (pos != result.payloadLen || data_used + needed > data_size) {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    memcpy(&data[data_used], &result.payload[offsets[i]], lengths[i]);
+    setDidRead(reads[i], result);
+    reads[i].ok = true;
+    reads[i].batched = count > 1;
+    reads[i].dataOffset = data_used;
+    reads[i].dataLen = lengths[i];
+    data_used += lengths[i];
+  }
+  return true;
+}
+
+uint8_t diagUdsReadDataByIdentifiers(diag_uds_did_read_t* reads, uint8_t count, uint8_t* data, uint16_t data_size,
+                                     diag_uds_result_t& last, uint32_t timeout_ms) {
+  clearResult(last);
+  for (uint8_t i = 0; i < count; i++) {
+    setDidRead(reads[i], last);
+    reads[i].status = "not_read";
+    reads[i].message = "";
+  }
+  if (count == 0) {
+    return 0;
+  }
+
+  if (!diagUdsHasSelectedRoute() && !diagUdsProbeHaldex(last, timeout_ms)) {
+    for (uint8_t i = 0; i < count; i++) {
+      setDidRead(reads[i], last);
+    }
+    return 0;
+  }
+  const diag_uds_route_t* route = diagUdsSelectedRoute();
+  if (!route) {
+    failResult(last, "no_route", "No Haldex UDS route selected");
+    recordLastResult(last);
+    return 0;
+  }
+
+  uint16_t data_used = 0;
+  uint8_t read_count = 0;
+  uint8_t index = 0;
+  while (index < count) {
+    // Grow the batch while the combined response still fits the local buffer. A DID the module refused
+    // is read on its own, so it cannot fail a batch again.
+    uint8_t batch = 0;
+    uint16_t response_len = 1;
+    bool batch_learned = true; // every length in the batch was measured by a single read
+    while (index + batch < count && batch < OH_UDS_DID_BATCH_MAX && !g_did_batch_rejected) {
+      const did_learned_t* learned = findLearnedDid(reads[index + batch].did);
+      if (learned && learned->rejected) {
+        if (batch == 0) {
+          batch = 1;
+        }
+        break;
+      }
+      batch_learned = batch_learned && learned && learned->len != 0;
+      const uint16_t len = didExpectedLen(reads[index + batch]);
+      if (len == 0) {
+        batch++;
+        break;
+      }
+      if (response_len + 2 + len > OH_UDS_MAX_PAYLOAD) {
+        break;
+      }
+      response_len += 2 + len;
+      batch++;
+    }
+    if (batch == 0) {
+      batch = 1;
+    }
+
+    if (batch > 1) {
+      uint8_t req[1 + 2 * OH_UDS_DID_BATCH_MAX];
+      req[0] = k_sid_read_data_by_identifier;
+      for (uint8_t i = 0; i < batch; i++) {
+        req[1 + 2 * i] = (uint8_t)(reads[index + i].did >> 8);
+        req[2 + 2 * i] = (uint8_t)(reads[index + i].did & 0xFF);
+      }
+      const bool ok = sendRequestOnRoute(*route, req, (uint16_t)(1 + 2 * batch), last, timeout_ms);
+      if (ok && splitDidBatch(last, &reads[index], batch, data, data_size, data_used)) {
+        read_count += batch;
+        index += batch;
+        continue;
+      }
+      if (last.timeout || last.busy) {
+        for (uint8_t i = index; i < count; i++) {
+          setDidRead(reads[i], last);
+        }
+        if (last.timeout) {
+          g_selected_route_index = -1;
+        }
+        return read_count;
+      }
+      // With every length measured and no refused DID in it, a failing batch means the module cannot
+      // serve multi-DID reads at all; stop asking instead of failing the same batch every cycle.
+      if ((last.negative && last.nrc == k_nrc_incorrect_message_length) || batch_learned) {
+        g_did_batch_rejected = true;
+        LOG_INFO("uds", "multi-DID read rejected by %s, reading one DID per request", route->name);
+      }
+      vTaskDelay(pdMS_TO_TICKS(20));
+    }
+
+    // One DID per request: the fallback after a rejected or unsplittable batch (NRC 0x31 names no DID,
+    // so the unsupported one is found this way), and the path for a lone DID.
+    for (uint8_t i = 0; i < batch; i++) {
+      diag_uds_did_read_t& read = reads[index + i];
+      const bool ok = readDidOnRoute(*route, read.did, last, timeout_ms);
+      setDidRead(read, last);
+      if (ok && isPositiveDidResponse(last, read.did)) {
+        const uint16_t len = (uint16_t)(last.payloadLen - 3);
+        learnDid(read.did, len, false);
+        if (data_used + len <= data_size) {
+          memcpy(&data[data_used], &last.payload[3], len);
+          read.ok = true;
+          read.dataOffset = data_used;
+          read.dataLen = len;
+          data_used += len;
+          read_count++;
+        } else {
+          read.status = "payload_too_large";
+          read.message = "DID data exceeded the batch buffer";
+        }
+      } else if (last.negative && !last.busy) {
+        learnDid(read.did, 0, true);
+      }
+      if (last.timeout || last.busy) {
+        for (uint8_t j = index + i + 1; j < count; j++) {
+          setDidRead(reads[j], last);
+        }
+        if (last.timeout) {
+          g_selected_route_index = -1;
+        }
+        return read_count;
+      }
+      vTaskDelay(pdMS_TO_TICKS(20));
+    }
+    index += batch;
+  }
+  return read_count;
+}
+
 bool diagUdsReadDtcByStatus(uint8_t status_mask, diag_uds_result_t& out, uint32_t timeout_ms) {
   if (!diagUdsHasSelectedRoute()) {
     diag_uds_result_t probe = {};
@@ -853,6 +1268,72 @@ bool diagUdsClearDtc(uint32_t group_of_dtc, diag_uds_result_t& out, uint32_t tim
   return ok;
 }
 
+// Session helpers run with g_diag_mutex held. g_tp20_active only routes frames while a request or
+// channel test is on the bus; the channel IDs persist in g_tp20_session between them.
+static void closeTp20Session(const char* reason) {
+  if (g_tp20_session.open) {
+    g_tp20_active = true;
+    disconnectTp20Channel(g_tp20_session.testerTxId, g_tp20_session.ecuTxId);
+    LOG_INFO("kwp", "TP2.0 channel closed (%s) after %lu requests", reason, (unsigned long)g_tp20_session.requests);
+  }
+  g_tp20_session.open = false;
+  g_tp20_session.txSeq = 0;
+  g_tp20_active = false;
+  g_tp20_response_id = 0;
+}
+
+static bool openTp20Session(diag_uds_result_t& out, uint32_t started_ms, uint32_t timeout_ms) {
+  clearTp20RxQueue();
+  g_tp20_response_id = 0;
+  g_tp20_active = true;
+
+  uint32_t tester_tx_id = 0;
+  uint32_t ecu_tx_id = 0;
+  if (!openTp20Channel(tester_tx_id, ecu_tx_id, out, started_ms, timeout_ms)) {
+    g_tp20_active = false;
+    g_tp20_response_id = 0;
+    return false;
+  }
+
+  uint8_t tx_seq = 0;
+  const uint8_t session_req[] = {k_sid_kwp_start_diagnostic_session, k_kwp_vag_diagnostic_session};
+  if (!sendKwpRequestTp20(tester_tx_id, ecu_tx_id, session_req, sizeof(session_req),
+                          (uint8_t)(k_sid_kwp_start_diagnostic_session + 0x40), tx_seq, out, started_ms,
+                          timeout_ms)) {
+    disconnectTp20Channel(tester_tx_id, ecu_tx_id);
+    g_tp20_active = false;
+    g_tp20_response_id = 0;
+    return false;
+  }
+
+  const uint32_t now = millis();
+  g_tp20_session.open = true;
+  g_tp20_session.testerTxId = tester_tx_id;
+  g_tp20_session.ecuTxId = ecu_tx_id;
+  g_tp20_session.txSeq = tx_seq;
+  g_tp20_session.openedMs = now;
+  g_tp20_session.lastUseMs = now;
+  g_tp20_session.lastTrafficMs = now;
+  g_tp20_session.requests = 0;
+  g_tp20_session.opens++;
+  return true;
+}
+
+// Channel test (A3); the module answers with its channel parameters (A1).
+static bool testTp20Channel() {
+  clearTp20RxQueue();
+  g_tp20_active = true;
+  const uint8_t test[] = {k_tp20_channel_test};
+  bool ok = sendTp20Frame(g_tp20_session.testerTxId, test, sizeof(test));
+  if (ok) {
+    twai_message_t response = {};
+    ok = receiveTp20Frame(g_tp20_session.ecuTxId, response, millis(), 200) && response.data_length_code >= 1 &&
+         response.data[0] == k_tp20_params_response;
+  }
+  g_tp20_active = false;
+  return ok;
+}
+
 static bool runKwpTp20Request(const uint8_t* request, uint8_t request_len, uint8_t positive_sid,
                               diag_uds_result_t& out, uint32_t timeout_ms) {
   clearResult(out);
@@ -878,33 +1359,36 @@ static bool runKwpTp20Request(const uint8_t* request, uint8_t request_len, uint8
 
   const uint32_t started_ms = millis();
   clearRxQueue();
-  clearTp20RxQueue();
-  g_tp20_response_id = 0;
-  g_tp20_active = true;
 
-  uint32_t tester_tx_id = 0;
-  uint32_t ecu_tx_id = 0;
-  bool channel_open = false;
   bool ok = false;
-
-  if (openTp20Channel(tester_tx_id, ecu_tx_id, out, started_ms, timeout_ms)) {
-    channel_open = true;
-    uint8_t tx_seq = 0;
-    const uint8_t session_req[] = {k_sid_kwp_start_diagnostic_session, k_kwp_vag_diagnostic_session};
-    if (sendKwpRequestTp20(tester_tx_id, ecu_tx_id, session_req, sizeof(session_req),
-                           (uint8_t)(k_sid_kwp_start_diagnostic_session + 0x40), tx_seq, out, started_ms,
-                           timeout_ms)) {
-      ok = sendKwpRequestTp20(tester_tx_id, ecu_tx_id, request, request_len, positive_sid, tx_seq, out, started_ms,
-                              timeout_ms);
+  const bool reused = g_tp20_session.open;
+  if (reused || openTp20Session(out, started_ms, timeout_ms)) {
+    clearTp20RxQueue();
+    g_tp20_active = true;
+    ok = sendKwpRequestTp20(g_tp20_session.testerTxId, g_tp20_session.ecuTxId, request, request_len, positive_sid,
+                            g_tp20_session.txSeq, out, started_ms, timeout_ms);
+    if (!ok && reused && !out.negative) {
+      // The module may have dropped the channel since the last request; set it up again once.
+      closeTp20Session("stale");
+      clearResult(out);
+      out.route = &k_kwp_tp20_haldex_route;
+      const uint32_t retry_ms = millis();
+      if (openTp20Session(out, retry_ms, timeout_ms)) {
+        ok = sendKwpRequestTp20(g_tp20_session.testerTxId, g_tp20_session.ecuTxId, request, request_len,
+                                positive_sid, g_tp20_session.txSeq, out, retry_ms, timeout_ms);
+      }
     }
-  }
 
-  if (channel_open) {
-    disconnectTp20Channel(tester_tx_id, ecu_tx_id);
+    if (g_tp20_session.open && (ok || out.negative)) {
+      g_tp20_session.lastUseMs = millis();
+      g_tp20_session.lastTrafficMs = g_tp20_session.lastUseMs;
+      g_tp20_session.requests++;
+      g_tp20_active = false;
+    } else {
+      closeTp20Session(out.status ? out.status : "error");
+    }
   }
 
-  g_tp20_active = false;
-  g_tp20_response_id = 0;
   out.elapsedMs = millis() - started_ms;
   xSemaphoreGive(g_diag_mutex);
 
@@ -937,6 +1421,58 @@ bool diagKwpTp20ClearDtc(uint32_t group_of_dtc, diag_uds_result_t& out, uint32_t
                            timeout_ms);
 }
 
+uint32_t diagKwpTp20SessionService() {
+  if (!g_tp20_session.open || !g_diag_mutex) {
+    return 0;
+  }
+  if (xSemaphoreTake(g_diag_mutex, 0) != pdTRUE) {
+    return k_tp20_keepalive_ms; // a request holds the channel
+  }
+
+  uint32_t next_ms = 0;
+  uint32_t now = millis();
+  if (g_tp20_session.open && (now - g_tp20_session.lastUseMs) >= k_tp20_idle_close_ms) {
+    closeTp20Session("idle");
+  } else if (g_tp20_session.open && (now - g_tp20_session.lastTrafficMs) >= k_tp20_keepalive_ms) {
+    if (testTp20Channel()) {
+      g_tp20_session.keepAlives++;
+      g_tp20_session.lastTrafficMs = millis();
+    } else {
+      closeTp20Session("channel_test_failed");
+    }
+  }
+
+  if (g_tp20_session.open) {
+    now = millis();
+    const uint32_t since_traffic = now - g_tp20_session.lastTrafficMs;
+    const uint32_t since_use = now - g_tp20_session.lastUseMs;
+    const uint32_t to_test = since_traffic >= k_tp20_keepalive_ms ? 0 : k_tp20_keepalive_ms - since_traffic;
+    const uint32_t to_idle = since_use >= k_tp20_idle_close_ms ? 0 : k_tp20_idle_close_ms - since_use;
+    next_ms = to_test < to_idle ? to_test : to_idle;
+    if (next_ms == 0) {
+      next_ms = 1;
+    }
+  }
+  xSemaphoreGive(g_diag_mutex);
+  return next_ms;
+}
+
+void diagUdsIsoTpConfigGet(diag_isotp_config_t& out) {
+  portENTER_CRITICAL(&g_isotp_mux);
+  out = g_isotp;
+  portEXIT_CRITICAL(&g_isotp_mux);
+}
+
+bool diagUdsIsoTpConfigSet(const diag_isotp_config_t& in) {
+  if (!isValidStMin(in.rxStMin) || in.nBsMs < 50 || in.nBsMs > 10000 || in.nCrMs < 50 || in.nCrMs > 10000) {
+    return false;
+  }
+  portENTER_CRITICAL(&g_isotp_mux);
+  g_isotp = in;
+  portEXIT_CRITICAL(&g_isotp_mux);
+  return true;
+}
+
 bool diagUdsHasSelectedRoute() {
   return g_selected_route_index >= 0 &&
          g_selected_route_index < (int)(sizeof(k_haldex_routes) / sizeof(k_haldex_routes[0]));
@@ -1007,6 +1543,27 @@ void diagUdsWriteStatusJson(JsonObject out) {
   const bool last_was_tp20 = strcmp(g_last_transport, "kwp_tp20") == 0;
   writeRouteJson(route, (g_tp20_active || last_was_tp20) ? &k_kwp_tp20_haldex_route : diagUdsSelectedRoute());
 
+  diag_isotp_config_t isotp;
+  diagUdsIsoTpConfigGet(isotp);
+  JsonObject iso_tp = out["isoTp"].to<JsonObject>();
+  iso_tp["blockSize"] = isotp.rxBlockSize;
+  iso_tp["stMin"] = isotp.rxStMin;
+  iso_tp["nBsMs"] = isotp.nBsMs;
+  iso_tp["nCrMs"] = isotp.nCrMs;
+
+  JsonObject tp20 = out["tp20Session"].to<JsonObject>();
+  const uint32_t now = millis();
+  tp20["open"] = g_tp20_session.open;
+  if (g_tp20_session.open) {
+    tp20["ageMs"] = now - g_tp20_session.openedMs;
+    tp20["idleMs"] = now - g_tp20_session.lastUseMs;
+    tp20["requests"] = g_tp20_session.requests;
+  }
+  tp20["opens"] = g_tp20_session.opens;
+  tp20["keepAlives"] = g_tp20_session.keepAlives;
+  tp20["keepAliveMs"] = k_tp20_keepalive_ms;
+  tp20["idleCloseMs"] = k_tp20_idle_close_ms;
+
   JsonObject last = out["last"].to<JsonObject>();
   if (g_last_result_ms == 0) {
     last["available"] = false;
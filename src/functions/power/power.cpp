@@ -79,6 +79,20 @@ void powerInitBootState() {
 }
 
 void powerLoadBootSettings() {
+  // Fast path: the settings config section (also primes storageLoad so NVS is only read once).
+  storage_boot_config_t boot_config = {};
+  if (storageReadBootConfig(boot_config)) {
+    if (boot_config.generation == 1 || boot_config.generation == 2 || boot_config.generation == 4 ||
+        boot_config.generation == 5) {
+      haldexGeneration = boot_config.generation;
+    }
+    lowPowerSleepEnabled = boot_config.lowPowerSleepEnabled;
+    lowPowerSleepDelayMs = clamp_u32(boot_config.lowPowerSleepDelayMs, 5000, 600000);
+    lowPowerWakeTimerSeconds = clamp_u32(boot_config.lowPowerWakeTimerSeconds, 30, 86400);
+    lowPowerProbeDurationMs = clamp_u32(boot_config.lowPowerProbeDurationMs, 100, 5000);
+    return;
+  }
+
   Preferences boot_pref;
   if (!boot_pref.begin("openhaldex", true)) {
     return;
@@ -23,6 +23,15 @@ static const char* LOG_ERROR_FILE = "/logs/error/error.txt";
 static const size_t LOG_FILE_MAX_BYTES = 256 * 1024;
 static const uint8_t LOG_FILE_ROTATIONS = 4;
 
+// Sparse time index: one {millis, offset} record each time a line crosses a stride boundary.
+static const char* LOG_INDEX_EXT = ".idx";
+static const size_t LOG_INDEX_STRIDE_BYTES = 4096;
+
+struct filelog_index_record_t {
+  uint32_t ms;
+  uint32_t offset;
+};
+
 static SemaphoreHandle_t filelog_mutex = nullptr;
 static bool filelog_ready = false;
 
@@ -150,6 +159,29 @@ static String filelog_rotated_path(const String& path, uint8_t idx) {
   return out;
 }
 
+static String filelog_index_path(const String& path) {
+  return path + LOG_INDEX_EXT;
+}
+
+static bool filelog_is_index_path(const String& path) {
+  return path.endsWith(LOG_INDEX_EXT);
+}
+
+static void filelog_move_file(const String& from, const String& to) {
+  if (!LittleFS.exists(from))
+    return;
+  if (LittleFS.exists(to)) {
+    LittleFS.remove(to);
+  }
+  LittleFS.rename(from, to);
+}
+
+static void filelog_remove_file(const String& path) {
+  if (LittleFS.exists(path)) {
+    LittleFS.remove(path);
+  }
+}
+
 static void filelog_rotate_if_needed(const String& path) {
   if (!LittleFS.exists(path))
     return;
@@ -165,26 +197,38 @@ static void filelog_rotate_if_needed(const String& path) {
   }
 
   String oldest = filelog_rotated_path(path, LOG_FILE_ROTATIONS);
-  if (LittleFS.exists(oldest)) {
-    LittleFS.remove(oldest);
-  }
+  filelog_remove_file(oldest);
+  filelog_remove_file(filelog_index_path(oldest));
 
+  // Index sidecars travel with their log so rotated files stay seekable.
   for (int i = LOG_FILE_ROTATIONS - 1; i >= 1; i--) {
     String from = filelog_rotated_path(path, (uint8_t)i);
     String to = filelog_rotated_path(path, (uint8_t)(i + 1));
-    if (!LittleFS.exists(from))
-      continue;
-    if (LittleFS.exists(to)) {
-      LittleFS.remove(to);
-    }
-    LittleFS.rename(from, to);
+    filelog_move_file(from, to);
+    filelog_move_file(filelog_index_path(from), filelog_index_path(to));
   }
 
   String first = filelog_rotated_path(path, 1);
-  if (LittleFS.exists(first)) {
-    LittleFS.remove(first);
-  }
+  filelog_remove_file(first);
+  filelog_remove_file(filelog_index_path(first));
   LittleFS.rename(path, first);
+  filelog_move_file(filelog_index_path(path), filelog_index_path(first));
+}
+
+// Record the line start whenever it lands on or spans a stride boundary; stateless across reboots.
+static void filelog_index_line_unlocked(const String& path, size_t offset, size_t len, uint32_t ms) {
+  const bool crosses = (offset % LOG_INDEX_STRIDE_BYTES) == 0 ||
+                       (offset / LOG_INDEX_STRIDE_BYTES) != ((offset + len) / LOG_INDEX_STRIDE_BYTES);
+  if (!crosses) {
+    return;
+  }
+
+  File idx = LittleFS.open(filelog_index_path(path), "a");
+  if (!idx)
+    return;
+  const filelog_index_record_t rec = {ms, (uint32_t)offset};
+  idx.write((const uint8_t*)&rec, sizeof(rec));
+  idx.close();
 }
 
 static bool filelog_append_line_unlocked(const String& path, const String& line) {
@@ -198,8 +242,12 @@ static bool filelog_append_line_unlocked(const String& path, const String& line)
   File f = LittleFS.open(path, "a");
   if (!f)
     return false;
+  const size_t offset = f.size();
   size_t written = f.print(line);
   f.close();
+  if (written > 0) {
+    filelog_index_line_unlocked(path, offset, written, millis());
+  }
   return written == line.length();
 }
 
@@ -290,7 +338,7 @@ static void filelog_list_dir(JsonArray out, const String& dir_path, const char*
 
   File file = dir.openNextFile();
   while (file) {
-    if (!file.isDirectory()) {
+    if (!file.isDirectory() && !filelog_is_index_path(file.name())) {
       String path = file.name();
       if (!path.startsWith("/")) {
         path = dir_path + "/" + path;
@@ -448,6 +496,41 @@ void filelogLogCanFrame(const twai_message_t& msg, uint8_t bus, uint8_t dir, boo
   xSemaphoreGive(filelog_mutex);
 }
 
+void filelogLogMeasuredValue(uint16_t did, const uint8_t* data, uint16_t len) {
+  if (!filelog_ready || !storageFsReady()) {
+    return;
+  }
+  if (!filelog_should_emit_file("CAN", "can")) {
+    return;
+  }
+
+  if (xSemaphoreTake(filelog_mutex, 0) != pdTRUE) {
+    return;
+  }
+
+  String line;
+  line.reserve(48 + (size_t)len * 3);
+  line += String(millis());
+  line += "\tUDS\thaldex\tRX\t-\t0x";
+  line += String(did, HEX);
+  line += "\t";
+  line += String(len);
+  line += "\t";
+
+  for (uint16_t i = 0; i < len; i++) {
+    if (i > 0)
+      line += " ";
+    if (data[i] < 16)
+      line += "0";
+    line += String(data[i], HEX);
+  }
+  line += "\n";
+
+  filelog_append_line_unlocked(LOG_CAN_FILE, line);
+  filelog_append_line_unlocked(LOG_ALL_FILE, line);
+  xSemaphoreGive(filelog_mutex);
+}
+
 void filelogList(JsonArray out) {
   if (!filelog_ready || !storageFsReady()) {
     return;
@@ -508,6 +591,120 @@ bool filelogRead(const String& path, String& out, size_t max_bytes) {
   return true;
 }
 
+static bool filelog_range_open(const String& path) {
+  if (!filelog_ready || !storageFsReady()) {
+    return false;
+  }
+  if (!filelog_is_valid_path(path) || filelog_is_index_path(path)) {
+    return false;
+  }
+  return LittleFS.exists(path);
+}
+
+bool filelogResolveByteRange(const String& path, size_t from, size_t to, filelog_range_t& out) {
+  out = {};
+  if (!filelog_range_open(path)) {
+    return false;
+  }
+  if (xSemaphoreTake(filelog_mutex, pdMS_TO_TICKS(200)) != pdTRUE) {
+    return false;
+  }
+
+  File f = LittleFS.open(path, "r");
+  if (!f) {
+    xSemaphoreGive(filelog_mutex);
+    return false;
+  }
+  out.size = f.size();
+  f.close();
+  xSemaphoreGive(filelog_mutex);
+
+  out.end = (to == 0 || to > out.size) ? out.size : to;
+  out.start = from < out.end ? from : out.end;
+  return true;
+}
+
+// Millis restarts on every boot, so the index is walked as monotonic segments and the newest match wins.
+bool filelogResolveTimeRange(const String& path, uint32_t since_ms, uint32_t until_ms, filelog_range_t& out) {
+  out = {};
+  if (!filelog_range_open(path)) {
+    return false;
+  }
+  if (xSemaphoreTake(filelog_mutex, pdMS_TO_TICKS(200)) != pdTRUE) {
+    return false;
+  }
+
+  File f = LittleFS.open(path, "r");
+  if (!f) {
+    xSemaphoreGive(filelog_mutex);
+    return false;
+  }
+  out.size = f.size();
+  f.close();
+
+  bool have_start = false;
+  bool end_locked = false;
+  bool first = true;
+  size_t start = 0;
+  size_t end = out.size;
+  uint32_t prev_ms = 0;
+
+  File idx = LittleFS.open(filelog_index_path(path), "r");
+  if (idx) {
+    filelog_index_record_t rec = {};
+    while (idx.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec)) {
+      if (rec.offset >= out.size) {
+        break;
+      }
+      const bool new_segment = !first && rec.ms < prev_ms;
+      first = false;
+      prev_ms = rec.ms;
+
+      if (rec.ms <= since_ms) {
+        start = rec.offset;
+        have_start = true;
+        end = out.size;
+        end_locked = false;
+        continue;
+      }
+      if (end_locked || rec.offset <= start) {
+        continue;
+      }
+      if (new_segment || (until_ms > 0 && rec.ms > until_ms)) {
+        end = rec.offset;
+        end_locked = true;
+      }
+    }
+    idx.close();
+  }
+  xSemaphoreGive(filelog_mutex);
+
+  out.start = start < end ? start : end;
+  out.end = end;
+  out.indexed = have_start || end_locked;
+  return true;
+}
+
+bool filelogReadChunk(const String& path, size_t offset, uint8_t* buffer, size_t max_len, size_t& read_len) {
+  read_len = 0;
+  if (!buffer || max_len == 0 || !filelog_range_open(path)) {
+    return true;
+  }
+  if (xSemaphoreTake(filelog_mutex, pdMS_TO_TICKS(20)) != pdTRUE) {
+    return false;
+  }
+
+  File f = LittleFS.open(path, "r");
+  if (f) {
+    if (offset < f.size() && f.seek(offset, SeekSet)) {
+      read_len = f.read(buffer, max_len);
+    }
+    f.close();
+  }
+  xSemaphoreGive(filelog_mutex);
+  return true;
+}
+
 bool filelogDelete(const String& path) {
   if (!filelog_ready || !storageFsReady()) {
     return false;
@@ -522,6 +719,7 @@ bool filelogDelete(const String& path) {
     return false;
   }
   bool ok = LittleFS.remove(path);
+  filelog_remove_file(filelog_index_path(path));
   xSemaphoreGive(filelog_mutex);
   return ok;
 }
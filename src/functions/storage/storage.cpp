@@ -3,6 +3,7 @@
 #include <ArduinoJson.h>
 #include <LittleFS.h>
 #include <Preferences.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "functions/config/config.h"
@@ -12,10 +13,15 @@
 static Preferences pref;
 static bool fs_ready = false;
 static volatile bool storage_dirty = false;
+static volatile uint32_t storage_dirty_ms = 0;
 
 static const char* MAP_DIR = "/maps";
-static const char* MAP_FILE = "/maps/current.json";
+static const char* MAP_FILE = "/maps/current.ohmap";
+static const char* LEGACY_MAP_FILE = "/maps/current.json";
+static const char* MAP_BIN_EXT = ".ohmap";
 static const char* CURRENT_MAP_KEY = "currentMap";
+static const char* MAP_FORMAT_KEY = "mapFormat";
+static const uint8_t MAP_FORMAT_VERSION = 1;
 
 static const char* WIFI_SSID_KEY = "wifiSsid";
 static const char* WIFI_PASS_KEY = "wifiPass";
@@ -59,6 +65,304 @@ static const uint8_t MODE_SCHEMA_UNKNOWN = 0;
 static const uint8_t MODE_SCHEMA_LEGACY = 1;
 static const uint8_t MODE_SCHEMA_VERSION = 2;
 
+// Config image in NVS, split by how often each part changes. Every section is its own record with a
+// shadow copy, and a save rewrites only the sections whose contents differ from the last write.
+static const uint16_t CONFIG_SECTION_VERSION = 1;
+static const size_t CONFIG_STRING_BYTES = MAPPED_SIGNAL_KEY_MAX + 1;
+
+struct __attribute__((packed)) storage_section_header_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t sequence;
+  uint32_t crc; // over the section body after this header
+};
+
+// Scalars and curves: everything a mode toggle or settings edit touches.
+struct __attribute__((packed)) storage_settings_section_t {
+  storage_section_header_t header;
+  bool broadcastOpen;
+  bool isStandalone;
+  bool disableControl;
+  uint8_t haldexGen;
+  uint8_t lastMode;
+  uint8_t disableThrottle;
+  uint16_t disableSpeed;
+  uint16_t disengageMap;
+  uint16_t disengageSpeed;
+  uint16_t disengageThrottle;
+  uint16_t disengageRpm;
+  float releaseRate;
+  bool logFile;
+  bool logCan;
+  bool logError;
+  bool logSerial;
+  bool logDebugFirmware;
+  bool logDebugNetwork;
+  bool logDebugCan;
+  bool lowPowerSleep;
+  uint32_t lowPowerDelayMs;
+  uint32_t lowPowerWakeSec;
+  uint32_t lowPowerProbeMs;
+  uint8_t speedCurveCount;
+  uint16_t speedCurveBins[CURVE_POINTS_MAX];
+  uint8_t speedCurveLock[CURVE_POINTS_MAX];
+  uint8_t throttleCurveCount;
+  uint8_t throttleCurveBins[CURVE_POINTS_MAX];
+  uint8_t throttleCurveLock[CURVE_POINTS_MAX];
+  uint8_t rpmCurveCount;
+  uint16_t rpmCurveBins[CURVE_POINTS_MAX];
+  uint8_t rpmCurveLock[CURVE_POINTS_MAX];
+};
+
+// Mapped input signals and the primary mode trigger.
+struct __attribute__((packed)) storage_inputs_section_t {
+  storage_section_header_t header;
+  char mappedSpeed[CONFIG_STRING_BYTES];
+  char mappedThrottle[CONFIG_STRING_BYTES];
+  char mappedRpm[CONFIG_STRING_BYTES];
+  bool triggerEnabled;
+  uint8_t triggerOp;
+  float triggerValue;
+  uint8_t triggerMode;
+  bool triggerBroadcast;
+  char triggerSignal[CONFIG_STRING_BYTES];
+};
+
+struct __attribute__((packed)) storage_dashboard_section_t {
+  storage_section_header_t header;
+  char dashboard[DASHBOARD_SIGNAL_SLOT_COUNT][CONFIG_STRING_BYTES];
+};
+
+// Active map and learn table, so boot never needs LittleFS for them.
+struct __attribute__((packed)) storage_map_section_t {
+  storage_section_header_t header;
+  bool learnValid;
+  uint8_t learnTable[sizeof(haldexLearnTable)];
+  uint16_t mapSpeedBins[MAP_SPEED_BINS];
+  uint8_t mapThrottleBins[MAP_THROTTLE_BINS];
+  uint8_t mapLockTable[MAP_THROTTLE_BINS][MAP_SPEED_BINS];
+};
+
+struct storage_config_t {
+  storage_settings_section_t settings;
+  storage_inputs_section_t inputs;
+  storage_dashboard_section_t dashboard;
+  storage_map_section_t map;
+};
+
+enum {
+  CONFIG_SECTION_SETTINGS = 0,
+  CONFIG_SECTION_INPUTS,
+  CONFIG_SECTION_DASHBOARD,
+  CONFIG_SECTION_MAP,
+  CONFIG_SECTION_COUNT,
+};
+
+static const uint8_t CONFIG_SECTIONS_ALL = (1U << CONFIG_SECTION_COUNT) - 1;
+
+struct storage_section_desc_t {
+  const char* name;
+  const char* key;
+  const char* shadowKey;
+  uint32_t magic;
+  size_t offset; // in storage_config_t
+  uint16_t size;
+};
+
+static const storage_section_desc_t k_config_sections[CONFIG_SECTION_COUNT] = {
+  {"settings", "cfgSettings", "cfgSettingsB", 0x5453484F, // "OHST"
+   offsetof(storage_config_t, settings), sizeof(storage_settings_section_t)},
+  {"inputs", "cfgInputs", "cfgInputsB", 0x4E49484F, // "OHIN"
+   offsetof(storage_config_t, inputs), sizeof(storage_inputs_section_t)},
+  {"dashboard", "cfgDash", "cfgDashB", 0x5344484F, // "OHDS"
+   offsetof(storage_config_t, dashboard), sizeof(storage_dashboard_section_t)},
+  {"map", "cfgMap", "cfgMapB", 0x4C4D484F, // "OHML"
+   offsetof(storage_config_t, map), sizeof(storage_map_section_t)},
+};
+
+// Extra mode-trigger rules get their own record, written only when the rules change.
+static const char* TRIGGER_RULES_KEY = "trigRules";
+static const uint32_t TRIGGER_RULES_MAGIC = 0x5254484F; // "OHTR"
+static const uint16_t TRIGGER_RULES_VERSION = 1;
+
+struct __attribute__((packed)) storage_trigger_term_t {
+  uint8_t op;
+  float value;
+  float hysteresis;
+  char signal[CONFIG_STRING_BYTES];
+};
+
+struct __attribute__((packed)) storage_trigger_rule_t {
+  bool enabled;
+  uint8_t combine;
+  uint16_t debounceMs;
+  uint8_t mode;
+  bool broadcast;
+  uint8_t termCount;
+  storage_trigger_term_t terms[MODE_TRIGGER_TERM_MAX];
+};
+
+struct __attribute__((packed)) storage_trigger_rules_blob_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint32_t crc;
+  uint8_t count;
+  storage_trigger_rule_t rules[MODE_TRIGGER_RULE_MAX];
+};
+
+static const size_t TRIGGER_RULES_BODY_OFFSET = offsetof(storage_trigger_rules_blob_t, crc) + sizeof(uint32_t);
+
+// One complete map (axes + lock table); loaders fill one of these before it is applied.
+struct storage_map_image_t {
+  uint16_t speedBins[MAP_SPEED_BINS];
+  uint8_t throttleBins[MAP_THROTTLE_BINS];
+  uint8_t lockTable[MAP_THROTTLE_BINS][MAP_SPEED_BINS];
+};
+
+// .ohmap file: fixed header, axis sizes, the raw map image and a CRC32 over everything before it.
+static const uint32_t MAP_BIN_MAGIC = 0x504D484F; // "OHMP"
+static const uint16_t MAP_BIN_VERSION = 1;
+
+struct __attribute__((packed)) storage_ohmap_file_t {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t size;
+  uint8_t speedBinCount;
+  uint8_t throttleBinCount;
+  uint8_t lockMax;
+  uint8_t reserved;
+  storage_map_image_t map;
+  uint32_t crc;
+};
+
+// Last sections written to (or read from) NVS; storageSave diffs against them so unchanged sections cost
+// nothing. Both images are static because they are too big for the storage task stack.
+static storage_config_t config_last = {};
+static storage_config_t config_next = {};
+static bool config_section_valid[CONFIG_SECTION_COUNT] = {};
+static uint8_t config_section_rewrite = 0; // restored from a shadow copy: write even though unchanged
+static uint32_t config_section_saves[CONFIG_SECTION_COUNT] = {};
+// Rules record last written or read; static because it is too big for the storage task stack.
+static storage_trigger_rules_blob_t trigger_rules_last = {};
+static storage_trigger_rules_blob_t trigger_rules_next = {};
+static bool trigger_rules_last_valid = false;
+// Map last mirrored to /maps/current.ohmap; the file only changes when the active map differs.
+static storage_map_image_t map_fs_image = {};
+static bool map_fs_image_valid = false;
+static const char* config_source = "none";
+static uint32_t config_load_us = 0;
+static uint32_t config_loaded_ms = 0;
+
+static uint32_t storage_save_count = 0;
+static uint32_t storage_save_skipped = 0;
+static uint32_t storage_write_count = 0;
+static uint16_t storage_last_save_writes = 0;
+static uint32_t storage_last_save_ms = 0;
+static uint32_t storage_last_save_duration_ms = 0;
+
+static uint32_t storage_crc32(const uint8_t* data, size_t len) {
+  uint32_t crc = 0xFFFFFFFFUL;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320UL) : (crc >> 1);
+    }
+  }
+  return ~crc;
+}
+
+static uint8_t* storage_section_bytes(storage_config_t& config, uint8_t section) {
+  return (uint8_t*)&config + k_config_sections[section].offset;
+}
+
+static storage_section_header_t& storage_section_header(storage_config_t& config, uint8_t section) {
+  return *(storage_section_header_t*)storage_section_bytes(config, section);
+}
+
+static uint32_t storage_section_crc(const uint8_t* bytes, uint16_t size) {
+  return storage_crc32(bytes + sizeof(storage_section_header_t), size - sizeof(storage_section_header_t));
+}
+
+static bool storage_section_valid(const uint8_t* bytes, uint8_t section) {
+  const storage_section_desc_t& desc = k_config_sections[section];
+  const storage_section_header_t* header = (const storage_section_header_t*)bytes;
+  return header->magic == desc.magic && header->version == CONFIG_SECTION_VERSION && header->size == desc.size &&
+         header->crc == storage_section_crc(bytes, desc.size);
+}
+
+static uint32_t storage_trigger_rules_crc(const storage_trigger_rules_blob_t& blob) {
+  const uint8_t* bytes = (const uint8_t*)&blob;
+  return storage_crc32(bytes + TRIGGER_RULES_BODY_OFFSET, sizeof(blob) - TRIGGER_RULES_BODY_OFFSET);
+}
+
+static bool storage_section_changed(uint8_t section) {
+  const size_t body = sizeof(storage_section_header_t);
+  return memcmp(storage_section_bytes(config_next, section) + body, storage_section_bytes(config_last, section) + body,
+                k_config_sections[section].size - body) != 0;
+}
+
+// Primary first; the shadow only costs a second read when the primary is missing or torn.
+static bool storage_read_section(Preferences& prefs, uint8_t section, storage_config_t& out, bool& used_shadow) {
+  const storage_section_desc_t& desc = k_config_sections[section];
+  uint8_t* bytes = storage_section_bytes(out, section);
+  used_shadow = false;
+  if (prefs.getBytes(desc.key, bytes, desc.size) == desc.size && storage_section_valid(bytes, section)) {
+    return true;
+  }
+  if (prefs.getBytes(desc.shadowKey, bytes, desc.size) == desc.size && storage_section_valid(bytes, section)) {
+    used_shadow = true;
+    return true;
+  }
+  return false;
+}
+
+static void storage_copy_string(char* dst, const String& src, const char* what) {
+  if (src.length() >= CONFIG_STRING_BYTES) {
+    LOG_WARN("storage", "%s truncated to %u chars", what, (unsigned)(CONFIG_STRING_BYTES - 1));
+  }
+  strncpy(dst, src.c_str(), CONFIG_STRING_BYTES - 1);
+  dst[CONFIG_STRING_BYTES - 1] = '\0';
+}
+
+static void storage_capture_map_image(storage_map_image_t& out) {
+  memcpy(out.speedBins, map_speed_bins, sizeof(map_speed_bins));
+  memcpy(out.throttleBins, map_throttle_bins, sizeof(map_throttle_bins));
+  memcpy(out.lockTable, map_lock_table, sizeof(map_lock_table));
+}
+
+static void storage_apply_map_image(const storage_map_image_t& map) {
+  memcpy(map_speed_bins, map.speedBins, sizeof(map_speed_bins));
+  memcpy(map_throttle_bins, map.throttleBins, sizeof(map_throttle_bins));
+  memcpy(map_lock_table, map.lockTable, sizeof(map_lock_table));
+}
+
+// Applies a loaded map and publishes it to the control path. On a publish timeout the previous map is
+// put back, so the working arrays never hold a map the control path is not running.
+static bool storage_publish_map_image(const storage_map_image_t& map, const String& path) {
+  storage_map_image_t previous;
+  storage_capture_map_image(previous);
+  storage_apply_map_image(map);
+  if (lockTablesPublish()) {
+    return true;
+  }
+  storage_apply_map_image(previous);
+  LOG_ERROR("storage", "Map load failed: publish timed out path=%s", path.c_str());
+  return false;
+}
+
+static bool storage_map_matches_fs_image() {
+  storage_map_image_t active;
+  storage_capture_map_image(active);
+  return map_fs_image_valid && memcmp(&map_fs_image, &active, sizeof(active)) == 0;
+}
+
+static void storage_capture_map_fs_image() {
+  storage_capture_map_image(map_fs_image);
+  map_fs_image_valid = true;
+}
+
 static bool learn_table_is_usable() {
   bool any_response = false;
   for (size_t i = 0; i < sizeof(haldexLearnTable); i++) {
@@ -153,7 +457,7 @@ static int split_tabs(const String& line, String parts[], int max_parts) {
   return count;
 }
 
-static bool parse_map_txt(const String& text) {
+static bool parse_map_txt(const String& text, storage_map_image_t& out) {
   // Parse tab-delimited map format: first row is speed bins, subsequent rows are throttle bins + lock percentages
   String parts[32];
   String line;
@@ -169,7 +473,7 @@ static bool parse_map_txt(const String& text) {
     return false;
 
   for (uint8_t i = 0; i < MAP_SPEED_BINS; i++) {
-    map_speed_bins[i] = (uint16_t)parse_token_int(parts[i + 2]);
+    out.speedBins[i] = (uint16_t)parse_token_int(parts[i + 2]);
   }
 
   uint8_t row = 0;
@@ -195,7 +499,7 @@ static bool parse_map_txt(const String& text) {
     if (throttle == 0 && throttle_id.length() == 0) {
       throttle = parse_token_int(parts[1]);
     }
-    map_throttle_bins[row] = (uint8_t)throttle;
+    out.throttleBins[row] = (uint8_t)throttle;
 
     for (uint8_t s = 0; s < MAP_SPEED_BINS; s++) {
       int v = parse_token_int(parts[s + 2]);
@@ -203,7 +507,7 @@ static bool parse_map_txt(const String& text) {
         v = 0;
       if (v > 100)
         v = 100;
-      map_lock_table[row][s] = (uint8_t)v;
+      out.lockTable[row][s] = (uint8_t)v;
     }
 
     row++;
@@ -212,27 +516,10 @@ static bool parse_map_txt(const String& text) {
   return (row == MAP_THROTTLE_BINS);
 }
 
-static bool load_map_from_json_file(const char* path) {
-  if (!fs_ready)
-    return false;
-  if (!LittleFS.exists(path))
-    return false;
-
-  File f = LittleFS.open(path, "r");
-  if (!f)
-    return false;
-
-  String body = f.readString();
-  f.close();
-
-  JsonDocument doc;
-  if (deserializeJson(doc, body) != DeserializationError::Ok) {
-    return false;
-  }
-
-  JsonArray speedBins = doc["speedBins"].as<JsonArray>();
-  JsonArray throttleBins = doc["throttleBins"].as<JsonArray>();
-  JsonArray lockTable = doc["lockTable"].as<JsonArray>();
+static bool parse_map_json(JsonVariantConst doc, storage_map_image_t& out) {
+  JsonArrayConst speedBins = doc["speedBins"].as<JsonArrayConst>();
+  JsonArrayConst throttleBins = doc["throttleBins"].as<JsonArrayConst>();
+  JsonArrayConst lockTable = doc["lockTable"].as<JsonArrayConst>();
 
   if (speedBins.size() != MAP_SPEED_BINS || throttleBins.size() != MAP_THROTTLE_BINS ||
       lockTable.size() != MAP_THROTTLE_BINS) {
@@ -240,15 +527,15 @@ static bool load_map_from_json_file(const char* path) {
   }
 
   for (uint8_t i = 0; i < MAP_SPEED_BINS; i++) {
-    map_speed_bins[i] = (uint16_t)(speedBins[i] | 0);
+    out.speedBins[i] = (uint16_t)(speedBins[i] | 0);
   }
 
   for (uint8_t i = 0; i < MAP_THROTTLE_BINS; i++) {
-    map_throttle_bins[i] = (uint8_t)(throttleBins[i] | 0);
+    out.throttleBins[i] = (uint8_t)(throttleBins[i] | 0);
   }
 
   for (uint8_t t = 0; t < MAP_THROTTLE_BINS; t++) {
-    JsonArray row = lockTable[t].as<JsonArray>();
+    JsonArrayConst row = lockTable[t].as<JsonArrayConst>();
     if (row.size() != MAP_SPEED_BINS) {
       return false;
     }
@@ -258,47 +545,78 @@ static bool load_map_from_json_file(const char* path) {
         v = 0;
       if (v > 100)
         v = 100;
-      map_lock_table[t][s] = (uint8_t)v;
+      out.lockTable[t][s] = (uint8_t)v;
     }
   }
 
   return true;
 }
 
-static bool save_map_to_json_file(const char* path) {
-  if (!fs_ready)
-    return false;
-  LittleFS.mkdir(MAP_DIR);
-
-  File f = LittleFS.open(path, "w");
-  if (!f)
-    return false;
-
+static void render_map_json(const storage_map_image_t& map, String& out) {
   JsonDocument doc;
   JsonArray speedBins = doc["speedBins"].to<JsonArray>();
   for (uint8_t i = 0; i < MAP_SPEED_BINS; i++) {
-    speedBins.add(map_speed_bins[i]);
+    speedBins.add(map.speedBins[i]);
   }
 
   JsonArray throttleBins = doc["throttleBins"].to<JsonArray>();
   for (uint8_t i = 0; i < MAP_THROTTLE_BINS; i++) {
-    throttleBins.add(map_throttle_bins[i]);
+    throttleBins.add(map.throttleBins[i]);
   }
 
   JsonArray lockTable = doc["lockTable"].to<JsonArray>();
   for (uint8_t t = 0; t < MAP_THROTTLE_BINS; t++) {
     JsonArray row = lockTable.add<JsonArray>();
     for (uint8_t s = 0; s < MAP_SPEED_BINS; s++) {
-      row.add(map_lock_table[t][s]);
+      row.add(map.lockTable[t][s]);
     }
   }
 
-  serializeJson(doc, f);
+  out = "";
+  serializeJson(doc, out);
+}
+
+// Same tab-separated layout parse_map_txt and the map editor export use.
+static void render_map_txt(const storage_map_image_t& map, String& out) {
+  out = "T\tThrottle";
+  for (uint8_t s = 0; s < MAP_SPEED_BINS; s++) {
+    out += "\tS";
+    out += String(map.speedBins[s]);
+  }
+  for (uint8_t t = 0; t < MAP_THROTTLE_BINS; t++) {
+    out += "\nT";
+    out += String(map.throttleBins[t]);
+    out += "\t";
+    out += String(map.throttleBins[t]);
+    for (uint8_t s = 0; s < MAP_SPEED_BINS; s++) {
+      out += "\t";
+      out += String(map.lockTable[t][s]);
+    }
+  }
+  out += "\n";
+}
+
+static bool load_map_from_json_file(const char* path, storage_map_image_t& out) {
+  if (!fs_ready)
+    return false;
+  if (!LittleFS.exists(path))
+    return false;
+
+  File f = LittleFS.open(path, "r");
+  if (!f)
+    return false;
+
+  String body = f.readString();
   f.close();
-  return true;
+
+  JsonDocument doc;
+  if (deserializeJson(doc, body) != DeserializationError::Ok) {
+    return false;
+  }
+  return parse_map_json(doc.as<JsonVariantConst>(), out);
 }
 
-static bool load_map_from_txt_file(const char* path) {
+static bool load_map_from_txt_file(const char* path, storage_map_image_t& out) {
   if (!fs_ready)
     return false;
   if (!LittleFS.exists(path))
@@ -311,7 +629,94 @@ static bool load_map_from_txt_file(const char* path) {
   String body = f.readString();
   f.close();
 
-  return parse_map_txt(body);
+  return parse_map_txt(body, out);
+}
+
+static uint32_t ohmap_crc(const storage_ohmap_file_t& file) {
+  return storage_crc32((const uint8_t*)&file, offsetof(storage_ohmap_file_t, crc));
+}
+
+// Binary maps are read straight into the image; validation is a header compare plus one CRC pass.
+static bool load_map_from_ohmap_file(const char* path, storage_map_image_t& out) {
+  if (!fs_ready)
+    return false;
+  if (!LittleFS.exists(path))
+    return false;
+
+  File f = LittleFS.open(path, "r");
+  if (!f)
+    return false;
+
+  storage_ohmap_file_t file;
+  const size_t read = f.read((uint8_t*)&file, sizeof(file));
+  f.close();
+
+  if (read != sizeof(file) || file.magic != MAP_BIN_MAGIC || file.version != MAP_BIN_VERSION ||
+      file.size != sizeof(file) || file.speedBinCount != MAP_SPEED_BINS ||
+      file.throttleBinCount != MAP_THROTTLE_BINS || file.crc != ohmap_crc(file)) {
+    return false;
+  }
+  for (uint8_t t = 0; t < MAP_THROTTLE_BINS; t++) {
+    for (uint8_t s = 0; s < MAP_SPEED_BINS; s++) {
+      if (file.map.lockTable[t][s] > file.lockMax || file.map.lockTable[t][s] > 100) {
+        return false;
+      }
+    }
+  }
+
+  out = file.map;
+  return true;
+}
+
+static bool save_map_to_ohmap_file(const char* path, const storage_map_image_t& map) {
+  if (!fs_ready)
+    return false;
+  LittleFS.mkdir(MAP_DIR);
+
+  storage_ohmap_file_t file = {};
+  file.magic = MAP_BIN_MAGIC;
+  file.version = MAP_BIN_VERSION;
+  file.size = sizeof(file);
+  file.speedBinCount = MAP_SPEED_BINS;
+  file.throttleBinCount = MAP_THROTTLE_BINS;
+  file.lockMax = 100;
+  file.map = map;
+  file.crc = ohmap_crc(file);
+
+  // Saves repeat the same map often (every save after a map switch); skip the flash write when the file
+  // already holds these bytes.
+  File existing = LittleFS.open(path, "r");
+  if (existing) {
+    storage_ohmap_file_t stored;
+    const bool same = existing.size() == sizeof(stored) &&
+                      existing.read((uint8_t*)&stored, sizeof(stored)) == sizeof(stored) &&
+                      memcmp(&stored, &file, sizeof(file)) == 0;
+    existing.close();
+    if (same) {
+      return true;
+    }
+  }
+
+  File f = LittleFS.open(path, "w");
+  if (!f)
+    return false;
+  const size_t written = f.write((const uint8_t*)&file, sizeof(file));
+  f.close();
+  return written == sizeof(file);
+}
+
+// Any supported map file into an image, without touching the active map.
+static bool load_map_file(const String& path, storage_map_image_t& out) {
+  if (path.endsWith(MAP_BIN_EXT)) {
+    return load_map_from_ohmap_file(path.c_str(), out);
+  }
+  if (path.endsWith(".json")) {
+    return load_map_from_json_file(path.c_str(), out);
+  }
+  if (path.endsWith(".txt")) {
+    return load_map_from_txt_file(path.c_str(), out);
+  }
+  return false;
 }
 
 static String sanitize_map_name(const String& name) {
@@ -331,6 +736,19 @@ static String sanitize_map_name(const String& name) {
   return out;
 }
 
+static String map_path_for_name(const String& name) {
+  String safe = sanitize_map_name(name);
+  if (safe.endsWith(MAP_BIN_EXT)) {
+    safe = safe.substring(0, safe.length() - strlen(MAP_BIN_EXT));
+  } else if (safe.endsWith(".json") || safe.endsWith(".txt")) {
+    safe = safe.substring(0, safe.lastIndexOf('.'));
+  }
+  if (safe.length() == 0) {
+    return String();
+  }
+  return String(MAP_DIR) + "/" + safe + MAP_BIN_EXT;
+}
+
 static bool map_entry_exists(JsonArray out, const String& path) {
   for (JsonVariant v : out) {
     JsonObject obj = v.as<JsonObject>();
@@ -355,19 +773,493 @@ static void add_map_entry(JsonArray out, const String& name, const String& path,
   obj["readOnly"] = readOnly;
 }
 
-static bool load_map_from_fs() {
-  return load_map_from_json_file(MAP_FILE);
-}
-
 static void save_map_to_fs() {
-  save_map_to_json_file(MAP_FILE);
+  storage_capture_map_fs_image();
+  save_map_to_ohmap_file(MAP_FILE, map_fs_image);
 
   String currentPath = storageGetCurrentMapPath();
   if (currentPath.length() > 0 && currentPath != MAP_FILE && currentPath.startsWith("/maps/") &&
-      currentPath.endsWith(".json")) {
-    save_map_to_json_file(currentPath.c_str());
+      currentPath.endsWith(MAP_BIN_EXT)) {
+    save_map_to_ohmap_file(currentPath.c_str(), map_fs_image);
+  }
+}
+
+// One-time conversion of writable JSON maps in /maps to .ohmap. A copy, not a move: the JSON files stay
+// on flash untouched (older firmware and a rollback still find them), and an existing .ohmap is never
+// overwritten.
+static void storage_migrate_json_maps() {
+  if (pref.getUChar(MAP_FORMAT_KEY, 0) >= MAP_FORMAT_VERSION) {
+    return;
+  }
+
+  String currentPath = storageGetCurrentMapPath();
+  String jsonPaths[32];
+  size_t jsonCount = 0;
+  File maps = LittleFS.open(MAP_DIR);
+  if (maps && maps.isDirectory()) {
+    File file = maps.openNextFile();
+    while (file && jsonCount < 32) {
+      if (!file.isDirectory()) {
+        String path = file.name();
+        if (!path.startsWith("/")) {
+          path = String(MAP_DIR) + "/" + path;
+        } else if (!path.startsWith(String(MAP_DIR) + "/")) {
+          path = String(MAP_DIR) + path;
+        }
+        if (path.endsWith(".json")) {
+          jsonPaths[jsonCount++] = path;
+        }
+      }
+      file = maps.openNextFile();
+    }
+  }
+
+  uint8_t converted = 0;
+  for (size_t i = 0; i < jsonCount; i++) {
+    const String& jsonPath = jsonPaths[i];
+    const String binPath =
+      (jsonPath == LEGACY_MAP_FILE) ? String(MAP_FILE) : jsonPath.substring(0, jsonPath.length() - 5) + MAP_BIN_EXT;
+    storage_map_image_t map;
+    if (!LittleFS.exists(binPath) &&
+        (!load_map_from_json_file(jsonPath.c_str(), map) || !save_map_to_ohmap_file(binPath.c_str(), map))) {
+      LOG_WARN("storage", "Map migration skipped path=%s", jsonPath.c_str());
+      continue;
+    }
+    if (currentPath == jsonPath) {
+      storageSetCurrentMapPath(binPath);
+    }
+    converted++;
+  }
+
+  pref.putUChar(MAP_FORMAT_KEY, MAP_FORMAT_VERSION);
+  if (converted > 0) {
+    LOG_INFO("storage", "Converted %u JSON maps to %s", (unsigned)converted, MAP_BIN_EXT);
   }
 }
+
+// Snapshot runtime settings into config_next. Returns the sections it filled completely: one with a
+// field behind a busy state mutex is left out, and the caller keeps the store dirty to retry it.
+static uint8_t storage_build_config() {
+  storage_config_t& next = config_next;
+  memset(&next, 0, sizeof(next));
+  uint8_t complete = (1U << CONFIG_SECTION_SETTINGS) | (1U << CONFIG_SECTION_MAP);
+
+  storage_settings_section_t& settings = next.settings;
+  lastMode = (uint8_t)state.mode;
+  settings.broadcastOpen = broadcastOpenHaldexOverCAN;
+  settings.isStandalone = isStandalone;
+  settings.disableControl = disableController;
+  settings.haldexGen = haldexGeneration;
+  settings.lastMode = lastMode;
+  settings.disableThrottle = disableThrottle;
+  settings.disableSpeed = disableSpeed;
+  settings.disengageMap = disengageUnderSpeedMap;
+  settings.disengageSpeed = disengageUnderSpeedSpeedMode;
+  settings.disengageThrottle = disengageUnderSpeedThrottleMode;
+  settings.disengageRpm = disengageUnderSpeedRpmMode;
+  settings.releaseRate = lockReleaseRatePctPerSec;
+  settings.logFile = logToFileEnabled;
+  settings.logCan = logCanToFileEnabled;
+  settings.logError = logErrorToFileEnabled;
+  settings.logSerial = logSerialEnabled;
+  settings.logDebugFirmware = logDebugFirmwareEnabled;
+  settings.logDebugNetwork = logDebugNetworkEnabled;
+  settings.logDebugCan = logDebugCanEnabled;
+  settings.lowPowerSleep = lowPowerSleepEnabled;
+  settings.lowPowerDelayMs = lowPowerSleepDelayMs;
+  settings.lowPowerWakeSec = lowPowerWakeTimerSeconds;
+  settings.lowPowerProbeMs = lowPowerProbeDurationMs;
+  settings.speedCurveCount = speed_curve_count;
+  memcpy(settings.speedCurveBins, speed_curve_bins, sizeof(speed_curve_bins));
+  memcpy(settings.speedCurveLock, speed_curve_lock, sizeof(speed_curve_lock));
+  settings.throttleCurveCount = throttle_curve_count;
+  memcpy(settings.throttleCurveBins, throttle_curve_bins, sizeof(throttle_curve_bins));
+  memcpy(settings.throttleCurveLock, throttle_curve_lock, sizeof(throttle_curve_lock));
+  settings.rpmCurveCount = rpm_curve_count;
+  memcpy(settings.rpmCurveBins, rpm_curve_bins, sizeof(rpm_curve_bins));
+  memcpy(settings.rpmCurveLock, rpm_curve_lock, sizeof(rpm_curve_lock));
+
+  storage_inputs_section_t& inputs = next.inputs;
+  String mapped_speed;
+  String mapped_throttle;
+  String mapped_rpm;
+  mode_trigger_config_t mode_trigger_config = {};
+  if (mappedInputSignalsGet(mapped_speed, mapped_throttle, mapped_rpm, 2) &&
+      modeTriggerConfigGet(mode_trigger_config, 2)) {
+    storage_copy_string(inputs.mappedSpeed, mapped_speed, "speed mapping");
+    storage_copy_string(inputs.mappedThrottle, mapped_throttle, "throttle mapping");
+    storage_copy_string(inputs.mappedRpm, mapped_rpm, "rpm mapping");
+    inputs.triggerEnabled = mode_trigger_config.enabled;
+    inputs.triggerOp = (uint8_t)mode_trigger_config.op;
+    inputs.triggerValue = mode_trigger_config.value;
+    inputs.triggerMode = (uint8_t)mode_trigger_config.mode;
+    inputs.triggerBroadcast = mode_trigger_config.broadcastOpenHaldexOverCAN;
+    storage_copy_string(inputs.triggerSignal, mode_trigger_config.signal, "mode trigger signal");
+    complete |= 1U << CONFIG_SECTION_INPUTS;
+  }
+  String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+  if (dashboardSignalsGet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 2)) {
+    for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+      storage_copy_string(next.dashboard.dashboard[i], dashboard_slots[i], "dashboard signal");
+    }
+    complete |= 1U << CONFIG_SECTION_DASHBOARD;
+  }
+
+  storage_map_section_t& map = next.map;
+  map.learnValid = haldexLearnTableValid;
+  if (haldexLearnTableValid) {
+    memcpy(map.learnTable, haldexLearnTable, sizeof(haldexLearnTable));
+  }
+  memcpy(map.mapSpeedBins, map_speed_bins, sizeof(map_speed_bins));
+  memcpy(map.mapThrottleBins, map_throttle_bins, sizeof(map_throttle_bins));
+  memcpy(map.mapLockTable, map_lock_table, sizeof(map_lock_table));
+  return complete;
+}
+
+// Applies only the sections in the mask; the rest keep their current (default) values.
+static void storage_apply_config(const storage_config_t& config, uint8_t sections) {
+  if (sections & (1U << CONFIG_SECTION_SETTINGS)) {
+    const storage_settings_section_t& settings = config.settings;
+    broadcastOpenHaldexOverCAN = settings.broadcastOpen;
+    isStandalone = settings.isStandalone;
+    disableController = settings.disableControl;
+    haldexGeneration = settings.haldexGen;
+    lastMode = settings.lastMode;
+    disableThrottle = settings.disableThrottle;
+    disableSpeed = settings.disableSpeed;
+    disengageUnderSpeedMap = settings.disengageMap;
+    disengageUnderSpeedSpeedMode = settings.disengageSpeed;
+    disengageUnderSpeedThrottleMode = settings.disengageThrottle;
+    disengageUnderSpeedRpmMode = settings.disengageRpm;
+    lockReleaseRatePctPerSec = settings.releaseRate;
+    logToFileEnabled = settings.logFile;
+    logCanToFileEnabled = settings.logCan;
+    logErrorToFileEnabled = settings.logError;
+    logSerialEnabled = settings.logSerial;
+    logDebugFirmwareEnabled = settings.logDebugFirmware;
+    logDebugNetworkEnabled = settings.logDebugNetwork;
+    logDebugCanEnabled = settings.logDebugCan;
+    lowPowerSleepEnabled = settings.lowPowerSleep;
+    lowPowerSleepDelayMs = settings.lowPowerDelayMs;
+    lowPowerWakeTimerSeconds = settings.lowPowerWakeSec;
+    lowPowerProbeDurationMs = settings.lowPowerProbeMs;
+    speed_curve_count = settings.speedCurveCount;
+    memcpy(speed_curve_bins, settings.speedCurveBins, sizeof(speed_curve_bins));
+    memcpy(speed_curve_lock, settings.speedCurveLock, sizeof(speed_curve_lock));
+    throttle_curve_count = settings.throttleCurveCount;
+    memcpy(throttle_curve_bins, settings.throttleCurveBins, sizeof(throttle_curve_bins));
+    memcpy(throttle_curve_lock, settings.throttleCurveLock, sizeof(throttle_curve_lock));
+    rpm_curve_count = settings.rpmCurveCount;
+    memcpy(rpm_curve_bins, settings.rpmCurveBins, sizeof(rpm_curve_bins));
+    memcpy(rpm_curve_lock, settings.rpmCurveLock, sizeof(rpm_curve_lock));
+  }
+
+  if (sections & (1U << CONFIG_SECTION_INPUTS)) {
+    const storage_inputs_section_t& inputs = config.inputs;
+    (void)mappedInputSignalsSet(String(inputs.mappedSpeed), String(inputs.mappedThrottle), String(inputs.mappedRpm),
+                                0);
+    mode_trigger_config_t mode_trigger_config = {};
+    mode_trigger_config.enabled = inputs.triggerEnabled;
+    mode_trigger_config.signal = String(inputs.triggerSignal);
+    mode_trigger_config.op = (mode_trigger_operator_t)inputs.triggerOp;
+    mode_trigger_config.value = inputs.triggerValue;
+    mode_trigger_config.mode = (openhaldex_mode_t)inputs.triggerMode;
+    mode_trigger_config.broadcastOpenHaldexOverCAN = inputs.triggerBroadcast;
+    (void)modeTriggerConfigSet(mode_trigger_config, 0);
+  }
+
+  if (sections & (1U << CONFIG_SECTION_DASHBOARD)) {
+    String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+    for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+      dashboard_slots[i] = String(config.dashboard.dashboard[i]);
+    }
+    (void)dashboardSignalsSet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 0);
+  }
+
+  if (sections & (1U << CONFIG_SECTION_MAP)) {
+    const storage_map_section_t& map = config.map;
+    haldexLearnTableValid = map.learnValid;
+    memcpy(haldexLearnTable, map.learnTable, sizeof(haldexLearnTable));
+    memcpy(map_speed_bins, map.mapSpeedBins, sizeof(map_speed_bins));
+    memcpy(map_throttle_bins, map.mapThrottleBins, sizeof(map_throttle_bins));
+    memcpy(map_lock_table, map.mapLockTable, sizeof(map_lock_table));
+  }
+}
+
+// False while the mode-trigger mutex is busy; the caller keeps the store dirty and retries.
+static bool storage_build_trigger_rules(storage_trigger_rules_blob_t& blob) {
+  mode_trigger_rules_t rules = {};
+  if (!modeTriggerRulesGet(rules, 2)) {
+    return false;
+  }
+  memset(&blob, 0, sizeof(blob));
+  blob.magic = TRIGGER_RULES_MAGIC;
+  blob.version = TRIGGER_RULES_VERSION;
+  blob.size = sizeof(blob);
+  blob.count = rules.count;
+  for (uint8_t r = 0; r < rules.count; r++) {
+    const mode_trigger_rule_t& rule = rules.rules[r];
+    storage_trigger_rule_t& out = blob.rules[r];
+    out.enabled = rule.enabled;
+    out.combine = (uint8_t)rule.combine;
+    out.debounceMs = rule.debounceMs;
+    out.mode = (uint8_t)rule.mode;
+    out.broadcast = rule.broadcastOpenHaldexOverCAN;
+    out.termCount = rule.termCount;
+    for (uint8_t t = 0; t < rule.termCount; t++) {
+      out.terms[t].op = (uint8_t)rule.terms[t].op;
+      out.terms[t].value = rule.terms[t].value;
+      out.terms[t].hysteresis = rule.terms[t].hysteresis;
+      storage_copy_string(out.terms[t].signal, rule.terms[t].signal, "mode trigger rule signal");
+    }
+  }
+  blob.crc = storage_trigger_rules_crc(blob);
+  return true;
+}
+
+static void storage_load_trigger_rules() {
+  storage_trigger_rules_blob_t& blob = trigger_rules_last;
+  if (pref.getBytes(TRIGGER_RULES_KEY, &blob, sizeof(blob)) != sizeof(blob) || blob.magic != TRIGGER_RULES_MAGIC ||
+      blob.version != TRIGGER_RULES_VERSION || blob.size != sizeof(blob) ||
+      blob.crc != storage_trigger_rules_crc(blob)) {
+    trigger_rules_last_valid = false;
+    return;
+  }
+
+  mode_trigger_rules_t rules = {};
+  rules.count = std::min<uint8_t>(blob.count, MODE_TRIGGER_RULE_MAX);
+  for (uint8_t r = 0; r < rules.count; r++) {
+    const storage_trigger_rule_t& in = blob.rules[r];
+    mode_trigger_rule_t& rule = rules.rules[r];
+    rule.enabled = in.enabled;
+    rule.combine = (mode_trigger_combine_t)in.combine;
+    rule.debounceMs = in.debounceMs;
+    rule.mode = (openhaldex_mode_t)in.mode;
+    rule.broadcastOpenHaldexOverCAN = in.broadcast;
+    rule.termCount = std::min<uint8_t>(in.termCount, MODE_TRIGGER_TERM_MAX);
+    for (uint8_t t = 0; t < rule.termCount; t++) {
+      rule.terms[t].signal = String(in.terms[t].signal);
+      rule.terms[t].op = (mode_trigger_operator_t)in.terms[t].op;
+      rule.terms[t].value = in.terms[t].value;
+      rule.terms[t].hysteresis = in.terms[t].hysteresis;
+    }
+  }
+  (void)modeTriggerRulesSet(rules, 0);
+  trigger_rules_last_valid = true;
+}
+
+static uint16_t storage_persist_trigger_rules() {
+  if (!storage_build_trigger_rules(trigger_rules_next)) {
+    storage_dirty = true;
+    return 0;
+  }
+  if (trigger_rules_last_valid && memcmp(&trigger_rules_next, &trigger_rules_last, sizeof(trigger_rules_next)) == 0) {
+    return 0;
+  }
+  if (!trigger_rules_last_valid && trigger_rules_next.count == 0) {
+    return 0; // nothing configured and nothing stored
+  }
+  if (pref.putBytes(TRIGGER_RULES_KEY, &trigger_rules_next, sizeof(trigger_rules_next)) != sizeof(trigger_rules_next)) {
+    LOG_ERROR("storage", "mode trigger rules write failed");
+    return 0;
+  }
+  trigger_rules_last = trigger_rules_next;
+  trigger_rules_last_valid = true;
+  return 1;
+}
+
+// Writes primary then shadow so a torn primary always leaves a readable copy behind.
+static uint16_t storage_write_section(uint8_t section) {
+  const storage_section_desc_t& desc = k_config_sections[section];
+  uint8_t* bytes = storage_section_bytes(config_next, section);
+  storage_section_header_t& header = storage_section_header(config_next, section);
+  header.magic = desc.magic;
+  header.version = CONFIG_SECTION_VERSION;
+  header.size = desc.size;
+  header.sequence = config_section_valid[section] ? storage_section_header(config_last, section).sequence + 1 : 1;
+  header.crc = storage_section_crc(bytes, desc.size);
+
+  uint16_t writes = 0;
+  if (pref.putBytes(desc.key, bytes, desc.size) == desc.size) {
+    writes++;
+  } else {
+    LOG_ERROR("storage", "config %s write failed", desc.name);
+  }
+  if (pref.putBytes(desc.shadowKey, bytes, desc.size) == desc.size) {
+    writes++;
+  } else {
+    LOG_ERROR("storage", "config %s shadow write failed", desc.name);
+  }
+  memcpy(storage_section_bytes(config_last, section), bytes, desc.size);
+  config_section_valid[section] = true;
+  config_section_rewrite &= ~(1U << section);
+  config_section_saves[section]++;
+  return writes;
+}
+
+// Persist whatever differs from the last image: changed config sections, the trigger rules record
+// and the current map file.
+static uint16_t storage_persist_changed() {
+  const uint8_t complete = storage_build_config();
+  if (complete != CONFIG_SECTIONS_ALL) {
+    storage_dirty = true;
+  }
+
+  uint16_t writes = 0;
+  for (uint8_t section = 0; section < CONFIG_SECTION_COUNT; section++) {
+    const uint8_t bit = 1U << section;
+    if (!(complete & bit)) {
+      continue;
+    }
+    if (config_section_valid[section] && !(config_section_rewrite & bit) && !storage_section_changed(section)) {
+      continue;
+    }
+    writes += storage_write_section(section);
+  }
+  writes += storage_persist_trigger_rules();
+  if (!storage_map_matches_fs_image()) {
+    save_map_to_fs();
+    writes++;
+  }
+  storage_write_count += writes;
+  return writes;
+}
+
+// Legacy per-key layout; only read when no config section exists (first boot after upgrade).
+static void storage_load_legacy_keys() {
+  broadcastOpenHaldexOverCAN = pref.getBool("broadcastOpen", broadcastOpenHaldexOverCAN);
+  isStandalone = pref.getBool("isStandalone", isStandalone);
+  disableController = pref.getBool("disableControl", disableController);
+
+  haldexGeneration = pref.getUChar("haldexGen", haldexGeneration);
+  uint8_t mode_schema = pref.getUChar(MODE_SCHEMA_KEY, MODE_SCHEMA_UNKNOWN);
+  if (mode_schema == MODE_SCHEMA_UNKNOWN) {
+    bool has_v2_keys = pref.isKey(SPEED_CURVE_COUNT_KEY) || pref.isKey(THROTTLE_CURVE_COUNT_KEY) ||
+                       pref.isKey(RPM_CURVE_COUNT_KEY) || pref.isKey(INPUT_MAP_SPEED_KEY) ||
+                       pref.isKey(INPUT_MAP_THROTTLE_KEY) || pref.isKey(INPUT_MAP_RPM_KEY);
+    mode_schema = has_v2_keys ? MODE_SCHEMA_VERSION : MODE_SCHEMA_LEGACY;
+  }
+  lastMode = pref.getUChar("lastMode", lastMode);
+  lastMode = normalize_stored_mode(lastMode, mode_schema);
+  disableThrottle = pref.getUChar("disableThrottle", disableThrottle);
+  disableSpeed = pref.getUShort("disableSpeed", disableSpeed);
+  disengageUnderSpeedMap = pref.getUShort(DISENGAGE_MAP_SPEED_KEY, disengageUnderSpeedMap);
+  disengageUnderSpeedSpeedMode = pref.getUShort(DISENGAGE_SPEED_MODE_SPEED_KEY, disengageUnderSpeedSpeedMode);
+  disengageUnderSpeedThrottleMode = pref.getUShort(DISENGAGE_THROTTLE_MODE_SPEED_KEY, disengageUnderSpeedThrottleMode);
+  disengageUnderSpeedRpmMode = pref.getUShort(DISENGAGE_RPM_MODE_SPEED_KEY, disengageUnderSpeedRpmMode);
+  lockReleaseRatePctPerSec = pref.getFloat(LOCK_RELEASE_RATE_KEY, lockReleaseRatePctPerSec);
+  logToFileEnabled = pref.getBool(LOG_FILE_ENABLE_KEY, logToFileEnabled);
+  logCanToFileEnabled = pref.getBool(LOG_CAN_ENABLE_KEY, logCanToFileEnabled);
+  logErrorToFileEnabled = pref.getBool(LOG_ERROR_ENABLE_KEY, logErrorToFileEnabled);
+  logSerialEnabled = pref.getBool(LOG_SERIAL_ENABLE_KEY, logSerialEnabled);
+  logDebugFirmwareEnabled = pref.getBool(LOG_DEBUG_FIRMWARE_ENABLE_KEY, logDebugFirmwareEnabled);
+  logDebugNetworkEnabled = pref.getBool(LOG_DEBUG_NETWORK_ENABLE_KEY, logDebugNetworkEnabled);
+  logDebugCanEnabled = pref.getBool(LOG_DEBUG_CAN_ENABLE_KEY, logDebugCanEnabled);
+  lowPowerSleepEnabled = pref.isKey(LOW_POWER_SLEEP_ENABLED_KEY)
+                           ? pref.getBool(LOW_POWER_SLEEP_ENABLED_KEY, lowPowerSleepEnabled)
+                           : (haldexGeneration == 5);
+  lowPowerSleepDelayMs = pref.getUInt(LOW_POWER_SLEEP_DELAY_KEY, lowPowerSleepDelayMs);
+  lowPowerWakeTimerSeconds = pref.getUInt(LOW_POWER_WAKE_TIMER_KEY, lowPowerWakeTimerSeconds);
+  lowPowerProbeDurationMs = pref.getUInt(LOW_POWER_PROBE_DURATION_KEY, lowPowerProbeDurationMs);
+
+  speed_curve_count = pref.getUChar(SPEED_CURVE_COUNT_KEY, speed_curve_count);
+  throttle_curve_count = pref.getUChar(THROTTLE_CURVE_COUNT_KEY, throttle_curve_count);
+  rpm_curve_count = pref.getUChar(RPM_CURVE_COUNT_KEY, rpm_curve_count);
+  pref.getBytes("spCurveBins", &speed_curve_bins, sizeof(speed_curve_bins));
+  pref.getBytes("spCurveLock", &speed_curve_lock, sizeof(speed_curve_lock));
+  pref.getBytes("thCurveBins", &throttle_curve_bins, sizeof(throttle_curve_bins));
+  pref.getBytes("thCurveLock", &throttle_curve_lock, sizeof(throttle_curve_lock));
+  pref.getBytes("rpmCurveBins", &rpm_curve_bins, sizeof(rpm_curve_bins));
+  pref.getBytes("rpmCurveLock", &rpm_curve_lock, sizeof(rpm_curve_lock));
+  String mapped_speed = pref.getString(INPUT_MAP_SPEED_KEY, "");
+  String mapped_throttle = pref.getString(INPUT_MAP_THROTTLE_KEY, "");
+  String mapped_rpm = pref.getString(INPUT_MAP_RPM_KEY, "");
+  (void)mappedInputSignalsSet(mapped_speed, mapped_throttle, mapped_rpm, 0);
+  mode_trigger_config_t mode_trigger_config = {};
+  mode_trigger_config.enabled = pref.getBool(MODE_TRIGGER_ENABLED_KEY, false);
+  mode_trigger_config.signal = pref.getString(MODE_TRIGGER_SIGNAL_KEY, "");
+  mode_trigger_config.op = (mode_trigger_operator_t)pref.getUChar(MODE_TRIGGER_OPERATOR_KEY, MODE_TRIGGER_GTE);
+  mode_trigger_config.value = pref.getFloat(MODE_TRIGGER_VALUE_KEY, 1.0f);
+  mode_trigger_config.mode = (openhaldex_mode_t)pref.getUChar(MODE_TRIGGER_MODE_KEY, MODE_MAP);
+  mode_trigger_config.broadcastOpenHaldexOverCAN = pref.getBool(MODE_TRIGGER_BROADCAST_KEY, broadcastOpenHaldexOverCAN);
+  (void)modeTriggerConfigSet(mode_trigger_config, 0);
+  String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
+  for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
+    dashboard_slots[i] = pref.getString(DASHBOARD_SIGNAL_KEYS[i], "");
+  }
+  (void)dashboardSignalsSet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 0);
+  haldexLearnTableValid = pref.getBool(LEARN_TABLE_VALID_KEY, false);
+  if (haldexLearnTableValid && pref.getBytesLength(LEARN_TABLE_KEY) == sizeof(haldexLearnTable)) {
+    pref.getBytes(LEARN_TABLE_KEY, haldexLearnTable, sizeof(haldexLearnTable));
+  } else {
+    haldexLearnTableValid = false;
+  }
+
+  String currentPath = storageGetCurrentMapPath();
+  if (!storageLoadMapPath(currentPath)) {
+    reset_map_defaults();
+    save_map_to_fs();
+    storageSetCurrentMapPath(MAP_FILE);
+  }
+}
+
+// Range checks shared by the blob and legacy paths.
+static void storage_sanitize_loaded() {
+  state.pedal_threshold = disableThrottle;
+  if (disengageUnderSpeedMap > 300) {
+    disengageUnderSpeedMap = 300;
+  }
+  if (disengageUnderSpeedSpeedMode > 300) {
+    disengageUnderSpeedSpeedMode = 300;
+  }
+  if (disengageUnderSpeedThrottleMode > 300) {
+    disengageUnderSpeedThrottleMode = 300;
+  }
+  if (disengageUnderSpeedRpmMode > 300) {
+    disengageUnderSpeedRpmMode = 300;
+  }
+  if (!(lockReleaseRatePctPerSec >= 0.0f)) {
+    lockReleaseRatePctPerSec = 0.0f;
+  } else if (lockReleaseRatePctPerSec > 1000.0f) {
+    lockReleaseRatePctPerSec = 1000.0f;
+  }
+  lowPowerSleepDelayMs = clamp_u32(lowPowerSleepDelayMs, 5000, 600000);
+  lowPowerWakeTimerSeconds = clamp_u32(lowPowerWakeTimerSeconds, 30, 86400);
+  lowPowerProbeDurationMs = clamp_u32(lowPowerProbeDurationMs, 100, 5000);
+
+  const bool debug_profile_enabled = logDebugFirmwareEnabled || logDebugNetworkEnabled || logDebugCanEnabled;
+  if ((debug_profile_enabled || logCanToFileEnabled) && !logToFileEnabled) {
+    logToFileEnabled = true;
+    LOG_WARN("storage", "forcing logToFileEnabled=1 while debug/can capture is active");
+  }
+  if (debug_profile_enabled && !logErrorToFileEnabled) {
+    logErrorToFileEnabled = true;
+    LOG_WARN("storage", "forcing logErrorToFileEnabled=1 while debug capture is active");
+  }
+
+  if (speed_curve_count == 0 || speed_curve_count > CURVE_POINTS_MAX) {
+    speed_curve_count = 5;
+  }
+  if (throttle_curve_count == 0 || throttle_curve_count > CURVE_POINTS_MAX) {
+    throttle_curve_count = 5;
+  }
+  if (rpm_curve_count == 0 || rpm_curve_count > CURVE_POINTS_MAX) {
+    rpm_curve_count = 6;
+  }
+
+  haldexLearnActive = false;
+  haldexLearnCancel = false;
+  haldexLearnStep = 0;
+  haldexLearnCF = 0;
+  if (haldexLearnTableValid && !learn_table_is_usable()) {
+    haldexLearnTableValid = false;
+    LOG_WARN("storage", "discarded invalid Haldex learn table");
+  }
+  if (!haldexLearnTableValid) {
+    memset(haldexLearnTable, 0, sizeof(haldexLearnTable));
+  }
+}
+
 void storageInit() {
   // Initialize NVS (Preferences) and LittleFS filesystem
   // LittleFS is used for map storage and UI files
@@ -382,214 +1274,68 @@ void storageInit() {
 
   if (fs_ready) {
     LOG_INFO("storage", "LittleFS mounted successfully");
+    storage_migrate_json_maps();
   } else {
     LOG_ERROR("storage", "LittleFS mount failed completely");
   }
 }
 
 void storageLoad() {
+  const uint32_t started_us = micros();
   storage_dirty = false;
   LOG_INFO("storage", "Loading persisted settings");
 #if detailedDebugEEP
   DEBUG("EEPROM initialising!");
 #endif
 
-  if (pref.getUChar("haldexGen", 255) == 255) {
-    LOG_WARN("storage", "No persisted settings found; applying defaults");
-    String mapped_speed;
-    String mapped_throttle;
-    String mapped_rpm;
-    mode_trigger_config_t mode_trigger_config = {};
-    (void)mappedInputSignalsGet(mapped_speed, mapped_throttle, mapped_rpm, 0);
-    (void)modeTriggerConfigGet(mode_trigger_config, 0);
-
-    pref.putBool("broadcastOpen", broadcastOpenHaldexOverCAN);
-    pref.putBool("isStandalone", isStandalone);
-    pref.putBool("disableControl", disableController);
-
-    pref.putUChar("haldexGen", haldexGeneration);
-    pref.putUChar("lastMode", (uint8_t)state.mode);
-    pref.putUChar(MODE_SCHEMA_KEY, MODE_SCHEMA_VERSION);
-    pref.putUChar("disableThrottle", disableThrottle);
-    pref.putUShort("disableSpeed", disableSpeed);
-    pref.putUShort(DISENGAGE_MAP_SPEED_KEY, disengageUnderSpeedMap);
-    pref.putUShort(DISENGAGE_SPEED_MODE_SPEED_KEY, disengageUnderSpeedSpeedMode);
-    pref.putUShort(DISENGAGE_THROTTLE_MODE_SPEED_KEY, disengageUnderSpeedThrottleMode);
-    pref.putUShort(DISENGAGE_RPM_MODE_SPEED_KEY, disengageUnderSpeedRpmMode);
-    pref.putFloat(LOCK_RELEASE_RATE_KEY, lockReleaseRatePctPerSec);
-    pref.putBool(LOG_FILE_ENABLE_KEY, logToFileEnabled);
-    pref.putBool(LOG_CAN_ENABLE_KEY, logCanToFileEnabled);
-    pref.putBool(LOG_ERROR_ENABLE_KEY, logErrorToFileEnabled);
-    pref.putBool(LOG_SERIAL_ENABLE_KEY, logSerialEnabled);
-    pref.putBool(LOG_DEBUG_FIRMWARE_ENABLE_KEY, logDebugFirmwareEnabled);
-    pref.putBool(LOG_DEBUG_NETWORK_ENABLE_KEY, logDebugNetworkEnabled);
-    pref.putBool(LOG_DEBUG_CAN_ENABLE_KEY, logDebugCanEnabled);
-    pref.putBool(LOW_POWER_SLEEP_ENABLED_KEY, lowPowerSleepEnabled);
-    pref.putUInt(LOW_POWER_SLEEP_DELAY_KEY, lowPowerSleepDelayMs);
-    pref.putUInt(LOW_POWER_WAKE_TIMER_KEY, lowPowerWakeTimerSeconds);
-    pref.putUInt(LOW_POWER_PROBE_DURATION_KEY, lowPowerProbeDurationMs);
-
-    pref.putUChar(SPEED_CURVE_COUNT_KEY, speed_curve_count);
-    pref.putBytes("spCurveBins", (byte*)(&speed_curve_bins), sizeof(speed_curve_bins));
-    pref.putBytes("spCurveLock", (byte*)(&speed_curve_lock), sizeof(speed_curve_lock));
-    pref.putUChar(THROTTLE_CURVE_COUNT_KEY, throttle_curve_count);
-    pref.putBytes("thCurveBins", (byte*)(&throttle_curve_bins), sizeof(throttle_curve_bins));
-    pref.putBytes("thCurveLock", (byte*)(&throttle_curve_lock), sizeof(throttle_curve_lock));
-    pref.putUChar(RPM_CURVE_COUNT_KEY, rpm_curve_count);
-    pref.putBytes("rpmCurveBins", (byte*)(&rpm_curve_bins), sizeof(rpm_curve_bins));
-    pref.putBytes("rpmCurveLock", (byte*)(&rpm_curve_lock), sizeof(rpm_curve_lock));
-    pref.putString(INPUT_MAP_SPEED_KEY, mapped_speed);
-    pref.putString(INPUT_MAP_THROTTLE_KEY, mapped_throttle);
-    pref.putString(INPUT_MAP_RPM_KEY, mapped_rpm);
-    pref.putBool(MODE_TRIGGER_ENABLED_KEY, mode_trigger_config.enabled);
-    pref.putString(MODE_TRIGGER_SIGNAL_KEY, mode_trigger_config.signal);
-    pref.putUChar(MODE_TRIGGER_OPERATOR_KEY, (uint8_t)mode_trigger_config.op);
-    pref.putFloat(MODE_TRIGGER_VALUE_KEY, mode_trigger_config.value);
-    pref.putUChar(MODE_TRIGGER_MODE_KEY, (uint8_t)mode_trigger_config.mode);
-    pref.putBool(MODE_TRIGGER_BROADCAST_KEY, mode_trigger_config.broadcastOpenHaldexOverCAN);
-    String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
-    if (dashboardSignalsGet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 0)) {
-      for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
-        pref.putString(DASHBOARD_SIGNAL_KEYS[i], dashboard_slots[i]);
+  uint8_t loaded = 0;
+  bool any_shadow = false;
+  for (uint8_t section = 0; section < CONFIG_SECTION_COUNT; section++) {
+    // storageReadBootConfig may already have read the settings section before CAN came up.
+    if (!config_section_valid[section]) {
+      bool used_shadow = false;
+      if (!storage_read_section(pref, section, config_last, used_shadow)) {
+        continue;
+      }
+      config_section_valid[section] = true;
+      if (used_shadow) {
+        // The restored image is what the next save diffs against; only the primary needs rewriting.
+        LOG_WARN("storage", "primary %s section invalid; restored from shadow copy", k_config_sections[section].name);
+        config_section_rewrite |= 1U << section;
+        any_shadow = true;
       }
     }
-    pref.putBool(LEARN_TABLE_VALID_KEY, false);
+    loaded |= 1U << section;
+  }
 
-    reset_map_defaults();
-    save_map_to_fs();
-  } else {
-    broadcastOpenHaldexOverCAN = pref.getBool("broadcastOpen", broadcastOpenHaldexOverCAN);
-    isStandalone = pref.getBool("isStandalone", isStandalone);
-    disableController = pref.getBool("disableControl", disableController);
-
-    haldexGeneration = pref.getUChar("haldexGen", haldexGeneration);
-    uint8_t mode_schema = pref.getUChar(MODE_SCHEMA_KEY, MODE_SCHEMA_UNKNOWN);
-    if (mode_schema == MODE_SCHEMA_UNKNOWN) {
-      bool has_v2_keys = pref.isKey(SPEED_CURVE_COUNT_KEY) || pref.isKey(THROTTLE_CURVE_COUNT_KEY) ||
-                         pref.isKey(RPM_CURVE_COUNT_KEY) || pref.isKey(INPUT_MAP_SPEED_KEY) ||
-                         pref.isKey(INPUT_MAP_THROTTLE_KEY) || pref.isKey(INPUT_MAP_RPM_KEY);
-      mode_schema = has_v2_keys ? MODE_SCHEMA_VERSION : MODE_SCHEMA_LEGACY;
-    }
-    lastMode = pref.getUChar("lastMode", lastMode);
-    lastMode = normalize_stored_mode(lastMode, mode_schema);
-    if (mode_schema < MODE_SCHEMA_VERSION) {
-      pref.putUChar(MODE_SCHEMA_KEY, MODE_SCHEMA_VERSION);
-    }
-    disableThrottle = pref.getUChar("disableThrottle", disableThrottle);
-    state.pedal_threshold = disableThrottle;
-    disableSpeed = pref.getUShort("disableSpeed", disableSpeed);
-    disengageUnderSpeedMap = pref.getUShort(DISENGAGE_MAP_SPEED_KEY, disengageUnderSpeedMap);
-    disengageUnderSpeedSpeedMode = pref.getUShort(DISENGAGE_SPEED_MODE_SPEED_KEY, disengageUnderSpeedSpeedMode);
-    disengageUnderSpeedThrottleMode =
-      pref.getUShort(DISENGAGE_THROTTLE_MODE_SPEED_KEY, disengageUnderSpeedThrottleMode);
-    disengageUnderSpeedRpmMode = pref.getUShort(DISENGAGE_RPM_MODE_SPEED_KEY, disengageUnderSpeedRpmMode);
-    lockReleaseRatePctPerSec = pref.getFloat(LOCK_RELEASE_RATE_KEY, lockReleaseRatePctPerSec);
-    if (disengageUnderSpeedMap > 300) {
-      disengageUnderSpeedMap = 300;
-    }
-    if (disengageUnderSpeedSpeedMode > 300) {
-      disengageUnderSpeedSpeedMode = 300;
-    }
-    if (disengageUnderSpeedThrottleMode > 300) {
-      disengageUnderSpeedThrottleMode = 300;
-    }
-    if (disengageUnderSpeedRpmMode > 300) {
-      disengageUnderSpeedRpmMode = 300;
-    }
-    if (lockReleaseRatePctPerSec < 0.0f) {
-      lockReleaseRatePctPerSec = 0.0f;
-    } else if (lockReleaseRatePctPerSec > 1000.0f) {
-      lockReleaseRatePctPerSec = 1000.0f;
-    }
-    logToFileEnabled = pref.getBool(LOG_FILE_ENABLE_KEY, logToFileEnabled);
-    logCanToFileEnabled = pref.getBool(LOG_CAN_ENABLE_KEY, logCanToFileEnabled);
-    logErrorToFileEnabled = pref.getBool(LOG_ERROR_ENABLE_KEY, logErrorToFileEnabled);
-    logSerialEnabled = pref.getBool(LOG_SERIAL_ENABLE_KEY, logSerialEnabled);
-    logDebugFirmwareEnabled = pref.getBool(LOG_DEBUG_FIRMWARE_ENABLE_KEY, logDebugFirmwareEnabled);
-    logDebugNetworkEnabled = pref.getBool(LOG_DEBUG_NETWORK_ENABLE_KEY, logDebugNetworkEnabled);
-    logDebugCanEnabled = pref.getBool(LOG_DEBUG_CAN_ENABLE_KEY, logDebugCanEnabled);
-    lowPowerSleepEnabled = pref.isKey(LOW_POWER_SLEEP_ENABLED_KEY)
-                             ? pref.getBool(LOW_POWER_SLEEP_ENABLED_KEY, lowPowerSleepEnabled)
-                             : (haldexGeneration == 5);
-    lowPowerSleepDelayMs = clamp_u32(pref.getUInt(LOW_POWER_SLEEP_DELAY_KEY, lowPowerSleepDelayMs), 5000, 600000);
-    lowPowerWakeTimerSeconds =
-      clamp_u32(pref.getUInt(LOW_POWER_WAKE_TIMER_KEY, lowPowerWakeTimerSeconds), 30, 86400);
-    lowPowerProbeDurationMs =
-      clamp_u32(pref.getUInt(LOW_POWER_PROBE_DURATION_KEY, lowPowerProbeDurationMs), 100, 5000);
-    const bool debug_profile_enabled = logDebugFirmwareEnabled || logDebugNetworkEnabled || logDebugCanEnabled;
-    if ((debug_profile_enabled || logCanToFileEnabled) && !logToFileEnabled) {
-      logToFileEnabled = true;
-      pref.putBool(LOG_FILE_ENABLE_KEY, true);
-      LOG_WARN("storage", "forcing logToFileEnabled=1 while debug/can capture is active");
-    }
-    if (debug_profile_enabled && !logErrorToFileEnabled) {
-      logErrorToFileEnabled = true;
-      pref.putBool(LOG_ERROR_ENABLE_KEY, true);
-      LOG_WARN("storage", "forcing logErrorToFileEnabled=1 while debug capture is active");
-    }
-
-    speed_curve_count = pref.getUChar(SPEED_CURVE_COUNT_KEY, speed_curve_count);
-    throttle_curve_count = pref.getUChar(THROTTLE_CURVE_COUNT_KEY, throttle_curve_count);
-    rpm_curve_count = pref.getUChar(RPM_CURVE_COUNT_KEY, rpm_curve_count);
-    if (speed_curve_count == 0 || speed_curve_count > CURVE_POINTS_MAX) {
-      speed_curve_count = 5;
-    }
-    if (throttle_curve_count == 0 || throttle_curve_count > CURVE_POINTS_MAX) {
-      throttle_curve_count = 5;
-    }
-    if (rpm_curve_count == 0 || rpm_curve_count > CURVE_POINTS_MAX) {
-      rpm_curve_count = 6;
-    }
-    pref.getBytes("spCurveBins", &speed_curve_bins, sizeof(speed_curve_bins));
-    pref.getBytes("spCurveLock", &speed_curve_lock, sizeof(speed_curve_lock));
-    pref.getBytes("thCurveBins", &throttle_curve_bins, sizeof(throttle_curve_bins));
-    pref.getBytes("thCurveLock", &throttle_curve_lock, sizeof(throttle_curve_lock));
-    pref.getBytes("rpmCurveBins", &rpm_curve_bins, sizeof(rpm_curve_bins));
-    pref.getBytes("rpmCurveLock", &rpm_curve_lock, sizeof(rpm_curve_lock));
-    String mapped_speed = pref.getString(INPUT_MAP_SPEED_KEY, "");
-    String mapped_throttle = pref.getString(INPUT_MAP_THROTTLE_KEY, "");
-    String mapped_rpm = pref.getString(INPUT_MAP_RPM_KEY, "");
-    (void)mappedInputSignalsSet(mapped_speed, mapped_throttle, mapped_rpm, 0);
-    mode_trigger_config_t mode_trigger_config = {};
-    mode_trigger_config.enabled = pref.getBool(MODE_TRIGGER_ENABLED_KEY, false);
-    mode_trigger_config.signal = pref.getString(MODE_TRIGGER_SIGNAL_KEY, "");
-    mode_trigger_config.op = (mode_trigger_operator_t)pref.getUChar(MODE_TRIGGER_OPERATOR_KEY, MODE_TRIGGER_GTE);
-    mode_trigger_config.value = pref.getFloat(MODE_TRIGGER_VALUE_KEY, 1.0f);
-    mode_trigger_config.mode = (openhaldex_mode_t)pref.getUChar(MODE_TRIGGER_MODE_KEY, MODE_MAP);
-    mode_trigger_config.broadcastOpenHaldexOverCAN =
-      pref.getBool(MODE_TRIGGER_BROADCAST_KEY, broadcastOpenHaldexOverCAN);
-    (void)modeTriggerConfigSet(mode_trigger_config, 0);
+  if (loaded != 0) {
+    storage_apply_config(config_last, loaded);
+    if (!(loaded & (1U << CONFIG_SECTION_MAP)) && !storageLoadMapPath(storageGetCurrentMapPath())) {
+      reset_map_defaults();
+    }
     modeTriggerRuntimeReset();
-    String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
-    for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
-      dashboard_slots[i] = pref.getString(DASHBOARD_SIGNAL_KEYS[i], "");
+    config_source = any_shadow ? "shadow" : "blob";
+    if (loaded != CONFIG_SECTIONS_ALL) {
+      LOG_WARN("storage", "config sections missing mask=0x%02X; rewriting them",
+               (unsigned)(CONFIG_SECTIONS_ALL & ~loaded));
     }
-    (void)dashboardSignalsSet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 0);
-    haldexLearnActive = false;
-    haldexLearnCancel = false;
-    haldexLearnStep = 0;
-    haldexLearnCF = 0;
-    haldexLearnTableValid = pref.getBool(LEARN_TABLE_VALID_KEY, false);
-    if (haldexLearnTableValid && pref.getBytesLength(LEARN_TABLE_KEY) == sizeof(haldexLearnTable)) {
-      pref.getBytes(LEARN_TABLE_KEY, haldexLearnTable, sizeof(haldexLearnTable));
-      if (!learn_table_is_usable()) {
-        haldexLearnTableValid = false;
-        memset(haldexLearnTable, 0, sizeof(haldexLearnTable));
-        pref.putBool(LEARN_TABLE_VALID_KEY, false);
-        pref.remove(LEARN_TABLE_KEY);
-        LOG_WARN("storage", "discarded invalid Haldex learn table");
-      }
-    } else {
-      haldexLearnTableValid = false;
-      memset(haldexLearnTable, 0, sizeof(haldexLearnTable));
+    if (loaded != CONFIG_SECTIONS_ALL || config_section_rewrite != 0) {
+      storageMarkDirty();
     }
+  } else if (pref.getUChar("haldexGen", 255) != 255) {
+    storage_load_legacy_keys();
+    modeTriggerRuntimeReset();
+    config_source = "migrated";
+  } else {
+    LOG_WARN("storage", "No persisted settings found; applying defaults");
+    reset_map_defaults();
+    config_source = "defaults";
+  }
 
-    String currentPath = storageGetCurrentMapPath();
-    if (!storageLoadMapPath(currentPath)) {
-      reset_map_defaults();
-      save_map_to_fs();
-      storageSetCurrentMapPath(MAP_FILE);
-    }
+  storage_sanitize_loaded();
+  storage_load_trigger_rules();
+
+  if (strcmp(config_source, "defaults") != 0) {
     if (disableController) {
       state.mode = MODE_STOCK;
     } else {
@@ -604,10 +1350,24 @@ void storageLoad() {
       state.mode = MODE_STOCK;
       LOG_WARN("storage", "Verbose debug profile active at boot; forcing STOCK controller-off");
     }
-    LOG_INFO("storage", "Settings loaded mode=%s gen=%d disableControl=%d", get_openhaldex_mode_string(state.mode),
-             haldexGeneration, disableController ? 1 : 0);
   }
 
+  if (strcmp(config_source, "migrated") == 0 || strcmp(config_source, "defaults") == 0) {
+    // Legacy keys are left in place so older firmware can still boot from them.
+    (void)storage_persist_changed();
+  } else {
+    // The section path never touches LittleFS at boot; treat current.ohmap as in sync with the map section.
+    storage_capture_map_fs_image();
+  }
+
+  lockTablesPublish();
+
+  config_load_us = micros() - started_us;
+  config_loaded_ms = millis();
+  LOG_INFO("storage", "Settings loaded source=%s loadUs=%lu mode=%s gen=%d disableControl=%d", config_source,
+           (unsigned long)config_load_us, get_openhaldex_mode_string(state.mode), haldexGeneration,
+           disableController ? 1 : 0);
+
 #if detailedDebugEEP
   DEBUG("EEPROM initialised with...");
   DEBUG("    Broadcast OpenHaldex over CAN: %s", broadcastOpenHaldexOverCAN ? "true" : "false");
@@ -619,80 +1379,54 @@ void storageLoad() {
 #endif
 }
 
+bool storageReadBootConfig(storage_boot_config_t& out) {
+  Preferences boot_pref;
+  if (!boot_pref.begin("openhaldex", true)) {
+    return false;
+  }
+  // Only the settings section; the rest waits for storageLoad.
+  bool used_shadow = false;
+  const bool ok = storage_read_section(boot_pref, CONFIG_SECTION_SETTINGS, config_last, used_shadow);
+  boot_pref.end();
+  if (!ok) {
+    return false;
+  }
+
+  // Cache it so storageLoad does not read NVS a second time; a shadow copy is re-read there and reported.
+  if (!used_shadow) {
+    config_section_valid[CONFIG_SECTION_SETTINGS] = true;
+  }
+  const storage_settings_section_t& settings = config_last.settings;
+  out.generation = settings.haldexGen;
+  out.lowPowerSleepEnabled = settings.lowPowerSleep;
+  out.lowPowerSleepDelayMs = settings.lowPowerDelayMs;
+  out.lowPowerWakeTimerSeconds = settings.lowPowerWakeSec;
+  out.lowPowerProbeDurationMs = settings.lowPowerProbeMs;
+  return true;
+}
+
 void storageSave() {
   storage_dirty = false;
-  LOG_INFO("storage", "Persisting settings to NVS/FS");
+  const uint32_t started_ms = millis();
 
 #if detailedDebugEEP
   DEBUG("Writing EEPROM...");
 #endif
 
-  pref.putBool("broadcastOpen", broadcastOpenHaldexOverCAN);
-  pref.putBool("isStandalone", isStandalone);
-  pref.putBool("disableControl", disableController);
+  const uint16_t writes = storage_persist_changed();
 
-  lastMode = (uint8_t)state.mode;
-  pref.putUChar("haldexGen", haldexGeneration);
-  pref.putUChar("lastMode", lastMode);
-  pref.putUChar(MODE_SCHEMA_KEY, MODE_SCHEMA_VERSION);
-  pref.putUChar("disableThrottle", disableThrottle);
-  pref.putUShort("disableSpeed", disableSpeed);
-  pref.putUShort(DISENGAGE_MAP_SPEED_KEY, disengageUnderSpeedMap);
-  pref.putUShort(DISENGAGE_SPEED_MODE_SPEED_KEY, disengageUnderSpeedSpeedMode);
-  pref.putUShort(DISENGAGE_THROTTLE_MODE_SPEED_KEY, disengageUnderSpeedThrottleMode);
-  pref.putUShort(DISENGAGE_RPM_MODE_SPEED_KEY, disengageUnderSpeedRpmMode);
-  pref.putFloat(LOCK_RELEASE_RATE_KEY, lockReleaseRatePctPerSec);
-  pref.putBool(LOG_FILE_ENABLE_KEY, logToFileEnabled);
-  pref.putBool(LOG_CAN_ENABLE_KEY, logCanToFileEnabled);
-  pref.putBool(LOG_ERROR_ENABLE_KEY, logErrorToFileEnabled);
-  pref.putBool(LOG_SERIAL_ENABLE_KEY, logSerialEnabled);
-  pref.putBool(LOG_DEBUG_FIRMWARE_ENABLE_KEY, logDebugFirmwareEnabled);
-  pref.putBool(LOG_DEBUG_NETWORK_ENABLE_KEY, logDebugNetworkEnabled);
-  pref.putBool(LOG_DEBUG_CAN_ENABLE_KEY, logDebugCanEnabled);
-  pref.putBool(LOW_POWER_SLEEP_ENABLED_KEY, lowPowerSleepEnabled);
-  pref.putUInt(LOW_POWER_SLEEP_DELAY_KEY, lowPowerSleepDelayMs);
-  pref.putUInt(LOW_POWER_WAKE_TIMER_KEY, lowPowerWakeTimerSeconds);
-  pref.putUInt(LOW_POWER_PROBE_DURATION_KEY, lowPowerProbeDurationMs);
-
-  pref.putUChar(SPEED_CURVE_COUNT_KEY, speed_curve_count);
-  pref.putBytes("spCurveBins", (byte*)(&speed_curve_bins), sizeof(speed_curve_bins));
-  pref.putBytes("spCurveLock", (byte*)(&speed_curve_lock), sizeof(speed_curve_lock));
-  pref.putUChar(THROTTLE_CURVE_COUNT_KEY, throttle_curve_count);
-  pref.putBytes("thCurveBins", (byte*)(&throttle_curve_bins), sizeof(throttle_curve_bins));
-  pref.putBytes("thCurveLock", (byte*)(&throttle_curve_lock), sizeof(throttle_curve_lock));
-  pref.putUChar(RPM_CURVE_COUNT_KEY, rpm_curve_count);
-  pref.putBytes("rpmCurveBins", (byte*)(&rpm_curve_bins), sizeof(rpm_curve_bins));
-  pref.putBytes("rpmCurveLock", (byte*)(&rpm_curve_lock), sizeof(rpm_curve_lock));
-  String mapped_speed;
-  String mapped_throttle;
-  String mapped_rpm;
-  mode_trigger_config_t mode_trigger_config = {};
-  (void)mappedInputSignalsGet(mapped_speed, mapped_throttle, mapped_rpm, 2);
-  (void)modeTriggerConfigGet(mode_trigger_config, 2);
-  pref.putString(INPUT_MAP_SPEED_KEY, mapped_speed);
-  pref.putString(INPUT_MAP_THROTTLE_KEY, mapped_throttle);
-  pref.putString(INPUT_MAP_RPM_KEY, mapped_rpm);
-  pref.putBool(MODE_TRIGGER_ENABLED_KEY, mode_trigger_config.enabled);
-  pref.putString(MODE_TRIGGER_SIGNAL_KEY, mode_trigger_config.signal);
-  pref.putUChar(MODE_TRIGGER_OPERATOR_KEY, (uint8_t)mode_trigger_config.op);
-  pref.putFloat(MODE_TRIGGER_VALUE_KEY, mode_trigger_config.value);
-  pref.putUChar(MODE_TRIGGER_MODE_KEY, (uint8_t)mode_trigger_config.mode);
-  pref.putBool(MODE_TRIGGER_BROADCAST_KEY, mode_trigger_config.broadcastOpenHaldexOverCAN);
-  String dashboard_slots[DASHBOARD_SIGNAL_SLOT_COUNT];
-  if (dashboardSignalsGet(dashboard_slots, DASHBOARD_SIGNAL_SLOT_COUNT, 2)) {
-    for (size_t i = 0; i < DASHBOARD_SIGNAL_SLOT_COUNT; i++) {
-      pref.putString(DASHBOARD_SIGNAL_KEYS[i], dashboard_slots[i]);
-    }
+  storage_save_count++;
+  if (writes == 0) {
+    storage_save_skipped++;
   }
-  pref.putBool(LEARN_TABLE_VALID_KEY, haldexLearnTableValid);
-  if (haldexLearnTableValid) {
-    pref.putBytes(LEARN_TABLE_KEY, haldexLearnTable, sizeof(haldexLearnTable));
-  } else {
-    pref.remove(LEARN_TABLE_KEY);
+  storage_last_save_writes = writes;
+  storage_last_save_ms = millis();
+  storage_last_save_duration_ms = storage_last_save_ms - started_ms;
+  if (writes > 0) {
+    LOG_INFO("storage", "Persisted settings writes=%u durationMs=%lu", (unsigned)writes,
+             (unsigned long)storage_last_save_duration_ms);
   }
 
-  save_map_to_fs();
-
 #if detailedDebugEEP
   DEBUG("Written EEPROM with data:");
   DEBUG("    Broadcast OpenHaldex over CAN: %s", broadcastOpenHaldexOverCAN ? "true" : "false");
@@ -709,9 +1443,36 @@ bool storageFsReady() {
 }
 
 void storageMarkDirty() {
+  storage_dirty_ms = millis();
   storage_dirty = true;
 }
 
+uint32_t storageDirtyAgeMs() {
+  return storage_dirty ? (millis() - storage_dirty_ms) : 0;
+}
+
+void storageWriteStatusJson(JsonObject out) {
+  out["dirty"] = (bool)storage_dirty;
+  out["saves"] = storage_save_count;
+  out["savesSkipped"] = storage_save_skipped;
+  out["writes"] = storage_write_count;
+  out["lastSaveWrites"] = storage_last_save_writes;
+  out["lastSaveDurationMs"] = storage_last_save_duration_ms;
+  out["lastSaveAgeMs"] = storage_last_save_ms > 0 ? (millis() - storage_last_save_ms) : 0;
+  out["configSource"] = config_source;
+  JsonObject sections = out["configSections"].to<JsonObject>();
+  for (uint8_t section = 0; section < CONFIG_SECTION_COUNT; section++) {
+    JsonObject entry = sections[k_config_sections[section].name].to<JsonObject>();
+    entry["bytes"] = k_config_sections[section].size;
+    entry["sequence"] = config_section_valid[section] ? storage_section_header(config_last, section).sequence : 0;
+    entry["saves"] = config_section_saves[section];
+  }
+  out["loadUs"] = config_load_us;
+  out["loadedAtMs"] = config_loaded_ms;
+  const uint32_t first_control_ms = bootFirstControlFrameMs;
+  out["bootToControlMs"] = first_control_ms;
+}
+
 bool storageIsDirty() {
   return storage_dirty;
 }
@@ -735,13 +1496,23 @@ bool storageLoadMapPath(const String& path) {
   }
 
   bool ok = false;
-  if (local.endsWith(".json")) {
-    ok = load_map_from_json_file(local.c_str());
-    if (ok) {
+  storage_map_image_t map;
+  if (local.endsWith(MAP_BIN_EXT)) {
+    // Native format: apply straight away; the map section and current.ohmap follow on the next EEP save.
+    ok = load_map_from_ohmap_file(local.c_str(), map);
+    if (!ok) {
+      LOG_ERROR("storage", "Map load failed: ohmap header/crc error path=%s", local.c_str());
+    } else if ((ok = storage_publish_map_image(map, local))) {
       storageSetCurrentMapPath(local);
-      save_map_to_fs();
-    } else {
+    }
+  } else if (local.endsWith(".json")) {
+    // JSON maps are imports; load into RAM and persist to current.ohmap.
+    ok = load_map_from_json_file(local.c_str(), map);
+    if (!ok) {
       LOG_ERROR("storage", "Map load failed: json parse/read error path=%s", local.c_str());
+    } else if ((ok = storage_publish_map_image(map, local))) {
+      storageSetCurrentMapPath(MAP_FILE);
+      save_map_to_fs();
     }
   } else if (local.endsWith(".txt")) {
     // TXT maps are read-only presets from /maps. Support legacy root paths transparently.
@@ -755,20 +1526,22 @@ bool storageLoadMapPath(const String& path) {
         LOG_ERROR("storage", "Map load failed: txt not found path=%s fallback=%s", local.c_str(), fallback.c_str());
       }
     }
-    // Load into RAM and persist to current.json
+    // Load into RAM and persist to current.ohmap
     // so boot and "save current" continue to work predictably.
-    ok = load_map_from_txt_file(txtPath.c_str());
-    if (ok) {
+    ok = load_map_from_txt_file(txtPath.c_str(), map);
+    if (!ok) {
+      LOG_ERROR("storage", "Map load failed: txt parse/read error path=%s", txtPath.c_str());
+    } else if ((ok = storage_publish_map_image(map, local))) {
       storageSetCurrentMapPath(MAP_FILE);
       save_map_to_fs();
-    } else {
-      LOG_ERROR("storage", "Map load failed: txt parse/read error path=%s", txtPath.c_str());
     }
   } else {
     LOG_ERROR("storage", "Map load failed: unsupported extension path=%s", local.c_str());
   }
 
   if (ok) {
+    // The active map is part of the map section; let the EEP task persist it.
+    storageMarkDirty();
     LOG_INFO("storage", "Map loaded path=%s", local.c_str());
   }
 
@@ -779,18 +1552,15 @@ bool storageSaveMapName(const String& name, String& outPath) {
     LOG_ERROR("storage", "Map save failed: filesystem not ready name=%s", name.c_str());
     return false;
   }
-  String safe = sanitize_map_name(name);
-  if (safe.length() == 0) {
+  String path = map_path_for_name(name);
+  if (path.length() == 0) {
     LOG_ERROR("storage", "Map save failed: invalid name=%s", name.c_str());
     return false;
   }
 
-  String path = String(MAP_DIR) + "/" + safe;
-  if (!path.endsWith(".json")) {
-    path += ".json";
-  }
-
-  if (!save_map_to_json_file(path.c_str())) {
+  storage_map_image_t map;
+  storage_capture_map_image(map);
+  if (!save_map_to_ohmap_file(path.c_str(), map)) {
     LOG_ERROR("storage", "Map save failed: write error path=%s", path.c_str());
     return false;
   }
@@ -812,7 +1582,7 @@ bool storageDeleteMapPath(const String& path) {
     LOG_ERROR("storage", "Map delete rejected: path outside /maps path=%s", path.c_str());
     return false;
   }
-  if (path == MAP_FILE) {
+  if (path == MAP_FILE || path == LEGACY_MAP_FILE) {
     LOG_ERROR("storage", "Map delete rejected: cannot delete current map file");
     return false;
   }
@@ -839,6 +1609,8 @@ String storageGetCurrentMapPath() {
 void storageSetCurrentMapPath(const String& path) {
   if (path.length() == 0)
     return;
+  if (pref.getString(CURRENT_MAP_KEY, "") == path)
+    return;
   pref.putString(CURRENT_MAP_KEY, path);
 }
 
@@ -858,11 +1630,19 @@ void storageListMaps(JsonArray out) {
         } else if (!path.startsWith(String(MAP_DIR) + "/")) {
           path = String(MAP_DIR) + path;
         }
-        if (path.endsWith(".json")) {
+        if (path.endsWith(MAP_BIN_EXT)) {
           String base = path.substring(path.lastIndexOf('/') + 1);
-          String name = base.substring(0, base.length() - 5);
+          String name = base.substring(0, base.length() - strlen(MAP_BIN_EXT));
           if (path != MAP_FILE) {
-            add_map_entry(out, name, path, "json", false);
+            add_map_entry(out, name, path, "ohmap", false);
+          }
+        } else if (path.endsWith(".json")) {
+          // Unconverted JSON (e.g. uploaded after migration): loadable as an import, never written back.
+          // One the migration copied sits next to its .ohmap and is not listed twice.
+          String base = path.substring(path.lastIndexOf('/') + 1);
+          String name = base.substring(0, base.length() - 5);
+          if (path != LEGACY_MAP_FILE && !LittleFS.exists(String(MAP_DIR) + "/" + name + MAP_BIN_EXT)) {
+            add_map_entry(out, name, path, "json", true);
           }
         } else if (path.endsWith(".txt")) {
           String base = path.substring(path.lastIndexOf('/') + 1);
@@ -897,6 +1677,59 @@ void storageListMaps(JsonArray out) {
   }
 }
 
+bool storageExportMap(const String& path, bool asTxt, String& out) {
+  storage_map_image_t map;
+  if (path.length() == 0) {
+    storage_capture_map_image(map);
+  } else if (!fs_ready || path.indexOf("..") >= 0 || !load_map_file(path, map)) {
+    LOG_ERROR("storage", "Map export failed path=%s", path.c_str());
+    return false;
+  }
+  if (asTxt) {
+    render_map_txt(map, out);
+  } else {
+    render_map_json(map, out);
+  }
+  return true;
+}
+
+static bool storage_import_map(const String& name, const storage_map_image_t& map, String& outPath) {
+  if (!fs_ready) {
+    LOG_ERROR("storage", "Map import failed: filesystem not ready name=%s", name.c_str());
+    return false;
+  }
+  String path = map_path_for_name(name);
+  if (path.length() == 0 || path == MAP_FILE) {
+    LOG_ERROR("storage", "Map import failed: invalid name=%s", name.c_str());
+    return false;
+  }
+  if (!save_map_to_ohmap_file(path.c_str(), map)) {
+    LOG_ERROR("storage", "Map import failed: write error path=%s", path.c_str());
+    return false;
+  }
+  outPath = path;
+  LOG_INFO("storage", "Map imported path=%s", path.c_str());
+  return true;
+}
+
+bool storageImportMapJson(const String& name, JsonVariantConst data, String& outPath) {
+  storage_map_image_t map;
+  if (!parse_map_json(data, map)) {
+    LOG_ERROR("storage", "Map import failed: invalid json map name=%s", name.c_str());
+    return false;
+  }
+  return storage_import_map(name, map, outPath);
+}
+
+bool storageImportMapTxt(const String& name, const String& text, String& outPath) {
+  storage_map_image_t map;
+  if (!parse_map_txt(text, map)) {
+    LOG_ERROR("storage", "Map import failed: invalid txt map name=%s", name.c_str());
+    return false;
+  }
+  return storage_import_map(name, map, outPath);
+}
+
 // WiFi credentials management
 bool storageGetWifiCreds(String& ssid, String& pass) {
   ssid = pref.getString(WIFI_SSID_KEY, "");
@@ -904,13 +1737,26 @@ bool storageGetWifiCreds(String& ssid, String& pass) {
   return ssid.length() > 0;
 }
 
+// The WiFi keys live outside the config sections, so they get their own unchanged-value check.
 void storageSetWifiCreds(const String& ssid, const String& pass) {
-  pref.putString(WIFI_SSID_KEY, ssid);
-  pref.putString(WIFI_PASS_KEY, pass);
+  const bool ssid_changed = !pref.isKey(WIFI_SSID_KEY) || pref.getString(WIFI_SSID_KEY, "") != ssid;
+  const bool pass_changed = !pref.isKey(WIFI_PASS_KEY) || pref.getString(WIFI_PASS_KEY, "") != pass;
+  if (!ssid_changed && !pass_changed) {
+    return;
+  }
+  if (ssid_changed) {
+    pref.putString(WIFI_SSID_KEY, ssid);
+  }
+  if (pass_changed) {
+    pref.putString(WIFI_PASS_KEY, pass);
+  }
   LOG_INFO("storage", "WiFi credentials updated ssid=%s", ssid.c_str());
 }
 
 void storageClearWifiCreds() {
+  if (!pref.isKey(WIFI_SSID_KEY) && !pref.isKey(WIFI_PASS_KEY)) {
+    return;
+  }
   pref.remove(WIFI_SSID_KEY);
   pref.remove(WIFI_PASS_KEY);
   LOG_WARN("storage", "WiFi credentials cleared");
@@ -922,6 +1768,9 @@ bool storageGetWifiStaEnabled() {
 }
 
 void storageSetWifiStaEnabled(bool enabled) {
+  if (pref.isKey(WIFI_STA_ENABLE_KEY) && pref.getBool(WIFI_STA_ENABLE_KEY, true) == enabled) {
+    return;
+  }
   pref.putBool(WIFI_STA_ENABLE_KEY, enabled);
   LOG_INFO("storage", "WiFi STA flag set enabled=%d", enabled ? 1 : 0);
 }
@@ -932,11 +1781,17 @@ bool storageGetWifiApPassword(String& pass) {
 }
 
 void storageSetWifiApPassword(const String& pass) {
+  if (pref.isKey(WIFI_AP_PASS_KEY) && pref.getString(WIFI_AP_PASS_KEY, "") == pass) {
+    return;
+  }
   pref.putString(WIFI_AP_PASS_KEY, pass);
   LOG_INFO("storage", "WiFi AP password updated set=%d", pass.length() > 0 ? 1 : 0);
 }
 
 void storageClearWifiApPassword() {
+  if (!pref.isKey(WIFI_AP_PASS_KEY)) {
+    return;
+  }
   pref.remove(WIFI_AP_PASS_KEY);
   LOG_WARN("storage", "WiFi AP password cleared");
 }
@@ -8,8 +8,10 @@
 #include "functions/config/pins.h"
 #include "functions/core/state.h"
 #include "functions/core/calcs.h"
+#include "functions/core/telemetry.h"
 #include "functions/can/can.h"
 #include "functions/can/can_id.h"
+#include "functions/can/can_loadgen.h"
 #include "functions/io/frames.h"
 #include "functions/can/standalone_can.h"
 #include "functions/storage/storage.h"
@@ -35,11 +37,29 @@ static void updateLabels(void* arg) {
   }
 }
 
+#if OH_CAN_LOADGEN
+// Bench self-test builds: summarises the synthetic load run on the serial log.
+static void loadgenReport(void* arg) {
+  while (1) {
+    vTaskDelay(5000 / portTICK_PERIOD_MS);
+    can_loadgen_stats_t stats;
+    canLoadgenGetStats(stats);
+    LOG_INFO("can",
+             "loadgen gen=%u load=%u%% bus=%.1f%% frames=%lu rx_dropped=%lu rx_high_water=%lu forwarded=%lu "
+             "latency_p99_us=%lu latency_max_us=%lu",
+             stats.generation, stats.loadPercent, stats.elapsedUs ? 100.0f * stats.busyUs / stats.elapsedUs : 0.0f,
+             (unsigned long)stats.generated, (unsigned long)stats.rxDropped, (unsigned long)stats.rxHighWater,
+             (unsigned long)stats.forwarded, (unsigned long)canLoadgenLatencyPercentileUs(stats, 99),
+             (unsigned long)stats.latencyMaxUs);
+  }
+}
+#endif
+
 static void writeEEP(void* arg) {
   vTaskDelay(OH_EEP_START_DELAY_MS / portTICK_PERIOD_MS);
   while (1) {
     stackwriteEEP = uxTaskGetStackHighWaterMark(NULL);
-    if (storageIsDirty()) {
+    if (storageIsDirty() && storageDirtyAgeMs() >= OH_EEP_SETTLE_MS) {
       storageSave();
     }
     vTaskDelay(OH_EEP_REFRESH_MS / portTICK_PERIOD_MS);
@@ -61,7 +81,9 @@ static void haldexLearnTask(void* arg) {
 
     vTaskDelay(settle_ms / portTICK_PERIOD_MS);
 
-    uint8_t engagement = constrain(received_haldex_engagement, 0, 100);
+    telemetry_snapshot_t telemetry = {};
+    telemetryRead(telemetry);
+    uint8_t engagement = constrain(telemetry.haldexEngagement, 0, 100);
     if (engagement == 0 && cf > 0) {
       engagement = last_valid;
     } else {
@@ -156,6 +178,9 @@ void tasksInit() {
     xTaskCreatePinnedToCore(broadcastOpenHaldex, "broadcastOpenHaldex", 4096, NULL, 6, NULL, OH_CAN_TASK_CORE);
     xTaskCreatePinnedToCore(parseCAN_hdx, "parseHaldex", 4096, NULL, 6, NULL, OH_CAN_TASK_CORE);
     xTaskCreatePinnedToCore(parseCAN_chs, "parseChassis", 4096, NULL, 7, NULL, OH_CAN_TASK_CORE);
+#if OH_CAN_LOADGEN
+    xTaskCreatePinnedToCore(loadgenReport, "loadgenReport", 4096, NULL, 1, NULL, OH_APP_TASK_CORE);
+#endif
     filelogLogInfo("tasks", "CAN tasks initialized");
   } else {
     filelogLogError("tasks", "CAN not ready; frame/parser tasks not started");
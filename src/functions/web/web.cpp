@@ -24,66 +24,41 @@ static void otaSendResult(AsyncWebServerRequest* request, bool ok) {
   }
 }
 
+// Pages are stored as <page>.html.gz by the asset build; the file response adds Content-Encoding itself.
+static void sendPage(AsyncWebServerRequest* request, const char* path) {
+  if (!fs_ok) {
+    request->send(500, "text/plain", "LittleFS not mounted");
+    return;
+  }
+  if (!LittleFS.exists(path) && !LittleFS.exists(String(path) + ".gz")) {
+    request->send(500, "text/plain", String("Missing ") + path + " in LittleFS");
+    return;
+  }
+  AsyncWebServerResponse* response = request->beginResponse(LittleFS, path, "text/html");
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+
 void webInit(AsyncWebServer& server) {
   fs_ok = storageFsReady();
   if (!fs_ok) {
     DEBUG("LittleFS not mounted");
   }
 
-  // Avoid stale UI assets after LittleFS updates.
+  // Content-hashed assets (scripts/web_assets.py): a new build changes the name, so they never go stale.
+  // Registered before the root handler, which would otherwise claim /assets/ too.
+  server.serveStatic("/assets/", LittleFS, "/assets/").setCacheControl("public, max-age=31536000, immutable");
+
+  // Pages and unhashed files always revalidate so a LittleFS update shows up on the next load.
   auto& staticHandler = server.serveStatic("/", LittleFS, "/");
   staticHandler.setDefaultFile("index.html");
-  staticHandler.setCacheControl("no-cache, no-store, must-revalidate");
-
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
-    if (!fs_ok) {
-      request->send(500, "text/plain", "LittleFS not mounted");
-    } else if (LittleFS.exists("/index.html")) {
-      request->send(LittleFS, "/index.html", "text/html");
-    } else {
-      request->send(500, "text/plain", "Missing /index.html in LittleFS");
-    }
-  });
-
-  server.on("/map", HTTP_GET, [](AsyncWebServerRequest* request) {
-    if (!fs_ok) {
-      request->send(500, "text/plain", "LittleFS not mounted");
-    } else if (LittleFS.exists("/map.html")) {
-      request->send(LittleFS, "/map.html", "text/html");
-    } else {
-      request->send(500, "text/plain", "Missing /map.html in LittleFS");
-    }
-  });
+  staticHandler.setCacheControl("no-cache");
 
-  server.on("/canview", HTTP_GET, [](AsyncWebServerRequest* request) {
-    if (!fs_ok) {
-      request->send(500, "text/plain", "LittleFS not mounted");
-    } else if (LittleFS.exists("/canview.html")) {
-      request->send(LittleFS, "/canview.html", "text/html");
-    } else {
-      request->send(500, "text/plain", "Missing /canview.html in LittleFS");
-    }
-  });
-
-  server.on("/diag", HTTP_GET, [](AsyncWebServerRequest* request) {
-    if (!fs_ok) {
-      request->send(500, "text/plain", "LittleFS not mounted");
-    } else if (LittleFS.exists("/diag.html")) {
-      request->send(LittleFS, "/diag.html", "text/html");
-    } else {
-      request->send(500, "text/plain", "Missing /diag.html in LittleFS");
-    }
-  });
-
-  server.on("/ota", HTTP_GET, [](AsyncWebServerRequest* request) {
-    if (!fs_ok) {
-      request->send(500, "text/plain", "LittleFS not mounted");
-    } else if (LittleFS.exists("/ota.html")) {
-      request->send(LittleFS, "/ota.html", "text/html");
-    } else {
-      request->send(500, "text/plain", "Missing /ota.html in LittleFS");
-    }
-  });
+  server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) { sendPage(request, "/index.html"); });
+  server.on("/map", HTTP_GET, [](AsyncWebServerRequest* request) { sendPage(request, "/map.html"); });
+  server.on("/canview", HTTP_GET, [](AsyncWebServerRequest* request) { sendPage(request, "/canview.html"); });
+  server.on("/diag", HTTP_GET, [](AsyncWebServerRequest* request) { sendPage(request, "/diag.html"); });
+  server.on("/ota", HTTP_GET, [](AsyncWebServerRequest* request) { sendPage(request, "/ota.html"); });
 
   server.on("/status", HTTP_GET, [](AsyncWebServerRequest* request) {
     String out;
@@ -16,7 +16,9 @@
 #include "functions/web/web.h"
 #include "functions/net/update.h"
 #include "functions/power/power.h"
+#include "functions/diag/diag_jobs.h"
 #include "functions/diag/uds.h"
+#include "functions/canview/dbc_table.h"
 
 static AsyncWebServer server(80);
 
@@ -262,6 +264,7 @@ void setup() {
   mappedInputSignalsInit();
   modeTriggerInit();
   dashboardSignalsInit();
+  lockTablesInit();
   powerInitBootState();
   powerLoadBootSettings();
   if (!powerBootProbeOrSleep()) {
@@ -274,7 +277,9 @@ void setup() {
   storageInit();
   filelogInit();
   storageLoad();
+  dbcTablesInit();
   diagUdsInit();
+  diagJobsInit();
   LOG_INFO("system", "Storage loaded and logger active");
 
   tasksInit();